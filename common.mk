@@ -80,6 +80,25 @@ CONFIG_VOICE_CORE_MODE=LIMITED
 
 CONFIG_AE_MODE=FUNCTIONAL
 
+#########################################################################################
+##################### AE Execution Mode #################################################
+
+# AE execution mode :
+# TASK          - PDM ISR only captures frames. AE feed and output run in a high priority AE worker task. (Default)
+# ISR           - AE feed and output run inside the PDM ISR.
+
+CONFIG_AE_EXEC_MODE=TASK
+
+#########################################################################################
+##################### AE Backend ########################################################
+
+# AE processing backend :
+# DEEPCRAFT     - DEEPCRAFT(TM) Audio Enhancement middleware. (Default)
+# PASSTHROUGH   - No processing, the first mic channel is copied to the output. Measures the application overhead.
+# REFERENCE     - Simple NLMS echo canceller and noise suppressor in portable C for benchmarking.
+
+CONFIG_AE_BACKEND=DEEPCRAFT
+
 #########################################################################################
 
 
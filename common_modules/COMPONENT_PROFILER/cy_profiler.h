@@ -43,11 +43,82 @@
 extern "C" {
 #endif /* __cplusplus */
 
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 to collect per probe latency histograms. The histograms are
+ * printed periodically on the debug UART, so keep this disabled while
+ * tuning with the AFE configurator.
+ */
+#ifndef CY_PROFILER_PROBE_ENABLE
+#define CY_PROFILER_PROBE_ENABLE                (0)
+#endif /* CY_PROFILER_PROBE_ENABLE */
+
+/* Number of calls of cy_profiler_probe_tick between two dumps */
+#ifndef CY_PROFILER_PROBE_DUMP_TICKS
+#define CY_PROFILER_PROBE_DUMP_TICKS            (500u)
+#endif /* CY_PROFILER_PROBE_DUMP_TICKS */
+
+/* Each power of 2 range of the histogram is split in 2^SUB_BITS buckets */
+#define CY_PROFILER_HIST_SUB_BITS               (2u)
+#define CY_PROFILER_HIST_BUCKETS                ((32u - 1u) << CY_PROFILER_HIST_SUB_BITS)
+
+#if CY_PROFILER_PROBE_ENABLE
+#define CY_PROFILER_PROBE_BEGIN(probe)          uint32_t probe##_start = cy_profiler_now()
+#define CY_PROFILER_PROBE_END(probe)            cy_profiler_probe_record((probe), probe##_start)
+#else
+#define CY_PROFILER_PROBE_BEGIN(probe)
+#define CY_PROFILER_PROBE_END(probe)
+#endif /* CY_PROFILER_PROBE_ENABLE */
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+typedef enum
+{
+    CY_PROFILER_PROBE_PDM_ISR = 0,
+    CY_PROFILER_PROBE_DEINTERLEAVE,
+    CY_PROFILER_PROBE_AEC_POP,
+    CY_PROFILER_PROBE_AFE_FEED,
+    CY_PROFILER_PROBE_OUTPUT_CB,
+    CY_PROFILER_PROBE_USB_PUSH,
+    CY_PROFILER_PROBE_I2S_ISR,
+    CY_PROFILER_PROBE_COUNT,
+} cy_profiler_probe_id_t;
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Summary of a probe. Durations are in profiler ticks: CPU cycles on the
+ * target, nanoseconds in the host build.
+ */
+typedef struct
+{
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint32_t avg;
+    uint32_t p99;
+} cy_profiler_probe_summary_t;
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
 void cy_profiler_init(void);
 void cy_profiler_start(void);
 void cy_profiler_stop(void);
 uint32_t cy_profiler_get_cycles(void);
 
+void cy_profiler_probe_init(void);
+uint32_t cy_profiler_now(void);
+void cy_profiler_probe_record(cy_profiler_probe_id_t probe, uint32_t start);
+void cy_profiler_probe_get_summary(cy_profiler_probe_id_t probe, cy_profiler_probe_summary_t *summary);
+void cy_profiler_probe_tick(void);
+void cy_profiler_probe_dump(void);
+void cy_profiler_probe_reset(void);
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
@@ -71,6 +71,7 @@ uint32_t timer_hz;
 /* CM4 system clock vs. Peripheral clock ratio */
 int CM4_clk_ratio;
 
+static uint32_t start_time_val;
 static uint32_t stop_time_val;
 
 #define RESET_CYCLE_CNT (DWT->CYCCNT=0)
@@ -221,7 +222,8 @@ void Cy_SysLib_ProcessingFault(void)
 * Function Name: start_time
 ********************************************************************************
 * Summary:
-* Starts timer for profiling.
+* Starts timer for profiling. The cycle counter is free running and shared
+* with the probes, so only the start value is saved.
 *
 * Parameters:
 *  None
@@ -234,7 +236,7 @@ void Cy_SysLib_ProcessingFault(void)
 static void start_time(void)
 {
 
-    Cy_Reset_Cycles();
+    start_time_val = Cy_Get_Cycles();
 }
 
 /*******************************************************************************
@@ -254,8 +256,8 @@ static void start_time(void)
 static void stop_time(void)
 {
 
-    stop_time_val = Cy_Get_Cycles();
-  
+    stop_time_val = Cy_Get_Cycles() - start_time_val;
+
 }
 
 /*******************************************************************************
@@ -0,0 +1,395 @@
+/******************************************************************************
+* File Name : profiler_probe.c
+*
+* Description :
+* Named latency probes for the MIPS profiler. Each probe keeps running
+* min/avg/max statistics and a log scale histogram for percentiles.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "cy_profiler.h"
+
+#ifdef CY_PROFILER_HOST
+#include <stdio.h>
+#include <time.h>
+#else
+#include "cy_pdl.h"
+#include "app_logger.h"
+#endif /* CY_PROFILER_HOST */
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#ifdef CY_PROFILER_HOST
+#define PROBE_TICK_UNIT                         "ns"
+#define PROBE_LOG(format, ...)                  printf(format, ##__VA_ARGS__)
+#define PROBE_ENTER_CRITICAL()                  (0u)
+#define PROBE_EXIT_CRITICAL(state)              ((void)(state))
+#define PROBE_CLZ(value)                        ((uint32_t)__builtin_clz(value))
+#else
+#define PROBE_TICK_UNIT                         "cycles"
+#define PROBE_LOG(format, ...)                  app_log_print(format, ##__VA_ARGS__)
+#define PROBE_ENTER_CRITICAL()                  Cy_SysLib_EnterCriticalSection()
+#define PROBE_EXIT_CRITICAL(state)              Cy_SysLib_ExitCriticalSection(state)
+#define PROBE_CLZ(value)                        ((uint32_t)__CLZ(value))
+#endif /* CY_PROFILER_HOST */
+
+#define PROBE_SUB_BUCKETS                       (1u << CY_PROFILER_HIST_SUB_BITS)
+
+/* Percentile reported by the dump, in percent */
+#define PROBE_PERCENTILE                        (99u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+    uint32_t hist[CY_PROFILER_HIST_BUCKETS];
+} probe_stats_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static probe_stats_t probe_stats[CY_PROFILER_PROBE_COUNT];
+static uint32_t probe_ticks = 0;
+
+static const char *probe_names[CY_PROFILER_PROBE_COUNT] =
+{
+    "PDM ISR",
+    "De-interleave",
+    "AEC pop",
+    "cy_afe_feed",
+    "Output callback",
+    "USB push",
+    "I2S ISR",
+};
+
+/*******************************************************************************
+* Function Name: probe_bucket
+********************************************************************************
+* Summary:
+* Returns the histogram bucket of a duration. Values below 2^SUB_BITS get a
+* bucket each; above that every power of 2 range is split in 2^SUB_BITS
+* buckets, which bounds the bucket width to 1/2^SUB_BITS of its value.
+*
+* Parameters:
+*  value - Duration in ticks
+*
+* Return:
+*  Bucket index.
+*
+*******************************************************************************/
+static uint32_t probe_bucket(uint32_t value)
+{
+    uint32_t msb = 0;
+    uint32_t sub = 0;
+
+    if (value < PROBE_SUB_BUCKETS)
+    {
+        return value;
+    }
+
+    msb = 31u - PROBE_CLZ(value);
+    sub = (value >> (msb - CY_PROFILER_HIST_SUB_BITS)) & (PROBE_SUB_BUCKETS - 1u);
+
+    return ((msb - CY_PROFILER_HIST_SUB_BITS + 1u) << CY_PROFILER_HIST_SUB_BITS) + sub;
+}
+
+/*******************************************************************************
+* Function Name: probe_bucket_upper
+********************************************************************************
+* Summary:
+* Returns the largest duration that falls in a histogram bucket.
+*
+* Parameters:
+*  bucket - Bucket index
+*
+* Return:
+*  Upper bound of the bucket in ticks.
+*
+*******************************************************************************/
+static uint32_t probe_bucket_upper(uint32_t bucket)
+{
+    uint32_t shift = 0;
+    uint32_t lower = 0;
+
+    if (bucket < PROBE_SUB_BUCKETS)
+    {
+        return bucket;
+    }
+
+    shift = (bucket >> CY_PROFILER_HIST_SUB_BITS) - 1u;
+    lower = (PROBE_SUB_BUCKETS + (bucket & (PROBE_SUB_BUCKETS - 1u))) << shift;
+
+    return lower + ((1u << shift) - 1u);
+}
+
+/*******************************************************************************
+* Function Name: cy_profiler_now
+********************************************************************************
+* Summary:
+* Returns the free-running profiler counter. The counter is never reset;
+* durations are computed with unsigned wrap-around arithmetic, so nested and
+* concurrent measurements do not disturb each other.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  Current tick count.
+*
+*******************************************************************************/
+uint32_t cy_profiler_now(void)
+{
+#ifdef CY_PROFILER_HOST
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)(((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec);
+#else
+    return DWT->CYCCNT;
+#endif /* CY_PROFILER_HOST */
+}
+
+/*******************************************************************************
+* Function Name: cy_profiler_probe_init
+********************************************************************************
+* Summary:
+* Starts the profiler counter and clears all probes.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void cy_profiler_probe_init(void)
+{
+#ifndef CY_PROFILER_HOST
+    cy_profiler_init();
+#endif /* CY_PROFILER_HOST */
+    cy_profiler_probe_reset();
+}
+
+/*******************************************************************************
+* Function Name: cy_profiler_probe_record
+********************************************************************************
+* Summary:
+* Records the duration of one run of a probe. Each probe must be recorded
+* from a single context.
+*
+* Parameters:
+*  probe - Probe ID
+*  start - Value of cy_profiler_now at the start of the run
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void cy_profiler_probe_record(cy_profiler_probe_id_t probe, uint32_t start)
+{
+    uint32_t duration = cy_profiler_now() - start;
+    probe_stats_t *stats = NULL;
+
+    if (probe >= CY_PROFILER_PROBE_COUNT)
+    {
+        return;
+    }
+
+    stats = &probe_stats[probe];
+    stats->count++;
+    stats->total += duration;
+    if (duration < stats->min)
+    {
+        stats->min = duration;
+    }
+    if (duration > stats->max)
+    {
+        stats->max = duration;
+    }
+    stats->hist[probe_bucket(duration)]++;
+}
+
+/*******************************************************************************
+* Function Name: cy_profiler_probe_get_summary
+********************************************************************************
+* Summary:
+* Returns the min/avg/max and 99th percentile of a probe. The percentile is
+* the upper bound of its histogram bucket.
+*
+* Parameters:
+*  probe - Probe ID
+*  summary - Filled with the probe summary
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void cy_profiler_probe_get_summary(cy_profiler_probe_id_t probe, cy_profiler_probe_summary_t *summary)
+{
+    static probe_stats_t snapshot;
+    uint32_t state = 0;
+    uint32_t rank = 0;
+    uint32_t seen = 0;
+    uint32_t i = 0;
+
+    if ((NULL == summary) || (probe >= CY_PROFILER_PROBE_COUNT))
+    {
+        return;
+    }
+
+    state = PROBE_ENTER_CRITICAL();
+    snapshot = probe_stats[probe];
+    PROBE_EXIT_CRITICAL(state);
+
+    memset(summary, 0, sizeof(*summary));
+    if (0u == snapshot.count)
+    {
+        return;
+    }
+
+    summary->count = snapshot.count;
+    summary->min = snapshot.min;
+    summary->max = snapshot.max;
+    summary->avg = (uint32_t)(snapshot.total / snapshot.count);
+
+    rank = (uint32_t)((((uint64_t)snapshot.count * PROBE_PERCENTILE) + 99u) / 100u);
+    for (i = 0; i < CY_PROFILER_HIST_BUCKETS; i++)
+    {
+        seen += snapshot.hist[i];
+        if (seen >= rank)
+        {
+            summary->p99 = probe_bucket_upper(i);
+            break;
+        }
+    }
+    if (summary->p99 > summary->max)
+    {
+        summary->p99 = summary->max;
+    }
+}
+
+/*******************************************************************************
+* Function Name: cy_profiler_probe_dump
+********************************************************************************
+* Summary:
+* Prints the summary of all probes that have been recorded.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void cy_profiler_probe_dump(void)
+{
+    cy_profiler_probe_summary_t summary;
+    uint32_t i = 0;
+
+    PROBE_LOG("Probe             count      min      avg      max      p99 (%s)\r\n", PROBE_TICK_UNIT);
+    for (i = 0; i < CY_PROFILER_PROBE_COUNT; i++)
+    {
+        cy_profiler_probe_get_summary((cy_profiler_probe_id_t)i, &summary);
+        if (0u != summary.count)
+        {
+            PROBE_LOG("%-15s %8lu %8lu %8lu %8lu %8lu\r\n", probe_names[i],
+                    (unsigned long)summary.count, (unsigned long)summary.min,
+                    (unsigned long)summary.avg, (unsigned long)summary.max,
+                    (unsigned long)summary.p99);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: cy_profiler_probe_tick
+********************************************************************************
+* Summary:
+* Dumps the probes every CY_PROFILER_PROBE_DUMP_TICKS calls. Call once per
+* audio frame from task context.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void cy_profiler_probe_tick(void)
+{
+    probe_ticks++;
+    if (CY_PROFILER_PROBE_DUMP_TICKS <= probe_ticks)
+    {
+        probe_ticks = 0;
+        cy_profiler_probe_dump();
+    }
+}
+
+/*******************************************************************************
+* Function Name: cy_profiler_probe_reset
+********************************************************************************
+* Summary:
+* Clears the statistics of all probes.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void cy_profiler_probe_reset(void)
+{
+    uint32_t state = 0;
+    uint32_t i = 0;
+
+    state = PROBE_ENTER_CRITICAL();
+    memset(probe_stats, 0, sizeof(probe_stats));
+    for (i = 0; i < CY_PROFILER_PROBE_COUNT; i++)
+    {
+        probe_stats[i].min = UINT32_MAX;
+    }
+    probe_ticks = 0;
+    PROBE_EXIT_CRITICAL(state);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,159 @@
+/******************************************************************************
+* File Name : bench_audio_conv_utils.c
+*
+* Description :
+* Benchmark of the pipeline frame converters: scalar reference against the
+* Helium (MVE) kernels. The MVE kernels run on the host emulation of the
+* intrinsics, so their time is not meaningful; the benchmark reports the
+* vector instructions they issue per frame next to the scalar loads and
+* stores of the reference loops. The CM55 cycles are measured on the target
+* with the CY_PROFILER_PROBE_DEINTERLEAVE probe.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "host_bench.h"
+#include "audio_conv_utils.h"
+#include "arm_mve.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define BENCH_DEFAULT_ITERATIONS        (100000u)
+#define BENCH_FRAME_SAMPLES             (AUDIO_PIPELINE_SAMPLES_PER_FRAME)
+
+#if !AUDIO_CONV_USE_MVE
+#error "The conversion benchmark needs AUDIO_CONV_USE_MVE=1"
+#endif /* AUDIO_CONV_USE_MVE */
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef void (*bench_converter_t)(uint16_t *a, uint16_t *b);
+
+typedef struct
+{
+    const char *name;
+    bench_converter_t scalar;
+    bench_converter_t mve;
+    uint32_t scalar_ops;                /* Loads and stores of the scalar loop per frame */
+} bench_case_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+uint32_t host_mve_ops = 0;
+
+static uint16_t bench_a[2u * BENCH_FRAME_SAMPLES];
+static uint16_t bench_b[2u * BENCH_FRAME_SAMPLES];
+
+/* The argument order of each converter is kept, the output is either buffer */
+static const bench_case_t bench_cases[] =
+{
+    {
+        .name = "non-interleaved to interleaved",
+        .scalar = convert_stereo_non_interleaved_to_stereo_interleaved_ref,
+        .mve = convert_stereo_non_interleaved_to_stereo_interleaved,
+        .scalar_ops = 4u * BENCH_FRAME_SAMPLES,
+    },
+    {
+        .name = "interleaved to non-interleaved",
+        .scalar = convert_interleaved_to_stereo_non_interleaved_ref,
+        .mve = convert_interleaved_to_stereo_non_interleaved,
+        .scalar_ops = 4u * BENCH_FRAME_SAMPLES,
+    },
+    {
+        .name = "stereo to mono",
+        .scalar = convert_stereo_interleaved_to_mono_ref,
+        .mve = convert_stereo_interleaved_to_mono,
+        .scalar_ops = 2u * BENCH_FRAME_SAMPLES,
+    },
+    {
+        .name = "mono to stereo",
+        .scalar = convert_mono_to_stereo_interleaved_ref,
+        .mve = convert_mono_to_stereo_interleaved,
+        .scalar_ops = 3u * BENCH_FRAME_SAMPLES,
+    },
+};
+
+int main(int argc, char *argv[])
+{
+    uint32_t iterations = host_bench_iterations(argc, argv, BENCH_DEFAULT_ITERATIONS);
+    const bench_case_t *bench;
+    uint64_t start;
+    uint64_t scalar_ns;
+    uint32_t checksum = 0;
+
+    for (uint32_t i = 0; i < (2u * BENCH_FRAME_SAMPLES); i++)
+    {
+        bench_a[i] = (uint16_t)(i * 40503u);
+    }
+
+    printf("%u samples per channel, %lu frames\n\n", (unsigned int)BENCH_FRAME_SAMPLES,
+            (unsigned long)iterations);
+    printf("%-32s %12s %14s %12s %8s\n", "Converter", "scalar ns", "scalar ld+st",
+           "MVE vec ops", "ratio");
+
+    for (uint32_t id = 0; id < (sizeof(bench_cases) / sizeof(bench_cases[0])); id++)
+    {
+        bench = &bench_cases[id];
+
+        start = host_bench_now_ns();
+        for (uint32_t i = 0; i < iterations; i++)
+        {
+            bench->scalar(bench_a, bench_b);
+            checksum += bench_b[i % BENCH_FRAME_SAMPLES];
+        }
+        scalar_ns = host_bench_now_ns() - start;
+
+        host_mve_ops = 0;
+        bench->mve(bench_a, bench_b);
+
+        printf("%-32s %12.1f %14lu %12lu %7.1fx\n", bench->name,
+                HOST_BENCH_NS_PER_CALL(scalar_ns, iterations),
+                (unsigned long)bench->scalar_ops, (unsigned long)host_mve_ops,
+                (0u != host_mve_ops) ? (double)bench->scalar_ops / host_mve_ops : 0.0);
+        if (0u == host_mve_ops)
+        {
+            fprintf(stderr, "%s did not use the vector path\n", bench->name);
+            return EXIT_FAILURE;
+        }
+    }
+    printf("\nchecksum %08lx\n", (unsigned long)checksum);
+
+    return EXIT_SUCCESS;
+}
+
+/* [] END OF FILE */
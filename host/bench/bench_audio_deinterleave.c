@@ -0,0 +1,201 @@
+/******************************************************************************
+* File Name : bench_audio_deinterleave.c
+*
+* Description :
+* De-interleave throughput of N-channel capture. A synthetic N-channel WAV
+* stream is split frame by frame into the planar frame layout for 1 to 8
+* channels.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "host_bench.h"
+#include "audio_conv_utils.h"
+#include "ae_frame_pool.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define BENCH_DEFAULT_ITERATIONS        (20000u)
+#define BENCH_FRAME_SAMPLES             (AUDIO_PIPELINE_SAMPLES_PER_FRAME)
+#define BENCH_MAX_CHANNELS              (8u)
+/* Frames in the synthetic stream, the benchmark loops over them */
+#define BENCH_STREAM_FRAMES             (50u)
+#define BENCH_WAV_HEADER_SIZE           (44u)
+#define BENCH_WAV_DATA_SIZE(channels)   (BENCH_STREAM_FRAMES * BENCH_FRAME_SAMPLES * (channels) * sizeof(int16_t))
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const uint32_t bench_channels[] = { 1u, 2u, 4u, 6u, 8u };
+
+static uint8_t bench_wav[BENCH_WAV_HEADER_SIZE + BENCH_WAV_DATA_SIZE(BENCH_MAX_CHANNELS)]
+        __attribute__((aligned(AE_FRAME_ALIGNMENT)));
+/* Channel planes laid out as in ae_frame_t, for the largest array */
+static uint16_t bench_planar[BENCH_MAX_CHANNELS * AE_FRAME_CHANNEL_STRIDE]
+        __attribute__((aligned(AE_FRAME_ALIGNMENT)));
+
+/*******************************************************************************
+* Function Name: bench_put_u16
+*******************************************************************************/
+static void bench_put_u16(uint8_t *p, uint32_t value)
+{
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+}
+
+/*******************************************************************************
+* Function Name: bench_put_u32
+*******************************************************************************/
+static void bench_put_u32(uint8_t *p, uint32_t value)
+{
+    bench_put_u16(p, value);
+    bench_put_u16(p + 2, value >> 16);
+}
+
+/*******************************************************************************
+* Function Name: bench_wav_build
+********************************************************************************
+* Summary:
+* Builds a 16-bit PCM WAV image with 'channels' interleaved channels. Sample
+* n of channel c holds c * 4096 + n, so that a swapped channel or sample is
+* caught by bench_check.
+*
+* Return:
+*  The interleaved samples of the data chunk
+*
+*******************************************************************************/
+static const uint16_t* bench_wav_build(uint32_t channels)
+{
+    uint32_t data_bytes = BENCH_WAV_DATA_SIZE(channels);
+    uint16_t *data = (uint16_t *)(bench_wav + BENCH_WAV_HEADER_SIZE);
+
+    memcpy(bench_wav, "RIFF", 4);
+    bench_put_u32(bench_wav + 4, (BENCH_WAV_HEADER_SIZE - 8u) + data_bytes);
+    memcpy(bench_wav + 8, "WAVEfmt ", 8);
+    bench_put_u32(bench_wav + 16, 16u);
+    bench_put_u16(bench_wav + 20, 1u);
+    bench_put_u16(bench_wav + 22, channels);
+    bench_put_u32(bench_wav + 24, AUDIO_PIPELINE_SAMPLE_RATE_HZ);
+    bench_put_u32(bench_wav + 28, AUDIO_PIPELINE_SAMPLE_RATE_HZ * channels * sizeof(int16_t));
+    bench_put_u16(bench_wav + 32, channels * sizeof(int16_t));
+    bench_put_u16(bench_wav + 34, 16u);
+    memcpy(bench_wav + 36, "data", 4);
+    bench_put_u32(bench_wav + 40, data_bytes);
+
+    for (uint32_t n = 0; n < (BENCH_STREAM_FRAMES * BENCH_FRAME_SAMPLES); n++)
+    {
+        for (uint32_t c = 0; c < channels; c++)
+        {
+            data[(n * channels) + c] = (uint16_t)((c * 4096u) + (n % 4096u));
+        }
+    }
+    return data;
+}
+
+/*******************************************************************************
+* Function Name: bench_check
+********************************************************************************
+* Summary:
+* Checks that the planes hold frame 'frame' of the stream.
+*
+*******************************************************************************/
+static bool bench_check(uint32_t channels, uint32_t frame)
+{
+    for (uint32_t c = 0; c < channels; c++)
+    {
+        for (uint32_t i = 0; i < BENCH_FRAME_SAMPLES; i++)
+        {
+            uint32_t n = (frame * BENCH_FRAME_SAMPLES) + i;
+
+            if (bench_planar[(c * AE_FRAME_CHANNEL_STRIDE) + i] != (uint16_t)((c * 4096u) + (n % 4096u)))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t iterations = host_bench_iterations(argc, argv, BENCH_DEFAULT_ITERATIONS);
+    const uint16_t *data;
+    uint32_t channels;
+    uint32_t frame = 0;
+    uint64_t start;
+    uint64_t elapsed_ns;
+    uint32_t checksum = 0;
+
+    printf("%u samples per channel, %lu frames, plane stride %u samples\n\n",
+            (unsigned int)BENCH_FRAME_SAMPLES, (unsigned long)iterations,
+            (unsigned int)AE_FRAME_CHANNEL_STRIDE);
+    printf("%-8s %12s %14s %12s\n", "Channels", "ns/frame", "ns/sample", "MB/s");
+
+    for (uint32_t id = 0; id < (sizeof(bench_channels) / sizeof(bench_channels[0])); id++)
+    {
+        channels = bench_channels[id];
+        data = bench_wav_build(channels);
+
+        start = host_bench_now_ns();
+        for (uint32_t i = 0; i < iterations; i++)
+        {
+            frame = i % BENCH_STREAM_FRAMES;
+            audio_conv_deinterleave(&data[frame * BENCH_FRAME_SAMPLES * channels], bench_planar,
+                    BENCH_FRAME_SAMPLES, channels, AE_FRAME_CHANNEL_STRIDE);
+            checksum += bench_planar[(i % channels) * AE_FRAME_CHANNEL_STRIDE];
+        }
+        elapsed_ns = host_bench_now_ns() - start;
+
+        if (!bench_check(channels, frame))
+        {
+            fprintf(stderr, "%lu channels: planes do not match the stream\n", (unsigned long)channels);
+            return EXIT_FAILURE;
+        }
+
+        printf("%-8lu %12.1f %14.3f %12.1f\n", (unsigned long)channels,
+                HOST_BENCH_NS_PER_CALL(elapsed_ns, iterations),
+                HOST_BENCH_NS_PER_CALL(elapsed_ns, (uint64_t)iterations * BENCH_FRAME_SAMPLES * channels),
+                (0u != elapsed_ns) ?
+                    ((double)iterations * BENCH_FRAME_SAMPLES * channels * sizeof(int16_t) * 1000.0) / elapsed_ns :
+                    0.0);
+    }
+    printf("\nchecksum %08lx\n", (unsigned long)checksum);
+
+    return EXIT_SUCCESS;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,165 @@
+/******************************************************************************
+* File Name : bench_audio_resampler.c
+*
+* Description :
+* Cost of the USB boundary resampler per 10 ms frame for each host rate
+* the USB side supports, in both directions and for 1 to 4 channels.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "host_bench.h"
+#include "audio_pipeline_config.h"
+#include "audio_resampler.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define BENCH_DEFAULT_ITERATIONS        (5000u)
+#define BENCH_FRAME_MS                  (AUDIO_PIPELINE_FRAME_MS)
+#define BENCH_MAX_RATE_HZ               (48000u)
+#define BENCH_MAX_FRAME_SAMPLES         ((BENCH_MAX_RATE_HZ / 1000u) * BENCH_FRAME_MS)
+#define BENCH_MAX_CHANNELS              (AUDIO_RESAMPLER_MAX_CHANNELS)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    uint32_t in_rate_hz;
+    uint32_t out_rate_hz;
+} bench_case_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* The enhanced audio leaves at the host rate, the AEC reference comes in at
+ * it. Equal rates are the pass-through of a 16 kHz host.
+ */
+static const bench_case_t bench_cases[] =
+{
+    { AUDIO_PIPELINE_SAMPLE_RATE_HZ, 16000u },
+    { AUDIO_PIPELINE_SAMPLE_RATE_HZ, 32000u },
+    { AUDIO_PIPELINE_SAMPLE_RATE_HZ, 48000u },
+    { 32000u, AUDIO_PIPELINE_SAMPLE_RATE_HZ },
+    { 48000u, AUDIO_PIPELINE_SAMPLE_RATE_HZ },
+};
+
+static const uint32_t bench_channels[] = { 1u, 2u, 4u };
+
+static audio_resampler_t bench_resampler;
+static int16_t bench_in[BENCH_MAX_FRAME_SAMPLES * BENCH_MAX_CHANNELS];
+static int16_t bench_out[AUDIO_RESAMPLER_MAX_OUTPUT(BENCH_MAX_FRAME_SAMPLES, AUDIO_RESAMPLER_MAX_FACTOR, 1u) *
+        BENCH_MAX_CHANNELS];
+
+int main(int argc, char *argv[])
+{
+    uint32_t iterations = host_bench_iterations(argc, argv, BENCH_DEFAULT_ITERATIONS);
+    const bench_case_t *bench;
+    uint32_t channels;
+    uint32_t in_frames;
+    uint64_t out_frames;
+    uint64_t macs;
+    uint64_t start;
+    uint64_t start_cycles;
+    uint64_t elapsed_ns;
+    uint64_t elapsed_cycles;
+    uint32_t checksum = 0;
+
+    for (uint32_t i = 0; i < (BENCH_MAX_FRAME_SAMPLES * BENCH_MAX_CHANNELS); i++)
+    {
+        bench_in[i] = (int16_t)(i * 40503u);
+    }
+
+    printf("%lu frames of %u ms, cycles are host time stamp counter cycles\n\n",
+            (unsigned long)iterations, (unsigned int)BENCH_FRAME_MS);
+    printf("%-16s %8s %12s %14s %12s %10s %8s\n", "Rates (Hz)", "Channels", "ns/frame",
+            "cycles/frame", "MAC/frame", "ns/MAC", "load");
+
+    for (uint32_t id = 0; id < (sizeof(bench_cases) / sizeof(bench_cases[0])); id++)
+    {
+        bench = &bench_cases[id];
+        in_frames = (bench->in_rate_hz / 1000u) * BENCH_FRAME_MS;
+
+        for (uint32_t c = 0; c < (sizeof(bench_channels) / sizeof(bench_channels[0])); c++)
+        {
+            channels = bench_channels[c];
+            if (CY_RSLT_SUCCESS != audio_resampler_init(&bench_resampler, bench->in_rate_hz,
+                    bench->out_rate_hz, channels))
+            {
+                fprintf(stderr, "%lu to %lu Hz is not supported\n",
+                        (unsigned long)bench->in_rate_hz, (unsigned long)bench->out_rate_hz);
+                return EXIT_FAILURE;
+            }
+
+            out_frames = 0;
+            start = host_bench_now_ns();
+            start_cycles = host_bench_cycles();
+            for (uint32_t i = 0; i < iterations; i++)
+            {
+                out_frames += audio_resampler_process(&bench_resampler, bench_in, in_frames, bench_out);
+                checksum += (uint16_t)bench_out[i % in_frames];
+            }
+            elapsed_cycles = host_bench_cycles() - start_cycles;
+            elapsed_ns = host_bench_now_ns() - start;
+
+            /* Every output sample of a resampling case is a dot product over
+             * the taps of one phase
+             */
+            if (out_frames != (((uint64_t)iterations * in_frames * bench->out_rate_hz) / bench->in_rate_hz))
+            {
+                fprintf(stderr, "%lu to %lu Hz produced %llu frames\n", (unsigned long)bench->in_rate_hz,
+                        (unsigned long)bench->out_rate_hz, (unsigned long long)out_frames);
+                return EXIT_FAILURE;
+            }
+            macs = (bench_resampler.up != bench_resampler.down) ?
+                    (out_frames * channels * bench_resampler.taps_per_phase) / iterations : 0u;
+
+            printf("%6lu -> %-6lu %8lu %12.1f %14.0f %12llu %10.2f %7.2f%%\n",
+                    (unsigned long)bench->in_rate_hz, (unsigned long)bench->out_rate_hz,
+                    (unsigned long)channels,
+                    HOST_BENCH_NS_PER_CALL(elapsed_ns, iterations),
+                    HOST_BENCH_NS_PER_CALL(elapsed_cycles, iterations),
+                    (unsigned long long)macs,
+                    HOST_BENCH_NS_PER_CALL(elapsed_ns, (uint64_t)iterations * macs),
+                    HOST_BENCH_NS_PER_CALL(elapsed_ns * 100u, (uint64_t)iterations * BENCH_FRAME_MS * 1000000u));
+        }
+    }
+    printf("\nchecksum %08lx\n", (unsigned long)checksum);
+
+    return EXIT_SUCCESS;
+}
+
+/* [] END OF FILE */
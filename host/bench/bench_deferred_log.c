@@ -0,0 +1,165 @@
+/******************************************************************************
+* File Name : bench_deferred_log.c
+*
+* Description :
+* Cost of the deferred log. Compares the per-call cost of a deferred record
+* with formatting the same line, and reports the record rate and the cost
+* of the drain per record.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <fcntl.h>
+#include "host_bench.h"
+#include "deferred_log.h"
+#include "cy_pdl.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define BENCH_DEFAULT_ITERATIONS        (10000u)
+/* Records written between two drains, the ring never overflows */
+#define BENCH_BURST                     (DEFERRED_LOG_RING_RECORDS)
+#define BENCH_LINE_SIZE                 (160u)
+
+#if !DEFERRED_LOG_BINARY_OUTPUT
+#error "The deferred log benchmark needs DEFERRED_LOG_BINARY_OUTPUT=1"
+#endif /* DEFERRED_LOG_BINARY_OUTPUT */
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* A line as logged by the feed path on a failed feed */
+static const char bench_format[] = "ae_interface_feed: frame %lu failed with 0x%08lx";
+
+static char bench_line[BENCH_LINE_SIZE];
+static int bench_stdout = -1;
+
+/*******************************************************************************
+* Function Name: bench_quiet
+********************************************************************************
+* Summary:
+* Sends stdout, which carries the binary frames of the drain, to /dev/null
+* while 'quiet' is set and restores it afterwards.
+*
+*******************************************************************************/
+static void bench_quiet(bool quiet)
+{
+    int null_fd;
+
+    fflush(stdout);
+    if (quiet)
+    {
+        bench_stdout = dup(STDOUT_FILENO);
+        null_fd = open("/dev/null", O_WRONLY);
+        (void)dup2(null_fd, STDOUT_FILENO);
+        close(null_fd);
+    }
+    else
+    {
+        (void)dup2(bench_stdout, STDOUT_FILENO);
+        close(bench_stdout);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t bursts = host_bench_iterations(argc, argv, BENCH_DEFAULT_ITERATIONS);
+    uint64_t calls = (uint64_t)bursts * BENCH_BURST;
+    deferred_log_stats_t stats;
+    uint64_t start;
+    uint64_t format_ns = 0;
+    uint64_t timestamp_ns = 0;
+    uint64_t write_ns = 0;
+    uint64_t drain_ns = 0;
+    uint32_t checksum = 0;
+    uint32_t n = 0;
+
+    bench_quiet(true);
+    for (uint32_t burst = 0; burst < bursts; burst++)
+    {
+        start = host_bench_now_ns();
+        for (uint32_t i = 0; i < BENCH_BURST; i++, n++)
+        {
+            checksum += (uint32_t)snprintf(bench_line, sizeof(bench_line), bench_format,
+                                           (unsigned long)n, (unsigned long)(n * 40503u));
+        }
+        format_ns += host_bench_now_ns() - start;
+
+        start = host_bench_now_ns();
+        for (uint32_t i = 0; i < BENCH_BURST; i++)
+        {
+            checksum += DWT->CYCCNT;
+        }
+        timestamp_ns += host_bench_now_ns() - start;
+
+        start = host_bench_now_ns();
+        for (uint32_t i = 0; i < BENCH_BURST; i++, n++)
+        {
+            deferred_log_write(bench_format, 2u, n, n * 40503u, 0u, 0u);
+        }
+        write_ns += host_bench_now_ns() - start;
+
+        start = host_bench_now_ns();
+        deferred_log_drain();
+        drain_ns += host_bench_now_ns() - start;
+    }
+    bench_quiet(false);
+
+    deferred_log_get_stats(&stats);
+    if ((stats.records != (uint32_t)calls) || (0u != stats.dropped))
+    {
+        fprintf(stderr, "%lu records written, %lu dropped, expected %lu and none\n",
+                (unsigned long)stats.records, (unsigned long)stats.dropped, (unsigned long)calls);
+        return EXIT_FAILURE;
+    }
+
+    printf("%lu records in bursts of %u, ring high water %lu\n\n", (unsigned long)calls,
+            (unsigned int)BENCH_BURST, (unsigned long)stats.max_depth);
+    printf("%-34s %10s\n", "", "ns/call");
+    printf("%-34s %10.1f\n", "snprintf of the line", HOST_BENCH_NS_PER_CALL(format_ns, calls));
+    printf("%-34s %10.1f\n", "deferred_log_write", HOST_BENCH_NS_PER_CALL(write_ns, calls));
+    printf("%-34s %10.1f\n", "  of which the timestamp read", HOST_BENCH_NS_PER_CALL(timestamp_ns, calls));
+    printf("%-34s %10.1f\n", "deferred_log_drain, per record", HOST_BENCH_NS_PER_CALL(drain_ns, calls));
+    printf("\nRecord rate %.2f M records/s, %.1fx cheaper than formatting\n",
+            (0u != write_ns) ? ((double)calls * 1000.0) / write_ns : 0.0,
+            (0u != write_ns) ? (double)format_ns / write_ns : 0.0);
+    printf("The timestamp is clock_gettime on the host and a register read on the target.\n");
+    printf("\nchecksum %08lx\n", (unsigned long)checksum);
+
+    return EXIT_SUCCESS;
+}
+
+/* [] END OF FILE */
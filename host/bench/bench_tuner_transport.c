@@ -0,0 +1,336 @@
+/******************************************************************************
+* File Name : bench_tuner_transport.c
+*
+* Description :
+* Round-trip latency of the tuner transports on a loopback host side. The
+* UART runs on a pseudo-terminal with its interrupt called in the loop, the
+* USB bulk task in a thread against the bulk class stand-in. A request is
+* sent, read by the tuner side as the tuner callback does, and answered
+* with a response of the same size.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <fcntl.h>
+#include <pthread.h>
+#include <pty.h>
+#include <sched.h>
+#include <string.h>
+#include <termios.h>
+#include "host_bench.h"
+#include "cybsp.h"
+#include "task.h"
+#include "USB_Bulk.h"
+#include "tuner_transport.h"
+#include "tuner_uart.h"
+#include "tuner_usb.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define BENCH_DEFAULT_ITERATIONS        (1000u)
+#define BENCH_MAX_MESSAGE               (512u)
+
+/* Debug UART baud rate set by retarget-io, 10 bits per byte on the wire */
+#define BENCH_UART_BAUD                 (115200u)
+#define BENCH_UART_BITS_PER_BYTE        (10u)
+
+/* Round trips without progress for this long are considered stuck */
+#define BENCH_TIMEOUT_NS                (1000000000u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    tuner_transport_t device;           /* Device side, as used by the tuner */
+    void (*attach)(void);               /* Connects the host side */
+    void (*service)(void);              /* Runs the device interrupt, if any */
+    uint32_t (*host_send)(const uint8_t *data, uint32_t length);
+    uint32_t (*host_read)(uint8_t *buffer, uint32_t size);
+    double wire_ns_per_byte;            /* Serialization time, 0 if not modeled */
+} bench_link_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const uint32_t bench_sizes[] = { 16u, BENCH_MAX_MESSAGE };
+
+static int bench_pty_fd = -1;
+
+static uint8_t bench_request[BENCH_MAX_MESSAGE];
+static uint8_t bench_response[BENCH_MAX_MESSAGE];
+static uint64_t *bench_trip_ns = NULL;
+
+/*******************************************************************************
+* Function Name: bench_uart_attach
+********************************************************************************
+* Summary:
+* Connects the debug UART to a raw, non-blocking pseudo-terminal.
+*
+*******************************************************************************/
+static void bench_uart_attach(void)
+{
+    struct termios raw;
+    int uart_fd;
+
+    if ((0 != openpty(&bench_pty_fd, &uart_fd, NULL, NULL, NULL)) || (0 != tcgetattr(uart_fd, &raw)))
+    {
+        fprintf(stderr, "No pseudo-terminal\n");
+        exit(EXIT_FAILURE);
+    }
+    cfmakeraw(&raw);
+    (void)tcsetattr(uart_fd, TCSANOW, &raw);
+    (void)fcntl(bench_pty_fd, F_SETFL, O_NONBLOCK);
+    (void)fcntl(uart_fd, F_SETFL, O_NONBLOCK);
+    host_uart_attach(uart_fd);
+}
+
+static void bench_uart_service(void)
+{
+    (void)host_uart_service();
+}
+
+static uint32_t bench_uart_host_send(const uint8_t *data, uint32_t length)
+{
+    ssize_t count = write(bench_pty_fd, data, length);
+
+    return (count > 0) ? (uint32_t)count : 0u;
+}
+
+static uint32_t bench_uart_host_read(uint8_t *buffer, uint32_t size)
+{
+    ssize_t count = read(bench_pty_fd, buffer, size);
+
+    return (count > 0) ? (uint32_t)count : 0u;
+}
+
+/*******************************************************************************
+* Function Name: bench_usb_task
+********************************************************************************
+* Summary:
+* Runs the bulk transport task created by tuner_usb_init, which the host
+* FreeRTOS stub does not start.
+*
+*******************************************************************************/
+static void* bench_usb_task(void *arg)
+{
+    void *task_arg = NULL;
+    TaskFunction_t task = host_task_find("tuner_usb", &task_arg);
+
+    (void)arg;
+    if (NULL == task)
+    {
+        fprintf(stderr, "The tuner USB task was not created\n");
+        exit(EXIT_FAILURE);
+    }
+    task(task_arg);
+    return NULL;
+}
+
+static void bench_usb_attach(void)
+{
+    pthread_t thread;
+
+    tuner_usb_add();
+    if (0 != pthread_create(&thread, NULL, bench_usb_task, NULL))
+    {
+        fprintf(stderr, "No thread for the tuner USB task\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+/* Same operations as tuner_transport.c, which only exposes the one selected
+ * by TUNER_TRANSPORT
+ */
+static const bench_link_t bench_links[] =
+{
+    {
+        .device = { .name = "uart", .init = tuner_uart_init, .read = tuner_uart_read, .write = tuner_uart_write },
+        .attach = bench_uart_attach,
+        .service = bench_uart_service,
+        .host_send = bench_uart_host_send,
+        .host_read = bench_uart_host_read,
+        .wire_ns_per_byte = (1e9 * BENCH_UART_BITS_PER_BYTE) / BENCH_UART_BAUD,
+    },
+    {
+        .device = { .name = "usb", .init = tuner_usb_init, .read = tuner_usb_read, .write = tuner_usb_write },
+        .attach = bench_usb_attach,
+        .service = NULL,
+        .host_send = host_usb_bulk_send,
+        .host_read = host_usb_bulk_read,
+        .wire_ns_per_byte = 0.0,
+    },
+};
+
+/*******************************************************************************
+* Function Name: bench_round_trip
+********************************************************************************
+* Summary:
+* Sends a request of 'size' bytes from the host side, answers it on the
+* tuner side once complete and waits for the whole response. Returns the
+* round-trip time, or 0 if the transport lost bytes or got stuck.
+*
+*******************************************************************************/
+static uint64_t bench_round_trip(const bench_link_t *link, uint32_t size, uint32_t trip)
+{
+    uint8_t buffer[BENCH_MAX_MESSAGE];
+    uint32_t sent = 0;
+    uint32_t received = 0;
+    uint32_t answered = 0;
+    uint32_t returned = 0;
+    uint32_t count;
+    uint32_t progress;
+    uint64_t start = host_bench_now_ns();
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        bench_request[i] = (uint8_t)(trip + i);
+    }
+
+    while (returned < size)
+    {
+        if ((host_bench_now_ns() - start) > BENCH_TIMEOUT_NS)
+        {
+            return 0u;
+        }
+
+        progress = sent + received + answered + returned;
+
+        sent += link->host_send(&bench_request[sent], size - sent);
+        if (NULL != link->service)
+        {
+            link->service();
+        }
+
+        /* Tuner side */
+        count = link->device.read(&buffer[received], size - received);
+        if ((0u != count) && (0 != memcmp(&buffer[received], &bench_request[received], count)))
+        {
+            return 0u;
+        }
+        received += count;
+        if (received == size)
+        {
+            answered += link->device.write(&bench_request[answered], size - answered);
+        }
+
+        returned += link->host_read(&bench_response[returned], size - returned);
+
+        /* Leave the CPU to the USB task thread while waiting */
+        if (progress == (sent + received + answered + returned))
+        {
+            (void)sched_yield();
+        }
+    }
+
+    return (0 == memcmp(bench_response, bench_request, size)) ? (host_bench_now_ns() - start) : 0u;
+}
+
+static int bench_compare(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t iterations = host_bench_iterations(argc, argv, BENCH_DEFAULT_ITERATIONS);
+    const bench_link_t *link;
+    uint64_t total_ns;
+    uint32_t size;
+
+    bench_trip_ns = calloc(iterations, sizeof(*bench_trip_ns));
+    if (NULL == bench_trip_ns)
+    {
+        return EXIT_FAILURE;
+    }
+
+    printf("%lu round trips per transport and size\n\n", (unsigned long)iterations);
+    printf("%-9s %6s %12s %12s %12s %12s\n", "Transport", "bytes", "mean us", "median us", "p99 us",
+           "wire us");
+
+    for (uint32_t id = 0; id < (sizeof(bench_links) / sizeof(bench_links[0])); id++)
+    {
+        link = &bench_links[id];
+        if (CY_RSLT_SUCCESS != link->device.init())
+        {
+            fprintf(stderr, "%s: init failed\n", link->device.name);
+            return EXIT_FAILURE;
+        }
+        link->attach();
+
+        for (uint32_t s = 0; s < (sizeof(bench_sizes) / sizeof(bench_sizes[0])); s++)
+        {
+            size = bench_sizes[s];
+            total_ns = 0;
+            for (uint32_t i = 0; i < iterations; i++)
+            {
+                bench_trip_ns[i] = bench_round_trip(link, size, i);
+                if (0u == bench_trip_ns[i])
+                {
+                    fprintf(stderr, "%s: round trip %lu of %lu bytes failed\n", link->device.name,
+                            (unsigned long)i, (unsigned long)size);
+                    return EXIT_FAILURE;
+                }
+                total_ns += bench_trip_ns[i];
+            }
+            qsort(bench_trip_ns, iterations, sizeof(*bench_trip_ns), bench_compare);
+
+            printf("%-9s %6lu %12.1f %12.1f %12.1f ", link->device.name, (unsigned long)size,
+                   HOST_BENCH_NS_PER_CALL(total_ns, iterations) / 1000.0,
+                   (double)bench_trip_ns[iterations / 2u] / 1000.0,
+                   (double)bench_trip_ns[(iterations * 99u) / 100u] / 1000.0);
+            if (0.0 != link->wire_ns_per_byte)
+            {
+                printf("%12.1f\n", (2u * size * link->wire_ns_per_byte) / 1000.0);
+            }
+            else
+            {
+                printf("%12s\n", "-");
+            }
+        }
+    }
+
+    printf("\nThe UART wire time is that of both messages at %u baud.\n", (unsigned int)BENCH_UART_BAUD);
+    printf("USB responses wait for the bulk receive timeout of the transport task.\n");
+    free(bench_trip_ns);
+
+    return EXIT_SUCCESS;
+}
+
+/* [] END OF FILE */
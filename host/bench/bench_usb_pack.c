@@ -0,0 +1,242 @@
+/******************************************************************************
+* File Name : bench_usb_pack.c
+*
+* Description :
+* USB IN packer against the fixed four-pointer loop it replaced. The same
+* 10 ms frames of all USB channels are packed into 1 ms packets by both,
+* the packets are compared and the time per packet reported.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "host_bench.h"
+#include "audio.h"
+#include "audio_frame_ring.h"
+#include "audio_pipeline_config.h"
+#include "audio_usb_send_utils.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define BENCH_DEFAULT_ITERATIONS        (20000u)
+#define BENCH_FRAME_SAMPLES             (AUDIO_PIPELINE_SAMPLES_PER_FRAME)
+#define BENCH_PACKETS_PER_FRAME         (AUDIO_PIPELINE_FRAME_MS)
+#define BENCH_SAMPLES_PER_MS            (AUDIO_PIPELINE_SAMPLES_PER_MS)
+#define BENCH_PACKET_SAMPLES            (BENCH_SAMPLES_PER_MS * USB_OUT_NUM_CHANNELS)
+#define BENCH_PACKET_BYTES              (BENCH_PACKET_SAMPLES * sizeof(int16_t))
+/* Slots of the reference rings, a frame is written and packed per iteration */
+#define BENCH_RING_SLOTS                (4u)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Reference packer, the loop of usb_send_out_for_1_channel_worth_1ms before
+ * the channel table
+ */
+static audio_frame_ring_t bench_ref_ring[USB_OUT_NUM_CHANNELS];
+static uint8_t bench_ref_storage[USB_OUT_NUM_CHANNELS][BENCH_RING_SLOTS * BENCH_FRAME_SAMPLES * sizeof(int16_t)];
+static short *bench_ref_ptr[USB_OUT_NUM_CHANNELS];
+static bool bench_ref_held[USB_OUT_NUM_CHANNELS];
+static const short bench_ref_zero[BENCH_FRAME_SAMPLES] = {0};
+static int bench_ref_counter = 0;
+static uint16_t bench_ref_packet[BENCH_PACKETS_PER_FRAME][BENCH_PACKET_SAMPLES];
+
+static short bench_frame[USB_OUT_NUM_CHANNELS][BENCH_FRAME_SAMPLES];
+
+/*******************************************************************************
+* Function Name: bench_ref_get
+*******************************************************************************/
+static void bench_ref_get(unsigned int index)
+{
+    short *slot;
+
+    if (bench_ref_held[index])
+    {
+        audio_frame_ring_release(&bench_ref_ring[index]);
+        bench_ref_held[index] = false;
+    }
+
+    slot = (short *)audio_frame_ring_peek(&bench_ref_ring[index]);
+    if (NULL != slot)
+    {
+        bench_ref_ptr[index] = slot;
+        bench_ref_held[index] = true;
+    }
+    else
+    {
+        audio_frame_ring_count_underrun(&bench_ref_ring[index]);
+        bench_ref_ptr[index] = (short *)bench_ref_zero;
+    }
+}
+
+/*******************************************************************************
+* Function Name: bench_ref_pack
+********************************************************************************
+* Summary:
+* One 1 ms packet of the previous packer, unrolled for the four channels of
+* the tuning build.
+*
+*******************************************************************************/
+static void bench_ref_pack(short *data_to_send)
+{
+    short *ch1;
+    short *ch2;
+    short *ch3;
+    short *ch4;
+
+    if ((bench_ref_counter % BENCH_PACKETS_PER_FRAME) == 0)
+    {
+        bench_ref_counter = 0;
+        bench_ref_get(0);
+        bench_ref_get(1);
+        bench_ref_get(2);
+        bench_ref_get(3);
+    }
+
+    ch1 = bench_ref_ptr[0] + (bench_ref_counter * BENCH_SAMPLES_PER_MS);
+    ch2 = bench_ref_ptr[1] + (bench_ref_counter * BENCH_SAMPLES_PER_MS);
+    ch3 = bench_ref_ptr[2] + (bench_ref_counter * BENCH_SAMPLES_PER_MS);
+    ch4 = bench_ref_ptr[3] + (bench_ref_counter * BENCH_SAMPLES_PER_MS);
+    bench_ref_counter++;
+
+    for (int i = 0; i < BENCH_SAMPLES_PER_MS; i++)
+    {
+        *data_to_send++ = *ch1++;
+        *data_to_send++ = *ch2++;
+        *data_to_send++ = *ch3++;
+        *data_to_send++ = *ch4++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: bench_frame_fill
+********************************************************************************
+* Summary:
+* Fills the frames of all channels for frame 'frame'. Sample n of channel c
+* holds c * 4096 + n, so that a swapped channel or sample shows as a packet
+* mismatch.
+*
+*******************************************************************************/
+static void bench_frame_fill(uint32_t frame)
+{
+    for (uint32_t c = 0; c < USB_OUT_NUM_CHANNELS; c++)
+    {
+        for (uint32_t i = 0; i < BENCH_FRAME_SAMPLES; i++)
+        {
+            bench_frame[c][i] = (short)((c * 4096u) + (((frame * BENCH_FRAME_SAMPLES) + i) % 4096u));
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t iterations = host_bench_iterations(argc, argv, BENCH_DEFAULT_ITERATIONS);
+    uint8_t *packet = NULL;
+    uint16_t length = 0;
+    uint64_t start;
+    uint64_t ref_ns = 0;
+    uint64_t new_ns = 0;
+    uint32_t checksum = 0;
+
+    for (uint32_t c = 0; c < USB_OUT_NUM_CHANNELS; c++)
+    {
+        bench_ref_ptr[c] = (short *)bench_ref_zero;
+        (void)audio_frame_ring_init(&bench_ref_ring[c], bench_ref_storage[c],
+                BENCH_FRAME_SAMPLES * sizeof(int16_t), BENCH_RING_SLOTS);
+    }
+    usb_send_out_dbg_init_channels();
+    usb_send_out_dbg_set_sample_rate(AUDIO_PIPELINE_SAMPLE_RATE_HZ);
+
+    printf("%u channels, %u samples per packet, %lu timed frames of %u packets\n\n",
+            (unsigned int)USB_OUT_NUM_CHANNELS, (unsigned int)BENCH_SAMPLES_PER_MS,
+            (unsigned long)iterations, (unsigned int)BENCH_PACKETS_PER_FRAME);
+
+    /* Both packers are fed the same frames. Every other frame is packed
+     * packet by packet and compared, the others are timed as a batch of
+     * packets.
+     */
+    for (uint32_t frame = 0; frame < (2u * iterations); frame++)
+    {
+        bench_frame_fill(frame);
+        for (uint32_t c = 0; c < USB_OUT_NUM_CHANNELS; c++)
+        {
+            (void)audio_frame_ring_write(&bench_ref_ring[c], bench_frame[c]);
+            (void)usb_send_out_dbg_put(USB_CHANNEL_1 + c, bench_frame[c]);
+        }
+
+        if (0u != (frame & 1u))
+        {
+            for (uint32_t p = 0; p < BENCH_PACKETS_PER_FRAME; p++)
+            {
+                bench_ref_pack((short *)bench_ref_packet[p]);
+                usb_send_out_dbg_callback(&packet, &length);
+                if ((BENCH_PACKET_BYTES != length) || (0 != memcmp(packet, bench_ref_packet[p], BENCH_PACKET_BYTES)))
+                {
+                    fprintf(stderr, "Frame %lu packet %lu differs from the reference loop\n",
+                            (unsigned long)frame, (unsigned long)p);
+                    return EXIT_FAILURE;
+                }
+            }
+            continue;
+        }
+
+        start = host_bench_now_ns();
+        for (uint32_t p = 0; p < BENCH_PACKETS_PER_FRAME; p++)
+        {
+            bench_ref_pack((short *)bench_ref_packet[p]);
+        }
+        ref_ns += host_bench_now_ns() - start;
+
+        start = host_bench_now_ns();
+        for (uint32_t p = 0; p < BENCH_PACKETS_PER_FRAME; p++)
+        {
+            usb_send_out_dbg_callback(&packet, &length);
+        }
+        new_ns += host_bench_now_ns() - start;
+
+        checksum += bench_ref_packet[frame % BENCH_PACKETS_PER_FRAME][frame % BENCH_PACKET_SAMPLES] +
+                ((const uint16_t *)packet)[frame % BENCH_PACKET_SAMPLES];
+    }
+
+    printf("%-18s %12s\n", "Packer", "ns/packet");
+    printf("%-18s %12.1f\n", "four-pointer loop", HOST_BENCH_NS_PER_CALL(ref_ns, (uint64_t)iterations * BENCH_PACKETS_PER_FRAME));
+    printf("%-18s %12.1f\n", "channel table", HOST_BENCH_NS_PER_CALL(new_ns, (uint64_t)iterations * BENCH_PACKETS_PER_FRAME));
+    printf("\nchecksum %08lx\n", (unsigned long)checksum);
+
+    return EXIT_SUCCESS;
+}
+
+/* [] END OF FILE */
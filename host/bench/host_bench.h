@@ -0,0 +1,122 @@
+/******************************************************************************
+* File Name : host_bench.h
+*
+* Description :
+* Helpers of the host micro-benchmarks: monotonic clock, cycle counter and
+* command line.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __HOST_BENCH_H__
+#define __HOST_BENCH_H__
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Nanoseconds per call of 'calls' calls that took 'ns' */
+#define HOST_BENCH_NS_PER_CALL(ns, calls)   ((0u != (calls)) ? ((double)(ns) / (double)(calls)) : 0.0)
+
+/*******************************************************************************
+* Function Name: host_bench_now_ns
+********************************************************************************
+* Summary:
+* Returns the host monotonic clock in nanoseconds.
+*
+*******************************************************************************/
+static inline uint64_t host_bench_now_ns(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+}
+
+/*******************************************************************************
+* Function Name: host_bench_cycles
+********************************************************************************
+* Summary:
+* Returns the host time stamp counter, or 0 on hosts without one. The counter
+* runs at the nominal clock of the CPU.
+*
+*******************************************************************************/
+static inline uint64_t host_bench_cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0u;
+#endif
+}
+
+/*******************************************************************************
+* Function Name: host_bench_iterations
+********************************************************************************
+* Summary:
+* Returns the iteration count given with -n, or 'iterations' without it.
+* Exits on other options.
+*
+*******************************************************************************/
+static inline uint32_t host_bench_iterations(int argc, char *argv[], uint32_t iterations)
+{
+    int option;
+
+    while (-1 != (option = getopt(argc, argv, "n:h")))
+    {
+        if ('n' == option)
+        {
+            iterations = (uint32_t)strtoul(optarg, NULL, 10);
+        }
+        else
+        {
+            printf("Usage: %s [-n iterations] (default %lu)\n", argv[0], (unsigned long)iterations);
+            exit(('h' == option) ? EXIT_SUCCESS : EXIT_FAILURE);
+        }
+    }
+    return (0u != iterations) ? iterations : 1u;
+}
+
+#endif /* __HOST_BENCH_H__ */
+
+/* [] END OF FILE */
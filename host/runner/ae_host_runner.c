@@ -0,0 +1,501 @@
+/******************************************************************************
+* File Name : ae_host_runner.c
+*
+* Description :
+* Host pipeline runner. Streams a stereo WAV file frame by frame through
+* ae_audio_data_feed_usb(), drains the USB IN packer like the isochronous
+* endpoint does and writes the USB channels to a WAV file. Reports the
+* wall time of each pipeline stage and the frames processed per second.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include "cy_pdl.h"
+#include "audio_pipeline_config.h"
+#include "ae_frame_pool.h"
+#include "ae_deadline.h"
+#include "ae_pipeline.h"
+#include "ae_backend.h"
+#include "audio_usb_send_utils.h"
+#include "latency_trace.h"
+#include "audio.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#ifndef AE_HOST_DEFAULT_INPUT
+#define AE_HOST_DEFAULT_INPUT                   "ae_test_stream/ae_test_stream.wav"
+#endif /* AE_HOST_DEFAULT_INPUT */
+
+#define AE_HOST_DEFAULT_OUTPUT                  "ae_host_output.wav"
+
+/* The USB IN endpoint is served once per millisecond */
+#define AE_HOST_USB_PACKETS_PER_FRAME           (AUDIO_PIPELINE_FRAME_MS)
+
+#define AE_HOST_WAV_HEADER_SIZE                 (44u)
+#define AE_HOST_WAV_FORMAT_PCM                  (1u)
+
+#define AE_HOST_NS_PER_US                       (1000u)
+#define AE_HOST_US_PER_MS                       (1000u)
+
+/* Frames between two mic-to-USB latency reports, as on the target */
+#define AE_HOST_LATENCY_REPORT_FRAMES           (500u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    uint32_t channels;
+    uint32_t sample_rate;
+    uint32_t frames;                    /* Samples per channel */
+    int16_t *samples;                   /* Interleaved */
+} ae_host_wav_t;
+
+/* Wall time of one stage, in nanoseconds */
+typedef struct
+{
+    const char *name;
+    uint64_t total_ns;
+    uint32_t max_ns;
+} ae_host_stage_t;
+
+typedef enum
+{
+    AE_HOST_STAGE_FEED = 0,             /* ae_audio_data_feed_usb() */
+    AE_HOST_STAGE_BACKEND,              /* Backend feed, part of the feed */
+    AE_HOST_STAGE_OUTPUT,               /* Output callback, part of the feed */
+    AE_HOST_STAGE_GLUE,                 /* Rest of the feed: deinterleave, frame pool, deadlines */
+    AE_HOST_STAGE_USB_PACK,             /* USB IN packer and resampler */
+    AE_HOST_STAGE_COUNT,
+} ae_host_stage_id_t;
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
+extern void ae_audio_data_feed_usb(int16_t *audio_data);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern volatile bool ae_toggle_flag;
+
+static ae_host_stage_t ae_host_stages[AE_HOST_STAGE_COUNT] =
+{
+    { .name = "feed" },
+    { .name = "  backend" },
+    { .name = "  output" },
+    { .name = "  glue" },
+    { .name = "usb pack" },
+};
+
+/*******************************************************************************
+* Function Name: ae_host_read_u16
+*******************************************************************************/
+static uint32_t ae_host_read_u16(const uint8_t *data)
+{
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8);
+}
+
+/*******************************************************************************
+* Function Name: ae_host_read_u32
+*******************************************************************************/
+static uint32_t ae_host_read_u32(const uint8_t *data)
+{
+    return ae_host_read_u16(data) | (ae_host_read_u16(data + 2) << 16);
+}
+
+/*******************************************************************************
+* Function Name: ae_host_write_u16
+*******************************************************************************/
+static void ae_host_write_u16(uint8_t *data, uint32_t value)
+{
+    data[0] = (uint8_t)value;
+    data[1] = (uint8_t)(value >> 8);
+}
+
+/*******************************************************************************
+* Function Name: ae_host_write_u32
+*******************************************************************************/
+static void ae_host_write_u32(uint8_t *data, uint32_t value)
+{
+    ae_host_write_u16(data, value);
+    ae_host_write_u16(data + 2, value >> 16);
+}
+
+/*******************************************************************************
+* Function Name: ae_host_wav_read
+********************************************************************************
+* Summary:
+*   Loads a 16-bit PCM WAV file. Chunks other than "fmt " and "data" are
+*   skipped.
+*
+* Parameters:
+*  path - File to read
+*  wav - Filled with the format and the samples
+*
+* Return:
+*  true on success.
+*
+*******************************************************************************/
+static bool ae_host_wav_read(const char *path, ae_host_wav_t *wav)
+{
+    FILE *file = fopen(path, "rb");
+    uint8_t header[12];
+    uint8_t chunk[8];
+    uint8_t fmt[16];
+    uint32_t size = 0;
+    bool have_fmt = false;
+
+    memset(wav, 0, sizeof(*wav));
+    if (NULL == file)
+    {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return false;
+    }
+
+    if ((1u != fread(header, sizeof(header), 1, file)) ||
+        (0 != memcmp(header, "RIFF", 4)) || (0 != memcmp(header + 8, "WAVE", 4)))
+    {
+        fprintf(stderr, "%s is not a WAV file\n", path);
+        fclose(file);
+        return false;
+    }
+
+    while (1u == fread(chunk, sizeof(chunk), 1, file))
+    {
+        size = ae_host_read_u32(chunk + 4);
+
+        if ((0 == memcmp(chunk, "fmt ", 4)) && (size >= sizeof(fmt)))
+        {
+            if (1u != fread(fmt, sizeof(fmt), 1, file))
+            {
+                break;
+            }
+            if ((AE_HOST_WAV_FORMAT_PCM != ae_host_read_u16(fmt)) || (16u != ae_host_read_u16(fmt + 14)))
+            {
+                fprintf(stderr, "%s is not 16-bit PCM\n", path);
+                break;
+            }
+            wav->channels = ae_host_read_u16(fmt + 2);
+            wav->sample_rate = ae_host_read_u32(fmt + 4);
+            have_fmt = true;
+            size -= sizeof(fmt);
+        }
+        else if ((0 == memcmp(chunk, "data", 4)) && have_fmt && (0u != wav->channels))
+        {
+            wav->frames = size / (wav->channels * sizeof(int16_t));
+            wav->samples = malloc((size_t)wav->frames * wav->channels * sizeof(int16_t));
+            if ((NULL == wav->samples) ||
+                (wav->frames != fread(wav->samples, wav->channels * sizeof(int16_t), wav->frames, file)))
+            {
+                fprintf(stderr, "Cannot read the samples of %s\n", path);
+                free(wav->samples);
+                wav->samples = NULL;
+            }
+            break;
+        }
+
+        /* Chunks are padded to an even size */
+        if (0 != fseek(file, (long)(size + (size & 1u)), SEEK_CUR))
+        {
+            break;
+        }
+    }
+
+    fclose(file);
+    return (NULL != wav->samples);
+}
+
+/*******************************************************************************
+* Function Name: ae_host_wav_header
+********************************************************************************
+* Summary:
+*   Builds the header of a 16-bit PCM WAV file.
+*
+*******************************************************************************/
+static void ae_host_wav_header(uint8_t *header, uint32_t channels, uint32_t sample_rate,
+                               uint32_t data_bytes)
+{
+    memcpy(header, "RIFF", 4);
+    ae_host_write_u32(header + 4, (AE_HOST_WAV_HEADER_SIZE - 8u) + data_bytes);
+    memcpy(header + 8, "WAVEfmt ", 8);
+    ae_host_write_u32(header + 16, 16u);
+    ae_host_write_u16(header + 20, AE_HOST_WAV_FORMAT_PCM);
+    ae_host_write_u16(header + 22, channels);
+    ae_host_write_u32(header + 24, sample_rate);
+    ae_host_write_u32(header + 28, sample_rate * channels * sizeof(int16_t));
+    ae_host_write_u16(header + 32, channels * sizeof(int16_t));
+    ae_host_write_u16(header + 34, 16u);
+    memcpy(header + 36, "data", 4);
+    ae_host_write_u32(header + 40, data_bytes);
+}
+
+/*******************************************************************************
+* Function Name: ae_host_stage_add
+*******************************************************************************/
+static void ae_host_stage_add(ae_host_stage_id_t id, uint32_t ns)
+{
+    ae_host_stages[id].total_ns += ns;
+    if (ns > ae_host_stages[id].max_ns)
+    {
+        ae_host_stages[id].max_ns = ns;
+    }
+}
+
+/*******************************************************************************
+* Function Name: ae_host_usage
+*******************************************************************************/
+static void ae_host_usage(const char *name)
+{
+    printf("Usage: %s [-i input.wav] [-o output.wav] [-n frames] [-r usb_rate] [-a]\n"
+           "          [-l report_frames] [-p \"pipeline <settings>\"]\n"
+           "  -i  stereo 16-bit WAV at the pipeline rate (default %s)\n"
+           "  -o  WAV file with the USB IN channels (default %s)\n"
+           "  -n  process at most this many frames\n"
+           "  -r  USB microphone rate selected by the host, in Hz\n"
+           "  -a  send the raw input instead of the AE output (A/B switch)\n"
+           "  -l  frames between two latency reports, 0 for one at the end (default %u)\n"
+           "  -p  pipeline console command applied before streaming\n",
+           name, AE_HOST_DEFAULT_INPUT, AE_HOST_DEFAULT_OUTPUT,
+           (unsigned int)AE_HOST_LATENCY_REPORT_FRAMES);
+}
+
+/*******************************************************************************
+* Function Name: ae_host_print_report
+********************************************************************************
+* Summary:
+*   Prints the wall time of each stage, the frame copies and the throughput.
+*
+*******************************************************************************/
+static void ae_host_print_report(uint32_t frames, uint64_t wall_ns)
+{
+    const audio_pipeline_config_t *cfg = audio_pipeline_get_config();
+    ae_backend_stats_t backend;
+    ae_frame_copy_stats_t copies;
+    double audio_s = ((double)frames * cfg->frame_ms) / 1000.0;
+    double wall_s = (double)wall_ns / 1e9;
+
+    audio_enhancement_get_backend_stats(&backend);
+    ae_frame_copy_stats_get(&copies);
+
+    printf("\nStage          total ms   avg us/frame   max us\n");
+    for (uint32_t id = 0; id < AE_HOST_STAGE_COUNT; id++)
+    {
+        printf("%-12s %10.2f %14.2f %8.1f\n", ae_host_stages[id].name,
+                (double)ae_host_stages[id].total_ns / 1e6,
+                (frames != 0u) ? ((double)ae_host_stages[id].total_ns / AE_HOST_NS_PER_US) / frames : 0.0,
+                (double)ae_host_stages[id].max_ns / AE_HOST_NS_PER_US);
+    }
+
+    printf("\nBackend %s: %lu frames\n", (NULL != backend.backend_name) ? backend.backend_name : "none",
+            (unsigned long)backend.frames);
+    printf("Frame copies: %lu copies, %lu bytes for %lu frames (%.1f bytes/frame)\n",
+            (unsigned long)copies.copies, (unsigned long)copies.bytes, (unsigned long)copies.frames,
+            (copies.frames != 0u) ? (double)copies.bytes / copies.frames : 0.0);
+    printf("%lu frames (%.1f s of audio) in %.3f s: %.0f frames/s, %.1fx real time\n",
+            (unsigned long)frames, audio_s, wall_s,
+            (wall_s > 0.0) ? frames / wall_s : 0.0,
+            (wall_s > 0.0) ? audio_s / wall_s : 0.0);
+}
+
+/*******************************************************************************
+* Function Name: main
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    const audio_pipeline_config_t *cfg = audio_pipeline_get_config();
+    const char *input_path = AE_HOST_DEFAULT_INPUT;
+    const char *output_path = AE_HOST_DEFAULT_OUTPUT;
+    const char *command = NULL;
+    uint32_t usb_rate = AUDIO_IN_SAMPLE_FREQ;
+    uint32_t max_frames = UINT32_MAX;
+    uint32_t report_frames = AE_HOST_LATENCY_REPORT_FRAMES;
+    uint32_t frame_us = 0;
+    uint8_t header[AE_HOST_WAV_HEADER_SIZE];
+    ae_host_wav_t wav;
+    ae_backend_stats_t backend;
+    FILE *output = NULL;
+    uint64_t previous_backend_ns = 0;
+    uint64_t previous_output_ns = 0;
+    uint64_t wall_ns = 0;
+    uint32_t data_bytes = 0;
+    uint32_t frames = 0;
+    uint32_t start = 0;
+    uint32_t feed_ns = 0;
+    uint32_t pack_ns = 0;
+    uint32_t backend_ns = 0;
+    uint32_t output_ns = 0;
+    uint8_t *packet = NULL;
+    uint16_t length = 0;
+    int option;
+
+    while (-1 != (option = getopt(argc, argv, "i:o:n:r:al:p:h")))
+    {
+        switch (option)
+        {
+            case 'i': input_path = optarg; break;
+            case 'o': output_path = optarg; break;
+            case 'n': max_frames = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'r': usb_rate = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'a': ae_toggle_flag = false; break;
+            case 'l': report_frames = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'p': command = optarg; break;
+            default:
+                ae_host_usage(argv[0]);
+                return (option == 'h') ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    if (!ae_host_wav_read(input_path, &wav))
+    {
+        return EXIT_FAILURE;
+    }
+    if ((cfg->playback_channels != wav.channels) || (cfg->sample_rate_hz != wav.sample_rate))
+    {
+        fprintf(stderr, "%s must be %u channels at %lu Hz\n", input_path,
+                (unsigned int)cfg->playback_channels, (unsigned long)cfg->sample_rate_hz);
+        free(wav.samples);
+        return EXIT_FAILURE;
+    }
+
+    /* Same start-up order as the application */
+    (void)ae_frame_pool_init();
+    (void)ae_deadline_init();
+    (void)latency_trace_init();
+    if (CY_RSLT_SUCCESS != ae_pipeline_init())
+    {
+        fprintf(stderr, "Pipeline initialization failed\n");
+        free(wav.samples);
+        return EXIT_FAILURE;
+    }
+    usb_send_out_dbg_init_channels();
+    usb_send_out_dbg_set_sample_rate(usb_rate);
+
+    if ((NULL != command) && (CY_RSLT_SUCCESS != ae_pipeline_command(command)))
+    {
+        fprintf(stderr, "Pipeline command failed: %s\n", command);
+        free(wav.samples);
+        return EXIT_FAILURE;
+    }
+    if (AE_PIPELINE_INPUT_USB != ae_pipeline_get_config()->input_source)
+    {
+        fprintf(stderr, "The runner feeds the USB input, use source=usb\n");
+        free(wav.samples);
+        return EXIT_FAILURE;
+    }
+
+    output = fopen(output_path, "wb");
+    if (NULL == output)
+    {
+        fprintf(stderr, "Cannot create %s\n", output_path);
+        free(wav.samples);
+        return EXIT_FAILURE;
+    }
+    ae_host_wav_header(header, USB_OUT_NUM_CHANNELS, usb_rate, 0u);
+    (void)fwrite(header, sizeof(header), 1, output);
+
+    audio_enhancement_reset_backend_stats();
+    ae_frame_copy_stats_reset();
+
+    for (uint32_t offset = 0; ((offset + cfg->samples_per_frame) <= wav.frames) && (frames < max_frames);
+         offset += cfg->samples_per_frame)
+    {
+        /* Frames arrive in real time on the synthetic deadline and latency
+         * clocks, once their last sample was received. The USB IN packets
+         * then leave one per millisecond.
+         */
+        frame_us = (frames + 1u) * cfg->frame_ms * AE_HOST_US_PER_MS;
+        ae_deadline_set_clock_us(frame_us);
+        latency_trace_set_clock_us(frame_us);
+
+        start = DWT->CYCCNT;
+        ae_audio_data_feed_usb(&wav.samples[offset * wav.channels]);
+        feed_ns = DWT->CYCCNT - start;
+
+        start = DWT->CYCCNT;
+        for (uint32_t i = 0; i < AE_HOST_USB_PACKETS_PER_FRAME; i++)
+        {
+            latency_trace_set_clock_us(frame_us + (i * AE_HOST_US_PER_MS));
+            usb_send_out_dbg_callback(&packet, &length);
+            data_bytes += (uint32_t)fwrite(packet, 1, length, output);
+        }
+        pack_ns = DWT->CYCCNT - start;
+
+        /* The backend statistics count host nanoseconds */
+        audio_enhancement_get_backend_stats(&backend);
+        backend_ns = (uint32_t)(backend.total_cycles - previous_backend_ns);
+        output_ns = (uint32_t)(backend.output_cycles - previous_output_ns);
+        previous_backend_ns = backend.total_cycles;
+        previous_output_ns = backend.output_cycles;
+
+        ae_host_stage_add(AE_HOST_STAGE_FEED, feed_ns);
+        ae_host_stage_add(AE_HOST_STAGE_BACKEND, backend_ns);
+        ae_host_stage_add(AE_HOST_STAGE_OUTPUT, output_ns);
+        ae_host_stage_add(AE_HOST_STAGE_GLUE, feed_ns - backend_ns - output_ns);
+        ae_host_stage_add(AE_HOST_STAGE_USB_PACK, pack_ns);
+        wall_ns += (uint64_t)feed_ns + pack_ns;
+        frames++;
+
+        if ((0u != report_frames) && (0u == (frames % report_frames)))
+        {
+            latency_trace_print();
+        }
+    }
+
+    ae_host_wav_header(header, USB_OUT_NUM_CHANNELS, usb_rate, data_bytes);
+    (void)fseek(output, 0, SEEK_SET);
+    (void)fwrite(header, sizeof(header), 1, output);
+    fclose(output);
+    free(wav.samples);
+
+    if ((0u == report_frames) || (0u != (frames % report_frames)))
+    {
+        latency_trace_print();
+    }
+    (void)ae_pipeline_command("pipeline");
+    ae_host_print_report(frames, wall_ns);
+    printf("Wrote %lu samples per channel to %s\n",
+            (unsigned long)(data_bytes / (USB_OUT_NUM_CHANNELS * sizeof(int16_t))), output_path);
+
+    return (0u != frames) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* [] END OF FILE */
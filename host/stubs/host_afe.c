@@ -0,0 +1,206 @@
+/******************************************************************************
+* File Name : host_afe.c
+*
+* Description :
+* Host stub of the DEEPCRAFT(TM) Audio Front End middleware. It takes
+* its memory through the allocation callbacks like the middleware and
+* outputs the average of the mic channels of each frame, delayed like the
+* algorithmic delay of the middleware, so that the glue code around
+* cy_afe_feed can be run and timed on the host.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include <stdbool.h>
+#include "cy_audio_front_end.h"
+#include "cy_afe_configurator_settings.h"
+#include "audio_pipeline_config.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Memory requested per memory ID, in the order of cy_afe_mem_id_t */
+#define HOST_AFE_MEMORY_SIZES                   { 16u * 1024u, 8u * 1024u, 32u * 1024u, 32u * 1024u }
+
+#define HOST_AFE_FRAME_SAMPLES                  (AUDIO_PIPELINE_SAMPLES_PER_FRAME)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    cy_afe_config_t config;
+    void *memory[CY_AFE_MEM_ID_MAX];
+    int16_t delay_line[HOST_AFE_DELAY_SAMPLES + HOST_AFE_FRAME_SAMPLES];
+} host_afe_instance_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const uint32_t host_afe_memory_sizes[CY_AFE_MEM_ID_MAX] = HOST_AFE_MEMORY_SIZES;
+
+/* The middleware is used as a single instance */
+static host_afe_instance_t host_afe;
+static bool host_afe_created = false;
+
+/*******************************************************************************
+* Function Name: host_afe_free
+********************************************************************************
+* Summary:
+*   Returns the memory of the instance through the free callback.
+*
+*******************************************************************************/
+static void host_afe_free(void)
+{
+    for (uint32_t id = 0; id < CY_AFE_MEM_ID_MAX; id++)
+    {
+        if (NULL != host_afe.memory[id])
+        {
+            (void)host_afe.config.free_memory((cy_afe_mem_id_t)id, host_afe.memory[id]);
+            host_afe.memory[id] = NULL;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: cy_afe_create
+********************************************************************************
+* Summary:
+*   Creates the instance and takes its memory through the allocation
+*   callback.
+*
+*******************************************************************************/
+cy_rslt_t cy_afe_create(cy_afe_config_t *config, cy_afe_t *handle)
+{
+    if ((NULL == config) || (NULL == handle) || host_afe_created ||
+        (NULL == config->afe_get_buffer_callback) || (NULL == config->afe_output_callback) ||
+        (NULL == config->alloc_memory) || (NULL == config->free_memory))
+    {
+        return CY_RSLT_AFE_BAD_ARG;
+    }
+
+    memset(&host_afe, 0, sizeof(host_afe));
+    host_afe.config = *config;
+
+    for (uint32_t id = 0; id < CY_AFE_MEM_ID_MAX; id++)
+    {
+        if ((CY_RSLT_SUCCESS != config->alloc_memory((cy_afe_mem_id_t)id, host_afe_memory_sizes[id],
+                &host_afe.memory[id])) || (NULL == host_afe.memory[id]))
+        {
+            host_afe.memory[id] = NULL;
+            host_afe_free();
+            return CY_RSLT_AFE_OUT_OF_MEMORY;
+        }
+        memset(host_afe.memory[id], 0, host_afe_memory_sizes[id]);
+    }
+
+    host_afe_created = true;
+    *handle = &host_afe;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cy_afe_feed
+********************************************************************************
+* Summary:
+*   Processes one frame of AFE_INPUT_NUMBER_CHANNELS mic channels stored back
+*   to back. The output is the average of the channels, delayed by
+*   HOST_AFE_DELAY_SAMPLES, and is delivered through the output callback
+*   before returning.
+*
+*******************************************************************************/
+cy_rslt_t cy_afe_feed(cy_afe_t handle, int16_t *input, int16_t *aec_reference)
+{
+    cy_afe_buffer_info_t info = {0};
+    uint32_t *buffer = NULL;
+    int16_t *output = NULL;
+    int32_t sum = 0;
+
+    if ((&host_afe != handle) || !host_afe_created || (NULL == input))
+    {
+        return CY_RSLT_AFE_BAD_ARG;
+    }
+
+    if ((CY_RSLT_SUCCESS != host_afe.config.afe_get_buffer_callback(handle, &buffer,
+            host_afe.config.user_arg_callbacks)) || (NULL == buffer))
+    {
+        return CY_RSLT_AFE_OUT_OF_MEMORY;
+    }
+    output = (int16_t *)buffer;
+
+    for (uint32_t i = 0; i < HOST_AFE_FRAME_SAMPLES; i++)
+    {
+        sum = 0;
+        for (uint32_t ch = 0; ch < AFE_INPUT_NUMBER_CHANNELS; ch++)
+        {
+            sum += input[(ch * HOST_AFE_FRAME_SAMPLES) + i];
+        }
+        host_afe.delay_line[HOST_AFE_DELAY_SAMPLES + i] = (int16_t)(sum / AFE_INPUT_NUMBER_CHANNELS);
+    }
+    memcpy(output, host_afe.delay_line, HOST_AFE_FRAME_SAMPLES * sizeof(int16_t));
+    memmove(host_afe.delay_line, &host_afe.delay_line[HOST_AFE_FRAME_SAMPLES],
+            HOST_AFE_DELAY_SAMPLES * sizeof(int16_t));
+
+    info.input_buf = input;
+    info.input_aec_ref_buf = aec_reference;
+    info.output_buf = output;
+
+    return host_afe.config.afe_output_callback(handle, &info, host_afe.config.user_arg_callbacks);
+}
+
+/*******************************************************************************
+* Function Name: cy_afe_delete
+********************************************************************************
+* Summary:
+*   Deletes the instance and returns its memory.
+*
+*******************************************************************************/
+cy_rslt_t cy_afe_delete(cy_afe_t *handle)
+{
+    if ((NULL == handle) || (&host_afe != *handle) || !host_afe_created)
+    {
+        return CY_RSLT_AFE_BAD_ARG;
+    }
+
+    host_afe_free();
+    host_afe_created = false;
+    *handle = NULL;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,263 @@
+/******************************************************************************
+* File Name : host_freertos.c
+*
+* Description :
+* Single threaded host implementation of the FreeRTOS calls used by the
+* pipeline. Tasks are accepted but never run, the runner calls the
+* pipeline functions directly.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define HOST_TASK_MAX                           (16u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Header in front of every heap block, keeps the size for vPortFree */
+typedef union
+{
+    size_t size;
+    max_align_t alignment;
+} host_heap_header_t;
+
+typedef struct
+{
+    const char *name;
+    TaskFunction_t function;
+    void *arg;
+} host_task_entry_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Handle returned for every mutex, the host build never contends */
+static uint8_t host_mutex;
+
+/* Handle returned for every task */
+static uint8_t host_task;
+
+/* Tasks created so far, for the host programs that run one themselves */
+static host_task_entry_t host_tasks[HOST_TASK_MAX];
+static uint32_t host_task_count = 0;
+
+/* Bytes allocated with pvPortMalloc and not freed */
+static size_t host_heap_used = 0;
+
+/*******************************************************************************
+* Function Name: pvPortMalloc
+*******************************************************************************/
+void *pvPortMalloc(size_t size)
+{
+    host_heap_header_t *header;
+
+    if (size > (configTOTAL_HEAP_SIZE - host_heap_used))
+    {
+        return NULL;
+    }
+    header = malloc(sizeof(*header) + size);
+    if (NULL == header)
+    {
+        return NULL;
+    }
+    header->size = size;
+    host_heap_used += size;
+    return header + 1;
+}
+
+/*******************************************************************************
+* Function Name: vPortFree
+*******************************************************************************/
+void vPortFree(void *buffer)
+{
+    host_heap_header_t *header;
+
+    if (NULL != buffer)
+    {
+        header = (host_heap_header_t *)buffer - 1;
+        host_heap_used -= header->size;
+        free(header);
+    }
+}
+
+/*******************************************************************************
+* Function Name: xPortGetFreeHeapSize
+*******************************************************************************/
+size_t xPortGetFreeHeapSize(void)
+{
+    return configTOTAL_HEAP_SIZE - host_heap_used;
+}
+
+/*******************************************************************************
+* Function Name: xTaskCreate
+********************************************************************************
+* Summary:
+*   Accepts the task without running it. The task is recorded for
+*   host_task_find.
+*
+*******************************************************************************/
+BaseType_t xTaskCreate(TaskFunction_t task, const char *name, uint32_t stack_depth,
+                       void *arg, UBaseType_t priority, TaskHandle_t *handle)
+{
+    (void)stack_depth;
+    (void)priority;
+
+    if (host_task_count < HOST_TASK_MAX)
+    {
+        host_tasks[host_task_count].name = name;
+        host_tasks[host_task_count].function = task;
+        host_tasks[host_task_count].arg = arg;
+        host_task_count++;
+    }
+
+    if (NULL != handle)
+    {
+        *handle = &host_task;
+    }
+    return pdPASS;
+}
+
+/*******************************************************************************
+* Function Name: host_task_find
+********************************************************************************
+* Summary:
+*   Returns the function and argument of the last task created with 'name',
+*   or NULL if there is none.
+*
+*******************************************************************************/
+TaskFunction_t host_task_find(const char *name, void **arg)
+{
+    for (uint32_t i = host_task_count; i > 0u; i--)
+    {
+        if ((NULL != host_tasks[i - 1u].name) && (0 == strcmp(host_tasks[i - 1u].name, name)))
+        {
+            if (NULL != arg)
+            {
+                *arg = host_tasks[i - 1u].arg;
+            }
+            return host_tasks[i - 1u].function;
+        }
+    }
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: xTaskGetSchedulerState
+*******************************************************************************/
+BaseType_t xTaskGetSchedulerState(void)
+{
+    return taskSCHEDULER_NOT_STARTED;
+}
+
+/*******************************************************************************
+* Function Name: xTaskGetTickCount
+*******************************************************************************/
+TickType_t xTaskGetTickCount(void)
+{
+    return 0u;
+}
+
+/*******************************************************************************
+* Function Name: vTaskDelay
+*******************************************************************************/
+void vTaskDelay(TickType_t ticks)
+{
+    (void)ticks;
+}
+
+/*******************************************************************************
+* Function Name: ulTaskNotifyTake
+*******************************************************************************/
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks)
+{
+    (void)clear_on_exit;
+    (void)ticks;
+
+    return 0u;
+}
+
+/*******************************************************************************
+* Function Name: vTaskNotifyGiveFromISR
+*******************************************************************************/
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higher_priority_task_woken)
+{
+    (void)task;
+
+    if (NULL != higher_priority_task_woken)
+    {
+        *higher_priority_task_woken = pdFALSE;
+    }
+}
+
+/*******************************************************************************
+* Function Name: xSemaphoreCreateMutex
+*******************************************************************************/
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return &host_mutex;
+}
+
+/*******************************************************************************
+* Function Name: xSemaphoreTake
+*******************************************************************************/
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks)
+{
+    (void)semaphore;
+    (void)ticks;
+
+    return pdTRUE;
+}
+
+/*******************************************************************************
+* Function Name: xSemaphoreGive
+*******************************************************************************/
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+    (void)semaphore;
+
+    return pdTRUE;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,97 @@
+/******************************************************************************
+* File Name : host_pdl.c
+*
+* Description :
+* Host implementation of the PDL and CMSIS core symbols used by the
+* pipeline. The DWT cycle counter follows the host monotonic clock.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <time.h>
+#include "cy_pdl.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+uint32_t SystemCoreClock = HOST_CORE_CLOCK_HZ;
+CoreDebug_Type host_core_debug;
+
+static DWT_Type host_dwt_regs;
+
+/*******************************************************************************
+* Function Name: host_dwt
+********************************************************************************
+* Summary:
+*   Returns the DWT registers with CYCCNT updated to the host monotonic
+*   clock, one cycle per nanosecond. The counter wraps like the hardware
+*   counter, so differences of two reads are valid for about 4 s.
+*
+*******************************************************************************/
+DWT_Type *host_dwt(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    host_dwt_regs.CYCCNT = (uint32_t)(((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec);
+
+    return &host_dwt_regs;
+}
+
+/*******************************************************************************
+* Function Name: SystemCoreClockUpdate
+*******************************************************************************/
+void SystemCoreClockUpdate(void)
+{
+    SystemCoreClock = HOST_CORE_CLOCK_HZ;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SysLib_EnterCriticalSection
+*******************************************************************************/
+uint32_t Cy_SysLib_EnterCriticalSection(void)
+{
+    return 0u;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SysLib_ExitCriticalSection
+*******************************************************************************/
+void Cy_SysLib_ExitCriticalSection(uint32_t saved_intr_status)
+{
+    (void)saved_intr_status;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,93 @@
+/******************************************************************************
+* File Name : host_platform.c
+*
+* Description :
+* Host replacements of the firmware symbols the pipeline glue code uses
+* from modules that are not part of the host build: the application, the
+* PDM capture, the AFE tuner and the USB audio class tasks.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdbool.h>
+#include <stddef.h>
+#include "pdm_mic_interface.h"
+#include "audio_receive_task.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* ae_application.c: AE output selected on the USB channels */
+volatile bool ae_toggle_flag = true;
+
+/* app_afe_tuner.c: no bulk delay measurement in the host build */
+char *bdm_aec_ref_buffer = NULL;
+unsigned int bdm_aec_ref_len = 0;
+
+/*******************************************************************************
+* Function Name: is_audio_usb_send_out_data_from_device_started
+********************************************************************************
+* Summary:
+*   The host always streams the USB microphone.
+*
+*******************************************************************************/
+int is_audio_usb_send_out_data_from_device_started(void)
+{
+    return 1;
+}
+
+/*******************************************************************************
+* Function Name: audio_out_get_drift_ppm
+*******************************************************************************/
+float audio_out_get_drift_ppm(void)
+{
+    return 0.0f;
+}
+
+/*******************************************************************************
+* Function Name: pdm_mic_interface_start
+*******************************************************************************/
+void pdm_mic_interface_start(void)
+{
+}
+
+/*******************************************************************************
+* Function Name: pdm_mic_interface_stop
+*******************************************************************************/
+void pdm_mic_interface_stop(void)
+{
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,314 @@
+/******************************************************************************
+* File Name : host_uart.c
+*
+* Description :
+* Host implementation of the debug UART: the SCB UART FIFO functions on a
+* non-blocking file descriptor, and the interrupt controller functions for
+* its interrupt, which is run by host_uart_service.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <poll.h>
+#include <unistd.h>
+#include "cybsp.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* SCB FIFO depth in bytes */
+#define HOST_UART_FIFO_SIZE                     (64u)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+CySCB_Type host_debug_uart = { .fd = -1 };
+
+/* RX FIFO, refilled from the file descriptor once empty */
+static uint8_t host_uart_rx_fifo[HOST_UART_FIFO_SIZE];
+static uint32_t host_uart_rx_count = 0;
+static uint32_t host_uart_rx_pos = 0;
+
+static uint32_t host_uart_rx_mask = 0;
+static uint32_t host_uart_tx_mask = 0;
+
+static cy_israddress host_uart_isr = NULL;
+static bool host_uart_irq_enabled = false;
+
+/*******************************************************************************
+* Function Name: host_uart_attach
+********************************************************************************
+* Summary:
+*   Connects the debug UART to a non-blocking file descriptor and empties
+*   its FIFOs.
+*
+*******************************************************************************/
+void host_uart_attach(int fd)
+{
+    host_debug_uart.fd = fd;
+    host_uart_rx_count = 0;
+    host_uart_rx_pos = 0;
+}
+
+/*******************************************************************************
+* Function Name: host_uart_service
+********************************************************************************
+* Summary:
+*   Runs the UART interrupt handler once if the interrupt is enabled and a
+*   masked source is pending: received bytes, or the TX level while the TX
+*   interrupt is unmasked. Returns true if the handler ran.
+*
+*******************************************************************************/
+bool host_uart_service(void)
+{
+    if (!host_uart_irq_enabled || (NULL == host_uart_isr) ||
+        ((0u == Cy_SCB_GetRxInterruptStatusMasked(&host_debug_uart)) &&
+         (0u == Cy_SCB_GetTxInterruptStatusMasked(&host_debug_uart))))
+    {
+        return false;
+    }
+    host_uart_isr();
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SysInt_Init
+*******************************************************************************/
+cy_en_sysint_status_t Cy_SysInt_Init(const cy_stc_sysint_t *config, cy_israddress isr)
+{
+    if ((NULL == config) || (CYBSP_DEBUG_UART_IRQ != config->intrSrc))
+    {
+        return CY_SYSINT_BAD_PARAM;
+    }
+    host_uart_isr = isr;
+    return CY_SYSINT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: NVIC_EnableIRQ
+*******************************************************************************/
+void NVIC_EnableIRQ(IRQn_Type irq)
+{
+    if (CYBSP_DEBUG_UART_IRQ == irq)
+    {
+        host_uart_irq_enabled = true;
+    }
+}
+
+/*******************************************************************************
+* Function Name: NVIC_DisableIRQ
+*******************************************************************************/
+void NVIC_DisableIRQ(IRQn_Type irq)
+{
+    if (CYBSP_DEBUG_UART_IRQ == irq)
+    {
+        host_uart_irq_enabled = false;
+    }
+}
+
+/*******************************************************************************
+* Function Name: NVIC_ClearPendingIRQ
+*******************************************************************************/
+void NVIC_ClearPendingIRQ(IRQn_Type irq)
+{
+    (void)irq;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SCB_UART_GetNumInRxFifo
+********************************************************************************
+* Summary:
+*   Returns the bytes left in the RX FIFO, refilled from the file descriptor
+*   once it is empty.
+*
+*******************************************************************************/
+uint32_t Cy_SCB_UART_GetNumInRxFifo(CySCB_Type const *base)
+{
+    ssize_t count;
+
+    if ((host_uart_rx_pos == host_uart_rx_count) && (base->fd >= 0))
+    {
+        count = read(base->fd, host_uart_rx_fifo, sizeof(host_uart_rx_fifo));
+        host_uart_rx_count = (count > 0) ? (uint32_t)count : 0u;
+        host_uart_rx_pos = 0;
+    }
+    return host_uart_rx_count - host_uart_rx_pos;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SCB_UART_Get
+*******************************************************************************/
+uint32_t Cy_SCB_UART_Get(CySCB_Type const *base)
+{
+    (void)base;
+
+    if (host_uart_rx_pos == host_uart_rx_count)
+    {
+        return 0u;
+    }
+    return host_uart_rx_fifo[host_uart_rx_pos++];
+}
+
+/*******************************************************************************
+* Function Name: Cy_SCB_UART_PutArray
+********************************************************************************
+* Summary:
+*   Writes up to one FIFO of bytes to the file descriptor without blocking
+*   and returns the number of bytes taken.
+*
+*******************************************************************************/
+uint32_t Cy_SCB_UART_PutArray(CySCB_Type *base, void *buffer, uint32_t size)
+{
+    ssize_t count;
+
+    if (size > HOST_UART_FIFO_SIZE)
+    {
+        size = HOST_UART_FIFO_SIZE;
+    }
+    count = write(base->fd, buffer, size);
+    return (count > 0) ? (uint32_t)count : 0u;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SCB_GetFifoSize
+*******************************************************************************/
+uint32_t Cy_SCB_GetFifoSize(CySCB_Type const *base)
+{
+    (void)base;
+    return HOST_UART_FIFO_SIZE;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SCB_SetRxFifoLevel
+*******************************************************************************/
+void Cy_SCB_SetRxFifoLevel(CySCB_Type *base, uint32_t level)
+{
+    (void)base;
+    (void)level;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SCB_SetTxFifoLevel
+*******************************************************************************/
+void Cy_SCB_SetTxFifoLevel(CySCB_Type *base, uint32_t level)
+{
+    (void)base;
+    (void)level;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SCB_SetRxInterruptMask
+*******************************************************************************/
+void Cy_SCB_SetRxInterruptMask(CySCB_Type *base, uint32_t mask)
+{
+    (void)base;
+    host_uart_rx_mask = mask;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SCB_SetTxInterruptMask
+*******************************************************************************/
+void Cy_SCB_SetTxInterruptMask(CySCB_Type *base, uint32_t mask)
+{
+    (void)base;
+    host_uart_tx_mask = mask;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SCB_GetRxInterruptStatusMasked
+********************************************************************************
+* Summary:
+*   Reports the RX level interrupt while the FIFO or the file descriptor
+*   holds received bytes.
+*
+*******************************************************************************/
+uint32_t Cy_SCB_GetRxInterruptStatusMasked(CySCB_Type const *base)
+{
+    struct pollfd pending = { .fd = base->fd, .events = POLLIN };
+
+    if ((0u == (host_uart_rx_mask & CY_SCB_RX_INTR_LEVEL)) || (base->fd < 0))
+    {
+        return 0u;
+    }
+    if ((host_uart_rx_pos != host_uart_rx_count) ||
+        ((1 == poll(&pending, 1, 0)) && (0 != (pending.revents & POLLIN))))
+    {
+        return CY_SCB_RX_INTR_LEVEL;
+    }
+    return 0u;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SCB_GetTxInterruptStatusMasked
+********************************************************************************
+* Summary:
+*   Reports the TX level interrupt while it is unmasked and the file
+*   descriptor accepts data.
+*
+*******************************************************************************/
+uint32_t Cy_SCB_GetTxInterruptStatusMasked(CySCB_Type const *base)
+{
+    struct pollfd pending = { .fd = base->fd, .events = POLLOUT };
+
+    if ((0u == (host_uart_tx_mask & CY_SCB_TX_INTR_LEVEL)) || (base->fd < 0))
+    {
+        return 0u;
+    }
+    if ((1 == poll(&pending, 1, 0)) && (0 != (pending.revents & POLLOUT)))
+    {
+        return CY_SCB_TX_INTR_LEVEL;
+    }
+    return 0u;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SCB_ClearRxInterrupt
+*******************************************************************************/
+void Cy_SCB_ClearRxInterrupt(CySCB_Type *base, uint32_t mask)
+{
+    (void)base;
+    (void)mask;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SCB_ClearTxInterrupt
+*******************************************************************************/
+void Cy_SCB_ClearTxInterrupt(CySCB_Type *base, uint32_t mask)
+{
+    (void)base;
+    (void)mask;
+}
+
+/* [] END OF FILE */
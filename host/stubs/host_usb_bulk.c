@@ -0,0 +1,229 @@
+/******************************************************************************
+* File Name : host_usb_bulk.c
+*
+* Description :
+* Host stand-in of the emUSB-Device bulk class. The OUT endpoint is fed by
+* host_usb_bulk_send and the IN endpoint read by host_usb_bulk_read, so the
+* bulk transport task can run in a thread against a loopback host side.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <errno.h>
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+#include "USB_Bulk.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Bytes buffered per direction, more than the transport rings */
+#define HOST_USB_BULK_QUEUE_SIZE                (16384u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    uint8_t data[HOST_USB_BULK_QUEUE_SIZE];
+    uint32_t head;
+    uint32_t tail;
+} host_usb_bulk_queue_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static pthread_mutex_t host_usb_bulk_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t host_usb_bulk_out_ready = PTHREAD_COND_INITIALIZER;
+
+/* OUT: host to device, IN: device to host */
+static host_usb_bulk_queue_t host_usb_bulk_out;
+static host_usb_bulk_queue_t host_usb_bulk_in;
+
+static U8 host_usb_bulk_endpoints = 0;
+
+/*******************************************************************************
+* Function Name: host_usb_bulk_put
+********************************************************************************
+* Summary:
+*   Appends bytes to a queue, up to its free space. Called with the lock held.
+*
+*******************************************************************************/
+static uint32_t host_usb_bulk_put(host_usb_bulk_queue_t *queue, const uint8_t *data, uint32_t length)
+{
+    uint32_t count = 0;
+
+    while ((count < length) && ((queue->head - queue->tail) < HOST_USB_BULK_QUEUE_SIZE))
+    {
+        queue->data[queue->head % HOST_USB_BULK_QUEUE_SIZE] = data[count++];
+        queue->head++;
+    }
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: host_usb_bulk_get
+********************************************************************************
+* Summary:
+*   Takes up to 'size' bytes from a queue. Called with the lock held.
+*
+*******************************************************************************/
+static uint32_t host_usb_bulk_get(host_usb_bulk_queue_t *queue, uint8_t *buffer, uint32_t size)
+{
+    uint32_t count = 0;
+
+    while ((count < size) && (queue->tail != queue->head))
+    {
+        buffer[count++] = queue->data[queue->tail % HOST_USB_BULK_QUEUE_SIZE];
+        queue->tail++;
+    }
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: USBD_AddEPEx
+*******************************************************************************/
+U8 USBD_AddEPEx(const USB_ADD_EP_INFO *info, U8 *buffer, unsigned buffer_size)
+{
+    (void)info;
+    (void)buffer;
+    (void)buffer_size;
+
+    return ++host_usb_bulk_endpoints;
+}
+
+/*******************************************************************************
+* Function Name: USBD_IsConfigured
+*******************************************************************************/
+char USBD_IsConfigured(void)
+{
+    return 1;
+}
+
+/*******************************************************************************
+* Function Name: USBD_BULK_Add
+*******************************************************************************/
+USB_BULK_HANDLE USBD_BULK_Add(const USB_BULK_INIT_DATA *init_data)
+{
+    (void)init_data;
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: USBD_BULK_Receive
+********************************************************************************
+* Summary:
+*   Waits up to 'timeout_ms' for OUT data and returns what arrived, up to
+*   'num_bytes'. Returns 0 on timeout.
+*
+*******************************************************************************/
+int USBD_BULK_Receive(USB_BULK_HANDLE handle, void *data, unsigned num_bytes, int timeout_ms)
+{
+    struct timespec deadline;
+    uint32_t count;
+    int status = 0;
+
+    (void)handle;
+
+    (void)clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_nsec += (long)timeout_ms * 1000000L;
+    deadline.tv_sec += deadline.tv_nsec / 1000000000L;
+    deadline.tv_nsec %= 1000000000L;
+
+    pthread_mutex_lock(&host_usb_bulk_lock);
+    while ((host_usb_bulk_out.head == host_usb_bulk_out.tail) && (ETIMEDOUT != status))
+    {
+        status = pthread_cond_timedwait(&host_usb_bulk_out_ready, &host_usb_bulk_lock, &deadline);
+    }
+    count = host_usb_bulk_get(&host_usb_bulk_out, (uint8_t *)data, num_bytes);
+    pthread_mutex_unlock(&host_usb_bulk_lock);
+
+    return (int)count;
+}
+
+/*******************************************************************************
+* Function Name: USBD_BULK_Write
+********************************************************************************
+* Summary:
+*   Queues IN data for the host side. Returns the bytes taken, which are
+*   fewer than 'num_bytes' if the host side does not read.
+*
+*******************************************************************************/
+int USBD_BULK_Write(USB_BULK_HANDLE handle, const void *data, unsigned num_bytes, int timeout_ms)
+{
+    uint32_t count;
+
+    (void)handle;
+    (void)timeout_ms;
+
+    pthread_mutex_lock(&host_usb_bulk_lock);
+    count = host_usb_bulk_put(&host_usb_bulk_in, (const uint8_t *)data, num_bytes);
+    pthread_mutex_unlock(&host_usb_bulk_lock);
+
+    return (int)count;
+}
+
+/*******************************************************************************
+* Function Name: host_usb_bulk_send
+*******************************************************************************/
+uint32_t host_usb_bulk_send(const uint8_t *data, uint32_t length)
+{
+    uint32_t count;
+
+    pthread_mutex_lock(&host_usb_bulk_lock);
+    count = host_usb_bulk_put(&host_usb_bulk_out, data, length);
+    pthread_cond_signal(&host_usb_bulk_out_ready);
+    pthread_mutex_unlock(&host_usb_bulk_lock);
+
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: host_usb_bulk_read
+*******************************************************************************/
+uint32_t host_usb_bulk_read(uint8_t *buffer, uint32_t size)
+{
+    uint32_t count;
+
+    pthread_mutex_lock(&host_usb_bulk_lock);
+    count = host_usb_bulk_get(&host_usb_bulk_in, buffer, size);
+    pthread_mutex_unlock(&host_usb_bulk_lock);
+
+    return count;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,86 @@
+/******************************************************************************
+* File Name : FreeRTOS.h
+*
+* Description :
+* Host build stub of the FreeRTOS kernel. The host build is single
+* threaded: tasks are never scheduled and mutexes are always free.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __HOST_FREERTOS_H__
+#define __HOST_FREERTOS_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "cy_result.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define configMAX_PRIORITIES                    (7)
+#define configMINIMAL_STACK_SIZE                (128)
+#define configTICK_RATE_HZ                      (1000u)
+/* Nominal heap size, only used to report the free heap */
+#define configTOTAL_HEAP_SIZE                   (64u * 1024u * 1024u)
+
+#define pdFALSE                                 (0)
+#define pdTRUE                                  (1)
+#define pdFAIL                                  (pdFALSE)
+#define pdPASS                                  (pdTRUE)
+
+#define portMAX_DELAY                           (0xFFFFFFFFu)
+#define pdMS_TO_TICKS(ms)                       ((TickType_t)(((uint64_t)(ms) * configTICK_RATE_HZ) / 1000u))
+
+#define portYIELD_FROM_ISR(woken)               ((void)(woken))
+
+#define configRUN_TIME_COUNTER_TYPE             uint32_t
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+typedef uint32_t StackType_t;
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
+void *pvPortMalloc(size_t size);
+void vPortFree(void *buffer);
+size_t xPortGetFreeHeapSize(void);
+
+#endif /* __HOST_FREERTOS_H__ */
+
+/* [] END OF FILE */
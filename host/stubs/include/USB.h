@@ -0,0 +1,76 @@
+/******************************************************************************
+* File Name : USB.h
+*
+* Description :
+* Host stub of the emUSB-Device core API used by the tuner bulk transport.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __HOST_USB_H__
+#define __HOST_USB_H__
+
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define USB_DIR_IN                              (1u)
+#define USB_DIR_OUT                             (0u)
+
+#define USB_TRANSFER_TYPE_BULK                  (2u)
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+typedef uint8_t U8;
+typedef uint16_t U16;
+typedef uint32_t U32;
+
+typedef struct
+{
+    U16 Flags;
+    U8 InDir;
+    U8 Interval;
+    U16 MaxPacketSize;
+    U8 TransferType;
+} USB_ADD_EP_INFO;
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
+U8 USBD_AddEPEx(const USB_ADD_EP_INFO *info, U8 *buffer, unsigned buffer_size);
+char USBD_IsConfigured(void);
+
+#endif /* __HOST_USB_H__ */
+
+/* [] END OF FILE */
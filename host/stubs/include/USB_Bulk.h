@@ -0,0 +1,71 @@
+/******************************************************************************
+* File Name : USB_Bulk.h
+*
+* Description :
+* Host stub of the emUSB-Device bulk class. The bulk endpoints of the
+* device are looped back to the host side functions host_usb_bulk_*.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __HOST_USB_BULK_H__
+#define __HOST_USB_BULK_H__
+
+#include "USB.h"
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+typedef int USB_BULK_HANDLE;
+
+typedef struct
+{
+    U8 EPIn;
+    U8 EPOut;
+} USB_BULK_INIT_DATA;
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
+USB_BULK_HANDLE USBD_BULK_Add(const USB_BULK_INIT_DATA *init_data);
+int USBD_BULK_Receive(USB_BULK_HANDLE handle, void *data, unsigned num_bytes, int timeout_ms);
+int USBD_BULK_Write(USB_BULK_HANDLE handle, const void *data, unsigned num_bytes, int timeout_ms);
+
+/* Host side of the bulk endpoints: OUT transfers to the device and IN
+ * transfers from it, without blocking
+ */
+uint32_t host_usb_bulk_send(const uint8_t *data, uint32_t length);
+uint32_t host_usb_bulk_read(uint8_t *buffer, uint32_t size);
+
+#endif /* __HOST_USB_BULK_H__ */
+
+/* [] END OF FILE */
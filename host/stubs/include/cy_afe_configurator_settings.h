@@ -0,0 +1,64 @@
+/******************************************************************************
+* File Name : cy_afe_configurator_settings.h
+*
+* Description :
+* Host build stand-in for the AFE configurator output: stereo mics
+* fed from the USB speaker stream, so that the host runner replays a
+* recorded stream through the pipeline.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __HOST_CY_AFE_CONFIGURATOR_SETTINGS_H__
+#define __HOST_CY_AFE_CONFIGURATOR_SETTINGS_H__
+
+#define AFE_INPUT_SOURCE_MIC                    (0)
+#define AFE_INPUT_SOURCE_USB                    (1)
+
+#define AFE_INPUT_SOURCE                        (AFE_INPUT_SOURCE_USB)
+#define AFE_INPUT_NUMBER_CHANNELS               (2)
+#define AFE_CONFIG_BULK_DELAY                   (0)
+#define AFE_MIC_INPUT_GAIN_DB                   (0)
+#define AFE_USE_TARGET_SPEAKER                  (0)
+
+/* Filter and middleware settings blobs, unused by the stub middleware */
+#define AFE_FILTER_SETTINGS                     (NULL)
+#define AFE_MW_SETTINGS_SIZE                    (0)
+
+/* Delay of the stub middleware output against its input, in samples. Not a
+ * configurator setting, the real delay depends on the components enabled.
+ */
+#define HOST_AFE_DELAY_SAMPLES                  (72u)
+
+#endif /* __HOST_CY_AFE_CONFIGURATOR_SETTINGS_H__ */
+
+/* [] END OF FILE */
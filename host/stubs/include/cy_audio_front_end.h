@@ -0,0 +1,99 @@
+/******************************************************************************
+* File Name : cy_audio_front_end.h
+*
+* Description :
+* Host build stub of the DEEPCRAFT(TM) Audio Front End middleware
+* API. The stub takes its memory through the application callbacks and
+* outputs the mix of the mic channels, see host_afe.c.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __HOST_CY_AUDIO_FRONT_END_H__
+#define __HOST_CY_AUDIO_FRONT_END_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include "cy_result.h"
+#include "cy_audio_front_end_error.h"
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+typedef void *cy_afe_t;
+
+typedef enum
+{
+    CY_AFE_MEM_ID_ALGORITHM_PERSISTENT_MEMORY = 0,
+    CY_AFE_MEM_ID_ALGORITHM_SCRATCH_MEMORY,
+    CY_AFE_MEM_ID_ALGORITHM_NS_MEMORY,
+    CY_AFE_MEM_ID_ALGORITHM_ES_MEMORY,
+    CY_AFE_MEM_ID_MAX,
+} cy_afe_mem_id_t;
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    void *input_buf;
+    void *input_aec_ref_buf;
+    void *output_buf;
+} cy_afe_buffer_info_t;
+
+typedef cy_rslt_t (*cy_afe_get_buffer_callback_t)(cy_afe_t handle, uint32_t **output_buffer, void *user_arg);
+typedef cy_rslt_t (*cy_afe_output_callback_t)(cy_afe_t handle, cy_afe_buffer_info_t *output_buffer_info, void *user_arg);
+typedef cy_rslt_t (*cy_afe_alloc_memory_callback_t)(cy_afe_mem_id_t mem_id, uint32_t size, void **buffer);
+typedef cy_rslt_t (*cy_afe_free_memory_callback_t)(cy_afe_mem_id_t mem_id, void *buffer);
+
+typedef struct
+{
+    const void *filter_settings;
+    const void *mw_settings;
+    uint32_t mw_settings_length;
+    cy_afe_get_buffer_callback_t afe_get_buffer_callback;
+    cy_afe_output_callback_t afe_output_callback;
+    void *user_arg_callbacks;
+    cy_afe_alloc_memory_callback_t alloc_memory;
+    cy_afe_free_memory_callback_t free_memory;
+} cy_afe_config_t;
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
+cy_rslt_t cy_afe_create(cy_afe_config_t *config, cy_afe_t *handle);
+cy_rslt_t cy_afe_feed(cy_afe_t handle, int16_t *input, int16_t *aec_reference);
+cy_rslt_t cy_afe_delete(cy_afe_t *handle);
+
+#endif /* __HOST_CY_AUDIO_FRONT_END_H__ */
+
+/* [] END OF FILE */
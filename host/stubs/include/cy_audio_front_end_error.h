@@ -0,0 +1,50 @@
+/******************************************************************************
+* File Name : cy_audio_front_end_error.h
+*
+* Description :
+* Host build stub of the AFE middleware result codes
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __HOST_CY_AUDIO_FRONT_END_ERROR_H__
+#define __HOST_CY_AUDIO_FRONT_END_ERROR_H__
+
+#include "cy_result.h"
+
+#define CY_RSLT_AFE_FUNCTIONALITY_RESTRICTED    ((cy_rslt_t)0x0A000001U)
+#define CY_RSLT_AFE_BAD_ARG                     ((cy_rslt_t)0x0A000002U)
+#define CY_RSLT_AFE_OUT_OF_MEMORY               ((cy_rslt_t)0x0A000003U)
+
+#endif /* __HOST_CY_AUDIO_FRONT_END_ERROR_H__ */
+
+/* [] END OF FILE */
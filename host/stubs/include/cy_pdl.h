@@ -0,0 +1,146 @@
+/******************************************************************************
+* File Name : cy_pdl.h
+*
+* Description :
+* Host build stub of the peripheral driver library. The DWT cycle
+* counter reads the host monotonic clock in nanoseconds, so cycle counts
+* of the firmware statistics are nanoseconds at a 1 GHz core clock.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __HOST_CY_PDL_H__
+#define __HOST_CY_PDL_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_result.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Core clock of the host build, one cycle per nanosecond */
+#define HOST_CORE_CLOCK_HZ                      (1000000000u)
+
+#define __STATIC_INLINE                         static inline
+
+#define CY_UNUSED_PARAMETER(x)                  ((void)(x))
+#define CY_ASSERT(x)                            ((void)(x))
+
+#define CoreDebug_DEMCR_TRCENA_Msk              (1u << 24)
+#define DWT_CTRL_CYCCNTENA_Msk                  (1u << 0)
+
+#define DWT                                     (host_dwt())
+#define CoreDebug                               (&host_core_debug)
+
+/* SCB UART interrupt sources used by the drivers */
+#define CY_SCB_RX_INTR_LEVEL                    (1u << 0)
+#define CY_SCB_RX_INTR_MASK                     (0xFFFu)
+#define CY_SCB_TX_INTR_LEVEL                    (1u << 0)
+#define CY_SCB_TX_INTR_MASK                     (0xFFFu)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+    volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+typedef int32_t IRQn_Type;
+typedef void (*cy_israddress)(void);
+
+typedef struct
+{
+    IRQn_Type intrSrc;
+    uint32_t intrPriority;
+} cy_stc_sysint_t;
+
+typedef enum
+{
+    CY_SYSINT_SUCCESS = 0,
+    CY_SYSINT_BAD_PARAM = 1,
+} cy_en_sysint_status_t;
+
+/* SCB block, backed by a file descriptor on the host */
+typedef struct
+{
+    int fd;
+} CySCB_Type;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern uint32_t SystemCoreClock;
+extern CoreDebug_Type host_core_debug;
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
+DWT_Type *host_dwt(void);
+void SystemCoreClockUpdate(void);
+uint32_t Cy_SysLib_EnterCriticalSection(void);
+void Cy_SysLib_ExitCriticalSection(uint32_t saved_intr_status);
+
+cy_en_sysint_status_t Cy_SysInt_Init(const cy_stc_sysint_t *config, cy_israddress isr);
+void NVIC_EnableIRQ(IRQn_Type irq);
+void NVIC_DisableIRQ(IRQn_Type irq);
+void NVIC_ClearPendingIRQ(IRQn_Type irq);
+
+uint32_t Cy_SCB_UART_GetNumInRxFifo(CySCB_Type const *base);
+uint32_t Cy_SCB_UART_Get(CySCB_Type const *base);
+uint32_t Cy_SCB_UART_PutArray(CySCB_Type *base, void *buffer, uint32_t size);
+uint32_t Cy_SCB_GetFifoSize(CySCB_Type const *base);
+void Cy_SCB_SetRxFifoLevel(CySCB_Type *base, uint32_t level);
+void Cy_SCB_SetTxFifoLevel(CySCB_Type *base, uint32_t level);
+void Cy_SCB_SetRxInterruptMask(CySCB_Type *base, uint32_t mask);
+void Cy_SCB_SetTxInterruptMask(CySCB_Type *base, uint32_t mask);
+uint32_t Cy_SCB_GetRxInterruptStatusMasked(CySCB_Type const *base);
+uint32_t Cy_SCB_GetTxInterruptStatusMasked(CySCB_Type const *base);
+void Cy_SCB_ClearRxInterrupt(CySCB_Type *base, uint32_t mask);
+void Cy_SCB_ClearTxInterrupt(CySCB_Type *base, uint32_t mask);
+
+/* Connects the debug UART to a file descriptor, a pseudo-terminal in the
+ * tests, and runs its interrupt handler while the UART has work for it.
+ */
+void host_uart_attach(int fd);
+bool host_uart_service(void);
+
+#endif /* __HOST_CY_PDL_H__ */
+
+/* [] END OF FILE */
@@ -0,0 +1,104 @@
+/******************************************************************************
+* File Name : host_test.h
+*
+* Description :
+* Minimal assertion helpers for the host unit tests. Each test is a
+* C executable that returns a non-zero status on the first failure.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __HOST_TEST_H__
+#define __HOST_TEST_H__
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define HOST_TEST_FAIL(...)                                                   \
+    do                                                                        \
+    {                                                                         \
+        fprintf(stderr, "%s:%d: ", __FILE__, __LINE__);                       \
+        fprintf(stderr, __VA_ARGS__);                                         \
+        fprintf(stderr, "\n");                                                \
+        exit(EXIT_FAILURE);                                                   \
+    } while (0)
+
+#define HOST_TEST_CHECK(cond)                                                 \
+    do                                                                        \
+    {                                                                         \
+        if (!(cond))                                                          \
+        {                                                                     \
+            HOST_TEST_FAIL("check failed: %s", #cond);                        \
+        }                                                                     \
+    } while (0)
+
+#define HOST_TEST_EQUAL(actual, expected)                                     \
+    do                                                                        \
+    {                                                                         \
+        long long host_test_a = (long long)(actual);                          \
+        long long host_test_e = (long long)(expected);                        \
+        if (host_test_a != host_test_e)                                       \
+        {                                                                     \
+            HOST_TEST_FAIL("%s == %lld, expected %lld", #actual,              \
+                           host_test_a, host_test_e);                         \
+        }                                                                     \
+    } while (0)
+
+#define HOST_TEST_NEAR(actual, expected, tolerance)                           \
+    do                                                                        \
+    {                                                                         \
+        double host_test_a = (double)(actual);                                \
+        double host_test_e = (double)(expected);                              \
+        if (fabs(host_test_a - host_test_e) > (double)(tolerance))            \
+        {                                                                     \
+            HOST_TEST_FAIL("%s == %g, expected %g +/- %g", #actual,           \
+                           host_test_a, host_test_e, (double)(tolerance));    \
+        }                                                                     \
+    } while (0)
+
+#define HOST_TEST_RUN(test)                                                   \
+    do                                                                        \
+    {                                                                         \
+        test();                                                               \
+        printf("PASS %s\n", #test);                                           \
+    } while (0)
+
+#endif /* __HOST_TEST_H__ */
+
+/* [] END OF FILE */
@@ -0,0 +1,196 @@
+/******************************************************************************
+* File Name : arm_mve.h
+*
+* Description :
+* Host emulation of the MVE intrinsics used by audio_conv_utils.c and
+* audio_resampler.c, so that the vector kernels can be checked against a
+* scalar reference on a PC.
+* Every intrinsic call increments host_mve_ops.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __HOST_ARM_MVE_H__
+#define __HOST_ARM_MVE_H__
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define HOST_MVE_LANES                          (8u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    uint16_t lane[HOST_MVE_LANES];
+} uint16x8_t;
+
+typedef struct
+{
+    int16_t lane[HOST_MVE_LANES];
+} int16x8_t;
+
+typedef struct
+{
+    uint16x8_t val[2];
+} uint16x8x2_t;
+
+typedef struct
+{
+    uint16x8_t val[4];
+} uint16x8x4_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Number of emulated intrinsic calls, lets a test check the vector path ran */
+extern uint32_t host_mve_ops;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+static inline uint16x8_t vld1q_u16(const uint16_t *base)
+{
+    uint16x8_t v;
+    uint32_t i;
+
+    host_mve_ops++;
+    for (i = 0; i < HOST_MVE_LANES; i++)
+    {
+        v.lane[i] = base[i];
+    }
+    return v;
+}
+
+static inline void vst1q_u16(uint16_t *base, uint16x8_t v)
+{
+    uint32_t i;
+
+    host_mve_ops++;
+    for (i = 0; i < HOST_MVE_LANES; i++)
+    {
+        base[i] = v.lane[i];
+    }
+}
+
+static inline uint16x8x2_t vld2q_u16(const uint16_t *base)
+{
+    uint16x8x2_t v;
+    uint32_t i;
+
+    host_mve_ops++;
+    for (i = 0; i < HOST_MVE_LANES; i++)
+    {
+        v.val[0].lane[i] = base[2u * i];
+        v.val[1].lane[i] = base[(2u * i) + 1u];
+    }
+    return v;
+}
+
+static inline void vst2q_u16(uint16_t *base, uint16x8x2_t v)
+{
+    uint32_t i;
+
+    host_mve_ops++;
+    for (i = 0; i < HOST_MVE_LANES; i++)
+    {
+        base[2u * i] = v.val[0].lane[i];
+        base[(2u * i) + 1u] = v.val[1].lane[i];
+    }
+}
+
+static inline uint16x8x4_t vld4q_u16(const uint16_t *base)
+{
+    uint16x8x4_t v;
+    uint32_t i;
+    uint32_t ch;
+
+    host_mve_ops++;
+    for (i = 0; i < HOST_MVE_LANES; i++)
+    {
+        for (ch = 0; ch < 4u; ch++)
+        {
+            v.val[ch].lane[i] = base[(4u * i) + ch];
+        }
+    }
+    return v;
+}
+
+static inline void vst4q_u16(uint16_t *base, uint16x8x4_t v)
+{
+    uint32_t i;
+    uint32_t ch;
+
+    host_mve_ops++;
+    for (i = 0; i < HOST_MVE_LANES; i++)
+    {
+        for (ch = 0; ch < 4u; ch++)
+        {
+            base[(4u * i) + ch] = v.val[ch].lane[i];
+        }
+    }
+}
+
+static inline int16x8_t vld1q_s16(const int16_t *base)
+{
+    int16x8_t v;
+    uint32_t i;
+
+    host_mve_ops++;
+    for (i = 0; i < HOST_MVE_LANES; i++)
+    {
+        v.lane[i] = base[i];
+    }
+    return v;
+}
+
+static inline int64_t vmlaldavaq_s16(int64_t acc, int16x8_t a, int16x8_t b)
+{
+    uint32_t i;
+
+    host_mve_ops++;
+    for (i = 0; i < HOST_MVE_LANES; i++)
+    {
+        acc += (int32_t)a.lane[i] * b.lane[i];
+    }
+    return acc;
+}
+
+#endif /* __HOST_ARM_MVE_H__ */
+
+/* [] END OF FILE */
@@ -0,0 +1,265 @@
+/******************************************************************************
+* File Name : test_ae_arena.c
+*
+* Description :
+* Host tests of the AFE memory arena and its placement policy.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "host_test.h"
+#include "ae_arena.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const ae_arena_placement_t test_dtcm_then_heap =
+{
+    .mem_id = 0,
+    .name = "dtcm-heap",
+    .alignment = 0,
+    .tiers = { AE_ARENA_TIER_DTCM, AE_ARENA_TIER_HEAP, AE_ARENA_TIER_NONE },
+};
+
+static const ae_arena_placement_t test_dtcm_only_64 =
+{
+    .mem_id = 1,
+    .name = "dtcm-64",
+    .alignment = 64u,
+    .tiers = { AE_ARENA_TIER_DTCM, AE_ARENA_TIER_NONE, AE_ARENA_TIER_NONE },
+};
+
+static const ae_arena_placement_t test_socmem_then_heap =
+{
+    .mem_id = 2,
+    .name = "socmem-heap",
+    .alignment = 0,
+    .tiers = { AE_ARENA_TIER_SOCMEM, AE_ARENA_TIER_HEAP, AE_ARENA_TIER_NONE },
+};
+
+static const ae_arena_placement_t test_bad_alignment =
+{
+    .mem_id = 3,
+    .name = "bad-alignment",
+    .alignment = 24u,
+    .tiers = { AE_ARENA_TIER_DTCM, AE_ARENA_TIER_NONE, AE_ARENA_TIER_NONE },
+};
+
+/*******************************************************************************
+* Function Name: tier_used
+********************************************************************************
+* Summary:
+* Returns the bytes allocated in a tier.
+*
+*******************************************************************************/
+static uint32_t tier_used(ae_arena_tier_t tier)
+{
+    ae_arena_tier_stats_t stats;
+
+    ae_arena_get_stats(tier, &stats);
+    return stats.used;
+}
+
+static void test_alignment_and_zeroing(void)
+{
+    uint8_t *a;
+    uint8_t *b;
+    uint32_t i;
+
+    HOST_TEST_EQUAL(ae_arena_init(), CY_RSLT_SUCCESS);
+    /* Init is idempotent */
+    HOST_TEST_EQUAL(ae_arena_init(), CY_RSLT_SUCCESS);
+
+    a = ae_arena_alloc(&test_dtcm_then_heap, 10u);
+    b = ae_arena_alloc(&test_dtcm_only_64, 100u);
+    HOST_TEST_CHECK((NULL != a) && (NULL != b));
+    HOST_TEST_EQUAL((uintptr_t)a % AE_ARENA_DEFAULT_ALIGNMENT, 0);
+    HOST_TEST_EQUAL((uintptr_t)b % 64u, 0);
+    HOST_TEST_CHECK(b >= (a + 10));
+    for (i = 0; i < 100u; i++)
+    {
+        HOST_TEST_EQUAL(b[i], 0);
+    }
+
+    ae_arena_free(a);
+    HOST_TEST_CHECK(0u != tier_used(AE_ARENA_TIER_DTCM));
+    ae_arena_free(b);
+    /* The region rewinds once its last block is freed */
+    HOST_TEST_EQUAL(tier_used(AE_ARENA_TIER_DTCM), 0);
+}
+
+static void test_invalid_requests(void)
+{
+    ae_arena_tier_stats_t stats;
+    void *empty;
+
+    empty = ae_arena_alloc(&test_dtcm_then_heap, 0u);
+    HOST_TEST_CHECK(NULL != empty);
+    ae_arena_free(empty);
+    HOST_TEST_CHECK(NULL == ae_arena_alloc(NULL, 16u));
+    HOST_TEST_CHECK(NULL == ae_arena_alloc(&test_bad_alignment, 16u));
+    HOST_TEST_CHECK(NULL == ae_arena_alloc(&test_dtcm_only_64, AE_ARENA_DTCM_SIZE + 1u));
+
+    /* Unknown pointers are ignored */
+    ae_arena_free(&stats);
+    ae_arena_get_stats(AE_ARENA_TIER_DTCM, &stats);
+    HOST_TEST_EQUAL(stats.blocks, 0);
+    HOST_TEST_EQUAL(stats.size, AE_ARENA_DTCM_SIZE);
+}
+
+static void test_fallback_to_heap(void)
+{
+    ae_arena_tier_stats_t stats;
+    void *dtcm;
+    void *heap;
+    void *socmem;
+
+    /* Fill most of DTCM so that the next request falls back to the heap */
+    dtcm = ae_arena_alloc(&test_dtcm_then_heap, AE_ARENA_DTCM_SIZE - 64u);
+    HOST_TEST_CHECK(NULL != dtcm);
+    heap = ae_arena_alloc(&test_dtcm_then_heap, 1024u);
+    HOST_TEST_CHECK(NULL != heap);
+    HOST_TEST_EQUAL((uintptr_t)heap % AE_ARENA_DEFAULT_ALIGNMENT, 0);
+
+    ae_arena_get_stats(AE_ARENA_TIER_HEAP, &stats);
+    HOST_TEST_EQUAL(stats.used, 1024);
+    HOST_TEST_EQUAL(stats.blocks, 1);
+
+    /* The SOCMem tier is disabled by default, the heap takes over */
+    socmem = ae_arena_alloc(&test_socmem_then_heap, 256u);
+    HOST_TEST_CHECK(NULL != socmem);
+    HOST_TEST_EQUAL(tier_used(AE_ARENA_TIER_SOCMEM), 0);
+    HOST_TEST_EQUAL(tier_used(AE_ARENA_TIER_HEAP), 1024u + 256u);
+
+    ae_arena_free(heap);
+    ae_arena_free(socmem);
+    ae_arena_free(dtcm);
+    ae_arena_get_stats(AE_ARENA_TIER_HEAP, &stats);
+    HOST_TEST_EQUAL(stats.used, 0);
+    HOST_TEST_EQUAL(stats.high_water, 1024u + 256u);
+    HOST_TEST_EQUAL(tier_used(AE_ARENA_TIER_DTCM), 0);
+}
+
+static void test_block_records_exhausted(void)
+{
+    void *blocks[AE_ARENA_MAX_BLOCKS];
+    uint32_t i;
+
+    for (i = 0; i < AE_ARENA_MAX_BLOCKS; i++)
+    {
+        blocks[i] = ae_arena_alloc(&test_dtcm_then_heap, 32u);
+        HOST_TEST_CHECK(NULL != blocks[i]);
+    }
+    HOST_TEST_CHECK(NULL == ae_arena_alloc(&test_dtcm_then_heap, 32u));
+
+    for (i = 0; i < AE_ARENA_MAX_BLOCKS; i++)
+    {
+        ae_arena_free(blocks[i]);
+    }
+    HOST_TEST_EQUAL(tier_used(AE_ARENA_TIER_DTCM), 0);
+}
+
+/*******************************************************************************
+* Function Name: test_recreate_does_not_fragment
+********************************************************************************
+* Summary:
+* Allocating the blocks of an AFE instance and freeing them in another order,
+* as a create/destroy cycle does, returns the same addresses every time and
+* leaves DTCM empty with an unchanged high-water mark.
+*
+*******************************************************************************/
+static void test_recreate_does_not_fragment(void)
+{
+    static const uint32_t sizes[] = { 16384u, 8192u, 1000u, 3u, 4096u, 777u };
+    static const uint32_t free_order[] = { 2u, 0u, 5u, 3u, 1u, 4u };
+    const ae_arena_placement_t *placement;
+    void *first[sizeof(sizes) / sizeof(sizes[0])];
+    void *blocks[sizeof(sizes) / sizeof(sizes[0])];
+    ae_arena_tier_stats_t stats;
+    uint32_t high_water;
+    uint32_t cycle;
+    uint32_t i;
+
+    ae_arena_get_stats(AE_ARENA_TIER_DTCM, &stats);
+    high_water = stats.high_water;
+
+    for (cycle = 0; cycle < 1000u; cycle++)
+    {
+        for (i = 0; i < (sizeof(sizes) / sizeof(sizes[0])); i++)
+        {
+            placement = (0u != (i & 1u)) ? &test_dtcm_only_64 : &test_dtcm_then_heap;
+            blocks[i] = ae_arena_alloc(placement, sizes[i]);
+            HOST_TEST_CHECK(NULL != blocks[i]);
+            if (0u == cycle)
+            {
+                first[i] = blocks[i];
+            }
+            else if (blocks[i] != first[i])
+            {
+                HOST_TEST_FAIL("block %u moved in cycle %u", (unsigned)i, (unsigned)cycle);
+            }
+        }
+        if (0u == cycle)
+        {
+            ae_arena_get_stats(AE_ARENA_TIER_DTCM, &stats);
+            high_water = stats.high_water;
+        }
+
+        for (i = 0; i < (sizeof(free_order) / sizeof(free_order[0])); i++)
+        {
+            ae_arena_free(blocks[free_order[i]]);
+        }
+        ae_arena_get_stats(AE_ARENA_TIER_DTCM, &stats);
+        HOST_TEST_EQUAL(stats.used, 0);
+        HOST_TEST_EQUAL(stats.blocks, 0);
+    }
+
+    ae_arena_get_stats(AE_ARENA_TIER_DTCM, &stats);
+    HOST_TEST_EQUAL(stats.high_water, high_water);
+    HOST_TEST_EQUAL(tier_used(AE_ARENA_TIER_HEAP), 0);
+}
+
+int main(void)
+{
+    HOST_TEST_RUN(test_alignment_and_zeroing);
+    HOST_TEST_RUN(test_invalid_requests);
+    HOST_TEST_RUN(test_fallback_to_heap);
+    HOST_TEST_RUN(test_block_records_exhausted);
+    HOST_TEST_RUN(test_recreate_does_not_fragment);
+    return 0;
+}
+
+/* [] END OF FILE */
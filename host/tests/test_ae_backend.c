@@ -0,0 +1,152 @@
+/******************************************************************************
+* File Name : test_ae_backend.c
+*
+* Description :
+* Host tests of the per-frame cycle statistics of every AE backend. On the
+* host the cycle counter counts nanoseconds.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "host_test.h"
+#include "ae_pipeline.h"
+#include "ae_backend.h"
+#include "ae_frame_pool.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TEST_FRAMES                     (200u)
+#define TEST_CHANNELS                   (2u)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static ae_frame_t test_frame;
+
+/*******************************************************************************
+* Function Name: run_backend
+********************************************************************************
+* Summary:
+* Switches the pipeline to 'backend', feeds TEST_FRAMES frames of noise and
+* returns the backend statistics.
+*
+*******************************************************************************/
+static void run_backend(const ae_backend_t *backend, ae_backend_stats_t *stats)
+{
+    ae_pipeline_config_t config = *ae_pipeline_get_config();
+    uint32_t seed = 1u;
+    uint64_t last_cycles_sum = 0;
+
+    config.backend = backend;
+    config.num_channels = TEST_CHANNELS;
+    HOST_TEST_EQUAL(ae_pipeline_reconfigure(&config), CY_RSLT_SUCCESS);
+    HOST_TEST_CHECK(backend == audio_enhancement_get_backend());
+
+    audio_enhancement_reset_backend_stats();
+    for (uint32_t frame = 0; frame < TEST_FRAMES; frame++)
+    {
+        for (uint32_t i = 0; i < (sizeof(test_frame.mic) / sizeof(test_frame.mic[0])); i++)
+        {
+            seed = (seed * 1664525u) + 1013904223u;
+            test_frame.mic[i] = (int16_t)(seed >> 20);
+        }
+        test_frame.aec_reference = NULL;
+        HOST_TEST_EQUAL(audio_enhancement_feed_input(&test_frame), AE_RSLT_SUCCESS);
+
+        audio_enhancement_get_backend_stats(stats);
+        last_cycles_sum += stats->last_cycles;
+    }
+
+    HOST_TEST_CHECK(0 == strcmp(stats->backend_name, backend->name));
+    HOST_TEST_EQUAL(stats->frames, TEST_FRAMES);
+    HOST_TEST_EQUAL(stats->total_cycles, last_cycles_sum);
+    HOST_TEST_CHECK(stats->max_cycles <= stats->total_cycles);
+    HOST_TEST_CHECK((uint64_t)stats->max_cycles * TEST_FRAMES >= stats->total_cycles);
+    /* Every backend hands its frames to the output callback */
+    HOST_TEST_CHECK(0u != stats->output_cycles);
+
+    printf("%-12s %10.0f cycles/frame, max %lu, output %.0f cycles/frame\n", backend->name,
+           (double)stats->total_cycles / stats->frames, (unsigned long)stats->max_cycles,
+           (double)stats->output_cycles / stats->frames);
+}
+
+/*******************************************************************************
+* Function Name: test_every_backend_reports_cycles
+********************************************************************************
+* Summary:
+* Every backend counts its frames and cycles in the common statistics, apart
+* from the cycles of the output callback.
+*
+*******************************************************************************/
+static void test_every_backend_reports_cycles(void)
+{
+    ae_backend_stats_t stats;
+
+    run_backend(&ae_backend_passthrough, &stats);
+    run_backend(&ae_backend_reference, &stats);
+    run_backend(&ae_backend_deepcraft, &stats);
+}
+
+/*******************************************************************************
+* Function Name: test_reference_costs_more_than_passthrough
+********************************************************************************
+* Summary:
+* The reference NS/AEC takes more cycles per frame than the passthrough copy,
+* so the statistics tell the algorithm cost apart from the glue.
+*
+*******************************************************************************/
+static void test_reference_costs_more_than_passthrough(void)
+{
+    ae_backend_stats_t passthrough;
+    ae_backend_stats_t reference;
+
+    run_backend(&ae_backend_passthrough, &passthrough);
+    run_backend(&ae_backend_reference, &reference);
+    HOST_TEST_CHECK(reference.total_cycles > passthrough.total_cycles);
+}
+
+int main(void)
+{
+    HOST_TEST_EQUAL(ae_frame_pool_init(), CY_RSLT_SUCCESS);
+    HOST_TEST_EQUAL(ae_pipeline_init(), CY_RSLT_SUCCESS);
+
+    HOST_TEST_RUN(test_every_backend_reports_cycles);
+    HOST_TEST_RUN(test_reference_costs_more_than_passthrough);
+    return 0;
+}
+
+/* [] END OF FILE */
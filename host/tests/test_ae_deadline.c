@@ -0,0 +1,270 @@
+/******************************************************************************
+* File Name : test_ae_deadline.c
+*
+* Description :
+* Host tests of the frame deadline tracking on the synthetic clock.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "host_test.h"
+#include "ae_deadline.h"
+#include "audio_pipeline_config.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Time a frame may take from its capture, in microseconds */
+#define TEST_BUDGET_US                  (((AUDIO_PIPELINE_FRAME_MS * 1000u) * AE_DEADLINE_BUDGET_PERCENT) / 100u)
+
+/*******************************************************************************
+* Function Name: capture
+********************************************************************************
+* Summary:
+* Captures a frame with the given sequence number at time now_us.
+*
+*******************************************************************************/
+static void capture(ae_frame_t *frame, uint32_t sequence, uint32_t now_us)
+{
+    memset(frame, 0, sizeof(*frame));
+    frame->sequence = sequence;
+    ae_deadline_set_clock_us(now_us);
+    ae_deadline_captured(frame);
+}
+
+/*******************************************************************************
+* Function Name: begin_at
+********************************************************************************
+* Summary:
+* Starts the processing of a frame at time now_us.
+*
+*******************************************************************************/
+static ae_deadline_action_t begin_at(const ae_frame_t *frame, uint32_t now_us)
+{
+    ae_deadline_set_clock_us(now_us);
+    return ae_deadline_begin(frame);
+}
+
+/*******************************************************************************
+* Function Name: complete_at
+********************************************************************************
+* Summary:
+* Completes a frame at time now_us.
+*
+*******************************************************************************/
+static void complete_at(const ae_frame_t *frame, uint32_t now_us)
+{
+    ae_deadline_set_clock_us(now_us);
+    ae_deadline_complete(frame);
+}
+
+/*******************************************************************************
+* Function Name: test_default_policy_processes_late_frames
+********************************************************************************
+* Summary:
+* Late frames are processed unless a policy is selected, so that the AE
+* sees every frame.
+*
+*******************************************************************************/
+static void test_default_policy_processes_late_frames(void)
+{
+    ae_frame_t frame;
+    ae_deadline_stats_t stats;
+
+    HOST_TEST_EQUAL(ae_deadline_init(), CY_RSLT_SUCCESS);
+    HOST_TEST_EQUAL(ae_deadline_get_policy(), AE_DEADLINE_POLICY_NONE);
+
+    capture(&frame, 0u, 1000u);
+    HOST_TEST_EQUAL(begin_at(&frame, 1000u + TEST_BUDGET_US + 1u), AE_DEADLINE_PROCESS);
+    ae_deadline_get_stats(&stats);
+    HOST_TEST_EQUAL(stats.bypassed, 0);
+    HOST_TEST_EQUAL(stats.dropped, 0);
+}
+
+/*******************************************************************************
+* Function Name: test_slack_and_lateness
+********************************************************************************
+* Summary:
+* The time left at completion is recorded, and a completion after the
+* deadline counts the frame as late with its overrun.
+*
+*******************************************************************************/
+static void test_slack_and_lateness(void)
+{
+    ae_frame_t frame;
+    ae_deadline_stats_t stats;
+
+    HOST_TEST_EQUAL(ae_deadline_init(), CY_RSLT_SUCCESS);
+
+    capture(&frame, 0u, 0u);
+    HOST_TEST_EQUAL(begin_at(&frame, 100u), AE_DEADLINE_PROCESS);
+    complete_at(&frame, TEST_BUDGET_US - 2000u);
+
+    capture(&frame, 1u, 10000u);
+    HOST_TEST_EQUAL(begin_at(&frame, 10000u + TEST_BUDGET_US), AE_DEADLINE_PROCESS);
+    complete_at(&frame, 10000u + TEST_BUDGET_US + 300u);
+
+    capture(&frame, 2u, 20000u);
+    HOST_TEST_EQUAL(begin_at(&frame, 20000u), AE_DEADLINE_PROCESS);
+    complete_at(&frame, 20000u + TEST_BUDGET_US + 100u);
+
+    ae_deadline_get_stats(&stats);
+    HOST_TEST_EQUAL(stats.frames, 3);
+    HOST_TEST_EQUAL(stats.late, 2);
+    HOST_TEST_EQUAL(stats.missed, 0);
+    HOST_TEST_EQUAL(stats.max_late_us, 300);
+    HOST_TEST_EQUAL(stats.min_slack_us, -300);
+
+    ae_deadline_reset_stats();
+    ae_deadline_get_stats(&stats);
+    HOST_TEST_EQUAL(stats.frames, 0);
+    HOST_TEST_EQUAL(stats.late, 0);
+}
+
+/*******************************************************************************
+* Function Name: test_policies_handle_frames_behind_deadline
+********************************************************************************
+* Summary:
+* Only a frame that starts after its deadline is bypassed or dropped, and
+* each policy counts its own frames.
+*
+*******************************************************************************/
+static void test_policies_handle_frames_behind_deadline(void)
+{
+    ae_frame_t frame;
+    ae_deadline_stats_t stats;
+
+    HOST_TEST_EQUAL(ae_deadline_init(), CY_RSLT_SUCCESS);
+
+    ae_deadline_set_policy(AE_DEADLINE_POLICY_BYPASS);
+    capture(&frame, 0u, 0u);
+    HOST_TEST_EQUAL(begin_at(&frame, TEST_BUDGET_US), AE_DEADLINE_PROCESS);
+    capture(&frame, 1u, 0u);
+    HOST_TEST_EQUAL(begin_at(&frame, TEST_BUDGET_US + 1u), AE_DEADLINE_BYPASS);
+
+    ae_deadline_set_policy(AE_DEADLINE_POLICY_DROP);
+    capture(&frame, 2u, 0u);
+    HOST_TEST_EQUAL(begin_at(&frame, TEST_BUDGET_US + 1u), AE_DEADLINE_DROP);
+
+    ae_deadline_set_policy(AE_DEADLINE_POLICY_NONE);
+    capture(&frame, 3u, 0u);
+    HOST_TEST_EQUAL(begin_at(&frame, TEST_BUDGET_US + 1u), AE_DEADLINE_PROCESS);
+
+    ae_deadline_get_stats(&stats);
+    HOST_TEST_EQUAL(stats.bypassed, 1);
+    HOST_TEST_EQUAL(stats.dropped, 1);
+
+    /* Invalid policies are ignored */
+    ae_deadline_set_policy((ae_deadline_policy_t)(AE_DEADLINE_POLICY_DROP + 1));
+    HOST_TEST_EQUAL(ae_deadline_get_policy(), AE_DEADLINE_POLICY_NONE);
+    HOST_TEST_CHECK(0 == strcmp(ae_deadline_policy_name(AE_DEADLINE_POLICY_BYPASS), "bypass"));
+    HOST_TEST_CHECK(0 == strcmp(ae_deadline_policy_name((ae_deadline_policy_t)7), "?"));
+}
+
+/*******************************************************************************
+* Function Name: test_missed_frames_and_resync
+********************************************************************************
+* Summary:
+* A gap in the sequence numbers counts the missing frames, except after a
+* resync.
+*
+*******************************************************************************/
+static void test_missed_frames_and_resync(void)
+{
+    ae_frame_t frame;
+    ae_deadline_stats_t stats;
+
+    HOST_TEST_EQUAL(ae_deadline_init(), CY_RSLT_SUCCESS);
+
+    capture(&frame, 10u, 0u);
+    (void)begin_at(&frame, 0u);
+    capture(&frame, 11u, 0u);
+    (void)begin_at(&frame, 0u);
+    capture(&frame, 14u, 0u);
+    (void)begin_at(&frame, 0u);
+    ae_deadline_get_stats(&stats);
+    HOST_TEST_EQUAL(stats.missed, 2);
+
+    ae_deadline_resync();
+    capture(&frame, 40u, 0u);
+    (void)begin_at(&frame, 0u);
+    capture(&frame, 41u, 0u);
+    (void)begin_at(&frame, 0u);
+    ae_deadline_get_stats(&stats);
+    HOST_TEST_EQUAL(stats.missed, 2);
+}
+
+/*******************************************************************************
+* Function Name: test_clock_wraps
+********************************************************************************
+* Summary:
+* Deadlines that wrap around the clock are compared correctly.
+*
+*******************************************************************************/
+static void test_clock_wraps(void)
+{
+    ae_frame_t frame;
+    ae_deadline_stats_t stats;
+    const uint32_t start = 0xFFFFFFFFu - (TEST_BUDGET_US / 2u);
+
+    HOST_TEST_EQUAL(ae_deadline_init(), CY_RSLT_SUCCESS);
+    ae_deadline_set_policy(AE_DEADLINE_POLICY_DROP);
+
+    capture(&frame, 0u, start);
+    HOST_TEST_EQUAL(begin_at(&frame, start + (TEST_BUDGET_US - 10u)), AE_DEADLINE_PROCESS);
+    complete_at(&frame, start + TEST_BUDGET_US - 10u);
+
+    capture(&frame, 1u, start);
+    HOST_TEST_EQUAL(begin_at(&frame, start + TEST_BUDGET_US + 10u), AE_DEADLINE_DROP);
+
+    ae_deadline_get_stats(&stats);
+    HOST_TEST_EQUAL(stats.late, 0);
+    HOST_TEST_EQUAL(stats.min_slack_us, 10);
+
+    ae_deadline_set_policy(AE_DEADLINE_POLICY_NONE);
+}
+
+int main(void)
+{
+    HOST_TEST_RUN(test_default_policy_processes_late_frames);
+    HOST_TEST_RUN(test_slack_and_lateness);
+    HOST_TEST_RUN(test_policies_handle_frames_behind_deadline);
+    HOST_TEST_RUN(test_missed_frames_and_resync);
+    HOST_TEST_RUN(test_clock_wraps);
+    return 0;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,165 @@
+/******************************************************************************
+* File Name : test_ae_frame_pool.c
+*
+* Description :
+* Host tests of the frame pool between the capture path and the feed.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "host_test.h"
+#include "ae_frame_pool.h"
+
+/*******************************************************************************
+* Function Name: test_frames_keep_capture_order
+********************************************************************************
+* Summary:
+* Submitted frames are fed in capture order with consecutive sequence numbers.
+*
+*******************************************************************************/
+static void test_frames_keep_capture_order(void)
+{
+    ae_frame_t *frame;
+
+    HOST_TEST_EQUAL(ae_frame_pool_init(), CY_RSLT_SUCCESS);
+
+    for (uint32_t i = 0; i < (3u * AE_FRAME_POOL_SIZE); i++)
+    {
+        frame = ae_frame_acquire();
+        HOST_TEST_CHECK(NULL != frame);
+        HOST_TEST_EQUAL(frame->sequence, i);
+        frame->timestamp = i;
+        ae_frame_submit();
+
+        frame = ae_frame_next();
+        HOST_TEST_CHECK(NULL != frame);
+        HOST_TEST_EQUAL(frame->timestamp, i);
+        ae_frame_done();
+    }
+    HOST_TEST_CHECK(NULL == ae_frame_next());
+}
+
+/*******************************************************************************
+* Function Name: test_failed_acquire_submits_nothing
+********************************************************************************
+* Summary:
+* When the pool is full the acquire fails, the submit that follows it does not
+* hand a frame to the feed and the sequence number does not advance.
+*
+*******************************************************************************/
+static void test_failed_acquire_submits_nothing(void)
+{
+    ae_frame_t *frame;
+    uint32_t submitted = 0;
+
+    HOST_TEST_EQUAL(ae_frame_pool_init(), CY_RSLT_SUCCESS);
+
+    while (NULL != (frame = ae_frame_acquire()))
+    {
+        HOST_TEST_EQUAL(frame->sequence, submitted);
+        ae_frame_submit();
+        submitted++;
+    }
+    HOST_TEST_EQUAL(submitted, AE_FRAME_POOL_SIZE);
+    HOST_TEST_EQUAL(ae_frame_pending(), submitted);
+
+    ae_frame_submit();
+    HOST_TEST_CHECK(NULL == ae_frame_acquire());
+    ae_frame_submit();
+    HOST_TEST_EQUAL(ae_frame_pending(), submitted);
+
+    /* Space is back after one frame was fed */
+    HOST_TEST_EQUAL(ae_frame_next()->sequence, 0);
+    ae_frame_done();
+    frame = ae_frame_acquire();
+    HOST_TEST_CHECK(NULL != frame);
+    HOST_TEST_EQUAL(frame->sequence, submitted);
+    ae_frame_submit();
+
+    /* A second submit without an acquire does nothing either */
+    ae_frame_submit();
+    HOST_TEST_EQUAL(ae_frame_pending(), submitted);
+
+    for (uint32_t i = 1; i <= submitted; i++)
+    {
+        HOST_TEST_EQUAL(ae_frame_next()->sequence, i);
+        ae_frame_done();
+    }
+    HOST_TEST_EQUAL(ae_frame_pending(), 0);
+}
+
+/*******************************************************************************
+* Function Name: test_copy_stats
+********************************************************************************
+* Summary:
+* The copy counters add up the copies and count the frames fed.
+*
+*******************************************************************************/
+static void test_copy_stats(void)
+{
+    ae_frame_copy_stats_t stats;
+
+    HOST_TEST_EQUAL(ae_frame_pool_init(), CY_RSLT_SUCCESS);
+    ae_frame_copy_stats_reset();
+
+    for (uint32_t i = 0; i < 10u; i++)
+    {
+        (void)ae_frame_acquire();
+        AE_FRAME_COUNT_COPY(100u);
+        ae_frame_submit();
+        (void)ae_frame_next();
+        ae_frame_done();
+    }
+    AE_FRAME_COUNT_COPY(60u);
+
+    ae_frame_copy_stats_get(&stats);
+    HOST_TEST_EQUAL(stats.frames, 10);
+    HOST_TEST_EQUAL(stats.copies, 11);
+    HOST_TEST_EQUAL(stats.bytes, 1060);
+
+    ae_frame_copy_stats_reset();
+    ae_frame_copy_stats_get(&stats);
+    HOST_TEST_EQUAL(stats.frames + stats.copies + stats.bytes, 0);
+}
+
+int main(void)
+{
+    HOST_TEST_RUN(test_frames_keep_capture_order);
+    HOST_TEST_RUN(test_failed_acquire_submits_nothing);
+    HOST_TEST_RUN(test_copy_stats);
+    return 0;
+}
+
+/* [] END OF FILE */
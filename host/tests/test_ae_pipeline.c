@@ -0,0 +1,255 @@
+/******************************************************************************
+* File Name : test_ae_pipeline.c
+*
+* Description :
+* Host tests of the runtime pipeline reconfiguration: 1000 switches between
+* the backends return all arena and heap memory, and the ISR execution
+* mode refuses the switch.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "host_test.h"
+#include "FreeRTOS.h"
+#include "ae_pipeline.h"
+#include "ae_backend.h"
+#include "ae_arena.h"
+#include "ae_frame_pool.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TEST_CYCLES                     (1000u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Memory in use at one point of a reconfiguration cycle */
+typedef struct
+{
+    ae_arena_tier_stats_t tiers[AE_ARENA_TIER_COUNT];
+    size_t free_heap;
+} test_memory_t;
+
+/*******************************************************************************
+* Function Name: memory_snapshot
+*******************************************************************************/
+static void memory_snapshot(test_memory_t *memory)
+{
+    memset(memory, 0, sizeof(*memory));
+    for (uint32_t tier = 0; tier < AE_ARENA_TIER_COUNT; tier++)
+    {
+        ae_arena_get_stats((ae_arena_tier_t)tier, &memory->tiers[tier]);
+        /* Only the blocks in use have to come back */
+        memory->tiers[tier].high_water = 0;
+    }
+    memory->free_heap = xPortGetFreeHeapSize();
+}
+
+/*******************************************************************************
+* Function Name: memory_check
+********************************************************************************
+* Summary:
+* Fails the test if the memory in use differs from 'expected'.
+*
+*******************************************************************************/
+static void memory_check(const test_memory_t *expected, uint32_t cycle, const char *step)
+{
+    test_memory_t actual;
+
+    memory_snapshot(&actual);
+    for (uint32_t tier = 0; tier < AE_ARENA_TIER_COUNT; tier++)
+    {
+        if ((actual.tiers[tier].used != expected->tiers[tier].used) ||
+            (actual.tiers[tier].blocks != expected->tiers[tier].blocks))
+        {
+            HOST_TEST_FAIL("cycle %lu %s: tier %lu holds %lu bytes in %lu blocks, expected %lu in %lu",
+                    (unsigned long)cycle, step, (unsigned long)tier,
+                    (unsigned long)actual.tiers[tier].used, (unsigned long)actual.tiers[tier].blocks,
+                    (unsigned long)expected->tiers[tier].used, (unsigned long)expected->tiers[tier].blocks);
+        }
+    }
+    if (actual.free_heap != expected->free_heap)
+    {
+        HOST_TEST_FAIL("cycle %lu %s: free heap %lu, expected %lu", (unsigned long)cycle, step,
+                (unsigned long)actual.free_heap, (unsigned long)expected->free_heap);
+    }
+}
+
+#ifdef AE_EXEC_MODE_TASK
+/*******************************************************************************
+* Function Name: test_reconfiguration_does_not_leak
+********************************************************************************
+* Summary:
+* Switches 1000 times from the DEEPCRAFT(TM) backend on the mics to the
+* reference backend on the USB input and to the passthrough, and back. The
+* memory in use after each step matches the first cycle. The time of each
+* switch is reported.
+*
+*******************************************************************************/
+static void test_reconfiguration_does_not_leak(void)
+{
+    const ae_pipeline_config_t start = *ae_pipeline_get_config();
+    ae_pipeline_config_t steps[3];
+    test_memory_t memory[3];
+    ae_pipeline_stats_t stats;
+    uint32_t reconfigurations;
+
+    steps[0] = start;
+    steps[0].backend = &ae_backend_reference;
+    steps[0].input_source = AE_PIPELINE_INPUT_USB;
+    steps[0].num_channels = 2u;
+    steps[0].aec_quality_mode = true;
+    steps[1] = start;
+    steps[1].backend = &ae_backend_passthrough;
+    steps[1].num_channels = 1u;
+    steps[2] = start;
+    steps[2].backend = &ae_backend_deepcraft;
+    steps[2].num_channels = ae_backend_deepcraft.fixed_channels;
+
+    ae_pipeline_get_stats(&stats);
+    reconfigurations = stats.reconfigurations;
+
+    for (uint32_t cycle = 0; cycle < TEST_CYCLES; cycle++)
+    {
+        for (uint32_t step = 0; step < 3u; step++)
+        {
+            HOST_TEST_EQUAL(ae_pipeline_reconfigure(&steps[step]), CY_RSLT_SUCCESS);
+            HOST_TEST_CHECK(steps[step].backend == audio_enhancement_get_backend());
+            if (0u == cycle)
+            {
+                memory_snapshot(&memory[step]);
+            }
+            else
+            {
+                memory_check(&memory[step], cycle, steps[step].backend->name);
+            }
+        }
+    }
+
+    /* The DEEPCRAFT(TM) middleware memory is only held by its backend */
+    HOST_TEST_EQUAL(memory[1].tiers[AE_ARENA_TIER_DTCM].blocks, 0u);
+    HOST_TEST_EQUAL(memory[1].tiers[AE_ARENA_TIER_SOCMEM].blocks, 0u);
+    HOST_TEST_EQUAL(memory[1].tiers[AE_ARENA_TIER_HEAP].blocks, 0u);
+    HOST_TEST_CHECK(0u != memory[2].tiers[AE_ARENA_TIER_DTCM].blocks +
+            memory[2].tiers[AE_ARENA_TIER_SOCMEM].blocks + memory[2].tiers[AE_ARENA_TIER_HEAP].blocks);
+
+    ae_pipeline_get_stats(&stats);
+    HOST_TEST_EQUAL(stats.reconfigurations - reconfigurations, 3u * TEST_CYCLES);
+    printf("%lu reconfigurations, last %lu us, max %lu us\n",
+            (unsigned long)(3u * TEST_CYCLES), (unsigned long)stats.last_us, (unsigned long)stats.max_us);
+}
+
+/*******************************************************************************
+* Function Name: test_rejected_channels_keep_configuration
+********************************************************************************
+* Summary:
+* A channel count the DEEPCRAFT(TM) backend was not generated for is refused
+* before the pipeline is touched.
+*
+*******************************************************************************/
+static void test_rejected_channels_keep_configuration(void)
+{
+    ae_pipeline_config_t config = *ae_pipeline_get_config();
+    ae_pipeline_stats_t before;
+    ae_pipeline_stats_t after;
+    test_memory_t memory;
+
+    memory_snapshot(&memory);
+    ae_pipeline_get_stats(&before);
+
+    config.backend = &ae_backend_deepcraft;
+    config.num_channels = ae_backend_deepcraft.fixed_channels + 1u;
+    HOST_TEST_EQUAL(ae_pipeline_reconfigure(&config), (cy_rslt_t)AE_PIPELINE_FAILURE);
+
+    ae_pipeline_get_stats(&after);
+    HOST_TEST_EQUAL(after.failures, before.failures + 1u);
+    HOST_TEST_EQUAL(after.reconfigurations, before.reconfigurations);
+    HOST_TEST_CHECK(ae_backend_deepcraft.fixed_channels == ae_pipeline_get_config()->num_channels);
+    memory_check(&memory, 0u, "rejected");
+}
+#else
+/*******************************************************************************
+* Function Name: test_isr_mode_refuses_reconfiguration
+********************************************************************************
+* Summary:
+* In ISR execution mode the switch and the pipeline command fail with
+* AE_PIPELINE_EXEC_MODE_FAILURE and leave the pipeline as it was.
+*
+*******************************************************************************/
+static void test_isr_mode_refuses_reconfiguration(void)
+{
+    const ae_pipeline_config_t before = *ae_pipeline_get_config();
+    ae_pipeline_config_t config = before;
+    ae_pipeline_stats_t stats;
+    test_memory_t memory;
+
+    memory_snapshot(&memory);
+
+    config.backend = &ae_backend_passthrough;
+    config.num_channels = 1u;
+    HOST_TEST_EQUAL(ae_pipeline_reconfigure(&config), (cy_rslt_t)AE_PIPELINE_EXEC_MODE_FAILURE);
+    HOST_TEST_EQUAL(ae_pipeline_command("pipeline backend=passthrough channels=1"),
+            (cy_rslt_t)AE_PIPELINE_EXEC_MODE_FAILURE);
+
+    /* Printing the configuration needs no switch */
+    HOST_TEST_EQUAL(ae_pipeline_command("pipeline"), CY_RSLT_SUCCESS);
+
+    HOST_TEST_CHECK(0 == memcmp(&before, ae_pipeline_get_config(), sizeof(before)));
+    HOST_TEST_CHECK(before.backend == audio_enhancement_get_backend());
+    ae_pipeline_get_stats(&stats);
+    HOST_TEST_EQUAL(stats.reconfigurations, 0u);
+    HOST_TEST_EQUAL(stats.failures, 2u);
+    memory_check(&memory, 0u, "refused");
+}
+#endif /* AE_EXEC_MODE_TASK */
+
+int main(void)
+{
+    HOST_TEST_EQUAL(ae_frame_pool_init(), CY_RSLT_SUCCESS);
+    HOST_TEST_EQUAL(ae_pipeline_init(), CY_RSLT_SUCCESS);
+    HOST_TEST_CHECK(&ae_backend_deepcraft == audio_enhancement_get_backend());
+
+#ifdef AE_EXEC_MODE_TASK
+    HOST_TEST_RUN(test_reconfiguration_does_not_leak);
+    HOST_TEST_RUN(test_rejected_channels_keep_configuration);
+#else
+    HOST_TEST_RUN(test_isr_mode_refuses_reconfiguration);
+#endif /* AE_EXEC_MODE_TASK */
+    return 0;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,210 @@
+/******************************************************************************
+* File Name : test_ae_power.c
+*
+* Description :
+* Host tests of the clock profile controller of the AE power management.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "host_test.h"
+#include "ae_power.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TEST_FRAME_US                   (10000u)
+#define TEST_CLOCK_HZ                   (400000000u)
+
+/* Work per frame of the fastest profile less the headroom, in cycles */
+#define TEST_FULL_CAPACITY              ((TEST_FRAME_US * (TEST_CLOCK_HZ / 1000000u) * \
+                                          (100u - AE_POWER_HEADROOM_PERCENT)) / 100u)
+
+#define TEST_SLOWEST                    (0u)
+#define TEST_FASTEST                    (AE_POWER_NUM_PROFILES - 1u)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static ae_power_controller_t controller;
+
+/*******************************************************************************
+* Function Name: run_frames
+********************************************************************************
+* Summary:
+* Steps the controller with the same work for a number of frames and
+* returns the last selected profile.
+*
+*******************************************************************************/
+static uint32_t run_frames(uint32_t frames, uint32_t work_cycles)
+{
+    uint32_t profile = controller.profile;
+
+    for (uint32_t i = 0; i < frames; i++)
+    {
+        profile = ae_power_controller_step(&controller, work_cycles, false);
+    }
+    return profile;
+}
+
+/*******************************************************************************
+* Function Name: test_init_capacities
+********************************************************************************
+* Summary:
+* Each profile can take the work of the full clock divided by its divider,
+* and the controller starts at the fastest profile.
+*
+*******************************************************************************/
+static void test_init_capacities(void)
+{
+    static const uint32_t dividers[AE_POWER_NUM_PROFILES] = AE_POWER_PROFILE_DIVIDERS;
+
+    ae_power_controller_init(&controller, TEST_FRAME_US, TEST_CLOCK_HZ);
+    HOST_TEST_EQUAL(controller.profile, TEST_FASTEST);
+    HOST_TEST_EQUAL(controller.hold_windows, 1);
+    for (uint32_t profile = 0; profile < AE_POWER_NUM_PROFILES; profile++)
+    {
+        HOST_TEST_EQUAL(controller.capacity[profile], TEST_FULL_CAPACITY / dividers[profile]);
+    }
+    HOST_TEST_CHECK(controller.capacity[TEST_SLOWEST] < controller.capacity[TEST_FASTEST]);
+}
+
+/*******************************************************************************
+* Function Name: test_lowers_after_a_window
+********************************************************************************
+* Summary:
+* A light load lowers the clock to the slowest profile that fits, only
+* after a full window of frames.
+*
+*******************************************************************************/
+static void test_lowers_after_a_window(void)
+{
+    ae_power_controller_init(&controller, TEST_FRAME_US, TEST_CLOCK_HZ);
+
+    HOST_TEST_EQUAL(run_frames(AE_POWER_WINDOW_FRAMES - 1u, controller.capacity[TEST_SLOWEST] / 2u),
+                    TEST_FASTEST);
+    HOST_TEST_EQUAL(run_frames(1u, controller.capacity[TEST_SLOWEST] / 2u), TEST_SLOWEST);
+
+    /* A load between the slowest and the middle profile settles on the middle */
+    ae_power_controller_init(&controller, TEST_FRAME_US, TEST_CLOCK_HZ);
+    HOST_TEST_EQUAL(run_frames(AE_POWER_WINDOW_FRAMES, controller.capacity[TEST_SLOWEST] + 1u), 1);
+    HOST_TEST_EQUAL(run_frames(10u * AE_POWER_WINDOW_FRAMES, controller.capacity[TEST_SLOWEST] + 1u), 1);
+}
+
+/*******************************************************************************
+* Function Name: test_window_peak_decides
+********************************************************************************
+* Summary:
+* One heavy frame in a window keeps the clock at the profile it needs.
+*
+*******************************************************************************/
+static void test_window_peak_decides(void)
+{
+    uint32_t light = 0;
+
+    ae_power_controller_init(&controller, TEST_FRAME_US, TEST_CLOCK_HZ);
+    light = controller.capacity[TEST_SLOWEST] / 2u;
+    (void)run_frames(10u, light);
+    (void)run_frames(1u, controller.capacity[TEST_FASTEST - 1u] + 1u);
+    HOST_TEST_EQUAL(run_frames(AE_POWER_WINDOW_FRAMES - 11u, light), TEST_FASTEST);
+}
+
+/*******************************************************************************
+* Function Name: test_raises_at_once
+********************************************************************************
+* Summary:
+* A frame that does not fit the active profile raises the clock with the
+* next step, to the slowest profile that fits it, or to the fastest.
+*
+*******************************************************************************/
+static void test_raises_at_once(void)
+{
+    ae_power_controller_init(&controller, TEST_FRAME_US, TEST_CLOCK_HZ);
+    HOST_TEST_EQUAL(run_frames(AE_POWER_WINDOW_FRAMES, 1000u), TEST_SLOWEST);
+
+    HOST_TEST_EQUAL(ae_power_controller_step(&controller, controller.capacity[TEST_SLOWEST] + 1u, false), 1);
+    HOST_TEST_EQUAL(controller.window_frames, 0);
+
+    HOST_TEST_EQUAL(ae_power_controller_step(&controller, 0xFFFFFFFFu, false), TEST_FASTEST);
+}
+
+/*******************************************************************************
+* Function Name: test_late_frames_hold_the_clock
+********************************************************************************
+* Summary:
+* A late frame selects the fastest profile and doubles the windows needed
+* before the clock is lowered again, up to AE_POWER_MAX_HOLD_WINDOWS. Quiet
+* windows reduce the hold again.
+*
+*******************************************************************************/
+static void test_late_frames_hold_the_clock(void)
+{
+    const uint32_t light = 1000u;
+
+    ae_power_controller_init(&controller, TEST_FRAME_US, TEST_CLOCK_HZ);
+    HOST_TEST_EQUAL(run_frames(AE_POWER_WINDOW_FRAMES, light), TEST_SLOWEST);
+
+    HOST_TEST_EQUAL(ae_power_controller_step(&controller, light, true), TEST_FASTEST);
+    HOST_TEST_EQUAL(controller.hold_windows, 2);
+    HOST_TEST_EQUAL(run_frames((2u * AE_POWER_WINDOW_FRAMES) - 1u, light), TEST_FASTEST);
+    HOST_TEST_EQUAL(run_frames(1u, light), TEST_SLOWEST);
+
+    for (uint32_t i = 0; i < 10u; i++)
+    {
+        (void)ae_power_controller_step(&controller, light, true);
+    }
+    HOST_TEST_EQUAL(controller.hold_windows, AE_POWER_MAX_HOLD_WINDOWS);
+    HOST_TEST_EQUAL(controller.profile, TEST_FASTEST);
+
+    /* The first lowering takes the longest hold, counted from the switch to
+     * the fastest profile, after which the hold shrinks
+     */
+    HOST_TEST_EQUAL(run_frames((AE_POWER_MAX_HOLD_WINDOWS * AE_POWER_WINDOW_FRAMES) - 1u -
+                               controller.window_frames, light), TEST_FASTEST);
+    HOST_TEST_EQUAL(run_frames(1u, light), TEST_SLOWEST);
+    HOST_TEST_EQUAL(controller.hold_windows, AE_POWER_MAX_HOLD_WINDOWS - 1u);
+}
+
+int main(void)
+{
+    HOST_TEST_RUN(test_init_capacities);
+    HOST_TEST_RUN(test_lowers_after_a_window);
+    HOST_TEST_RUN(test_window_peak_decides);
+    HOST_TEST_RUN(test_raises_at_once);
+    HOST_TEST_RUN(test_late_frames_hold_the_clock);
+    return 0;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,296 @@
+/******************************************************************************
+* File Name : test_aec_jitter_buffer.c
+*
+* Description :
+* Host tests of the adaptive AEC reference jitter buffer.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "host_test.h"
+#include "aec_jitter_buffer.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TEST_FRAME_LEN                  (AUDIO_PIPELINE_SAMPLES_PER_FRAME)
+
+/* Stereo playback frames, the reference is taken from the left channel */
+#define TEST_PLAYBACK_CHANNELS          (2u)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static int16_t test_playback[TEST_FRAME_LEN * TEST_PLAYBACK_CHANNELS];
+static int16_t test_reference[TEST_FRAME_LEN];
+
+/*******************************************************************************
+* Function Name: ramp_sample
+********************************************************************************
+* Summary:
+* Value of the playback ramp at a sample position, 0 before the stream start.
+*
+*******************************************************************************/
+static int16_t ramp_sample(int32_t position)
+{
+    if (position < 0)
+    {
+        return 0;
+    }
+    return (int16_t)(1 + (position % 30000));
+}
+
+/*******************************************************************************
+* Function Name: write_ramp_frame
+********************************************************************************
+* Summary:
+* Writes the next playback frame of the ramp. The right channel carries a
+* different signal that must not leak into the reference.
+*
+*******************************************************************************/
+static void write_ramp_frame(uint32_t frame_index)
+{
+    uint32_t i;
+
+    for (i = 0; i < TEST_FRAME_LEN; i++)
+    {
+        test_playback[i * TEST_PLAYBACK_CHANNELS] = ramp_sample((int32_t)((frame_index * TEST_FRAME_LEN) + i));
+        test_playback[(i * TEST_PLAYBACK_CHANNELS) + 1u] = -1;
+    }
+    aec_jb_write(test_playback, TEST_FRAME_LEN, TEST_PLAYBACK_CHANNELS, 0u);
+}
+
+/*******************************************************************************
+* Function Name: check_delayed_ramp
+********************************************************************************
+* Summary:
+* Checks that the reference read after frame_index is the ramp delayed by
+* delay samples.
+*
+*******************************************************************************/
+static void check_delayed_ramp(uint32_t frame_index, uint32_t delay)
+{
+    int32_t start = (int32_t)(frame_index * TEST_FRAME_LEN) - (int32_t)delay;
+    uint32_t i;
+
+    for (i = 0; i < TEST_FRAME_LEN; i++)
+    {
+        if (test_reference[i] != ramp_sample(start + (int32_t)i))
+        {
+            HOST_TEST_FAIL("frame %u sample %u: %d, expected %d", (unsigned)frame_index,
+                           (unsigned)i, test_reference[i], ramp_sample(start + (int32_t)i));
+        }
+    }
+}
+
+static void test_empty_before_playback(void)
+{
+    HOST_TEST_EQUAL(aec_jb_init(), CY_RSLT_SUCCESS);
+    HOST_TEST_EQUAL(aec_jb_read(test_reference, TEST_FRAME_LEN, 0u), (cy_rslt_t)AEC_JB_FAILURE);
+}
+
+static void test_constant_delay_in_lockstep(void)
+{
+    const uint32_t delays[] = { 0u, TEST_FRAME_LEN, 3u * TEST_FRAME_LEN + 40u };
+    aec_jb_stats_t stats;
+    uint32_t expected_delay;
+    uint32_t frame;
+    uint32_t d;
+
+    for (d = 0; d < (sizeof(delays) / sizeof(delays[0])); d++)
+    {
+        HOST_TEST_EQUAL(aec_jb_init(), CY_RSLT_SUCCESS);
+
+        /* The delay covers at least one frame plus the initial margin */
+        expected_delay = ((delays[d] > TEST_FRAME_LEN) ? delays[d] : TEST_FRAME_LEN) +
+                         AEC_JB_INITIAL_MARGIN_SAMPLES;
+
+        /* Stays within the first adaptation window */
+        for (frame = 0; frame < (AEC_JB_ADAPT_WINDOW_READS - 1u); frame++)
+        {
+            write_ramp_frame(frame);
+            HOST_TEST_EQUAL(aec_jb_read(test_reference, TEST_FRAME_LEN, delays[d]), CY_RSLT_SUCCESS);
+            check_delayed_ramp(frame + 1u, expected_delay);
+        }
+
+        aec_jb_get_stats(&stats);
+        HOST_TEST_EQUAL(stats.underruns, 0);
+        HOST_TEST_EQUAL(stats.overruns, 0);
+        HOST_TEST_EQUAL(stats.depth, expected_delay);
+        HOST_TEST_EQUAL(stats.target_depth, expected_delay);
+    }
+}
+
+static void test_underrun_is_concealed_and_goes_idle(void)
+{
+    aec_jb_stats_t stats;
+    uint32_t frame;
+    uint32_t i;
+    uint32_t reads;
+
+    HOST_TEST_EQUAL(aec_jb_init(), CY_RSLT_SUCCESS);
+    for (frame = 0; frame < 4u; frame++)
+    {
+        write_ramp_frame(frame);
+        HOST_TEST_EQUAL(aec_jb_read(test_reference, TEST_FRAME_LEN, 0u), CY_RSLT_SUCCESS);
+    }
+
+    /* Playback stops: the buffered margin is played out, then faded */
+    HOST_TEST_EQUAL(aec_jb_read(test_reference, TEST_FRAME_LEN, 0u), CY_RSLT_SUCCESS);
+    aec_jb_get_stats(&stats);
+    HOST_TEST_EQUAL(stats.underruns, 1);
+    HOST_TEST_EQUAL(stats.concealed_samples, TEST_FRAME_LEN - AEC_JB_INITIAL_MARGIN_SAMPLES);
+    HOST_TEST_CHECK(stats.margin > AEC_JB_INITIAL_MARGIN_SAMPLES);
+    for (i = AEC_JB_INITIAL_MARGIN_SAMPLES; i < TEST_FRAME_LEN; i++)
+    {
+        HOST_TEST_CHECK(abs(test_reference[i]) <= abs(test_reference[AEC_JB_INITIAL_MARGIN_SAMPLES - 1u]));
+        if (i >= (AEC_JB_INITIAL_MARGIN_SAMPLES + AEC_JB_FADE_SAMPLES))
+        {
+            HOST_TEST_EQUAL(test_reference[i], 0);
+        }
+    }
+
+    /* Continuous empty reads stop the reference */
+    reads = 0;
+    while (CY_RSLT_SUCCESS == aec_jb_read(test_reference, TEST_FRAME_LEN, 0u))
+    {
+        for (i = 0; i < TEST_FRAME_LEN; i++)
+        {
+            HOST_TEST_EQUAL(test_reference[i], 0);
+        }
+        reads++;
+        HOST_TEST_CHECK(reads < 1000u);
+    }
+    HOST_TEST_CHECK(reads > 1u);
+
+    /* Playback restarts with a fresh alignment */
+    write_ramp_frame(0);
+    HOST_TEST_EQUAL(aec_jb_read(test_reference, TEST_FRAME_LEN, 0u), CY_RSLT_SUCCESS);
+    aec_jb_get_stats(&stats);
+    HOST_TEST_EQUAL(stats.margin, AEC_JB_INITIAL_MARGIN_SAMPLES);
+}
+
+static void test_overrun_resyncs(void)
+{
+    aec_jb_stats_t stats;
+    uint32_t frame;
+
+    HOST_TEST_EQUAL(aec_jb_init(), CY_RSLT_SUCCESS);
+    write_ramp_frame(0);
+    HOST_TEST_EQUAL(aec_jb_read(test_reference, TEST_FRAME_LEN, 0u), CY_RSLT_SUCCESS);
+
+    /* The consumer stalls for longer than the delay line */
+    for (frame = 1; frame <= ((AEC_JB_CAPACITY_SAMPLES / TEST_FRAME_LEN) + 1u); frame++)
+    {
+        write_ramp_frame(frame);
+    }
+    HOST_TEST_EQUAL(aec_jb_read(test_reference, TEST_FRAME_LEN, 0u), CY_RSLT_SUCCESS);
+    aec_jb_get_stats(&stats);
+    HOST_TEST_EQUAL(stats.overruns, 1);
+    check_delayed_ramp(frame, TEST_FRAME_LEN + AEC_JB_INITIAL_MARGIN_SAMPLES);
+}
+
+static void test_flush_realigns(void)
+{
+    aec_jb_stats_t stats;
+    uint32_t frame;
+
+    HOST_TEST_EQUAL(aec_jb_init(), CY_RSLT_SUCCESS);
+    for (frame = 0; frame < 3u; frame++)
+    {
+        write_ramp_frame(frame);
+        HOST_TEST_EQUAL(aec_jb_read(test_reference, TEST_FRAME_LEN, 0u), CY_RSLT_SUCCESS);
+    }
+
+    /* No new data after the flush: the reference is stopped */
+    aec_jb_flush();
+    HOST_TEST_EQUAL(aec_jb_read(test_reference, TEST_FRAME_LEN, 0u), (cy_rslt_t)AEC_JB_FAILURE);
+
+    write_ramp_frame(frame);
+    HOST_TEST_EQUAL(aec_jb_read(test_reference, TEST_FRAME_LEN, 0u), CY_RSLT_SUCCESS);
+    check_delayed_ramp(frame + 1u, TEST_FRAME_LEN + AEC_JB_INITIAL_MARGIN_SAMPLES);
+    aec_jb_get_stats(&stats);
+    HOST_TEST_EQUAL(stats.underruns, 0);
+}
+
+static void test_tracks_playback_drift(void)
+{
+    /* Playback clock 400 ppm faster than the mic clock */
+    const double drift_ppm = 400.0;
+    const uint32_t frames = 3000u;
+    aec_jb_stats_t stats;
+    double produced = 0.0;
+    uint32_t written = 0;
+    uint32_t chunk;
+    uint32_t frame;
+    uint32_t i;
+
+    HOST_TEST_EQUAL(aec_jb_init(), CY_RSLT_SUCCESS);
+    for (frame = 0; frame < frames; frame++)
+    {
+        produced += (double)TEST_FRAME_LEN * (1.0 + (drift_ppm * 1.0e-6));
+        chunk = (uint32_t)produced - written;
+        for (i = 0; i < chunk; i++)
+        {
+            test_playback[i * TEST_PLAYBACK_CHANNELS] = ramp_sample((int32_t)(written + i));
+        }
+        aec_jb_write(test_playback, chunk, TEST_PLAYBACK_CHANNELS, 0u);
+        written += chunk;
+        HOST_TEST_EQUAL(aec_jb_read(test_reference, TEST_FRAME_LEN, 0u), CY_RSLT_SUCCESS);
+    }
+
+    aec_jb_get_stats(&stats);
+    HOST_TEST_NEAR(stats.drift_ppm, drift_ppm, 20.0);
+    HOST_TEST_EQUAL(stats.underruns, 0);
+    HOST_TEST_EQUAL(stats.overruns, 0);
+    /* Resampling keeps the depth near the target, a few realignments at most */
+    HOST_TEST_CHECK(stats.realignments <= 3u);
+    HOST_TEST_NEAR(stats.depth, stats.target_depth,
+                   AEC_JB_REALIGN_THRESHOLD_SAMPLES + AEC_JB_MAX_MARGIN_SAMPLES);
+}
+
+int main(void)
+{
+    HOST_TEST_RUN(test_empty_before_playback);
+    HOST_TEST_RUN(test_constant_delay_in_lockstep);
+    HOST_TEST_RUN(test_underrun_is_concealed_and_goes_idle);
+    HOST_TEST_RUN(test_overrun_resyncs);
+    HOST_TEST_RUN(test_flush_realigns);
+    HOST_TEST_RUN(test_tracks_playback_drift);
+    return 0;
+}
+
+/* [] END OF FILE */
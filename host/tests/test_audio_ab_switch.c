@@ -0,0 +1,332 @@
+/******************************************************************************
+* File Name : test_audio_ab_switch.c
+*
+* Description :
+* Host tests of the A/B switch between the raw mics and the AE output.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "host_test.h"
+#include "audio_ab_switch.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TEST_FRAME_SAMPLES              (160u)
+#define TEST_CHANNELS                   (2u)
+#define TEST_FADE_SAMPLES               (320u)
+#define TEST_FRAMES                     (8u)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static audio_ab_switch_t ab_switch;
+
+/* Ramps that tell the stream and the sample index apart */
+static int16_t test_a[TEST_CHANNELS][TEST_FRAMES * TEST_FRAME_SAMPLES];
+static int16_t test_b[TEST_CHANNELS][TEST_FRAMES * TEST_FRAME_SAMPLES];
+
+/*******************************************************************************
+* Function Name: make_streams
+********************************************************************************
+* Summary:
+* Fills A with positive and B with negative ramps, offset per channel.
+*
+*******************************************************************************/
+static void make_streams(void)
+{
+    for (uint32_t ch = 0; ch < TEST_CHANNELS; ch++)
+    {
+        for (uint32_t i = 0; i < (TEST_FRAMES * TEST_FRAME_SAMPLES); i++)
+        {
+            test_a[ch][i] = (int16_t)(1 + i + (ch * 10000u));
+            test_b[ch][i] = (int16_t)-(int16_t)(1 + i + (ch * 10000u));
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: process_frame
+********************************************************************************
+* Summary:
+* Switches frame f of the test streams.
+*
+*******************************************************************************/
+static void process_frame(uint32_t f, const int16_t **out)
+{
+    const int16_t *a[TEST_CHANNELS];
+    const int16_t *b[TEST_CHANNELS];
+
+    for (uint32_t ch = 0; ch < TEST_CHANNELS; ch++)
+    {
+        a[ch] = &test_a[ch][f * TEST_FRAME_SAMPLES];
+        b[ch] = &test_b[ch][f * TEST_FRAME_SAMPLES];
+    }
+    audio_ab_switch_process(&ab_switch, a, b, out, TEST_FRAME_SAMPLES);
+}
+
+/*******************************************************************************
+* Function Name: delayed_a
+********************************************************************************
+* Summary:
+* Returns sample i of the A stream delayed by delay samples.
+*
+*******************************************************************************/
+static int16_t delayed_a(uint32_t ch, uint32_t i, uint32_t delay)
+{
+    return (i >= delay) ? test_a[ch][i - delay] : 0;
+}
+
+/*******************************************************************************
+* Function Name: test_init_rejects_bad_arguments
+********************************************************************************
+* Summary:
+* The channel count is bounded and the crossfade cannot be empty.
+*
+*******************************************************************************/
+static void test_init_rejects_bad_arguments(void)
+{
+    HOST_TEST_EQUAL(audio_ab_switch_init(NULL, 1u, 1u, false), (cy_rslt_t)AUDIO_AB_SWITCH_FAILURE);
+    HOST_TEST_EQUAL(audio_ab_switch_init(&ab_switch, 0u, 1u, false), (cy_rslt_t)AUDIO_AB_SWITCH_FAILURE);
+    HOST_TEST_EQUAL(audio_ab_switch_init(&ab_switch, AUDIO_AB_SWITCH_MAX_CHANNELS + 1u, 1u, false),
+                    (cy_rslt_t)AUDIO_AB_SWITCH_FAILURE);
+    HOST_TEST_EQUAL(audio_ab_switch_init(&ab_switch, 1u, 0u, false), (cy_rslt_t)AUDIO_AB_SWITCH_FAILURE);
+    HOST_TEST_EQUAL(audio_ab_switch_init(&ab_switch, AUDIO_AB_SWITCH_MAX_CHANNELS, 1u, true), CY_RSLT_SUCCESS);
+    HOST_TEST_EQUAL(ab_switch.fade_pos, 1);
+    HOST_TEST_EQUAL(ab_switch.delay_samples, 0);
+}
+
+/*******************************************************************************
+* Function Name: test_settled_output_points_to_input
+********************************************************************************
+* Summary:
+* Settled without delay, the output is the selected input itself.
+*
+*******************************************************************************/
+static void test_settled_output_points_to_input(void)
+{
+    const int16_t *out[TEST_CHANNELS];
+
+    make_streams();
+    HOST_TEST_EQUAL(audio_ab_switch_init(&ab_switch, TEST_CHANNELS, TEST_FADE_SAMPLES, false), CY_RSLT_SUCCESS);
+    process_frame(0u, out);
+    HOST_TEST_CHECK(out[0] == &test_a[0][0]);
+    HOST_TEST_CHECK(out[1] == &test_a[1][0]);
+
+    HOST_TEST_EQUAL(audio_ab_switch_init(&ab_switch, TEST_CHANNELS, TEST_FADE_SAMPLES, true), CY_RSLT_SUCCESS);
+    process_frame(1u, out);
+    HOST_TEST_CHECK(out[0] == &test_b[0][TEST_FRAME_SAMPLES]);
+    HOST_TEST_CHECK(out[1] == &test_b[1][TEST_FRAME_SAMPLES]);
+}
+
+/*******************************************************************************
+* Function Name: test_delay_aligns_a_across_frames
+********************************************************************************
+* Summary:
+* A is delayed exactly, for delays shorter and longer than a frame, and the
+* delay line restarts with silence when the delay is set.
+*
+*******************************************************************************/
+static void test_delay_aligns_a_across_frames(void)
+{
+    static const uint32_t delays[] = { 1u, 72u, TEST_FRAME_SAMPLES, 250u, AUDIO_AB_SWITCH_MAX_DELAY_SAMPLES };
+    const int16_t *out[TEST_CHANNELS];
+
+    make_streams();
+    for (uint32_t d = 0; d < (sizeof(delays) / sizeof(delays[0])); d++)
+    {
+        HOST_TEST_EQUAL(audio_ab_switch_init(&ab_switch, TEST_CHANNELS, TEST_FADE_SAMPLES, false),
+                        CY_RSLT_SUCCESS);
+        HOST_TEST_EQUAL(audio_ab_switch_set_delay(&ab_switch, delays[d]), CY_RSLT_SUCCESS);
+        for (uint32_t f = 0; f < TEST_FRAMES; f++)
+        {
+            process_frame(f, out);
+            for (uint32_t ch = 0; ch < TEST_CHANNELS; ch++)
+            {
+                for (uint32_t i = 0; i < TEST_FRAME_SAMPLES; i++)
+                {
+                    HOST_TEST_EQUAL(out[ch][i], delayed_a(ch, (f * TEST_FRAME_SAMPLES) + i, delays[d]));
+                }
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_set_delay_bounds
+********************************************************************************
+* Summary:
+* A delay beyond the delay line is refused and leaves the delay unchanged.
+*
+*******************************************************************************/
+static void test_set_delay_bounds(void)
+{
+    HOST_TEST_EQUAL(audio_ab_switch_init(&ab_switch, TEST_CHANNELS, TEST_FADE_SAMPLES, false), CY_RSLT_SUCCESS);
+    HOST_TEST_EQUAL(audio_ab_switch_set_delay(&ab_switch, 100u), CY_RSLT_SUCCESS);
+    HOST_TEST_EQUAL(audio_ab_switch_set_delay(&ab_switch, AUDIO_AB_SWITCH_MAX_DELAY_SAMPLES + 1u),
+                    (cy_rslt_t)AUDIO_AB_SWITCH_FAILURE);
+    HOST_TEST_EQUAL(ab_switch.delay_samples, 100);
+    HOST_TEST_EQUAL(audio_ab_switch_set_delay(&ab_switch, 0u), CY_RSLT_SUCCESS);
+    HOST_TEST_EQUAL(ab_switch.delay_samples, 0);
+}
+
+/*******************************************************************************
+* Function Name: test_crossfade_ramps_and_reverses
+********************************************************************************
+* Summary:
+* A switch ramps the gain of B by one step per sample over the crossfade,
+* and a switch back during the ramp reverses it from the current gain.
+*
+*******************************************************************************/
+static void test_crossfade_ramps_and_reverses(void)
+{
+    const int16_t *out[TEST_CHANNELS];
+    double gain = 0.0;
+    double expected = 0.0;
+    uint32_t pos = 0;
+
+    make_streams();
+    HOST_TEST_EQUAL(audio_ab_switch_init(&ab_switch, TEST_CHANNELS, TEST_FADE_SAMPLES, false), CY_RSLT_SUCCESS);
+
+    /* Two frames towards B, then one frame back towards A */
+    for (uint32_t f = 0; f < 3u; f++)
+    {
+        audio_ab_switch_select(&ab_switch, f < 2u);
+        process_frame(f, out);
+        for (uint32_t i = 0; i < TEST_FRAME_SAMPLES; i++)
+        {
+            pos = (f < 2u) ? (pos + 1u) : (pos - 1u);
+            gain = (double)pos / TEST_FADE_SAMPLES;
+            for (uint32_t ch = 0; ch < TEST_CHANNELS; ch++)
+            {
+                expected = ((1.0 - gain) * test_a[ch][(f * TEST_FRAME_SAMPLES) + i]) +
+                           (gain * test_b[ch][(f * TEST_FRAME_SAMPLES) + i]);
+                HOST_TEST_NEAR(out[ch][i], expected, 2.0);
+            }
+        }
+    }
+    HOST_TEST_EQUAL(ab_switch.fade_pos, TEST_FADE_SAMPLES - TEST_FRAME_SAMPLES);
+
+    /* The ramp ends on A and the output points to it again */
+    process_frame(3u, out);
+    HOST_TEST_EQUAL(ab_switch.fade_pos, 0);
+    process_frame(4u, out);
+    HOST_TEST_CHECK(out[0] == &test_a[0][4u * TEST_FRAME_SAMPLES]);
+}
+
+/*******************************************************************************
+* Function Name: test_missing_channels_are_silent
+********************************************************************************
+* Summary:
+* A NULL input channel is switched as silence.
+*
+*******************************************************************************/
+static void test_missing_channels_are_silent(void)
+{
+    const int16_t *a[TEST_CHANNELS] = { test_a[0], NULL };
+    const int16_t *b[TEST_CHANNELS] = { NULL, test_b[1] };
+    const int16_t *out[TEST_CHANNELS];
+
+    make_streams();
+    HOST_TEST_EQUAL(audio_ab_switch_init(&ab_switch, TEST_CHANNELS, TEST_FADE_SAMPLES, false), CY_RSLT_SUCCESS);
+    audio_ab_switch_process(&ab_switch, a, b, out, TEST_FRAME_SAMPLES);
+    HOST_TEST_EQUAL(out[0][10], test_a[0][10]);
+    HOST_TEST_EQUAL(out[1][10], 0);
+
+    audio_ab_switch_select(&ab_switch, true);
+    audio_ab_switch_process(&ab_switch, a, b, out, TEST_FRAME_SAMPLES);
+    HOST_TEST_EQUAL(out[0][TEST_FRAME_SAMPLES - 1u], (test_a[0][TEST_FRAME_SAMPLES - 1u] + 1) / 2);
+}
+
+/*******************************************************************************
+* Function Name: test_replaced_b_follows_delayed_a
+********************************************************************************
+* Summary:
+* While B is replaced, both sides carry the delayed A stream without a
+* break in the delay line, whichever stream is selected. The B input comes
+* back once the replacement ends.
+*
+*******************************************************************************/
+static void test_replaced_b_follows_delayed_a(void)
+{
+    const int16_t *out[TEST_CHANNELS];
+    const uint32_t delay = 72u;
+
+    make_streams();
+    HOST_TEST_EQUAL(audio_ab_switch_init(&ab_switch, TEST_CHANNELS, TEST_FADE_SAMPLES, true), CY_RSLT_SUCCESS);
+    HOST_TEST_EQUAL(audio_ab_switch_set_delay(&ab_switch, delay), CY_RSLT_SUCCESS);
+
+    process_frame(0u, out);
+    HOST_TEST_CHECK(out[0] == &test_b[0][0]);
+
+    /* Replaced while settled on B, then while fading back to A */
+    audio_ab_switch_replace_b(&ab_switch, true);
+    for (uint32_t f = 1u; f < 5u; f++)
+    {
+        audio_ab_switch_select(&ab_switch, f < 3u);
+        process_frame(f, out);
+        for (uint32_t ch = 0; ch < TEST_CHANNELS; ch++)
+        {
+            for (uint32_t i = 0; i < TEST_FRAME_SAMPLES; i++)
+            {
+                HOST_TEST_NEAR(out[ch][i], delayed_a(ch, (f * TEST_FRAME_SAMPLES) + i, delay), 1.0);
+            }
+        }
+    }
+
+    audio_ab_switch_replace_b(&ab_switch, false);
+    audio_ab_switch_select(&ab_switch, true);
+    for (uint32_t f = 5u; f < TEST_FRAMES; f++)
+    {
+        process_frame(f, out);
+    }
+    HOST_TEST_CHECK(out[0] == &test_b[0][(TEST_FRAMES - 1u) * TEST_FRAME_SAMPLES]);
+}
+
+int main(void)
+{
+    HOST_TEST_RUN(test_init_rejects_bad_arguments);
+    HOST_TEST_RUN(test_settled_output_points_to_input);
+    HOST_TEST_RUN(test_delay_aligns_a_across_frames);
+    HOST_TEST_RUN(test_set_delay_bounds);
+    HOST_TEST_RUN(test_crossfade_ramps_and_reverses);
+    HOST_TEST_RUN(test_missing_channels_are_silent);
+    HOST_TEST_RUN(test_replaced_b_follows_delayed_a);
+    return 0;
+}
+
+/* [] END OF FILE */
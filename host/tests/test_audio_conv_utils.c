@@ -0,0 +1,374 @@
+/******************************************************************************
+* File Name : test_audio_conv_utils.c
+*
+* Description :
+* Host tests of the audio conversion kernels. audio_conv_utils.c is built
+* with AUDIO_CONV_USE_MVE=1 against the emulated MVE intrinsics and every
+* vector path is compared with the scalar reference.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "host_test.h"
+#include "audio_conv_utils.h"
+#include "arm_mve.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TEST_MAX_CHANNELS               (4u)
+/* Longest frame of the frame size matrix */
+#define TEST_MAX_FRAME_MS               (20u)
+#define TEST_MAX_FRAME_LEN              ((AUDIO_PIPELINE_SAMPLES_PER_MS * TEST_MAX_FRAME_MS) + 16u)
+#define TEST_BUFFER_SAMPLES             (TEST_MAX_CHANNELS * TEST_MAX_FRAME_LEN)
+
+/* Canary value written past the expected output */
+#define TEST_CANARY                     (0xA5A5u)
+
+#if !AUDIO_CONV_USE_MVE
+#error "The conversion test needs AUDIO_CONV_USE_MVE=1"
+#endif /* AUDIO_CONV_USE_MVE */
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+uint32_t host_mve_ops = 0;
+
+/* Whole vector lengths, the pipeline frame and lengths with a scalar tail */
+static const uint32_t test_frame_lens[] = { 8u, 16u, AUDIO_PIPELINE_SAMPLES_PER_FRAME, 1u, 13u, 165u };
+
+/* Frame size and channel count matrix of the pipeline configurations */
+static const uint32_t test_frame_ms[] = { 5u, 10u, TEST_MAX_FRAME_MS };
+static const uint32_t test_channels[] = { 1u, 2u, 4u };
+
+static uint16_t test_input[TEST_BUFFER_SAMPLES];
+static uint16_t test_output[TEST_BUFFER_SAMPLES + 1u];
+static uint16_t test_expected[TEST_BUFFER_SAMPLES + 1u];
+
+/*******************************************************************************
+* Function Name: fill_input
+********************************************************************************
+* Summary:
+* Fills the input with a pattern that differs in every sample and channel.
+*
+*******************************************************************************/
+static void fill_input(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < TEST_BUFFER_SAMPLES; i++)
+    {
+        test_input[i] = (uint16_t)((i * 40503u) ^ 0x1234u);
+    }
+}
+
+/*******************************************************************************
+* Function Name: clear_outputs
+********************************************************************************
+* Summary:
+* Fills both outputs with the canary so that writes past 'samples' show up.
+*
+*******************************************************************************/
+static void clear_outputs(uint32_t samples)
+{
+    uint32_t i;
+
+    for (i = 0; i <= TEST_BUFFER_SAMPLES; i++)
+    {
+        test_output[i] = TEST_CANARY;
+        test_expected[i] = TEST_CANARY;
+    }
+    HOST_TEST_CHECK(samples <= TEST_BUFFER_SAMPLES);
+}
+
+/*******************************************************************************
+* Function Name: check_outputs
+********************************************************************************
+* Summary:
+* Compares the kernel output with the reference, canary included.
+*
+*******************************************************************************/
+static void check_outputs(const char *name, uint32_t frame_len, uint32_t num_channels)
+{
+    if (0 != memcmp(test_output, test_expected, sizeof(test_output)))
+    {
+        HOST_TEST_FAIL("%s differs from the reference, %u samples, %u channels",
+                       name, (unsigned)frame_len, (unsigned)num_channels);
+    }
+}
+
+static void test_deinterleave_matches_scalar(void)
+{
+    uint32_t n;
+    uint32_t ch;
+    uint32_t i;
+    uint32_t num_channels;
+    uint32_t frame_len;
+    uint32_t stride;
+
+    for (n = 0; n < (sizeof(test_frame_lens) / sizeof(test_frame_lens[0])); n++)
+    {
+        for (num_channels = 1; num_channels <= TEST_MAX_CHANNELS; num_channels++)
+        {
+            frame_len = test_frame_lens[n];
+            stride = frame_len + 3u;
+            clear_outputs(stride * num_channels);
+            for (ch = 0; ch < num_channels; ch++)
+            {
+                for (i = 0; i < frame_len; i++)
+                {
+                    test_expected[(ch * stride) + i] = test_input[(i * num_channels) + ch];
+                }
+            }
+            audio_conv_deinterleave(test_input, test_output, frame_len, num_channels, stride);
+            check_outputs("audio_conv_deinterleave", frame_len, num_channels);
+        }
+    }
+}
+
+static void test_interleave_matches_scalar(void)
+{
+    uint32_t n;
+    uint32_t ch;
+    uint32_t i;
+    uint32_t num_channels;
+    uint32_t frame_len;
+    uint32_t stride;
+
+    for (n = 0; n < (sizeof(test_frame_lens) / sizeof(test_frame_lens[0])); n++)
+    {
+        for (num_channels = 1; num_channels <= TEST_MAX_CHANNELS; num_channels++)
+        {
+            frame_len = test_frame_lens[n];
+            stride = frame_len + 5u;
+            if ((stride * num_channels) > TEST_BUFFER_SAMPLES)
+            {
+                stride = frame_len;
+            }
+            clear_outputs(frame_len * num_channels);
+            for (ch = 0; ch < num_channels; ch++)
+            {
+                for (i = 0; i < frame_len; i++)
+                {
+                    test_expected[(i * num_channels) + ch] = test_input[(ch * stride) + i];
+                }
+            }
+            audio_conv_interleave(test_input, test_output, frame_len, num_channels, stride);
+            check_outputs("audio_conv_interleave", frame_len, num_channels);
+        }
+    }
+}
+
+static void test_interleave_planes_matches_scalar(void)
+{
+    const uint16_t *planes[TEST_MAX_CHANNELS];
+    uint32_t n;
+    uint32_t ch;
+    uint32_t i;
+    uint32_t num_channels;
+    uint32_t frame_len;
+
+    for (n = 0; n < (sizeof(test_frame_lens) / sizeof(test_frame_lens[0])); n++)
+    {
+        for (num_channels = 1; num_channels <= TEST_MAX_CHANNELS; num_channels++)
+        {
+            frame_len = test_frame_lens[n];
+            clear_outputs(frame_len * num_channels);
+            /* Planes in reverse order and at odd offsets, only 16-bit aligned */
+            for (ch = 0; ch < num_channels; ch++)
+            {
+                planes[ch] = test_input + 1u + ((num_channels - 1u - ch) * frame_len);
+            }
+            for (ch = 0; ch < num_channels; ch++)
+            {
+                for (i = 0; i < frame_len; i++)
+                {
+                    test_expected[(i * num_channels) + ch] = planes[ch][i];
+                }
+            }
+            audio_conv_interleave_planes(planes, test_output, frame_len, num_channels);
+            check_outputs("audio_conv_interleave_planes", frame_len, num_channels);
+        }
+    }
+}
+
+static void test_extract_and_replicate_match_scalar(void)
+{
+    uint32_t n;
+    uint32_t ch;
+    uint32_t i;
+    uint32_t num_channels;
+    uint32_t frame_len;
+
+    for (n = 0; n < (sizeof(test_frame_lens) / sizeof(test_frame_lens[0])); n++)
+    {
+        for (num_channels = 1; num_channels <= TEST_MAX_CHANNELS; num_channels++)
+        {
+            frame_len = test_frame_lens[n];
+            for (ch = 0; ch < num_channels; ch++)
+            {
+                clear_outputs(frame_len);
+                for (i = 0; i < frame_len; i++)
+                {
+                    test_expected[i] = test_input[(i * num_channels) + ch];
+                }
+                audio_conv_extract_channel(test_input, test_output, frame_len, num_channels, ch);
+                check_outputs("audio_conv_extract_channel", frame_len, num_channels);
+            }
+
+            clear_outputs(frame_len * num_channels);
+            for (i = 0; i < frame_len; i++)
+            {
+                for (ch = 0; ch < num_channels; ch++)
+                {
+                    test_expected[(i * num_channels) + ch] = test_input[i];
+                }
+            }
+            audio_conv_replicate(test_input, test_output, frame_len, num_channels);
+            check_outputs("audio_conv_replicate", frame_len, num_channels);
+        }
+    }
+}
+
+static void test_fixed_converters_match_reference(void)
+{
+    const uint32_t frame_samples = AUDIO_PIPELINE_SAMPLES_PER_FRAME;
+
+    clear_outputs(2u * frame_samples);
+    convert_stereo_non_interleaved_to_stereo_interleaved_ref(test_input, test_expected);
+    convert_stereo_non_interleaved_to_stereo_interleaved(test_input, test_output);
+    check_outputs("convert_stereo_non_interleaved_to_stereo_interleaved", frame_samples, 2u);
+
+    clear_outputs(2u * frame_samples);
+    convert_interleaved_to_stereo_non_interleaved_ref(test_input, test_expected);
+    convert_interleaved_to_stereo_non_interleaved(test_input, test_output);
+    check_outputs("convert_interleaved_to_stereo_non_interleaved", frame_samples, 2u);
+
+    clear_outputs(frame_samples);
+    convert_stereo_interleaved_to_mono_ref(test_input, test_expected);
+    convert_stereo_interleaved_to_mono(test_input, test_output);
+    check_outputs("convert_stereo_interleaved_to_mono", frame_samples, 2u);
+
+    clear_outputs(2u * frame_samples);
+    convert_mono_to_stereo_interleaved_ref(test_expected, test_input);
+    convert_mono_to_stereo_interleaved(test_output, test_input);
+    check_outputs("convert_mono_to_stereo_interleaved", frame_samples, 2u);
+}
+
+/*******************************************************************************
+* Function Name: test_frame_matrix_round_trips
+********************************************************************************
+* Summary:
+* At 5, 10 and 20 ms for 1, 2 and 4 channels, de-interleaving into frame
+* planes and interleaving back restores the input, and every plane holds its
+* channel.
+*
+*******************************************************************************/
+static void test_frame_matrix_round_trips(void)
+{
+    static uint16_t planar[TEST_BUFFER_SAMPLES];
+    const uint16_t *planes[TEST_MAX_CHANNELS];
+    uint32_t frame_len;
+    uint32_t num_channels;
+    uint32_t stride;
+
+    for (uint32_t m = 0; m < (sizeof(test_frame_ms) / sizeof(test_frame_ms[0])); m++)
+    {
+        for (uint32_t c = 0; c < (sizeof(test_channels) / sizeof(test_channels[0])); c++)
+        {
+            frame_len = AUDIO_PIPELINE_SAMPLES_PER_MS * test_frame_ms[m];
+            num_channels = test_channels[c];
+            /* Planes padded to whole vectors, as in the frame pool */
+            stride = (frame_len + 15u) & ~15u;
+
+            audio_conv_deinterleave(test_input, planar, frame_len, num_channels, stride);
+            for (uint32_t ch = 0; ch < num_channels; ch++)
+            {
+                audio_conv_extract_channel(test_input, test_output, frame_len, num_channels, ch);
+                if (0 != memcmp(&planar[ch * stride], test_output, frame_len * sizeof(uint16_t)))
+                {
+                    HOST_TEST_FAIL("channel %u differs at %u ms, %u channels", (unsigned)ch,
+                                   (unsigned)test_frame_ms[m], (unsigned)num_channels);
+                }
+                planes[ch] = &planar[ch * stride];
+            }
+
+            clear_outputs(frame_len * num_channels);
+            memcpy(test_expected, test_input, frame_len * num_channels * sizeof(uint16_t));
+            audio_conv_interleave(planar, test_output, frame_len, num_channels, stride);
+            check_outputs("audio_conv_interleave", frame_len, num_channels);
+
+            clear_outputs(frame_len * num_channels);
+            memcpy(test_expected, test_input, frame_len * num_channels * sizeof(uint16_t));
+            audio_conv_interleave_planes(planes, test_output, frame_len, num_channels);
+            check_outputs("audio_conv_interleave_planes", frame_len, num_channels);
+        }
+    }
+}
+
+static void test_vector_path_is_used(void)
+{
+    /* Stereo frames of whole vectors must not fall back to the scalar loop */
+    host_mve_ops = 0;
+    audio_conv_deinterleave(test_input, test_output, AUDIO_PIPELINE_SAMPLES_PER_FRAME, 2u,
+                            AUDIO_PIPELINE_SAMPLES_PER_FRAME);
+    HOST_TEST_EQUAL(host_mve_ops, 3u * (AUDIO_PIPELINE_SAMPLES_PER_FRAME / HOST_MVE_LANES));
+
+    host_mve_ops = 0;
+    convert_mono_to_stereo_interleaved(test_output, test_input);
+    HOST_TEST_EQUAL(host_mve_ops, 2u * (AUDIO_PIPELINE_SAMPLES_PER_FRAME / HOST_MVE_LANES));
+
+    /* Three channels have no vector kernel */
+    host_mve_ops = 0;
+    audio_conv_interleave(test_input, test_output, 16u, 3u, 16u);
+    HOST_TEST_EQUAL(host_mve_ops, 0);
+}
+
+int main(void)
+{
+    fill_input();
+
+    HOST_TEST_RUN(test_deinterleave_matches_scalar);
+    HOST_TEST_RUN(test_interleave_matches_scalar);
+    HOST_TEST_RUN(test_interleave_planes_matches_scalar);
+    HOST_TEST_RUN(test_extract_and_replicate_match_scalar);
+    HOST_TEST_RUN(test_fixed_converters_match_reference);
+    HOST_TEST_RUN(test_frame_matrix_round_trips);
+    HOST_TEST_RUN(test_vector_path_is_used);
+    return 0;
+}
+
+/* [] END OF FILE */
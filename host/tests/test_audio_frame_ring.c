@@ -0,0 +1,455 @@
+/******************************************************************************
+* File Name : test_audio_frame_ring.c
+*
+* Description :
+* Host tests of the SPSC audio frame ring.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include "host_test.h"
+#include "audio_frame_ring.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TEST_SLOT_SIZE                  (16u)
+#define TEST_SLOT_COUNT                 (4u)
+
+/* Frames streamed by the two-thread test and the flush interval of the
+ * producer in frames
+ */
+#define TEST_STRESS_FRAMES              (400000u)
+#define TEST_STRESS_FLUSH_INTERVAL      (9973u)
+#define TEST_STRESS_CHECK_WORDS         (6u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Frame of the two-thread test. The check words are derived from the
+ * sequence number so that a frame read before it was fully written shows up.
+ */
+typedef struct
+{
+    uint32_t seq;
+    uint32_t epoch;                     /* Flushes requested before the frame was filled */
+    uint32_t check[TEST_STRESS_CHECK_WORDS];
+} stress_frame_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static uint8_t ring_storage[TEST_SLOT_SIZE * TEST_SLOT_COUNT];
+static audio_frame_ring_t ring;
+
+static stress_frame_t stress_storage[TEST_SLOT_COUNT];
+static audio_frame_ring_t stress_ring;
+
+/* Written by the producer before the commit that publishes a later frame */
+static uint8_t stress_committed[TEST_STRESS_FRAMES];
+static uint32_t stress_producer_overruns = 0;
+static uint32_t stress_producer_commits = 0;
+static uint32_t stress_flushes = 0;
+static volatile uint32_t stress_producer_done = 0;
+
+/*******************************************************************************
+* Function Name: ring_setup
+********************************************************************************
+* Summary:
+* Initializes the ring under test.
+*
+*******************************************************************************/
+static void ring_setup(void)
+{
+    HOST_TEST_EQUAL(audio_frame_ring_init(&ring, ring_storage, TEST_SLOT_SIZE,
+                                          TEST_SLOT_COUNT), CY_RSLT_SUCCESS);
+}
+
+/*******************************************************************************
+* Function Name: fill_frame
+********************************************************************************
+* Summary:
+* Fills a frame with a pattern derived from its sequence number.
+*
+*******************************************************************************/
+static void fill_frame(uint8_t *frame, uint32_t seq)
+{
+    memset(frame, (int)(seq & 0xFFu), TEST_SLOT_SIZE);
+}
+
+static void test_init_rejects_bad_arguments(void)
+{
+    HOST_TEST_EQUAL(audio_frame_ring_init(NULL, ring_storage, TEST_SLOT_SIZE,
+                                          TEST_SLOT_COUNT), (cy_rslt_t)AUDIO_FRAME_RING_FAILURE);
+    HOST_TEST_EQUAL(audio_frame_ring_init(&ring, NULL, TEST_SLOT_SIZE,
+                                          TEST_SLOT_COUNT), (cy_rslt_t)AUDIO_FRAME_RING_FAILURE);
+    HOST_TEST_EQUAL(audio_frame_ring_init(&ring, ring_storage, 0,
+                                          TEST_SLOT_COUNT), (cy_rslt_t)AUDIO_FRAME_RING_FAILURE);
+    HOST_TEST_EQUAL(audio_frame_ring_init(&ring, ring_storage, TEST_SLOT_SIZE,
+                                          0), (cy_rslt_t)AUDIO_FRAME_RING_FAILURE);
+}
+
+static void test_write_read_in_order_across_wrap(void)
+{
+    uint8_t in[TEST_SLOT_SIZE];
+    uint8_t out[TEST_SLOT_SIZE];
+    uint8_t expected[TEST_SLOT_SIZE];
+    uint32_t seq;
+
+    ring_setup();
+
+    /* Several laps so that both index halves and the wrap are exercised */
+    for (seq = 0; seq < (5u * TEST_SLOT_COUNT); seq++)
+    {
+        fill_frame(in, seq);
+        HOST_TEST_EQUAL(audio_frame_ring_write(&ring, in), CY_RSLT_SUCCESS);
+        if (seq & 1u)
+        {
+            HOST_TEST_EQUAL(audio_frame_ring_depth(&ring), 2);
+            fill_frame(expected, seq - 1u);
+            HOST_TEST_EQUAL(audio_frame_ring_read(&ring, out), CY_RSLT_SUCCESS);
+            HOST_TEST_CHECK(0 == memcmp(out, expected, TEST_SLOT_SIZE));
+            fill_frame(expected, seq);
+            HOST_TEST_EQUAL(audio_frame_ring_read(&ring, out), CY_RSLT_SUCCESS);
+            HOST_TEST_CHECK(0 == memcmp(out, expected, TEST_SLOT_SIZE));
+        }
+    }
+    HOST_TEST_EQUAL(audio_frame_ring_depth(&ring), 0);
+}
+
+static void test_full_ring_counts_overruns(void)
+{
+    uint8_t in[TEST_SLOT_SIZE];
+    uint8_t out[TEST_SLOT_SIZE];
+    audio_frame_ring_stats_t stats;
+    uint32_t seq;
+
+    ring_setup();
+
+    for (seq = 0; seq < TEST_SLOT_COUNT; seq++)
+    {
+        fill_frame(in, seq);
+        HOST_TEST_EQUAL(audio_frame_ring_write(&ring, in), CY_RSLT_SUCCESS);
+    }
+    HOST_TEST_CHECK(NULL == audio_frame_ring_reserve(&ring));
+    HOST_TEST_EQUAL(audio_frame_ring_write(&ring, in), (cy_rslt_t)AUDIO_FRAME_RING_FAILURE);
+
+    audio_frame_ring_get_stats(&ring, &stats);
+    HOST_TEST_EQUAL(stats.depth, TEST_SLOT_COUNT);
+    HOST_TEST_EQUAL(stats.max_depth, TEST_SLOT_COUNT);
+    HOST_TEST_EQUAL(stats.overruns, 2);
+    HOST_TEST_EQUAL(stats.underruns, 0);
+
+    /* The oldest frame survives the overrun */
+    fill_frame(in, 0);
+    HOST_TEST_EQUAL(audio_frame_ring_read(&ring, out), CY_RSLT_SUCCESS);
+    HOST_TEST_CHECK(0 == memcmp(out, in, TEST_SLOT_SIZE));
+}
+
+static void test_reserve_commit_in_place(void)
+{
+    uint8_t *slot;
+    uint8_t *peeked;
+
+    ring_setup();
+
+    slot = audio_frame_ring_reserve(&ring);
+    HOST_TEST_CHECK(NULL != slot);
+    fill_frame(slot, 7u);
+
+    /* Not visible before commit */
+    HOST_TEST_CHECK(NULL == audio_frame_ring_peek(&ring));
+    audio_frame_ring_commit(&ring);
+
+    peeked = audio_frame_ring_peek(&ring);
+    HOST_TEST_CHECK(peeked == slot);
+    HOST_TEST_EQUAL(peeked[0], 7);
+    audio_frame_ring_release(&ring);
+    HOST_TEST_EQUAL(audio_frame_ring_depth(&ring), 0);
+}
+
+static void test_reserve_ahead_matches_later_reserves(void)
+{
+    uint8_t out[TEST_SLOT_SIZE];
+    uint8_t *ahead[TEST_SLOT_COUNT];
+    audio_frame_ring_stats_t stats;
+    uint32_t lap;
+    uint32_t i;
+
+    ring_setup();
+    memset(out, 0, sizeof(out));
+
+    /* Start one slot before the wrap, then keep one frame queued */
+    for (lap = 0; lap < 3u; lap++)
+    {
+        HOST_TEST_EQUAL(audio_frame_ring_write(&ring, out), CY_RSLT_SUCCESS);
+        HOST_TEST_EQUAL(audio_frame_ring_read(&ring, out), CY_RSLT_SUCCESS);
+    }
+    HOST_TEST_EQUAL(audio_frame_ring_write(&ring, out), CY_RSLT_SUCCESS);
+
+    for (i = 0; i < (TEST_SLOT_COUNT - 1u); i++)
+    {
+        ahead[i] = audio_frame_ring_reserve_ahead(&ring, i);
+        HOST_TEST_CHECK(NULL != ahead[i]);
+    }
+    HOST_TEST_CHECK(NULL == audio_frame_ring_reserve_ahead(&ring, TEST_SLOT_COUNT - 1u));
+
+    /* Slots reserved ahead are the ones the producer gets next, in order */
+    for (i = 0; i < (TEST_SLOT_COUNT - 1u); i++)
+    {
+        HOST_TEST_CHECK(ahead[i] == audio_frame_ring_reserve(&ring));
+        fill_frame(ahead[i], i);
+        audio_frame_ring_commit(&ring);
+        HOST_TEST_CHECK(NULL == audio_frame_ring_reserve_ahead(&ring, TEST_SLOT_COUNT - 1u - i));
+    }
+
+    /* A full look ahead is not an overrun */
+    audio_frame_ring_get_stats(&ring, &stats);
+    HOST_TEST_EQUAL(stats.overruns, 0);
+
+    HOST_TEST_EQUAL(audio_frame_ring_read(&ring, out), CY_RSLT_SUCCESS);
+    for (i = 0; i < (TEST_SLOT_COUNT - 1u); i++)
+    {
+        HOST_TEST_EQUAL(audio_frame_ring_read(&ring, out), CY_RSLT_SUCCESS);
+        HOST_TEST_EQUAL(out[0], i);
+    }
+}
+
+static void test_empty_peek_is_not_an_underrun(void)
+{
+    uint8_t out[TEST_SLOT_SIZE];
+    audio_frame_ring_stats_t stats;
+    uint32_t i;
+
+    ring_setup();
+
+    /* Polling an empty ring, as the AE worker does, is not an underrun */
+    for (i = 0; i < 10u; i++)
+    {
+        HOST_TEST_CHECK(NULL == audio_frame_ring_peek(&ring));
+        HOST_TEST_EQUAL(audio_frame_ring_read(&ring, out), (cy_rslt_t)AUDIO_FRAME_RING_FAILURE);
+    }
+    audio_frame_ring_get_stats(&ring, &stats);
+    HOST_TEST_EQUAL(stats.underruns, 0);
+
+    /* Only a consumer that needed the frame counts one */
+    audio_frame_ring_count_underrun(&ring);
+    audio_frame_ring_get_stats(&ring, &stats);
+    HOST_TEST_EQUAL(stats.underruns, 1);
+}
+
+static void test_flush_drops_committed_frames(void)
+{
+    uint8_t in[TEST_SLOT_SIZE];
+    uint8_t out[TEST_SLOT_SIZE];
+    uint32_t seq;
+
+    ring_setup();
+
+    for (seq = 0; seq < 3u; seq++)
+    {
+        fill_frame(in, seq);
+        HOST_TEST_EQUAL(audio_frame_ring_write(&ring, in), CY_RSLT_SUCCESS);
+    }
+    audio_frame_ring_flush(&ring);
+
+    /* The depth is updated by the consumer on its next peek */
+    HOST_TEST_CHECK(NULL == audio_frame_ring_peek(&ring));
+    HOST_TEST_EQUAL(audio_frame_ring_depth(&ring), 0);
+
+    /* A release after the flush must not move the tail past the head */
+    audio_frame_ring_release(&ring);
+    HOST_TEST_EQUAL(audio_frame_ring_depth(&ring), 0);
+
+    fill_frame(in, 9u);
+    HOST_TEST_EQUAL(audio_frame_ring_write(&ring, in), CY_RSLT_SUCCESS);
+    HOST_TEST_EQUAL(audio_frame_ring_read(&ring, out), CY_RSLT_SUCCESS);
+    HOST_TEST_CHECK(0 == memcmp(out, in, TEST_SLOT_SIZE));
+}
+
+/*******************************************************************************
+* Function Name: stress_producer
+********************************************************************************
+* Summary:
+* Streams sequence numbered frames as fast as possible. A full ring drops the
+* frame, and a flush is requested every TEST_STRESS_FLUSH_INTERVAL frames.
+*
+*******************************************************************************/
+static void* stress_producer(void *arg)
+{
+    stress_frame_t *frame = NULL;
+
+    (void)arg;
+    for (uint32_t seq = 0; seq < TEST_STRESS_FRAMES; seq++)
+    {
+        if ((0u != seq) && (0u == (seq % TEST_STRESS_FLUSH_INTERVAL)))
+        {
+            stress_flushes++;
+            audio_frame_ring_flush(&stress_ring);
+        }
+
+        frame = audio_frame_ring_reserve(&stress_ring);
+        if (NULL == frame)
+        {
+            stress_producer_overruns++;
+            (void)sched_yield();
+            continue;
+        }
+
+        frame->seq = seq;
+        frame->epoch = stress_flushes;
+        for (uint32_t i = 0; i < TEST_STRESS_CHECK_WORDS; i++)
+        {
+            frame->check[i] = seq * (i + 1u);
+        }
+        stress_committed[seq] = 1u;
+        stress_producer_commits++;
+        audio_frame_ring_commit(&stress_ring);
+    }
+
+    __atomic_store_n(&stress_producer_done, 1u, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: test_two_threads_keep_order_and_account_losses
+********************************************************************************
+* Summary:
+* Runs the producer and the consumer on separate threads. The consumer must
+* see the frames complete and in order. A committed frame may only be lost
+* to a flush: once a frame of a later flush epoch is read, that flush has
+* been applied, so a gap between two frames of the same epoch is an error.
+* Frames dropped on a full ring must match the overrun counter.
+*
+*******************************************************************************/
+static void test_two_threads_keep_order_and_account_losses(void)
+{
+    pthread_t producer;
+    audio_frame_ring_stats_t stats;
+    const stress_frame_t *frame = NULL;
+    uint32_t consumed = 0;
+    uint32_t flushed = 0;
+    uint32_t underruns = 0;
+    uint32_t last_seq = 0;
+    uint32_t last_epoch = 0;
+    bool have_last = false;
+    bool done = false;
+
+    memset(stress_committed, 0, sizeof(stress_committed));
+    HOST_TEST_EQUAL(audio_frame_ring_init(&stress_ring, stress_storage, sizeof(stress_frame_t),
+                                          TEST_SLOT_COUNT), CY_RSLT_SUCCESS);
+    HOST_TEST_EQUAL(pthread_create(&producer, NULL, stress_producer, NULL), 0);
+
+    while (true)
+    {
+        /* Sample the end of the stream before the peek, so that the last
+         * frames are drained
+         */
+        done = (0u != __atomic_load_n(&stress_producer_done, __ATOMIC_ACQUIRE));
+        frame = audio_frame_ring_peek(&stress_ring);
+        if (NULL == frame)
+        {
+            if (done)
+            {
+                break;
+            }
+            audio_frame_ring_count_underrun(&stress_ring);
+            underruns++;
+            (void)sched_yield();
+            continue;
+        }
+
+        for (uint32_t i = 0; i < TEST_STRESS_CHECK_WORDS; i++)
+        {
+            HOST_TEST_EQUAL(frame->check[i], frame->seq * (i + 1u));
+        }
+        HOST_TEST_CHECK(frame->seq < TEST_STRESS_FRAMES);
+        HOST_TEST_CHECK(!have_last || (frame->seq > last_seq));
+        HOST_TEST_CHECK(!have_last || (frame->epoch >= last_epoch));
+
+        for (uint32_t seq = have_last ? (last_seq + 1u) : 0u; seq < frame->seq; seq++)
+        {
+            if (0u != stress_committed[seq])
+            {
+                HOST_TEST_CHECK(frame->epoch > (have_last ? last_epoch : 0u));
+                flushed++;
+            }
+        }
+
+        last_seq = frame->seq;
+        last_epoch = frame->epoch;
+        have_last = true;
+        consumed++;
+        audio_frame_ring_release(&stress_ring);
+    }
+
+    HOST_TEST_EQUAL(pthread_join(producer, NULL), 0);
+
+    /* Committed frames after the last one read can only have been flushed */
+    for (uint32_t seq = have_last ? (last_seq + 1u) : 0u; seq < TEST_STRESS_FRAMES; seq++)
+    {
+        flushed += stress_committed[seq];
+    }
+
+    audio_frame_ring_get_stats(&stress_ring, &stats);
+    HOST_TEST_EQUAL(consumed + flushed, stress_producer_commits);
+    HOST_TEST_EQUAL(stress_producer_commits + stress_producer_overruns, TEST_STRESS_FRAMES);
+    HOST_TEST_EQUAL(stats.overruns, stress_producer_overruns);
+    HOST_TEST_EQUAL(stats.underruns, underruns);
+    HOST_TEST_EQUAL(stats.depth, 0);
+    HOST_TEST_CHECK(stats.max_depth <= TEST_SLOT_COUNT);
+    HOST_TEST_CHECK(consumed > 0u);
+    printf("  %lu frames read, %lu overruns, %lu flushed by %lu flushes\n",
+           (unsigned long)consumed, (unsigned long)stress_producer_overruns,
+           (unsigned long)flushed, (unsigned long)stress_flushes);
+}
+
+int main(void)
+{
+    HOST_TEST_RUN(test_init_rejects_bad_arguments);
+    HOST_TEST_RUN(test_write_read_in_order_across_wrap);
+    HOST_TEST_RUN(test_full_ring_counts_overruns);
+    HOST_TEST_RUN(test_reserve_commit_in_place);
+    HOST_TEST_RUN(test_reserve_ahead_matches_later_reserves);
+    HOST_TEST_RUN(test_empty_peek_is_not_an_underrun);
+    HOST_TEST_RUN(test_flush_drops_committed_frames);
+    HOST_TEST_RUN(test_two_threads_keep_order_and_account_losses);
+    return 0;
+}
+
+/* [] END OF FILE */
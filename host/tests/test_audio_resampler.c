@@ -0,0 +1,347 @@
+/******************************************************************************
+* File Name : test_audio_resampler.c
+*
+* Description :
+* Host test of the polyphase resampler: rate pairs, output counts, a scalar
+* reference of the filter on the MVE path, passband gain and stopband
+* rejection.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <math.h>
+#include <string.h>
+#include "host_test.h"
+#include "audio_resampler.h"
+#include "arm_mve.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TEST_PI                         (3.14159265358979)
+
+/* One second of input at the highest rate, stereo */
+#define TEST_MAX_IN_FRAMES              (48000u)
+#define TEST_MAX_CHANNELS               (2u)
+#define TEST_MAX_OUT_FRAMES             (3u * TEST_MAX_IN_FRAMES)
+
+/* Output frames skipped before a level is measured, past the filter delay */
+#define TEST_SETTLE_FRAMES              (1000u)
+
+#if !AUDIO_RESAMPLER_USE_MVE
+#error "The resampler test needs AUDIO_RESAMPLER_USE_MVE=1"
+#endif /* AUDIO_RESAMPLER_USE_MVE */
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+uint32_t host_mve_ops = 0;
+
+static audio_resampler_t resampler;
+static int16_t test_in[TEST_MAX_IN_FRAMES * TEST_MAX_CHANNELS];
+static int16_t test_out[TEST_MAX_OUT_FRAMES * TEST_MAX_CHANNELS];
+static int16_t test_expected[TEST_MAX_OUT_FRAMES * TEST_MAX_CHANNELS];
+
+/*******************************************************************************
+* Function Name: reference_resample
+********************************************************************************
+* Summary:
+* Straightforward reference of the polyphase filter with the coefficients of
+* an initialized resampler: each input frame emits the phases that fall
+* before the next input frame, each filtered over the last taps_per_phase
+* inputs with the zero history of a fresh resampler.
+*
+*******************************************************************************/
+static uint32_t reference_resample(const audio_resampler_t *r, const int16_t *in,
+                                   uint32_t in_frames, int16_t *out)
+{
+    uint32_t taps = r->taps_per_phase;
+    uint32_t phase = 0;
+    uint32_t out_frames = 0;
+    uint32_t i;
+    uint32_t ch;
+    uint32_t j;
+    int64_t acc;
+    int32_t index;
+
+    for (i = 0; i < in_frames; i++)
+    {
+        while (phase < r->up)
+        {
+            for (ch = 0; ch < r->channels; ch++)
+            {
+                acc = 0;
+                for (j = 0; j < taps; j++)
+                {
+                    index = (int32_t)i - (int32_t)(taps - 1u) + (int32_t)j;
+                    if (index >= 0)
+                    {
+                        acc += (int32_t)in[((uint32_t)index * r->channels) + ch] *
+                               r->coeffs[(phase * taps) + j];
+                    }
+                }
+                acc = (acc + (1 << 14)) >> 15;
+                acc = (acc > INT16_MAX) ? INT16_MAX : ((acc < INT16_MIN) ? INT16_MIN : acc);
+                *out++ = (int16_t)acc;
+            }
+            out_frames++;
+            phase += r->down;
+        }
+        phase -= r->up;
+    }
+    return out_frames;
+}
+
+/*******************************************************************************
+* Function Name: fill_tone
+********************************************************************************
+* Summary:
+* Fills interleaved frames with a sine per channel, channel ch at
+* (ch + 1) * freq_hz.
+*
+*******************************************************************************/
+static void fill_tone(int16_t *buffer, uint32_t frames, uint32_t channels,
+                      double freq_hz, uint32_t rate_hz, double amplitude)
+{
+    uint32_t i;
+    uint32_t ch;
+
+    for (i = 0; i < frames; i++)
+    {
+        for (ch = 0; ch < channels; ch++)
+        {
+            buffer[(i * channels) + ch] = (int16_t)lrint(amplitude *
+                    sin((2.0 * TEST_PI * freq_hz * (double)(ch + 1u) * (double)i) / (double)rate_hz));
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: channel_rms
+********************************************************************************
+* Summary:
+* RMS of one channel of interleaved frames, from TEST_SETTLE_FRAMES on.
+*
+*******************************************************************************/
+static double channel_rms(const int16_t *buffer, uint32_t frames, uint32_t channels, uint32_t ch)
+{
+    double sum = 0.0;
+    uint32_t i;
+
+    for (i = TEST_SETTLE_FRAMES; i < frames; i++)
+    {
+        sum += (double)buffer[(i * channels) + ch] * (double)buffer[(i * channels) + ch];
+    }
+    return sqrt(sum / (double)(frames - TEST_SETTLE_FRAMES));
+}
+
+/*******************************************************************************
+* Function Name: resample_in_packets
+********************************************************************************
+* Summary:
+* Resamples a buffer in 1 msec packets, as the USB paths do, and checks the
+* output count of each call against AUDIO_RESAMPLER_MAX_OUTPUT.
+*
+*******************************************************************************/
+static uint32_t resample_in_packets(const int16_t *in, uint32_t in_frames,
+                                    uint32_t in_rate_hz, int16_t *out)
+{
+    uint32_t packet = in_rate_hz / 1000u;
+    uint32_t channels = resampler.channels;
+    uint32_t total = 0;
+    uint32_t count;
+    uint32_t frames;
+    uint32_t i;
+
+    for (i = 0; i < in_frames; i += packet)
+    {
+        count = ((in_frames - i) < packet) ? (in_frames - i) : packet;
+        frames = audio_resampler_process(&resampler, &in[i * channels], count,
+                                         &out[total * channels]);
+        HOST_TEST_CHECK(frames <= AUDIO_RESAMPLER_MAX_OUTPUT(count, resampler.up, resampler.down));
+        total += frames;
+    }
+    return total;
+}
+
+static void test_init_rejects_unsupported_ratios(void)
+{
+    HOST_TEST_EQUAL(audio_resampler_init(&resampler, 0u, 48000u, 2u),
+                    (cy_rslt_t)AUDIO_RESAMPLER_FAILURE);
+    HOST_TEST_EQUAL(audio_resampler_init(&resampler, 48000u, 0u, 2u),
+                    (cy_rslt_t)AUDIO_RESAMPLER_FAILURE);
+    HOST_TEST_EQUAL(audio_resampler_init(&resampler, 48000u, 16000u, 0u),
+                    (cy_rslt_t)AUDIO_RESAMPLER_FAILURE);
+    HOST_TEST_EQUAL(audio_resampler_init(&resampler, 48000u, 16000u, AUDIO_RESAMPLER_MAX_CHANNELS + 1u),
+                    (cy_rslt_t)AUDIO_RESAMPLER_FAILURE);
+
+    /* 44.1 kHz reduces to 147/160, 8 kHz against 48 kHz to a factor of 6 */
+    HOST_TEST_EQUAL(audio_resampler_init(&resampler, 44100u, 48000u, 2u),
+                    (cy_rslt_t)AUDIO_RESAMPLER_FAILURE);
+    HOST_TEST_EQUAL(audio_resampler_init(&resampler, 8000u, 48000u, 2u),
+                    (cy_rslt_t)AUDIO_RESAMPLER_FAILURE);
+
+    HOST_TEST_EQUAL(audio_resampler_init(&resampler, 48000u, 16000u, 2u), CY_RSLT_SUCCESS);
+    HOST_TEST_EQUAL(resampler.up, 1);
+    HOST_TEST_EQUAL(resampler.down, 3);
+    HOST_TEST_EQUAL(audio_resampler_init(&resampler, 32000u, 48000u, 2u), CY_RSLT_SUCCESS);
+    HOST_TEST_EQUAL(resampler.up, 3);
+    HOST_TEST_EQUAL(resampler.down, 2);
+}
+
+static void test_equal_rates_copy(void)
+{
+    uint32_t frames;
+
+    HOST_TEST_EQUAL(audio_resampler_init(&resampler, 16000u, 16000u, 2u), CY_RSLT_SUCCESS);
+    fill_tone(test_in, 160u, 2u, 1000.0, 16000u, 12000.0);
+
+    frames = audio_resampler_process(&resampler, test_in, 160u, test_out);
+    HOST_TEST_EQUAL(frames, 160);
+    HOST_TEST_CHECK(0 == memcmp(test_in, test_out, 160u * 2u * sizeof(int16_t)));
+}
+
+static void test_output_count_follows_ratio(void)
+{
+    static const uint32_t rates[][2] = {
+        { 48000u, 16000u }, { 16000u, 48000u }, { 32000u, 48000u },
+        { 48000u, 32000u }, { 32000u, 16000u }, { 24000u, 16000u },
+    };
+    uint32_t r;
+    uint32_t in_frames;
+    uint32_t frames;
+
+    for (r = 0; r < (sizeof(rates) / sizeof(rates[0])); r++)
+    {
+        HOST_TEST_EQUAL(audio_resampler_init(&resampler, rates[r][0], rates[r][1], 2u), CY_RSLT_SUCCESS);
+        in_frames = rates[r][0] / 10u;
+        memset(test_in, 0, in_frames * 2u * sizeof(int16_t));
+
+        /* 100 msec in 1 msec packets gives exactly 100 msec out */
+        frames = resample_in_packets(test_in, in_frames, rates[r][0], test_out);
+        HOST_TEST_EQUAL(frames, rates[r][1] / 10u);
+    }
+}
+
+static void test_vector_path_matches_reference(void)
+{
+    static const uint32_t rates[][2] = {
+        { 48000u, 16000u }, { 16000u, 48000u }, { 32000u, 48000u }, { 48000u, 32000u },
+    };
+    uint32_t r;
+    uint32_t in_frames;
+    uint32_t frames;
+    uint32_t expected;
+
+    for (r = 0; r < (sizeof(rates) / sizeof(rates[0])); r++)
+    {
+        HOST_TEST_EQUAL(audio_resampler_init(&resampler, rates[r][0], rates[r][1], 2u), CY_RSLT_SUCCESS);
+        in_frames = rates[r][0] / 50u;
+
+        /* Full scale content also exercises the saturation */
+        fill_tone(test_in, in_frames, 2u, 997.0, rates[r][0], 32767.0);
+
+        host_mve_ops = 0;
+        frames = resample_in_packets(test_in, in_frames, rates[r][0], test_out);
+        HOST_TEST_CHECK(0u != host_mve_ops);
+
+        expected = reference_resample(&resampler, test_in, in_frames, test_expected);
+        HOST_TEST_EQUAL(frames, expected);
+        HOST_TEST_CHECK(0 == memcmp(test_out, test_expected, frames * 2u * sizeof(int16_t)));
+    }
+}
+
+static void test_reset_restarts_the_stream(void)
+{
+    uint32_t first;
+    uint32_t second;
+
+    HOST_TEST_EQUAL(audio_resampler_init(&resampler, 48000u, 16000u, 2u), CY_RSLT_SUCCESS);
+    fill_tone(test_in, 4800u, 2u, 440.0, 48000u, 8000.0);
+
+    first = resample_in_packets(test_in, 4800u, 48000u, test_expected);
+    audio_resampler_reset(&resampler);
+    second = resample_in_packets(test_in, 4800u, 48000u, test_out);
+
+    HOST_TEST_EQUAL(first, second);
+    HOST_TEST_CHECK(0 == memcmp(test_out, test_expected, first * 2u * sizeof(int16_t)));
+}
+
+static void test_passband_gain_and_stopband(void)
+{
+    uint32_t frames;
+    double in_rms;
+    double out_rms;
+
+    /* Passband: 1 kHz and 2 kHz keep their level through 48 kHz to 16 kHz */
+    HOST_TEST_EQUAL(audio_resampler_init(&resampler, 48000u, 16000u, 2u), CY_RSLT_SUCCESS);
+    fill_tone(test_in, TEST_MAX_IN_FRAMES, 2u, 1000.0, 48000u, 10000.0);
+    frames = resample_in_packets(test_in, TEST_MAX_IN_FRAMES, 48000u, test_out);
+    in_rms = channel_rms(test_in, TEST_MAX_IN_FRAMES, 2u, 0u);
+    out_rms = channel_rms(test_out, frames, 2u, 0u);
+    HOST_TEST_NEAR(out_rms / in_rms, 1.0, 0.01);
+    out_rms = channel_rms(test_out, frames, 2u, 1u);
+    HOST_TEST_NEAR(out_rms / in_rms, 1.0, 0.01);
+
+    /* Stopband: 12 kHz would alias to 4 kHz, it must be at least 50 dB down */
+    HOST_TEST_EQUAL(audio_resampler_init(&resampler, 48000u, 16000u, 1u), CY_RSLT_SUCCESS);
+    fill_tone(test_in, TEST_MAX_IN_FRAMES, 1u, 12000.0, 48000u, 10000.0);
+    frames = resample_in_packets(test_in, TEST_MAX_IN_FRAMES, 48000u, test_out);
+    in_rms = channel_rms(test_in, TEST_MAX_IN_FRAMES, 1u, 0u);
+    out_rms = channel_rms(test_out, frames, 1u, 0u);
+    HOST_TEST_CHECK((20.0 * log10((out_rms + 1.0) / in_rms)) < -50.0);
+
+    /* Upsampling: 1 kHz from 16 kHz to 48 kHz keeps its level */
+    HOST_TEST_EQUAL(audio_resampler_init(&resampler, 16000u, 48000u, 1u), CY_RSLT_SUCCESS);
+    fill_tone(test_in, 16000u, 1u, 1000.0, 16000u, 10000.0);
+    frames = resample_in_packets(test_in, 16000u, 16000u, test_out);
+    HOST_TEST_EQUAL(frames, 48000);
+    in_rms = channel_rms(test_in, 16000u, 1u, 0u);
+    out_rms = channel_rms(test_out, frames, 1u, 0u);
+    HOST_TEST_NEAR(out_rms / in_rms, 1.0, 0.01);
+}
+
+int main(void)
+{
+    HOST_TEST_RUN(test_init_rejects_unsupported_ratios);
+    HOST_TEST_RUN(test_equal_rates_copy);
+    HOST_TEST_RUN(test_output_count_follows_ratio);
+    HOST_TEST_RUN(test_vector_path_matches_reference);
+    HOST_TEST_RUN(test_reset_restarts_the_stream);
+    HOST_TEST_RUN(test_passband_gain_and_stopband);
+    return 0;
+}
+
+/* [] END OF FILE */
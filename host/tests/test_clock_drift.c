@@ -0,0 +1,165 @@
+/******************************************************************************
+* File Name : test_clock_drift.c
+*
+* Description :
+* Host tests of the clock drift estimator and the USB feedback value.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "host_test.h"
+#include "clock_drift.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TEST_FRAME_SAMPLES              (160u)
+
+/* 10.14 value of one sample per 1 ms frame */
+#define TEST_FEEDBACK_ONE_SAMPLE        (1u << 14)
+
+/*******************************************************************************
+* Function Name: run_estimator
+********************************************************************************
+* Summary:
+* Feeds the estimator with a buffer fill that drifts by drift_ppm relative to
+* the consumer, with a periodic jitter of +/- jitter samples, and returns the
+* estimate.
+*
+*******************************************************************************/
+static float run_estimator(clock_drift_estimator_t *estimator, double drift_ppm,
+                           int32_t jitter, uint32_t updates)
+{
+    uint32_t consumed = 0;
+    double produced = 0.0;
+    int32_t fill;
+    uint32_t i;
+
+    for (i = 0; i < updates; i++)
+    {
+        produced += (double)TEST_FRAME_SAMPLES * (1.0 + (drift_ppm * 1.0e-6));
+        fill = (int32_t)produced - (int32_t)consumed + (((i % 4u) < 2u) ? jitter : -jitter);
+        clock_drift_update(estimator, consumed, fill);
+        consumed += TEST_FRAME_SAMPLES;
+    }
+    return clock_drift_get_ppm(estimator);
+}
+
+static void test_not_valid_before_min_updates(void)
+{
+    clock_drift_estimator_t estimator;
+
+    clock_drift_init(&estimator, 0u);
+    HOST_TEST_EQUAL(estimator.time_constant, CLOCK_DRIFT_DEFAULT_TIME_CONSTANT);
+    (void)run_estimator(&estimator, 300.0, 0, CLOCK_DRIFT_MIN_UPDATES - 1u);
+    HOST_TEST_CHECK(!clock_drift_is_valid(&estimator));
+    HOST_TEST_EQUAL(clock_drift_get_ppm(&estimator), 0);
+
+    (void)run_estimator(&estimator, 300.0, 0, 1u);
+    HOST_TEST_CHECK(clock_drift_is_valid(&estimator));
+}
+
+static void test_estimates_drift(void)
+{
+    const double drifts[] = { -500.0, -50.0, 0.0, 120.0, 700.0 };
+    clock_drift_estimator_t estimator;
+    uint32_t i;
+
+    for (i = 0; i < (sizeof(drifts) / sizeof(drifts[0])); i++)
+    {
+        clock_drift_init(&estimator, CLOCK_DRIFT_DEFAULT_TIME_CONSTANT);
+        HOST_TEST_NEAR(run_estimator(&estimator, drifts[i], 0, 3000u), drifts[i], 2.0);
+
+        /* Arrival jitter of a few packets only slows the convergence */
+        clock_drift_init(&estimator, CLOCK_DRIFT_DEFAULT_TIME_CONSTANT);
+        HOST_TEST_NEAR(run_estimator(&estimator, drifts[i], 48, 6000u), drifts[i], 10.0);
+    }
+}
+
+static void test_long_run_in_single_precision(void)
+{
+    clock_drift_estimator_t estimator;
+
+    /* Two hours of 10 ms frames */
+    clock_drift_init(&estimator, CLOCK_DRIFT_DEFAULT_TIME_CONSTANT);
+    HOST_TEST_NEAR(run_estimator(&estimator, 250.0, 48, 720000u), 250.0, 10.0);
+    HOST_TEST_CHECK(fabsf(estimator.lag) < (float)(CLOCK_DRIFT_DEFAULT_TIME_CONSTANT * TEST_FRAME_SAMPLES));
+}
+
+static void test_clamps_and_resets(void)
+{
+    clock_drift_estimator_t estimator;
+
+    clock_drift_init(&estimator, 1000u);
+    HOST_TEST_NEAR(run_estimator(&estimator, 5000.0, 0, 1000u), CLOCK_DRIFT_MAX_PPM, 0.0);
+    clock_drift_reset(&estimator);
+    HOST_TEST_EQUAL(estimator.time_constant, 1000u);
+    HOST_TEST_CHECK(!clock_drift_is_valid(&estimator));
+    HOST_TEST_NEAR(run_estimator(&estimator, -5000.0, 0, 1000u), -CLOCK_DRIFT_MAX_PPM, 0.0);
+}
+
+static void test_feedback_value(void)
+{
+    uint32_t nominal;
+
+    /* 48 and 16 samples per 1 ms frame */
+    HOST_TEST_EQUAL(clock_drift_feedback_10_14(48000u, 0.0f, 0), 48u * TEST_FEEDBACK_ONE_SAMPLE);
+    HOST_TEST_EQUAL(clock_drift_feedback_10_14(16000u, 0.0f, 0), 16u * TEST_FEEDBACK_ONE_SAMPLE);
+    HOST_TEST_EQUAL(clock_drift_feedback_10_14(44100u, 0.0f, 0),
+                    (uint32_t)((44.1 * TEST_FEEDBACK_ONE_SAMPLE) + 0.5));
+
+    /* A host faster than the device is asked for fewer samples */
+    nominal = clock_drift_feedback_10_14(48000u, 0.0f, 0);
+    HOST_TEST_NEAR(clock_drift_feedback_10_14(48000u, 100.0f, 0),
+                   nominal / (1.0 + 100.0e-6), 1.0);
+    HOST_TEST_CHECK(clock_drift_feedback_10_14(48000u, -100.0f, 0) > nominal);
+
+    /* A fill above the target is drained over CLOCK_DRIFT_FEEDBACK_SERVO_MS */
+    HOST_TEST_NEAR(clock_drift_feedback_10_14(48000u, 0.0f, (int32_t)CLOCK_DRIFT_FEEDBACK_SERVO_MS),
+                   nominal - TEST_FEEDBACK_ONE_SAMPLE, 1.0);
+    HOST_TEST_EQUAL(clock_drift_feedback_10_14(48000u, 0.0f, 100000000), 0);
+}
+
+int main(void)
+{
+    HOST_TEST_RUN(test_not_valid_before_min_updates);
+    HOST_TEST_RUN(test_estimates_drift);
+    HOST_TEST_RUN(test_long_run_in_single_precision);
+    HOST_TEST_RUN(test_clamps_and_resets);
+    HOST_TEST_RUN(test_feedback_value);
+    return 0;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,308 @@
+/******************************************************************************
+* File Name : test_delay_estimator.c
+*
+* Description :
+* Host tests of the delay estimator and of the delay measurement of the
+* DEEPCRAFT(TM) backend on the stub middleware.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "host_test.h"
+#include "delay_estimator.h"
+#include "ae_backend.h"
+#include "cy_afe_configurator_settings.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TEST_FRAME_SAMPLES              (160u)
+
+/* Frames fed, several windows */
+#define TEST_FRAMES                     (4u * DELAY_ESTIMATOR_DEFAULT_WINDOW_FRAMES)
+
+#define TEST_SIGNAL_SAMPLES             ((TEST_FRAMES * TEST_FRAME_SAMPLES) + DELAY_ESTIMATOR_MAX_LAG)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static delay_estimator_t estimator;
+static int16_t test_in[TEST_SIGNAL_SAMPLES];
+static int16_t test_out[TEST_SIGNAL_SAMPLES];
+static uint32_t test_seed = 1u;
+
+static int16_t test_backend_mic[AFE_INPUT_NUMBER_CHANNELS * TEST_FRAME_SAMPLES];
+static int16_t test_backend_output[TEST_FRAME_SAMPLES];
+static uint32_t test_backend_frames = 0;
+
+/*******************************************************************************
+* Function Name: test_noise
+********************************************************************************
+* Summary:
+* Returns a pseudo random sample of the given amplitude.
+*
+*******************************************************************************/
+static int16_t test_noise(int32_t amplitude)
+{
+    test_seed = (test_seed * 1664525u) + 1013904223u;
+    return (int16_t)((((int32_t)(test_seed >> 16) & 0xFFFF) - 0x8000) * amplitude / 0x8000);
+}
+
+/*******************************************************************************
+* Function Name: make_delayed_noise
+********************************************************************************
+* Summary:
+* Fills the input with noise and the output with the input delayed by delay
+* samples, scaled by gain, plus independent noise.
+*
+*******************************************************************************/
+static void make_delayed_noise(uint32_t delay, float gain, int32_t noise)
+{
+    for (uint32_t i = 0; i < TEST_SIGNAL_SAMPLES; i++)
+    {
+        test_in[i] = test_noise(8000);
+    }
+    for (uint32_t i = 0; i < TEST_SIGNAL_SAMPLES; i++)
+    {
+        test_out[i] = (int16_t)((gain * ((i >= delay) ? test_in[i - delay] : 0)) + test_noise(noise));
+    }
+}
+
+/*******************************************************************************
+* Function Name: feed_frames
+********************************************************************************
+* Summary:
+* Feeds frames of the test signals and returns the number of frames after
+* which the delay became known, 0 if it did not.
+*
+*******************************************************************************/
+static uint32_t feed_frames(uint32_t frames)
+{
+    for (uint32_t f = 0; f < frames; f++)
+    {
+        if (delay_estimator_update(&estimator, &test_in[f * TEST_FRAME_SAMPLES],
+                &test_out[f * TEST_FRAME_SAMPLES], TEST_FRAME_SAMPLES))
+        {
+            return f + 1u;
+        }
+    }
+    return 0u;
+}
+
+/*******************************************************************************
+* Function Name: test_init_rejects_bad_arguments
+********************************************************************************
+* Summary:
+* The estimator cannot search past the size of its history.
+*
+*******************************************************************************/
+static void test_init_rejects_bad_arguments(void)
+{
+    HOST_TEST_EQUAL(delay_estimator_init(NULL, 16u, 0u), (cy_rslt_t)DELAY_ESTIMATOR_FAILURE);
+    HOST_TEST_EQUAL(delay_estimator_init(&estimator, DELAY_ESTIMATOR_MAX_LAG + 1u, 0u),
+                    (cy_rslt_t)DELAY_ESTIMATOR_FAILURE);
+    HOST_TEST_EQUAL(delay_estimator_init(&estimator, DELAY_ESTIMATOR_MAX_LAG, 0u), CY_RSLT_SUCCESS);
+    HOST_TEST_EQUAL(estimator.window_frames, DELAY_ESTIMATOR_DEFAULT_WINDOW_FRAMES);
+    HOST_TEST_CHECK(!delay_estimator_is_valid(&estimator));
+    HOST_TEST_EQUAL(delay_estimator_get_delay(&estimator), 0);
+}
+
+/*******************************************************************************
+* Function Name: test_finds_delay_after_one_window
+********************************************************************************
+* Summary:
+* A delayed copy of the input is found at the end of the first window, for
+* delays within a frame, across frames and at the edges of the search.
+*
+*******************************************************************************/
+static void test_finds_delay_after_one_window(void)
+{
+    static const uint32_t delays[] = { 0u, 1u, 72u, TEST_FRAME_SAMPLES, 333u, DELAY_ESTIMATOR_MAX_LAG };
+
+    for (uint32_t i = 0; i < (sizeof(delays) / sizeof(delays[0])); i++)
+    {
+        make_delayed_noise(delays[i], 1.0f, 0);
+        HOST_TEST_EQUAL(delay_estimator_init(&estimator, DELAY_ESTIMATOR_MAX_LAG, 0u), CY_RSLT_SUCCESS);
+        HOST_TEST_EQUAL(feed_frames(TEST_FRAMES), DELAY_ESTIMATOR_DEFAULT_WINDOW_FRAMES);
+        HOST_TEST_EQUAL(delay_estimator_get_delay(&estimator), delays[i]);
+        HOST_TEST_CHECK(estimator.correlation > 0.95f);
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_finds_delay_of_noisy_scaled_output
+********************************************************************************
+* Summary:
+* Gain and uncorrelated noise in the output, as left by a noise suppressor,
+* do not move the peak.
+*
+*******************************************************************************/
+static void test_finds_delay_of_noisy_scaled_output(void)
+{
+    make_delayed_noise(200u, 0.3f, 1500);
+    HOST_TEST_EQUAL(delay_estimator_init(&estimator, DELAY_ESTIMATOR_MAX_LAG, 0u), CY_RSLT_SUCCESS);
+    HOST_TEST_CHECK(0u != feed_frames(TEST_FRAMES));
+    HOST_TEST_EQUAL(delay_estimator_get_delay(&estimator), 200);
+}
+
+/*******************************************************************************
+* Function Name: test_no_delay_without_correlation
+********************************************************************************
+* Summary:
+* Silence, an inverted output and an output unrelated to the input leave the
+* delay unknown.
+*
+*******************************************************************************/
+static void test_no_delay_without_correlation(void)
+{
+    HOST_TEST_EQUAL(delay_estimator_init(&estimator, DELAY_ESTIMATOR_MAX_LAG, 0u), CY_RSLT_SUCCESS);
+    memset(test_in, 0, sizeof(test_in));
+    memset(test_out, 0, sizeof(test_out));
+    HOST_TEST_EQUAL(feed_frames(TEST_FRAMES), 0);
+
+    make_delayed_noise(100u, -1.0f, 0);
+    HOST_TEST_EQUAL(feed_frames(TEST_FRAMES), 0);
+
+    make_delayed_noise(100u, 0.0f, 8000);
+    HOST_TEST_EQUAL(feed_frames(TEST_FRAMES), 0);
+    HOST_TEST_CHECK(estimator.correlation < DELAY_ESTIMATOR_MIN_CORRELATION);
+    HOST_TEST_EQUAL(delay_estimator_get_delay(&estimator), 0);
+}
+
+/*******************************************************************************
+* Function Name: test_reset_restarts_measurement
+********************************************************************************
+* Summary:
+* A known delay is kept until the estimator is reset, then measured again.
+*
+*******************************************************************************/
+static void test_reset_restarts_measurement(void)
+{
+    make_delayed_noise(50u, 1.0f, 0);
+    HOST_TEST_EQUAL(delay_estimator_init(&estimator, DELAY_ESTIMATOR_MAX_LAG, 10u), CY_RSLT_SUCCESS);
+    HOST_TEST_EQUAL(feed_frames(TEST_FRAMES), 10);
+    HOST_TEST_EQUAL(delay_estimator_get_delay(&estimator), 50);
+
+    make_delayed_noise(400u, 1.0f, 0);
+    HOST_TEST_EQUAL(feed_frames(TEST_FRAMES), 1);
+    HOST_TEST_EQUAL(delay_estimator_get_delay(&estimator), 50);
+
+    delay_estimator_reset(&estimator);
+    HOST_TEST_CHECK(!delay_estimator_is_valid(&estimator));
+    HOST_TEST_EQUAL(estimator.window_frames, 10);
+    HOST_TEST_EQUAL(feed_frames(TEST_FRAMES), 10);
+    HOST_TEST_EQUAL(delay_estimator_get_delay(&estimator), 400);
+}
+
+/*******************************************************************************
+* Function Name: test_backend_get_buffer
+********************************************************************************
+* Summary:
+* Output buffer provider of the backend under test.
+*
+*******************************************************************************/
+static int16_t* test_backend_get_buffer(void)
+{
+    return test_backend_output;
+}
+
+/*******************************************************************************
+* Function Name: test_backend_output_ready
+********************************************************************************
+* Summary:
+* Output consumer of the backend under test.
+*
+*******************************************************************************/
+static void test_backend_output_ready(ae_buffer_info_t *output_buffer_info)
+{
+    HOST_TEST_CHECK(test_backend_output == output_buffer_info->output_buf);
+    test_backend_frames++;
+}
+
+/*******************************************************************************
+* Function Name: test_deepcraft_measures_middleware_delay
+********************************************************************************
+* Summary:
+* The DEEPCRAFT backend reports no delay after its create and the delay of
+* the stub middleware once it was measured.
+*
+*******************************************************************************/
+static void test_deepcraft_measures_middleware_delay(void)
+{
+    ae_backend_config_t config =
+    {
+        .num_channels = AFE_INPUT_NUMBER_CHANNELS,
+        .frame_samples = TEST_FRAME_SAMPLES,
+        .channel_stride = TEST_FRAME_SAMPLES,
+        .get_buffer = test_backend_get_buffer,
+        .output = test_backend_output_ready,
+        .tuner_enable = false,
+    };
+
+    HOST_TEST_CHECK(NULL != ae_backend_deepcraft.get_delay);
+    HOST_TEST_EQUAL(ae_backend_deepcraft.create(&config), AE_RSLT_SUCCESS);
+    HOST_TEST_EQUAL(ae_backend_deepcraft.get_delay(), 0);
+
+    for (uint32_t f = 0; f < TEST_FRAMES; f++)
+    {
+        for (uint32_t i = 0; i < (AFE_INPUT_NUMBER_CHANNELS * TEST_FRAME_SAMPLES); i++)
+        {
+            test_backend_mic[i] = test_noise(8000);
+        }
+        HOST_TEST_EQUAL(ae_backend_deepcraft.feed(test_backend_mic, NULL), AE_RSLT_SUCCESS);
+    }
+    HOST_TEST_EQUAL(test_backend_frames, TEST_FRAMES);
+    HOST_TEST_EQUAL(ae_backend_deepcraft.get_delay(), HOST_AFE_DELAY_SAMPLES);
+
+    /* A new instance measures again */
+    HOST_TEST_EQUAL(ae_backend_deepcraft.destroy(), AE_RSLT_SUCCESS);
+    HOST_TEST_EQUAL(ae_backend_deepcraft.create(&config), AE_RSLT_SUCCESS);
+    HOST_TEST_EQUAL(ae_backend_deepcraft.get_delay(), 0);
+    HOST_TEST_EQUAL(ae_backend_deepcraft.destroy(), AE_RSLT_SUCCESS);
+}
+
+int main(void)
+{
+    HOST_TEST_RUN(test_init_rejects_bad_arguments);
+    HOST_TEST_RUN(test_finds_delay_after_one_window);
+    HOST_TEST_RUN(test_finds_delay_of_noisy_scaled_output);
+    HOST_TEST_RUN(test_no_delay_without_correlation);
+    HOST_TEST_RUN(test_reset_restarts_measurement);
+    HOST_TEST_RUN(test_deepcraft_measures_middleware_delay);
+    return 0;
+}
+
+/* [] END OF FILE */
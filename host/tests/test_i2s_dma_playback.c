@@ -0,0 +1,308 @@
+/******************************************************************************
+* File Name : test_i2s_dma_playback.c
+*
+* Description :
+* Host tests of the I2S DMA playback engine on a software double of the
+* DMA descriptor chain.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "host_test.h"
+#include "i2s_dma_playback.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TEST_FRAME_SAMPLES                      (I2S_DMA_SLOT_SAMPLES)
+#define TEST_MAX_FRAMES                         (64u)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* DMA double: the descriptor chain built by 'setup', played one slot at a
+ * time by test_dma_play_slot
+ */
+static int16_t *test_dma_slots[I2S_DMA_SLOT_COUNT];
+static uint32_t test_dma_slot_count = 0;
+static uint32_t test_dma_frame_samples = 0;
+static uint32_t test_dma_descriptor = 0;
+static bool test_dma_running = false;
+static uint32_t test_dma_syncs = 0;
+static cy_rslt_t test_dma_setup_result = CY_RSLT_SUCCESS;
+
+/* First sample of each frame that went out on the I2S bus, 0 for silence */
+static int16_t test_dma_output[TEST_MAX_FRAMES];
+static uint32_t test_dma_output_count = 0;
+
+/* Stream: frame n is filled with n + 1, 'fetch' fails after the last one */
+static uint32_t test_stream_fetched = 0;
+static uint32_t test_stream_available = 0;
+static int16_t test_stream_played[TEST_MAX_FRAMES];
+static uint32_t test_stream_played_count = 0;
+
+static cy_rslt_t test_dma_setup(int16_t *const slots[], uint32_t slot_count, uint32_t frame_samples)
+{
+    for (uint32_t i = 0; i < slot_count; i++)
+    {
+        test_dma_slots[i] = slots[i];
+    }
+    test_dma_slot_count = slot_count;
+    test_dma_frame_samples = frame_samples;
+    return test_dma_setup_result;
+}
+
+static void test_dma_start(void)
+{
+    test_dma_descriptor = 0;
+    test_dma_running = true;
+}
+
+static void test_dma_stop(void)
+{
+    test_dma_running = false;
+}
+
+static void test_dma_sync(const int16_t *slot, uint32_t size_bytes)
+{
+    bool known = false;
+
+    for (uint32_t i = 0; i < I2S_DMA_SLOT_COUNT; i++)
+    {
+        known = known || (slot == test_dma_slots[i]);
+    }
+    /* The slots are only known after setup, which runs after the first syncs */
+    HOST_TEST_CHECK(known || (0u == test_dma_slot_count));
+    HOST_TEST_CHECK(size_bytes <= (I2S_DMA_SLOT_SAMPLES * sizeof(int16_t)));
+    test_dma_syncs++;
+}
+
+static const i2s_dma_hw_t test_dma_hw =
+{
+    .setup = test_dma_setup,
+    .start = test_dma_start,
+    .stop  = test_dma_stop,
+    .sync  = test_dma_sync,
+};
+
+static cy_rslt_t test_stream_fetch(int16_t *frame)
+{
+    if (test_stream_fetched >= test_stream_available)
+    {
+        return I2S_DMA_FAILURE;
+    }
+    test_stream_fetched++;
+    for (uint32_t i = 0; i < TEST_FRAME_SAMPLES; i++)
+    {
+        frame[i] = (int16_t)test_stream_fetched;
+    }
+    return CY_RSLT_SUCCESS;
+}
+
+static void test_stream_played_frame(const int16_t *frame)
+{
+    HOST_TEST_CHECK(test_stream_played_count < TEST_MAX_FRAMES);
+    test_stream_played[test_stream_played_count++] = frame[0];
+}
+
+static const i2s_dma_stream_t test_stream =
+{
+    .fetch  = test_stream_fetch,
+    .played = test_stream_played_frame,
+};
+
+/*******************************************************************************
+* Function Name: test_dma_play_slot
+********************************************************************************
+* Summary:
+* Plays the slot of the current descriptor, checks that it holds one frame or
+* silence throughout, then raises the descriptor completion interrupt and
+* moves on to the next descriptor of the chain.
+*
+*******************************************************************************/
+static void test_dma_play_slot(void)
+{
+    const int16_t *slot = test_dma_slots[test_dma_descriptor];
+
+    HOST_TEST_CHECK(test_dma_running);
+    HOST_TEST_CHECK(test_dma_output_count < TEST_MAX_FRAMES);
+    for (uint32_t i = 1; i < test_dma_frame_samples; i++)
+    {
+        HOST_TEST_EQUAL(slot[i], slot[0]);
+    }
+    test_dma_output[test_dma_output_count++] = slot[0];
+
+    i2s_dma_playback_frame_done();
+    test_dma_descriptor = (test_dma_descriptor + 1u) % test_dma_slot_count;
+}
+
+static void test_reset(uint32_t available)
+{
+    test_dma_slot_count = 0;
+    test_dma_running = false;
+    test_dma_syncs = 0;
+    test_dma_setup_result = CY_RSLT_SUCCESS;
+    test_dma_output_count = 0;
+    test_stream_fetched = 0;
+    test_stream_available = available;
+    test_stream_played_count = 0;
+}
+
+/*******************************************************************************
+* Function Name: test_init_checks_arguments
+********************************************************************************
+* Summary:
+* Missing layers, empty frames and frames larger than a slot are refused, and
+* a failure to build the descriptor chain is reported.
+*
+*******************************************************************************/
+static void test_init_checks_arguments(void)
+{
+    test_reset(0);
+    HOST_TEST_EQUAL(i2s_dma_playback_init(NULL, &test_stream, TEST_FRAME_SAMPLES), (cy_rslt_t)I2S_DMA_FAILURE);
+    HOST_TEST_EQUAL(i2s_dma_playback_init(&test_dma_hw, NULL, TEST_FRAME_SAMPLES), (cy_rslt_t)I2S_DMA_FAILURE);
+    HOST_TEST_EQUAL(i2s_dma_playback_init(&test_dma_hw, &test_stream, 0), (cy_rslt_t)I2S_DMA_FAILURE);
+    HOST_TEST_EQUAL(i2s_dma_playback_init(&test_dma_hw, &test_stream, I2S_DMA_SLOT_SAMPLES + 1u),
+                    (cy_rslt_t)I2S_DMA_FAILURE);
+
+    test_dma_setup_result = I2S_DMA_FAILURE;
+    HOST_TEST_EQUAL(i2s_dma_playback_init(&test_dma_hw, &test_stream, TEST_FRAME_SAMPLES), (cy_rslt_t)I2S_DMA_FAILURE);
+
+    test_dma_setup_result = CY_RSLT_SUCCESS;
+    HOST_TEST_EQUAL(i2s_dma_playback_init(&test_dma_hw, &test_stream, TEST_FRAME_SAMPLES), CY_RSLT_SUCCESS);
+    HOST_TEST_EQUAL(test_dma_slot_count, I2S_DMA_SLOT_COUNT);
+    HOST_TEST_EQUAL(test_dma_frame_samples, TEST_FRAME_SAMPLES);
+    HOST_TEST_CHECK(test_dma_slots[0] != test_dma_slots[1]);
+    HOST_TEST_EQUAL((uintptr_t)test_dma_slots[0] % I2S_DMA_SLOT_ALIGNMENT, 0);
+    HOST_TEST_EQUAL((uintptr_t)test_dma_slots[1] % I2S_DMA_SLOT_ALIGNMENT, 0);
+}
+
+/*******************************************************************************
+* Function Name: test_frames_play_in_order
+********************************************************************************
+* Summary:
+* The chain starts with silent slots, then plays every frame once in order
+* with a latency of one slot per descriptor. Each frame is handed to the sink
+* after it was played and every refill is synced for the DMA.
+*
+*******************************************************************************/
+static void test_frames_play_in_order(void)
+{
+    const uint32_t frames = 20u;
+    i2s_dma_stats_t stats;
+
+    test_reset(frames);
+    HOST_TEST_EQUAL(i2s_dma_playback_init(&test_dma_hw, &test_stream, TEST_FRAME_SAMPLES), CY_RSLT_SUCCESS);
+    test_dma_syncs = 0;
+    i2s_dma_playback_start();
+
+    for (uint32_t i = 0; i < (frames + I2S_DMA_SLOT_COUNT); i++)
+    {
+        test_dma_play_slot();
+    }
+
+    for (uint32_t i = 0; i < I2S_DMA_SLOT_COUNT; i++)
+    {
+        HOST_TEST_EQUAL(test_dma_output[i], 0);
+    }
+    for (uint32_t i = 0; i < frames; i++)
+    {
+        HOST_TEST_EQUAL(test_dma_output[I2S_DMA_SLOT_COUNT + i], i + 1u);
+        HOST_TEST_EQUAL(test_stream_played[i], i + 1u);
+    }
+    HOST_TEST_EQUAL(test_stream_played_count, frames);
+
+    /* One sync per frame, one per slot cleared when the source ran dry */
+    HOST_TEST_EQUAL(test_dma_syncs, frames + I2S_DMA_SLOT_COUNT);
+
+    i2s_dma_playback_get_stats(&stats);
+    HOST_TEST_EQUAL(stats.frames, frames + I2S_DMA_SLOT_COUNT);
+    HOST_TEST_EQUAL(stats.valid_frames, frames);
+    HOST_TEST_EQUAL(stats.underruns, 1);
+
+    i2s_dma_playback_stop();
+    HOST_TEST_CHECK(!test_dma_running);
+}
+
+/*******************************************************************************
+* Function Name: test_underrun_plays_silence
+********************************************************************************
+* Summary:
+* A gap in the source is played as silence and counted once; the stream picks
+* up again without replaying stale audio.
+*
+*******************************************************************************/
+static void test_underrun_plays_silence(void)
+{
+    i2s_dma_stats_t stats;
+
+    test_reset(4u);
+    HOST_TEST_EQUAL(i2s_dma_playback_init(&test_dma_hw, &test_stream, TEST_FRAME_SAMPLES), CY_RSLT_SUCCESS);
+    i2s_dma_playback_start();
+
+    /* Frames 1-4, then the source runs dry for 4 slots */
+    for (uint32_t i = 0; i < 8u; i++)
+    {
+        test_dma_play_slot();
+    }
+    test_stream_available = 8u;
+    for (uint32_t i = 0; i < 8u; i++)
+    {
+        test_dma_play_slot();
+    }
+
+    static const int16_t expected[] = { 0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 5, 6, 7, 8, 0, 0 };
+    HOST_TEST_EQUAL(test_dma_output_count, sizeof(expected) / sizeof(expected[0]));
+    for (uint32_t i = 0; i < test_dma_output_count; i++)
+    {
+        HOST_TEST_EQUAL(test_dma_output[i], expected[i]);
+    }
+    HOST_TEST_EQUAL(test_stream_played_count, 8);
+
+    i2s_dma_playback_get_stats(&stats);
+    HOST_TEST_EQUAL(stats.valid_frames, 8);
+    HOST_TEST_EQUAL(stats.underruns, 2);
+}
+
+int main(void)
+{
+    HOST_TEST_RUN(test_init_checks_arguments);
+    HOST_TEST_RUN(test_frames_play_in_order);
+    HOST_TEST_RUN(test_underrun_plays_silence);
+    return 0;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,180 @@
+/******************************************************************************
+* File Name : test_latency_trace.c
+*
+* Description :
+* Host tests of the mic-to-USB latency trace on the synthetic clock.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "host_test.h"
+#include "latency_trace.h"
+
+/*******************************************************************************
+* Function Name: queue_frame
+********************************************************************************
+* Summary:
+* Captures a frame at capture_us and queues its AE output for USB at
+* queued_us.
+*
+*******************************************************************************/
+static void queue_frame(uint32_t capture_us, uint32_t queued_us)
+{
+    latency_trace_set_clock_us(capture_us);
+    latency_trace_feed(latency_trace_now());
+    latency_trace_set_clock_us(queued_us);
+    latency_trace_queued();
+}
+
+/*******************************************************************************
+* Function Name: send_frame
+********************************************************************************
+* Summary:
+* Starts sending the oldest queued frame at sent_us.
+*
+*******************************************************************************/
+static void send_frame(uint32_t sent_us, uint32_t queue_depth)
+{
+    latency_trace_set_clock_us(sent_us);
+    latency_trace_sent(queue_depth);
+}
+
+/*******************************************************************************
+* Function Name: test_ages_and_depth
+********************************************************************************
+* Summary:
+* Frames are matched with their timestamps in order and the window reports
+* their ages and the queue depth.
+*
+*******************************************************************************/
+static void test_ages_and_depth(void)
+{
+    latency_trace_summary_t summary;
+
+    HOST_TEST_EQUAL(latency_trace_init(), CY_RSLT_SUCCESS);
+
+    queue_frame(0u, 3000u);
+    queue_frame(10000u, 13000u);
+    queue_frame(20000u, 23000u);
+    send_frame(12000u, 3u);
+    send_frame(30000u, 2u);
+    send_frame(60000u, 1u);
+
+    latency_trace_get_summary(&summary);
+    HOST_TEST_EQUAL(summary.frames, 3);
+    HOST_TEST_EQUAL(summary.min_us, 12000);
+    HOST_TEST_EQUAL(summary.max_us, 40000);
+    HOST_TEST_EQUAL(summary.avg_us, (12000 + 20000 + 40000) / 3);
+    HOST_TEST_CHECK((summary.p50_us >= 20000u) && (summary.p50_us <= (20000u + LATENCY_TRACE_BUCKET_US)));
+    HOST_TEST_EQUAL(summary.p99_us, 40000);
+    HOST_TEST_EQUAL(summary.depth_min, 1);
+    HOST_TEST_EQUAL(summary.depth_max, 3);
+    HOST_TEST_EQUAL(summary.depth_last, 1);
+    HOST_TEST_EQUAL(summary.untracked, 0);
+
+    /* The summary starts a new window */
+    latency_trace_get_summary(&summary);
+    HOST_TEST_EQUAL(summary.frames, 0);
+}
+
+/*******************************************************************************
+* Function Name: test_flush_and_untracked
+********************************************************************************
+* Summary:
+* Frames sent without a timestamp, e.g. after a flush of the USB queue, are
+* counted as untracked and do not shift the later frames.
+*
+*******************************************************************************/
+static void test_flush_and_untracked(void)
+{
+    latency_trace_summary_t summary;
+
+    HOST_TEST_EQUAL(latency_trace_init(), CY_RSLT_SUCCESS);
+
+    queue_frame(0u, 1000u);
+    latency_trace_flush();
+    send_frame(5000u, 0u);
+
+    /* A feed whose output is flushed before it is queued is forgotten */
+    latency_trace_feed(latency_trace_now());
+    latency_trace_flush();
+    latency_trace_queued();
+    send_frame(8000u, 0u);
+
+    queue_frame(10000u, 11000u);
+    send_frame(15000u, 1u);
+
+    latency_trace_get_summary(&summary);
+    HOST_TEST_EQUAL(summary.untracked, 2);
+    HOST_TEST_EQUAL(summary.frames, 1);
+    HOST_TEST_EQUAL(summary.min_us, 5000);
+    HOST_TEST_EQUAL(summary.depth_min, 0);
+}
+
+/*******************************************************************************
+* Function Name: test_timestamp_before_now
+********************************************************************************
+* Summary:
+* latency_trace_before dates a frame back to its first sample, across a wrap
+* of the clock.
+*
+*******************************************************************************/
+static void test_timestamp_before_now(void)
+{
+    latency_trace_summary_t summary;
+
+    HOST_TEST_EQUAL(latency_trace_init(), CY_RSLT_SUCCESS);
+
+    latency_trace_set_clock_us(4000u);
+    HOST_TEST_EQUAL(latency_trace_before(10000u), (uint32_t)(4000u - 10000u));
+
+    latency_trace_feed(latency_trace_before(10000u));
+    latency_trace_queued();
+    send_frame(7000u, 1u);
+
+    latency_trace_get_summary(&summary);
+    HOST_TEST_EQUAL(summary.frames, 1);
+    HOST_TEST_EQUAL(summary.max_us, 13000);
+}
+
+int main(void)
+{
+    HOST_TEST_RUN(test_ages_and_depth);
+    HOST_TEST_RUN(test_flush_and_untracked);
+    HOST_TEST_RUN(test_timestamp_before_now);
+    return 0;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,170 @@
+/******************************************************************************
+* File Name : test_profiler_probe.c
+*
+* Description :
+* Host tests of the profiler latency probes on the clock_gettime backend
+* (CY_PROFILER_HOST), where the probe ticks are nanoseconds.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <time.h>
+#include "host_test.h"
+#include "cy_profiler.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TEST_NS_PER_MS                  (1000000u)
+
+/* Time taken by cy_profiler_now and the recording itself, in nanoseconds */
+#define TEST_OVERHEAD_NS                (50000u)
+
+#if !CY_PROFILER_PROBE_ENABLE
+#error "The probe test needs CY_PROFILER_PROBE_ENABLE=1"
+#endif /* CY_PROFILER_PROBE_ENABLE */
+
+/*******************************************************************************
+* Function Name: record_duration
+********************************************************************************
+* Summary:
+* Records a run of 'probe' that started 'duration_ns' ago.
+*
+*******************************************************************************/
+static void record_duration(cy_profiler_probe_id_t probe, uint32_t duration_ns)
+{
+    cy_profiler_probe_record(probe, cy_profiler_now() - duration_ns);
+}
+
+/*******************************************************************************
+* Function Name: test_clock_counts_nanoseconds
+********************************************************************************
+* Summary:
+* A probe around a 2 ms sleep measures at least 2 ms, in nanoseconds.
+*
+*******************************************************************************/
+static void test_clock_counts_nanoseconds(void)
+{
+    const struct timespec sleep_time = { .tv_sec = 0, .tv_nsec = 2 * TEST_NS_PER_MS };
+    cy_profiler_probe_summary_t summary;
+
+    cy_profiler_probe_init();
+    for (uint32_t i = 0; i < 5u; i++)
+    {
+        CY_PROFILER_PROBE_BEGIN(CY_PROFILER_PROBE_AFE_FEED);
+        (void)nanosleep(&sleep_time, NULL);
+        CY_PROFILER_PROBE_END(CY_PROFILER_PROBE_AFE_FEED);
+    }
+
+    cy_profiler_probe_get_summary(CY_PROFILER_PROBE_AFE_FEED, &summary);
+    HOST_TEST_EQUAL(summary.count, 5);
+    HOST_TEST_CHECK(summary.min >= (2u * TEST_NS_PER_MS));
+    HOST_TEST_CHECK(summary.min <= summary.avg);
+    HOST_TEST_CHECK(summary.avg <= summary.max);
+    /* Generous bound, the host may be loaded */
+    HOST_TEST_CHECK(summary.avg < (200u * TEST_NS_PER_MS));
+}
+
+/*******************************************************************************
+* Function Name: test_percentile_from_histogram
+********************************************************************************
+* Summary:
+* The 99th percentile is the upper bound of its histogram bucket, within a
+* quarter of the value, and follows the outliers once they pass 1 %.
+*
+*******************************************************************************/
+static void test_percentile_from_histogram(void)
+{
+    cy_profiler_probe_summary_t summary;
+
+    cy_profiler_probe_reset();
+    for (uint32_t i = 0; i < 99u; i++)
+    {
+        record_duration(CY_PROFILER_PROBE_DEINTERLEAVE, 100000u);
+    }
+    record_duration(CY_PROFILER_PROBE_DEINTERLEAVE, 10u * TEST_NS_PER_MS);
+
+    cy_profiler_probe_get_summary(CY_PROFILER_PROBE_DEINTERLEAVE, &summary);
+    HOST_TEST_EQUAL(summary.count, 100);
+    HOST_TEST_CHECK(summary.min >= 100000u);
+    HOST_TEST_CHECK(summary.p99 >= summary.min);
+    HOST_TEST_CHECK(summary.p99 <= ((100000u + TEST_OVERHEAD_NS) * 5u) / 4u);
+    HOST_TEST_CHECK(summary.max >= (10u * TEST_NS_PER_MS));
+
+    record_duration(CY_PROFILER_PROBE_DEINTERLEAVE, 10u * TEST_NS_PER_MS);
+    cy_profiler_probe_get_summary(CY_PROFILER_PROBE_DEINTERLEAVE, &summary);
+    HOST_TEST_CHECK(summary.p99 >= (10u * TEST_NS_PER_MS));
+    HOST_TEST_CHECK(summary.p99 <= summary.max);
+    cy_profiler_probe_dump();
+
+    /* Other probes are not affected */
+    cy_profiler_probe_get_summary(CY_PROFILER_PROBE_AEC_POP, &summary);
+    HOST_TEST_EQUAL(summary.count, 0);
+}
+
+/*******************************************************************************
+* Function Name: test_reset_and_invalid_probe
+********************************************************************************
+* Summary:
+* Reset clears every probe and unknown probe IDs are ignored.
+*
+*******************************************************************************/
+static void test_reset_and_invalid_probe(void)
+{
+    cy_profiler_probe_summary_t summary;
+
+    record_duration(CY_PROFILER_PROBE_USB_PUSH, 1000u);
+    record_duration(CY_PROFILER_PROBE_COUNT, 1000u);
+    cy_profiler_probe_get_summary(CY_PROFILER_PROBE_USB_PUSH, &summary);
+    HOST_TEST_EQUAL(summary.count, 1);
+
+    cy_profiler_probe_reset();
+    for (uint32_t probe = 0; probe < CY_PROFILER_PROBE_COUNT; probe++)
+    {
+        cy_profiler_probe_get_summary((cy_profiler_probe_id_t)probe, &summary);
+        HOST_TEST_EQUAL(summary.count, 0);
+        HOST_TEST_EQUAL(summary.max, 0);
+    }
+}
+
+int main(void)
+{
+    HOST_TEST_RUN(test_clock_counts_nanoseconds);
+    HOST_TEST_RUN(test_percentile_from_histogram);
+    HOST_TEST_RUN(test_reset_and_invalid_probe);
+    return 0;
+}
+
+/* [] END OF FILE */
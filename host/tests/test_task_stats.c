@@ -0,0 +1,284 @@
+/******************************************************************************
+* File Name : test_task_stats.c
+*
+* Description :
+* Host test of the task_stats accounting. The task_stats task runs on scripted
+* kernel snapshots returned by a stubbed uxTaskGetSystemState.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <setjmp.h>
+#include <string.h>
+#include "host_test.h"
+#include "task_stats.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TEST_TASKS                      (4u)
+#define TEST_SNAPSHOTS                  (5u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* One task of a kernel snapshot */
+typedef struct
+{
+    UBaseType_t number;
+    uint32_t run_cycles;
+} test_task_t;
+
+/* Kernel snapshot. more_tasks makes the kernel report more tasks than
+ * task_stats has room for.
+ */
+typedef struct
+{
+    uint32_t total_cycles;
+    uint32_t num_tasks;
+    bool more_tasks;
+    test_task_t tasks[TEST_TASKS];
+} test_snapshot_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const char *const test_task_names[TEST_TASKS + 1u] = { "", "ae", "usb", "IDLE", "tuner" };
+
+/* The run time counter starts just below its wrap. ae takes 75 % of the
+ * second and 90 % of the third period, during which both the total and the
+ * ae counter wrap. The fourth snapshot has too many tasks, in the fifth the
+ * tuner task has been created.
+ */
+static const test_snapshot_t test_snapshots[TEST_SNAPSHOTS] =
+{
+    { 0xFFF00000u, 3u, false, { { 1u, 0xFFEF0000u }, { 2u, 0x8000u }, { 3u, 0x8000u } } },
+    { 0xFFF61A80u, 3u, false, { { 1u, 0xFFF393E0u }, { 2u, 0x8000u + 60000u }, { 3u, 0x8000u + 40000u } } },
+    { 0x00055CC0u, 3u, false, { { 1u, 0x00014F80u }, { 2u, 0x8000u + 110000u }, { 3u, 0x8000u + 90000u } } },
+    { 0x0009F0A0u, 0u, true },
+    { 0x00100B20u, 4u, false, { { 1u, 0x000483D0u }, { 2u, 0x8000u + 110000u },
+                                { 3u, 0x8000u + 340000u }, { 4u, 21000u } } },
+};
+
+/* Samples read with task_stats_get after each period */
+static task_stats_sample_t test_samples[TEST_SNAPSHOTS];
+/* Periods of the task_stats task started so far */
+static uint32_t test_periods = 0;
+static jmp_buf test_done;
+
+/*******************************************************************************
+* Function Name: uxTaskGetSystemState
+********************************************************************************
+* Summary:
+* Returns the next scripted snapshot, or 0 like the kernel when the array is
+* too small for all tasks.
+*
+*******************************************************************************/
+UBaseType_t uxTaskGetSystemState(TaskStatus_t *status, UBaseType_t max_tasks,
+                                 configRUN_TIME_COUNTER_TYPE *total_run_time)
+{
+    const test_snapshot_t *snapshot = &test_snapshots[test_periods - 1u];
+
+    if (snapshot->more_tasks || (snapshot->num_tasks > max_tasks))
+    {
+        return 0u;
+    }
+
+    for (uint32_t i = 0; i < snapshot->num_tasks; i++)
+    {
+        memset(&status[i], 0, sizeof(status[i]));
+        status[i].pcTaskName = test_task_names[snapshot->tasks[i].number];
+        status[i].xTaskNumber = snapshot->tasks[i].number;
+        status[i].uxCurrentPriority = TEST_TASKS - snapshot->tasks[i].number;
+        status[i].ulRunTimeCounter = snapshot->tasks[i].run_cycles;
+        status[i].usStackHighWaterMark = (uint16_t)(16u * snapshot->tasks[i].number);
+    }
+    *total_run_time = snapshot->total_cycles;
+    return snapshot->num_tasks;
+}
+
+/*******************************************************************************
+* Function Name: vTaskDelayUntil
+********************************************************************************
+* Summary:
+* Ends a period of the task_stats task. The sample of the previous period is
+* kept, the task is left once all snapshots are taken.
+*
+*******************************************************************************/
+void vTaskDelayUntil(TickType_t *previous_wake_time, TickType_t increment)
+{
+    *previous_wake_time += increment;
+
+    if (0u != test_periods)
+    {
+        task_stats_get(&test_samples[test_periods - 1u]);
+    }
+    if (TEST_SNAPSHOTS == test_periods)
+    {
+        longjmp(test_done, 1);
+    }
+    test_periods++;
+}
+
+/*******************************************************************************
+* Function Name: expected_load
+********************************************************************************
+* Summary:
+* Load in 1/100 % of a task in snapshot 'index', against the snapshot
+* 'previous' or the start of the counters if there is none.
+*
+*******************************************************************************/
+static uint32_t expected_load(uint32_t index, int32_t previous, UBaseType_t number)
+{
+    const test_snapshot_t *snapshot = &test_snapshots[index];
+    uint32_t period = snapshot->total_cycles;
+    uint32_t cycles = 0;
+
+    for (uint32_t i = 0; i < snapshot->num_tasks; i++)
+    {
+        if (number == snapshot->tasks[i].number)
+        {
+            cycles = snapshot->tasks[i].run_cycles;
+        }
+    }
+    if (previous >= 0)
+    {
+        period -= test_snapshots[previous].total_cycles;
+        for (uint32_t i = 0; i < test_snapshots[previous].num_tasks; i++)
+        {
+            if (number == test_snapshots[previous].tasks[i].number)
+            {
+                cycles -= test_snapshots[previous].tasks[i].run_cycles;
+            }
+        }
+    }
+
+    return (cycles >= period) ? TASK_STATS_LOAD_SCALE :
+            (uint32_t)(((uint64_t)cycles * TASK_STATS_LOAD_SCALE) / period);
+}
+
+/*******************************************************************************
+* Function Name: test_load_saturates
+********************************************************************************
+* Summary:
+* Loads are scaled to 1/100 % and saturate at the whole period.
+*
+*******************************************************************************/
+static void test_load_saturates(void)
+{
+    HOST_TEST_EQUAL(task_stats_load(0u, 1000u), 0u);
+    HOST_TEST_EQUAL(task_stats_load(1u, 3u), 3333u);
+    HOST_TEST_EQUAL(task_stats_load(999u, 1000u), 9990u);
+    HOST_TEST_EQUAL(task_stats_load(1000u, 1000u), TASK_STATS_LOAD_SCALE);
+    HOST_TEST_EQUAL(task_stats_load(5000u, 1000u), TASK_STATS_LOAD_SCALE);
+    HOST_TEST_EQUAL(task_stats_load(5u, 0u), 0u);
+}
+
+/*******************************************************************************
+* Function Name: test_task_reports_every_period
+********************************************************************************
+* Summary:
+* Runs the task_stats task over the scripted snapshots. Every period reports
+* the share of each task, also across the wrap of the run time counter. The
+* snapshot with too many tasks is skipped, the next period then covers both.
+* A new task is charged its whole run time.
+*
+*******************************************************************************/
+static void test_task_reports_every_period(void)
+{
+    TaskFunction_t task;
+    void *arg = NULL;
+    int32_t previous = -1;
+    uint32_t sequence = 0;
+
+    HOST_TEST_EQUAL(task_stats_init(), CY_RSLT_SUCCESS);
+    HOST_TEST_EQUAL(task_stats_init(), CY_RSLT_SUCCESS);
+    task = host_task_find("task_stats", &arg);
+    HOST_TEST_CHECK(NULL != task);
+
+    if (0 == setjmp(test_done))
+    {
+        task(arg);
+    }
+    HOST_TEST_EQUAL(test_periods, TEST_SNAPSHOTS);
+
+    for (uint32_t index = 0; index < TEST_SNAPSHOTS; index++)
+    {
+        const test_snapshot_t *snapshot = &test_snapshots[index];
+        const task_stats_sample_t *sample = &test_samples[index];
+
+        if (snapshot->more_tasks)
+        {
+            /* The previous sample stays the newest */
+            HOST_TEST_EQUAL(sample->sequence, sequence);
+            continue;
+        }
+
+        sequence++;
+        HOST_TEST_EQUAL(sample->sequence, sequence);
+        HOST_TEST_EQUAL(sample->total_cycles, snapshot->total_cycles);
+        HOST_TEST_EQUAL(sample->period_cycles, snapshot->total_cycles -
+                ((previous >= 0) ? test_snapshots[previous].total_cycles : 0u));
+        HOST_TEST_EQUAL(sample->num_tasks, snapshot->num_tasks);
+        for (uint32_t i = 0; i < sample->num_tasks; i++)
+        {
+            const task_stats_task_t *task_sample = &sample->tasks[i];
+
+            HOST_TEST_EQUAL(task_sample->task_number, snapshot->tasks[i].number);
+            HOST_TEST_CHECK(0 == strcmp(task_sample->name, test_task_names[snapshot->tasks[i].number]));
+            HOST_TEST_EQUAL(task_sample->priority, TEST_TASKS - snapshot->tasks[i].number);
+            HOST_TEST_EQUAL(task_sample->run_cycles, snapshot->tasks[i].run_cycles);
+            HOST_TEST_EQUAL(task_sample->stack_free_bytes, 16u * snapshot->tasks[i].number * sizeof(StackType_t));
+            HOST_TEST_EQUAL(task_sample->load, expected_load(index, previous, snapshot->tasks[i].number));
+        }
+        previous = (int32_t)index;
+    }
+
+    /* Known values of the script, against the independent computation */
+    HOST_TEST_EQUAL(test_samples[1].tasks[0].load, 7500u);
+    HOST_TEST_EQUAL(test_samples[2].tasks[0].load, 9000u);
+    HOST_TEST_EQUAL(test_samples[2].tasks[1].load, 500u);
+    HOST_TEST_EQUAL(test_samples[4].tasks[0].load, 3000u);
+    HOST_TEST_EQUAL(test_samples[4].tasks[3].load, 300u);
+}
+
+int main(void)
+{
+    HOST_TEST_RUN(test_load_saturates);
+    HOST_TEST_RUN(test_task_reports_every_period);
+    return 0;
+}
+
+/* [] END OF FILE */
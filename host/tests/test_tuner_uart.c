@@ -0,0 +1,332 @@
+/******************************************************************************
+* File Name : test_tuner_uart.c
+*
+* Description :
+* Host loopback tests of the tuner UART over a pseudo-terminal. The UART
+* interrupt is run by the test between the steps of the configurator side.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <fcntl.h>
+#include <pty.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include "host_test.h"
+#include "cybsp.h"
+#include "tuner_uart.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Configuration uploaded by the configurator side, sent in acknowledged
+ * packets
+ */
+#define TEST_CONFIG_SIZE                        (32768u)
+#define TEST_PACKET_SIZE                        (256u)
+#define TEST_ACK_SIZE                           (4u)
+
+/* Poll interval of the middleware, one byte per poll before the receive ring */
+#define TEST_TUNER_POLL_MS                      (100u)
+
+/* Steps without progress before a loopback is considered stuck */
+#define TEST_MAX_IDLE_STEPS                     (1000000u)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Configurator end of the pseudo-terminal, the UART has the other one */
+static int test_host_fd = -1;
+
+static uint8_t test_config[TEST_CONFIG_SIZE];
+static uint8_t test_received[TEST_CONFIG_SIZE];
+
+/*******************************************************************************
+* Function Name: test_now_ns
+*******************************************************************************/
+static uint64_t test_now_ns(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+}
+
+/*******************************************************************************
+* Function Name: test_open_pty
+********************************************************************************
+* Summary:
+* Opens a raw, non-blocking pseudo-terminal, attaches one end to the debug
+* UART and starts the tuner UART on it.
+*
+*******************************************************************************/
+static void test_open_pty(void)
+{
+    struct termios raw;
+    int uart_fd;
+
+    HOST_TEST_EQUAL(openpty(&test_host_fd, &uart_fd, NULL, NULL, NULL), 0);
+    HOST_TEST_EQUAL(tcgetattr(uart_fd, &raw), 0);
+    cfmakeraw(&raw);
+    HOST_TEST_EQUAL(tcsetattr(uart_fd, TCSANOW, &raw), 0);
+    HOST_TEST_CHECK(fcntl(test_host_fd, F_SETFL, O_NONBLOCK) >= 0);
+    HOST_TEST_CHECK(fcntl(uart_fd, F_SETFL, O_NONBLOCK) >= 0);
+
+    host_uart_attach(uart_fd);
+    HOST_TEST_EQUAL(tuner_uart_init(), CY_RSLT_SUCCESS);
+}
+
+/*******************************************************************************
+* Function Name: test_host_read
+********************************************************************************
+* Summary:
+* Reads exactly 'size' bytes sent by the UART, running its interrupt while
+* waiting.
+*
+*******************************************************************************/
+static void test_host_read(uint8_t *data, uint32_t size)
+{
+    uint32_t done = 0;
+    uint32_t idle = 0;
+    ssize_t count;
+
+    while (done < size)
+    {
+        (void)host_uart_service();
+        count = read(test_host_fd, &data[done], size - done);
+        if (count > 0)
+        {
+            done += (uint32_t)count;
+            idle = 0;
+        }
+        else
+        {
+            HOST_TEST_CHECK(++idle < TEST_MAX_IDLE_STEPS);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_config_upload
+********************************************************************************
+* Summary:
+* Uploads a configuration from the configurator side in packets. The tuner
+* side takes all pending bytes per read, as the tuner callback does, and
+* acknowledges each packet with its sequence number, which the configurator
+* waits for before sending the next one. Reports the upload time against
+* the one byte per poll of the polled UART.
+*
+*******************************************************************************/
+static void test_config_upload(void)
+{
+    uint8_t buffer[TUNER_UART_RX_RING_SIZE];
+    uint8_t ack[TEST_ACK_SIZE];
+    uint32_t sent = 0;
+    uint32_t received = 0;
+    uint32_t acked = 0;
+    uint32_t packet_end = 0;
+    uint32_t reads = 0;
+    uint32_t max_read = 0;
+    uint32_t idle = 0;
+    uint32_t count;
+    ssize_t written;
+    tuner_uart_stats_t before;
+    tuner_uart_stats_t after;
+    uint64_t start;
+    uint64_t elapsed_ns;
+
+    for (uint32_t i = 0; i < TEST_CONFIG_SIZE; i++)
+    {
+        test_config[i] = (uint8_t)((i * 167u) ^ (i >> 8));
+    }
+    tuner_uart_get_stats(&before);
+
+    start = test_now_ns();
+    while (acked < (TEST_CONFIG_SIZE / TEST_PACKET_SIZE))
+    {
+        /* Configurator: send the current packet */
+        if (sent < packet_end)
+        {
+            written = write(test_host_fd, &test_config[sent], packet_end - sent);
+            sent += (written > 0) ? (uint32_t)written : 0u;
+        }
+
+        /* UART interrupt and tuner poll */
+        (void)host_uart_service();
+        count = tuner_uart_read(buffer, sizeof(buffer));
+        if (0u != count)
+        {
+            HOST_TEST_CHECK((received + count) <= TEST_CONFIG_SIZE);
+            memcpy(&test_received[received], buffer, count);
+            received += count;
+            reads++;
+            max_read = (count > max_read) ? count : max_read;
+            idle = 0;
+            if (0u == (received % TEST_PACKET_SIZE))
+            {
+                ack[0] = 'A';
+                ack[1] = 'C';
+                ack[2] = (uint8_t)((received / TEST_PACKET_SIZE) - 1u);
+                ack[3] = '\n';
+                HOST_TEST_EQUAL(tuner_uart_write(ack, sizeof(ack)), sizeof(ack));
+            }
+        }
+        else
+        {
+            HOST_TEST_CHECK(++idle < TEST_MAX_IDLE_STEPS);
+        }
+
+        /* Configurator: wait for the acknowledgement of the packet */
+        if ((sent == packet_end) && (received == sent) && (0u != sent))
+        {
+            test_host_read(ack, sizeof(ack));
+            HOST_TEST_EQUAL(ack[0], 'A');
+            HOST_TEST_EQUAL(ack[2], (uint8_t)acked);
+            acked++;
+        }
+        if ((sent == packet_end) && (acked == (sent / TEST_PACKET_SIZE)))
+        {
+            packet_end = sent + TEST_PACKET_SIZE;
+            if (packet_end > TEST_CONFIG_SIZE)
+            {
+                packet_end = TEST_CONFIG_SIZE;
+            }
+        }
+    }
+    elapsed_ns = test_now_ns() - start;
+
+    HOST_TEST_EQUAL(received, TEST_CONFIG_SIZE);
+    HOST_TEST_CHECK(0 == memcmp(test_received, test_config, TEST_CONFIG_SIZE));
+
+    /* The reads return whole packets, not single bytes */
+    HOST_TEST_CHECK(reads < (TEST_CONFIG_SIZE / 4u));
+    HOST_TEST_CHECK(max_read > 1u);
+
+    tuner_uart_get_stats(&after);
+    HOST_TEST_EQUAL(after.rx_bytes - before.rx_bytes, TEST_CONFIG_SIZE);
+    HOST_TEST_EQUAL(after.rx_overruns, before.rx_overruns);
+    HOST_TEST_EQUAL(after.tx_bytes - before.tx_bytes, (TEST_CONFIG_SIZE / TEST_PACKET_SIZE) * TEST_ACK_SIZE);
+    HOST_TEST_EQUAL(after.tx_overruns, before.tx_overruns);
+
+    printf("Uploaded %u bytes in %.2f ms over the pty, %lu reads of up to %lu bytes\n",
+           (unsigned int)TEST_CONFIG_SIZE, (double)elapsed_ns / 1e6,
+           (unsigned long)reads, (unsigned long)max_read);
+    printf("One byte per %u ms poll would take %.0f s\n", (unsigned int)TEST_TUNER_POLL_MS,
+           ((double)TEST_CONFIG_SIZE * TEST_TUNER_POLL_MS) / 1000.0);
+}
+
+/*******************************************************************************
+* Function Name: test_console_lines_are_split
+********************************************************************************
+* Summary:
+* A line starting with the console prefix goes to the console, the bytes
+* around it to the tuner, including a prefix that is not at a line start.
+*
+*******************************************************************************/
+static void test_console_lines_are_split(void)
+{
+    /* The upload before did not end with a line end */
+    static const char input[] = "\nae stats\r\n\x01\x02" "ae \x03\n";
+    static const uint8_t tuner[] = { '\n', 0x01, 0x02, 'a', 'e', ' ', 0x03, '\n' };
+    uint8_t buffer[64];
+    char line[TUNER_UART_CONSOLE_LINE_SIZE];
+    uint32_t count = 0;
+    uint32_t idle = 0;
+
+    tuner_uart_set_console_prefix("ae ");
+    HOST_TEST_EQUAL(write(test_host_fd, input, sizeof(input) - 1u), sizeof(input) - 1u);
+
+    while (count < sizeof(tuner))
+    {
+        (void)host_uart_service();
+        count += tuner_uart_read(&buffer[count], sizeof(buffer) - count);
+        HOST_TEST_CHECK(++idle < TEST_MAX_IDLE_STEPS);
+    }
+    HOST_TEST_EQUAL(count, sizeof(tuner));
+    HOST_TEST_CHECK(0 == memcmp(buffer, tuner, sizeof(tuner)));
+
+    HOST_TEST_CHECK(tuner_uart_read_console_line(line, sizeof(line)));
+    HOST_TEST_CHECK(0 == strcmp(line, "ae stats"));
+    HOST_TEST_CHECK(!tuner_uart_read_console_line(line, sizeof(line)));
+
+    tuner_uart_set_console_prefix(NULL);
+}
+
+/*******************************************************************************
+* Function Name: test_write_does_not_block
+********************************************************************************
+* Summary:
+* Writes are queued without the interrupt running. What does not fit in the
+* transmit ring is dropped and counted, the queued bytes all arrive once the
+* interrupt drains the ring.
+*
+*******************************************************************************/
+static void test_write_does_not_block(void)
+{
+    static uint8_t data[TUNER_UART_TX_RING_SIZE + 100u];
+    static uint8_t sent[TUNER_UART_TX_RING_SIZE];
+    tuner_uart_stats_t before;
+    tuner_uart_stats_t after;
+
+    for (uint32_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)(i * 31u);
+    }
+    tuner_uart_get_stats(&before);
+
+    HOST_TEST_EQUAL(tuner_uart_write(data, sizeof(data)), TUNER_UART_TX_RING_SIZE);
+    HOST_TEST_EQUAL(tuner_uart_write(data, 1u), 0);
+
+    tuner_uart_get_stats(&after);
+    HOST_TEST_EQUAL(after.tx_bytes - before.tx_bytes, TUNER_UART_TX_RING_SIZE);
+    HOST_TEST_EQUAL(after.tx_overruns - before.tx_overruns, 101);
+
+    test_host_read(sent, sizeof(sent));
+    HOST_TEST_CHECK(0 == memcmp(sent, data, sizeof(sent)));
+    HOST_TEST_CHECK(!host_uart_service());
+}
+
+int main(void)
+{
+    test_open_pty();
+    HOST_TEST_RUN(test_config_upload);
+    HOST_TEST_RUN(test_console_lines_are_split);
+    HOST_TEST_RUN(test_write_does_not_block);
+    return 0;
+}
+
+/* [] END OF FILE */
@@ -78,7 +78,13 @@ extern uint32_t SystemCoreClock;
 #define configUSE_TIME_SLICING                  1
 #define configENABLE_BACKWARD_COMPATIBILITY     0
 #define configNUM_THREAD_LOCAL_STORAGE_POINTERS 5
+/* Tasks run the MVE audio converters, so the MVE context is saved on task
+ * switches whenever the target supports MVE. */
+#if defined(__ARM_FEATURE_MVE) && !defined(MTB_SOFTFLOAT)
+#define configENABLE_MVE                        1
+#else
 #define configENABLE_MVE                        0
+#endif
 
 /* Compile-time macros to enable or disable TrustZone, Memory Protection Unit (MPU) and Floating Point Unit (FPU) support. */ 
 #if defined(MTB_SOFTFLOAT)
@@ -97,16 +103,35 @@ extern uint32_t SystemCoreClock;
 #define configAPPLICATION_ALLOCATED_HEAP        0
 
 /* Hook function related definitions. */
-#define configUSE_IDLE_HOOK                     0
+/* With AE_POWER_IDLE_SLEEP the idle task puts the CM55 in CPU sleep, see
+ * ae_power.h. The DWT cycle counter stops meanwhile, so it cannot be built
+ * with TASK_STATS_ENABLE or the other users of the counter as a clock. */
+#ifndef AE_POWER_IDLE_SLEEP
+#define AE_POWER_IDLE_SLEEP                     0
+#endif
+#define configUSE_IDLE_HOOK                     AE_POWER_IDLE_SLEEP
 #define configUSE_TICK_HOOK                     0
 #define configCHECK_FOR_STACK_OVERFLOW          2
 #define configUSE_MALLOC_FAILED_HOOK            1
 #define configUSE_DAEMON_TASK_STARTUP_HOOK      0
 
-/* Run time and task stats gathering related definitions. */
-#define configGENERATE_RUN_TIME_STATS           0
+/* Run time and task stats gathering related definitions. With
+ * TASK_STATS_ENABLE the DWT cycle counter is the run time counter and the
+ * task_stats module reports the CPU load of every task, see task_stats.h. */
+#ifndef TASK_STATS_ENABLE
+#define TASK_STATS_ENABLE                       0
+#endif
+#define configGENERATE_RUN_TIME_STATS           TASK_STATS_ENABLE
 #define configUSE_TRACE_FACILITY                1
 #define configUSE_STATS_FORMATTING_FUNCTIONS    0
+#if TASK_STATS_ENABLE
+#if defined (__ICCARM__) || (__GNUC__)
+extern void task_stats_counter_init(void);
+extern uint32_t task_stats_counter_get(void);
+#endif
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() task_stats_counter_init()
+#define portGET_RUN_TIME_COUNTER_VALUE()        task_stats_counter_get()
+#endif
 
 /* Co-routine related definitions. */
 #define configUSE_CO_ROUTINES                   0
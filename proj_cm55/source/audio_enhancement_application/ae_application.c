@@ -50,6 +50,12 @@
 #include "user_interaction.h"
 #include "i2s_playback.h"
 #include "audio_enhancement_interface.h"
+#include "ae_frame_pool.h"
+#include "ae_deadline.h"
+#include "ae_power.h"
+#include "deferred_log.h"
+#include "ae_pipeline.h"
+#include "task_stats.h"
 
 /*******************************************************************************
 * Global Variables
@@ -118,16 +124,57 @@ void ae_user_btn_init(cb_user_action user_action_cb)
 *******************************************************************************/
 void ae_application()
 {
-#if AFE_INPUT_SOURCE==AFE_INPUT_SOURCE_MIC
     cy_rslt_t result;
-#endif /* AFE_INPUT_SOURCE_MIC */
     app_core2_boot_log();
 
+/* Start the drain task of the logs deferred out of the real-time paths */
+#if DEFERRED_LOG_ENABLE
+    if(CY_RSLT_SUCCESS != deferred_log_init())
+    {
+        app_log_print("Deferred log initialization failed \r\n");
+    }
+#endif /* DEFERRED_LOG_ENABLE */
+
+/* Start the periodic report of the CPU load and stack usage of the tasks */
+#if TASK_STATS_ENABLE
+    if(CY_RSLT_SUCCESS != task_stats_init())
+    {
+        app_log_print("Task stats initialization failed \r\n");
+    }
+#endif /* TASK_STATS_ENABLE */
+
 /* Initialize I2S for audio playback */
     i2s_init();
 
-/* Initializing DEEPCRAFT(TM) Audio Enhancement */
-    ae_interface_init(AFE_INPUT_NUMBER_CHANNELS);
+/* Initialize the frame pool shared by audio capture and the AE feed */
+    ae_frame_pool_init();
+
+/* Start the frame deadline tracking before the capture path */
+#if AE_DEADLINE_ENABLE
+    ae_deadline_init();
+#endif /* AE_DEADLINE_ENABLE */
+
+/* Start the load adaptive clock scaling of the CM55 */
+#if AE_POWER_ENABLE
+    if(CY_RSLT_SUCCESS != ae_power_init())
+    {
+        app_log_print("AE power manager initialization failed \r\n");
+    }
+#endif /* AE_POWER_ENABLE */
+
+/* Initializing DEEPCRAFT(TM) Audio Enhancement with the start-up pipeline configuration */
+    if(CY_RSLT_SUCCESS != ae_pipeline_init())
+    {
+        app_log_print("AE pipeline initialization failed - Reset the board \r\n");
+        CY_ASSERT(0);
+    }
+
+/* Initialize the AE feed. Creates the AE worker task in task execution mode */
+    if(CY_RSLT_SUCCESS != ae_audio_feed_init())
+    {
+        app_log_print("AE feed initialization failed - Reset the board \r\n");
+        CY_ASSERT(0);
+    }
 
 /* Initializing USB for TX/RX of audio data */
     app_log_print("Initializing USB interface \r\n");
@@ -151,17 +198,20 @@ void ae_application()
     app_log_print("3. Capture Audio Data via PC from the enumerated USB Mic for AE processed data\r\n");
     app_log_print("Note: \r\n Refer to the README.md/ae_design_guide.md of this CE for details of different configurations and tuning via AFE configurator\r\n");
 
-    /* PDM mic initialization. Initialize if PDM mic is choosen as the input-mode.
-     * PDM mic data arrives via ISR.
+    /* PDM mic initialization. The input source can be switched at runtime,
+     * so the mics are always initialized and only capture while they are
+     * the input. PDM mic data arrives via ISR.
     */
-#if AFE_INPUT_SOURCE==AFE_INPUT_SOURCE_MIC
     result = pdm_mic_interface_init();
     if(CY_RSLT_SUCCESS != result)
     {
         app_log_print("PDM initialization failed - Reset the board \r\n");
         CY_ASSERT(0);
     }
-#endif /* AFE_INPUT_SOURCE_MIC */
+    if (AE_PIPELINE_INPUT_MIC != ae_pipeline_get_config()->input_source)
+    {
+        pdm_mic_interface_stop();
+    }
 
 }
 
@@ -43,8 +43,11 @@
 extern "C" {
 #endif /* __cplusplus */
 
+#include "cy_result.h"
+
 void ae_application();
 void led_init_hp();
+cy_rslt_t ae_audio_feed_init(void);
 
 #ifdef __cplusplus
 } /* extern C */
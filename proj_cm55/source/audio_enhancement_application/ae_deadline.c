@@ -0,0 +1,413 @@
+/******************************************************************************
+* File Name : ae_deadline.c
+*
+* Description :
+* Frame deadline tracking of the audio pipeline. Every frame is due one
+* frame period after its capture completed. Late and missed frames are
+* counted and frames that start behind their deadline are degraded by a
+* configurable policy.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdbool.h>
+#include <string.h>
+#include "ae_deadline.h"
+#include "audio_pipeline_config.h"
+#include "deferred_log.h"
+#ifndef AE_DEADLINE_HOST
+#include "cy_pdl.h"
+#endif /* AE_DEADLINE_HOST */
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static ae_deadline_policy_t ae_deadline_policy = AE_DEADLINE_POLICY;
+static ae_deadline_stats_t ae_deadline_stats = {0};
+
+/* Time allowed from the capture of a frame to the end of its AE output, in
+ * clock ticks. Read by the producer, set before capture starts.
+ */
+static uint32_t ae_deadline_budget_ticks = 0;
+static uint32_t ae_deadline_ticks_per_us = 1u;
+
+/* Sequence number expected from the next frame */
+static bool ae_deadline_sequence_valid = false;
+static uint32_t ae_deadline_next_sequence = 0;
+
+/* A late frame is logged once per series of late frames */
+static bool ae_deadline_late_reported = false;
+
+#ifdef AE_DEADLINE_HOST
+static uint32_t ae_deadline_clock_us = 0;
+#endif /* AE_DEADLINE_HOST */
+
+static const char *const ae_deadline_policy_names[] = { "none", "bypass", "drop" };
+
+/*******************************************************************************
+* Function Name: ae_deadline_now
+********************************************************************************
+* Summary:
+* Returns the clock of the deadlines: the DWT cycle counter on the target,
+* the synthetic clock in microseconds in the host build.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  Current time in ticks.
+*
+*******************************************************************************/
+static inline uint32_t ae_deadline_now(void)
+{
+#ifdef AE_DEADLINE_HOST
+    return ae_deadline_clock_us;
+#else
+    return DWT->CYCCNT;
+#endif /* AE_DEADLINE_HOST */
+}
+
+#ifdef AE_DEADLINE_HOST
+/*******************************************************************************
+* Function Name: ae_deadline_set_clock_us
+********************************************************************************
+* Summary:
+* Sets the synthetic clock of the host build.
+*
+* Parameters:
+*  now_us - Current time in microseconds
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void ae_deadline_set_clock_us(uint32_t now_us)
+{
+    ae_deadline_clock_us = now_us;
+}
+#endif /* AE_DEADLINE_HOST */
+
+/*******************************************************************************
+* Function Name: ae_deadline_init
+********************************************************************************
+* Summary:
+* Computes the frame budget from the pipeline configuration and clears the
+* statistics. Must be called before the capture path is started. The DWT
+* cycle counter is enabled without being reset so that it can be shared
+* with the profiler.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  CY_RSLT_SUCCESS
+*
+*******************************************************************************/
+cy_rslt_t ae_deadline_init(void)
+{
+#ifndef AE_DEADLINE_HOST
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif /* AE_DEADLINE_HOST */
+
+    ae_deadline_clock_changed();
+    ae_deadline_resync();
+    ae_deadline_reset_stats();
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: ae_deadline_clock_changed
+********************************************************************************
+* Summary:
+* Converts the frame budget to cycles of the current core clock. Called when
+* the core clock changed while no captured frame was waiting, so that all
+* deadlines pending later are counted with the new clock.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void ae_deadline_clock_changed(void)
+{
+    uint32_t frame_us = audio_pipeline_get_config()->frame_ms * 1000u;
+
+#ifndef AE_DEADLINE_HOST
+    ae_deadline_ticks_per_us = SystemCoreClock / 1000000u;
+#endif /* AE_DEADLINE_HOST */
+
+    ae_deadline_budget_ticks = ((frame_us * AE_DEADLINE_BUDGET_PERCENT) / 100u) *
+                               ae_deadline_ticks_per_us;
+}
+
+/*******************************************************************************
+* Function Name: ae_deadline_resync
+********************************************************************************
+* Summary:
+* Forgets the expected sequence number, so that frames discarded on purpose,
+* e.g. on a pipeline reconfiguration, are not counted as missed. Consumer
+* side.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void ae_deadline_resync(void)
+{
+    ae_deadline_sequence_valid = false;
+    ae_deadline_late_reported = false;
+}
+
+/*******************************************************************************
+* Function Name: ae_deadline_set_policy
+********************************************************************************
+* Summary:
+* Selects the handling of frames that start behind their deadline. Takes
+* effect from the next frame.
+*
+* Parameters:
+*  policy - New policy
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void ae_deadline_set_policy(ae_deadline_policy_t policy)
+{
+    if (policy <= AE_DEADLINE_POLICY_DROP)
+    {
+        ae_deadline_policy = policy;
+    }
+}
+
+/*******************************************************************************
+* Function Name: ae_deadline_get_policy
+********************************************************************************
+* Summary:
+* Returns the active policy.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  Active policy
+*
+*******************************************************************************/
+ae_deadline_policy_t ae_deadline_get_policy(void)
+{
+    return ae_deadline_policy;
+}
+
+/*******************************************************************************
+* Function Name: ae_deadline_policy_name
+********************************************************************************
+* Summary:
+* Returns the name of a policy as used by the pipeline console.
+*
+* Parameters:
+*  policy - Policy
+*
+* Return:
+*  Name, "?" for an invalid policy
+*
+*******************************************************************************/
+const char* ae_deadline_policy_name(ae_deadline_policy_t policy)
+{
+    return (policy <= AE_DEADLINE_POLICY_DROP) ? ae_deadline_policy_names[policy] : "?";
+}
+
+/*******************************************************************************
+* Function Name: ae_deadline_captured
+********************************************************************************
+* Summary:
+* Sets the deadline of a frame whose capture just completed. Producer side,
+* called from the capture interrupt or the USB feed.
+*
+* Parameters:
+*  frame - Captured frame
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void ae_deadline_captured(ae_frame_t *frame)
+{
+    frame->deadline = ae_deadline_now() + ae_deadline_budget_ticks;
+}
+
+/*******************************************************************************
+* Function Name: ae_deadline_begin
+********************************************************************************
+* Summary:
+* Called before a frame is processed. Counts the frames lost before the feed
+* from the gap in the sequence numbers and decides the handling of the frame.
+* A frame whose deadline has already passed cannot be processed in time and
+* delays the following frames, it is bypassed or dropped depending on the
+* policy so that the pipeline catches up. Either way the AE never sees the
+* frame, which breaks the continuity of the AEC and NS states.
+*
+* Parameters:
+*  frame - Frame about to be processed
+*
+* Return:
+*  Handling of the frame
+*
+*******************************************************************************/
+ae_deadline_action_t ae_deadline_begin(const ae_frame_t *frame)
+{
+    uint32_t gap = 0;
+
+    if (ae_deadline_sequence_valid && (frame->sequence != ae_deadline_next_sequence))
+    {
+        gap = frame->sequence - ae_deadline_next_sequence;
+        ae_deadline_stats.missed += gap;
+        DEFERRED_LOG("AE deadline: %lu frame(s) missed before frame %lu",
+                     (unsigned long)gap, (unsigned long)frame->sequence);
+    }
+    ae_deadline_sequence_valid = true;
+    ae_deadline_next_sequence = frame->sequence + 1u;
+
+    if ((int32_t)(ae_deadline_now() - frame->deadline) <= 0)
+    {
+        return AE_DEADLINE_PROCESS;
+    }
+
+    switch (ae_deadline_policy)
+    {
+        case AE_DEADLINE_POLICY_BYPASS:
+            ae_deadline_stats.bypassed++;
+            return AE_DEADLINE_BYPASS;
+
+        case AE_DEADLINE_POLICY_DROP:
+            ae_deadline_stats.dropped++;
+            return AE_DEADLINE_DROP;
+
+        default:
+            return AE_DEADLINE_PROCESS;
+    }
+}
+
+/*******************************************************************************
+* Function Name: ae_deadline_complete
+********************************************************************************
+* Summary:
+* Called after the AE output callback of a frame returned. Records the time
+* left before the deadline or the overrun.
+*
+* Parameters:
+*  frame - Frame processed or bypassed
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void ae_deadline_complete(const ae_frame_t *frame)
+{
+    int32_t slack_ticks = (int32_t)(frame->deadline - ae_deadline_now());
+    int32_t slack_us = slack_ticks / (int32_t)ae_deadline_ticks_per_us;
+
+    ae_deadline_stats.frames++;
+    if ((1u == ae_deadline_stats.frames) || (slack_us < ae_deadline_stats.min_slack_us))
+    {
+        ae_deadline_stats.min_slack_us = slack_us;
+    }
+
+    if (slack_ticks >= 0)
+    {
+        ae_deadline_late_reported = false;
+        return;
+    }
+
+    ae_deadline_stats.late++;
+    if ((uint32_t)(-slack_us) > ae_deadline_stats.max_late_us)
+    {
+        ae_deadline_stats.max_late_us = (uint32_t)(-slack_us);
+    }
+    if (!ae_deadline_late_reported)
+    {
+        ae_deadline_late_reported = true;
+        DEFERRED_LOG("AE deadline: frame %lu late by %lu us, policy %s",
+                     (unsigned long)frame->sequence, (unsigned long)(-slack_us),
+                     ae_deadline_policy_names[ae_deadline_policy]);
+    }
+}
+
+/*******************************************************************************
+* Function Name: ae_deadline_get_stats
+********************************************************************************
+* Summary:
+* Returns the deadline statistics.
+*
+* Parameters:
+*  stats - Filled with the statistics
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void ae_deadline_get_stats(ae_deadline_stats_t *stats)
+{
+    if (NULL != stats)
+    {
+        *stats = ae_deadline_stats;
+    }
+}
+
+/*******************************************************************************
+* Function Name: ae_deadline_reset_stats
+********************************************************************************
+* Summary:
+* Clears the deadline statistics.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void ae_deadline_reset_stats(void)
+{
+    memset(&ae_deadline_stats, 0, sizeof(ae_deadline_stats));
+}
+
+/* [] END OF FILE */
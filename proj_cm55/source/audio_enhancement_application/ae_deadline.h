@@ -0,0 +1,151 @@
+/******************************************************************************
+* File Name : ae_deadline.h
+*
+* Description :
+* Frame deadline tracking of the audio pipeline. Every frame is due one
+* frame period after its capture completed. Late and missed frames are
+* counted and frames that start behind their deadline are degraded by a
+* configurable policy.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __AE_DEADLINE_H__
+#define __AE_DEADLINE_H__
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include "cy_result.h"
+#include "ae_frame_pool.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 0 to remove the deadline tracking from the frame path */
+#ifndef AE_DEADLINE_ENABLE
+#define AE_DEADLINE_ENABLE                      (1)
+#endif /* AE_DEADLINE_ENABLE */
+
+/* Start-up policy for frames that start behind their deadline, one of
+ * ae_deadline_policy_t. It can be changed at runtime. Late frames are
+ * processed by default: a bypassed or dropped frame is never fed to the
+ * middleware, so the AEC and NS states lose a frame of continuity and the
+ * echo canceller reconverges after each one. Bypass and drop trade that for
+ * a bounded latency.
+ */
+#ifndef AE_DEADLINE_POLICY
+#define AE_DEADLINE_POLICY                      (AE_DEADLINE_POLICY_NONE)
+#endif /* AE_DEADLINE_POLICY */
+
+/* Share of the frame period in percent the AE may use for a frame. 100 %
+ * means a frame is due when the next one has been captured.
+ */
+#ifndef AE_DEADLINE_BUDGET_PERCENT
+#define AE_DEADLINE_BUDGET_PERCENT              (100u)
+#endif /* AE_DEADLINE_BUDGET_PERCENT */
+
+#if AE_DEADLINE_ENABLE
+#define AE_DEADLINE_CAPTURED(frame)             ae_deadline_captured(frame)
+#define AE_DEADLINE_BEGIN(frame)                ae_deadline_begin(frame)
+#define AE_DEADLINE_COMPLETE(frame)             ae_deadline_complete(frame)
+#else
+#define AE_DEADLINE_CAPTURED(frame)
+#define AE_DEADLINE_BEGIN(frame)                (AE_DEADLINE_PROCESS)
+#define AE_DEADLINE_COMPLETE(frame)
+#endif /* AE_DEADLINE_ENABLE */
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+typedef enum
+{
+    AE_DEADLINE_POLICY_NONE = 0,        /* Process late frames, only count them */
+    AE_DEADLINE_POLICY_BYPASS,          /* Send the raw mics instead of the AE output, not fed to the AE */
+    AE_DEADLINE_POLICY_DROP,            /* Skip the frame, the USB output and the AE miss it */
+} ae_deadline_policy_t;
+
+/* Handling of a frame decided when its processing starts */
+typedef enum
+{
+    AE_DEADLINE_PROCESS = 0,
+    AE_DEADLINE_BYPASS,
+    AE_DEADLINE_DROP,
+} ae_deadline_action_t;
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    uint32_t frames;                    /* Frames completed */
+    uint32_t late;                      /* Frames completed after their deadline */
+    uint32_t missed;                    /* Frames lost before the feed, pool full */
+    uint32_t bypassed;                  /* Frames sent without AE by the policy */
+    uint32_t dropped;                   /* Frames skipped by the policy */
+    int32_t min_slack_us;               /* Smallest time left at completion, negative when late */
+    uint32_t max_late_us;               /* Largest overrun of a deadline */
+} ae_deadline_stats_t;
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
+cy_rslt_t ae_deadline_init(void);
+void ae_deadline_resync(void);
+void ae_deadline_clock_changed(void);
+void ae_deadline_set_policy(ae_deadline_policy_t policy);
+ae_deadline_policy_t ae_deadline_get_policy(void);
+const char* ae_deadline_policy_name(ae_deadline_policy_t policy);
+
+/* Producer (capture) side, before the frame is submitted */
+void ae_deadline_captured(ae_frame_t *frame);
+
+/* Consumer (feed) side */
+ae_deadline_action_t ae_deadline_begin(const ae_frame_t *frame);
+void ae_deadline_complete(const ae_frame_t *frame);
+
+void ae_deadline_get_stats(ae_deadline_stats_t *stats);
+void ae_deadline_reset_stats(void);
+
+#ifdef AE_DEADLINE_HOST
+void ae_deadline_set_clock_us(uint32_t now_us);
+#endif /* AE_DEADLINE_HOST */
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* __AE_DEADLINE_H__ */
+
+/* [] END OF FILE */
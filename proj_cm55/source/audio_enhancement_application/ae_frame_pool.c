@@ -0,0 +1,222 @@
+/******************************************************************************
+* File Name : ae_frame_pool.c
+*
+* Description :
+* Pool of planar 10 ms frame descriptors. Capture writes frames in place
+* and the audio enhancement feed consumes them without further copies.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "ae_frame_pool.h"
+#include "audio_frame_ring.h"
+#include "ae_deadline.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static ae_frame_t ae_frame_storage[AE_FRAME_POOL_SIZE] __attribute__((aligned(AE_FRAME_ALIGNMENT)));
+static audio_frame_ring_t ae_frame_ring;
+static uint32_t ae_frame_sequence = 0;
+/* Frame returned by the last ae_frame_acquire, owned by the producer */
+static ae_frame_t *ae_frame_filling = NULL;
+
+#if AE_FRAME_COPY_STATS
+static ae_frame_copy_stats_t ae_frame_copy_stats = {0};
+#endif /* AE_FRAME_COPY_STATS */
+
+/*******************************************************************************
+* Function Name: ae_frame_pool_init
+********************************************************************************
+* Summary:
+* Initializes the frame pool.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  CY_RSLT_SUCCESS if successful.
+*
+*******************************************************************************/
+cy_rslt_t ae_frame_pool_init(void)
+{
+    ae_frame_sequence = 0;
+    ae_frame_filling = NULL;
+    return audio_frame_ring_init(&ae_frame_ring, ae_frame_storage,
+                                 sizeof(ae_frame_t), AE_FRAME_POOL_SIZE);
+}
+
+/*******************************************************************************
+* Function Name: ae_frame_acquire
+********************************************************************************
+* Summary:
+* Returns a free frame to be filled in place by the capture path, or NULL if
+* all frames are still waiting to be fed.
+*
+*******************************************************************************/
+ae_frame_t* ae_frame_acquire(void)
+{
+    ae_frame_t *frame = (ae_frame_t *)audio_frame_ring_reserve(&ae_frame_ring);
+
+    if (NULL != frame)
+    {
+        frame->sequence = ae_frame_sequence;
+        frame->aec_reference = NULL;
+        ae_frame_sequence++;
+    }
+    ae_frame_filling = frame;
+
+    return frame;
+}
+
+/*******************************************************************************
+* Function Name: ae_frame_reserve_ahead
+********************************************************************************
+* Summary:
+* Returns the free frame 'offset' frames after the one the next
+* ae_frame_acquire returns, or NULL if the pool has no such frame. Lets a DMA
+* capture path be pointed at its next frames before they are acquired; the
+* frame metadata is only set by ae_frame_acquire.
+*
+*******************************************************************************/
+ae_frame_t* ae_frame_reserve_ahead(uint32_t offset)
+{
+    return (ae_frame_t *)audio_frame_ring_reserve_ahead(&ae_frame_ring, offset);
+}
+
+/*******************************************************************************
+* Function Name: ae_frame_submit
+********************************************************************************
+* Summary:
+* Hands the frame returned by the last ae_frame_acquire to the feed. The
+* frame is due one frame period from now. Does nothing if that acquire failed
+* because the pool was full.
+*
+*******************************************************************************/
+void ae_frame_submit(void)
+{
+    if (NULL != ae_frame_filling)
+    {
+        AE_DEADLINE_CAPTURED(ae_frame_filling);
+        audio_frame_ring_commit(&ae_frame_ring);
+        ae_frame_filling = NULL;
+    }
+}
+
+/*******************************************************************************
+* Function Name: ae_frame_next
+********************************************************************************
+* Summary:
+* Returns the oldest captured frame, or NULL if none is pending.
+*
+*******************************************************************************/
+ae_frame_t* ae_frame_next(void)
+{
+    if (0 == audio_frame_ring_depth(&ae_frame_ring))
+    {
+        return NULL;
+    }
+    return (ae_frame_t *)audio_frame_ring_peek(&ae_frame_ring);
+}
+
+/*******************************************************************************
+* Function Name: ae_frame_done
+********************************************************************************
+* Summary:
+* Returns the frame obtained by ae_frame_next to the pool.
+*
+*******************************************************************************/
+void ae_frame_done(void)
+{
+    audio_frame_ring_release(&ae_frame_ring);
+#if AE_FRAME_COPY_STATS
+    ae_frame_copy_stats.frames++;
+#endif /* AE_FRAME_COPY_STATS */
+}
+
+/*******************************************************************************
+* Function Name: ae_frame_pending
+********************************************************************************
+* Summary:
+* Returns the number of captured frames waiting to be fed.
+*
+*******************************************************************************/
+uint32_t ae_frame_pending(void)
+{
+    return audio_frame_ring_depth(&ae_frame_ring);
+}
+
+#if AE_FRAME_COPY_STATS
+/*******************************************************************************
+* Function Name: ae_frame_count_copy
+********************************************************************************
+* Summary:
+* Records one frame copy of num_bytes bytes.
+*
+*******************************************************************************/
+void ae_frame_count_copy(uint32_t num_bytes)
+{
+    ae_frame_copy_stats.copies++;
+    ae_frame_copy_stats.bytes += num_bytes;
+}
+
+/*******************************************************************************
+* Function Name: ae_frame_copy_stats_get
+********************************************************************************
+* Summary:
+* Returns the copy counters accumulated since the last reset.
+*
+*******************************************************************************/
+void ae_frame_copy_stats_get(ae_frame_copy_stats_t *stats)
+{
+    *stats = ae_frame_copy_stats;
+}
+
+/*******************************************************************************
+* Function Name: ae_frame_copy_stats_reset
+********************************************************************************
+* Summary:
+* Clears the copy counters.
+*
+*******************************************************************************/
+void ae_frame_copy_stats_reset(void)
+{
+    ae_frame_copy_stats.frames = 0;
+    ae_frame_copy_stats.copies = 0;
+    ae_frame_copy_stats.bytes = 0;
+}
+#endif /* AE_FRAME_COPY_STATS */
+
+/* [] END OF FILE */
@@ -0,0 +1,137 @@
+/******************************************************************************
+* File Name : ae_frame_pool.h
+*
+* Description :
+* Header file for the pool of planar 10 ms frame descriptors shared between
+* audio capture and the audio enhancement feed.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __AE_FRAME_POOL_H__
+#define __AE_FRAME_POOL_H__
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include "cy_result.h"
+#include "audio_pipeline_config.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Number of samples per channel in a pipeline frame */
+#define AE_FRAME_SAMPLES_PER_CHANNEL            (AUDIO_PIPELINE_SAMPLES_PER_FRAME)
+#define AE_FRAME_MAX_CHANNELS                   (AUDIO_PIPELINE_MAX_MIC_CHANNELS)
+/* Frames and channel planes start on a data cache line, so that capture of
+ * one channel never shares a line with another channel.
+ */
+#define AE_FRAME_ALIGNMENT                      (32u)
+/* Distance in samples between two channel planes of a frame */
+#define AE_FRAME_CHANNEL_STRIDE                 ((((AE_FRAME_SAMPLES_PER_CHANNEL * sizeof(int16_t)) + \
+                                                   AE_FRAME_ALIGNMENT - 1u) / AE_FRAME_ALIGNMENT) * \
+                                                 (AE_FRAME_ALIGNMENT / sizeof(int16_t)))
+/* First sample of a channel plane */
+#define AE_FRAME_CHANNEL(frame, ch)             (&(frame)->mic[(ch) * AE_FRAME_CHANNEL_STRIDE])
+/* Number of frame slots. Frames stay intact for (AE_FRAME_POOL_SIZE - 1)
+ * frame periods after they were fed, which covers the AFE output callback.
+ */
+#define AE_FRAME_POOL_SIZE                      (4u)
+
+/* Set to 1 to count the bytes copied per frame between the capture FIFO and
+ * the AFE. Used to check the copy reduction of the frame path.
+ */
+#ifndef AE_FRAME_COPY_STATS
+#define AE_FRAME_COPY_STATS                     (0)
+#endif /* AE_FRAME_COPY_STATS */
+
+#if AE_FRAME_COPY_STATS
+#define AE_FRAME_COUNT_COPY(num_bytes)          ae_frame_count_copy(num_bytes)
+#else
+#define AE_FRAME_COUNT_COPY(num_bytes)
+#endif /* AE_FRAME_COPY_STATS */
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Frame descriptor. Microphone channels are stored planar, one block of
+ * AE_FRAME_SAMPLES_PER_CHANNEL samples per channel every AE_FRAME_CHANNEL_STRIDE
+ * samples.
+ */
+typedef struct
+{
+    int16_t mic[AE_FRAME_MAX_CHANNELS * AE_FRAME_CHANNEL_STRIDE] __attribute__((aligned(AE_FRAME_ALIGNMENT)));
+    int16_t aec_ref[AE_FRAME_SAMPLES_PER_CHANNEL];
+    int16_t *aec_reference;             /* aec_ref, another buffer or NULL */
+    uint32_t sequence;                  /* Capture sequence number */
+    uint32_t timestamp;                 /* Capture time of the first sample */
+    uint32_t deadline;                  /* Time the AE output of the frame is due */
+    uint8_t num_channels;               /* Number of valid mic channels */
+} ae_frame_t;
+
+typedef struct
+{
+    uint32_t frames;                    /* Frames fed to the AFE */
+    uint32_t copies;                    /* Frame copies performed */
+    uint32_t bytes;                     /* Bytes copied */
+} ae_frame_copy_stats_t;
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
+cy_rslt_t   ae_frame_pool_init(void);
+
+/* Producer (capture) side */
+ae_frame_t* ae_frame_acquire(void);
+ae_frame_t* ae_frame_reserve_ahead(uint32_t offset);
+void        ae_frame_submit(void);
+
+/* Consumer (feed) side */
+ae_frame_t* ae_frame_next(void);
+void        ae_frame_done(void);
+uint32_t    ae_frame_pending(void);
+
+#if AE_FRAME_COPY_STATS
+void        ae_frame_count_copy(uint32_t num_bytes);
+void        ae_frame_copy_stats_get(ae_frame_copy_stats_t *stats);
+void        ae_frame_copy_stats_reset(void);
+#endif /* AE_FRAME_COPY_STATS */
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* __AE_FRAME_POOL_H__ */
+
+/* [] END OF FILE */
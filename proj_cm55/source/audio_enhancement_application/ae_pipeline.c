@@ -0,0 +1,584 @@
+/******************************************************************************
+* File Name : ae_pipeline.c
+*
+* Description :
+* Runtime configuration of the audio pipeline. The input source, the number
+* of AFE channels, the AE backend and the AEC quality mode are changed
+* without a reboot, between two frames of the AE feed.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "cy_pdl.h"
+#include "app_logger.h"
+#include "ae_pipeline.h"
+#include "ae_frame_pool.h"
+#include "ae_deadline.h"
+#include "audio_enhancement_interface.h"
+#include "audio_pipeline_config.h"
+#include "pdm_mic_interface.h"
+#include "tuner_uart.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define AE_PIPELINE_CONSOLE_TASK_NAME           "ae_pipeline"
+#define AE_PIPELINE_CONSOLE_TASK_PRIORITY       (1)
+#define AE_PIPELINE_CONSOLE_TASK_STACK_SIZE     (configMINIMAL_STACK_SIZE * 4)
+#define AE_PIPELINE_CONSOLE_POLL_MS             (20u)
+#define AE_PIPELINE_CONSOLE_LINE_SIZE           (TUNER_UART_CONSOLE_LINE_SIZE)
+
+#define AE_PIPELINE_COMMAND                     "pipeline"
+#define AE_PIPELINE_TOKEN_DELIMITERS            " \t"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static ae_pipeline_config_t ae_pipeline_config =
+{
+#if AFE_INPUT_SOURCE==AFE_INPUT_SOURCE_MIC
+    .input_source = AE_PIPELINE_INPUT_MIC,
+#else
+    .input_source = AE_PIPELINE_INPUT_USB,
+#endif /* AFE_INPUT_SOURCE */
+    .num_channels = AFE_INPUT_NUMBER_CHANNELS,
+    .aec_quality_mode = (AEC_QUALITY_MODE != 0),
+    .backend = NULL,
+};
+
+static ae_pipeline_stats_t ae_pipeline_stats = {0};
+
+/* Serializes reconfigurations against the AE feed */
+static SemaphoreHandle_t ae_pipeline_mutex = NULL;
+
+static const char *const ae_pipeline_input_names[] = { "mic", "usb" };
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
+#if AE_PIPELINE_CONSOLE_ENABLE
+static void ae_pipeline_console_task(void *arg);
+#endif /* AE_PIPELINE_CONSOLE_ENABLE */
+
+/*******************************************************************************
+* Function Name: ae_pipeline_init
+********************************************************************************
+* Summary:
+* Creates the AE backend with the start-up configuration taken from the AFE
+* configurator settings. Must be called before the capture path is started.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  CY_RSLT_SUCCESS on success, AE_PIPELINE_FAILURE otherwise.
+*
+*******************************************************************************/
+cy_rslt_t ae_pipeline_init(void)
+{
+    ae_pipeline_mutex = xSemaphoreCreateMutex();
+    if (NULL == ae_pipeline_mutex)
+    {
+        return AE_PIPELINE_FAILURE;
+    }
+
+    /* DWT cycle counter for the reconfiguration time */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    /* A failed AE initialization is reported by the interface, the pipeline
+     * can still be reconfigured to another backend.
+     */
+    (void)ae_interface_init(ae_pipeline_config.num_channels);
+    ae_pipeline_config.backend = audio_enhancement_get_backend();
+
+#if AE_PIPELINE_CONSOLE_ENABLE
+    /* Already started by the tuner when it uses the UART transport */
+    tuner_uart_set_console_prefix(AE_PIPELINE_COMMAND);
+    if (CY_RSLT_SUCCESS != tuner_uart_init())
+    {
+        return AE_PIPELINE_FAILURE;
+    }
+    if (pdPASS != xTaskCreate(ae_pipeline_console_task, AE_PIPELINE_CONSOLE_TASK_NAME,
+            AE_PIPELINE_CONSOLE_TASK_STACK_SIZE, NULL, AE_PIPELINE_CONSOLE_TASK_PRIORITY, NULL))
+    {
+        return AE_PIPELINE_FAILURE;
+    }
+#endif /* AE_PIPELINE_CONSOLE_ENABLE */
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: ae_pipeline_get_config
+********************************************************************************
+* Summary:
+* Returns the active pipeline configuration.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  Pointer to the pipeline configuration
+*
+*******************************************************************************/
+const ae_pipeline_config_t* ae_pipeline_get_config(void)
+{
+    return &ae_pipeline_config;
+}
+
+/*******************************************************************************
+* Function Name: ae_pipeline_feed_lock
+********************************************************************************
+* Summary:
+* Taken by the AE feed around the frames it feeds, so that a reconfiguration
+* only runs between two frames. In ISR execution mode the feed cannot block
+* and the pipeline is not reconfigured.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void ae_pipeline_feed_lock(void)
+{
+#ifdef AE_EXEC_MODE_TASK
+    if (NULL != ae_pipeline_mutex)
+    {
+        (void)xSemaphoreTake(ae_pipeline_mutex, portMAX_DELAY);
+    }
+#endif /* AE_EXEC_MODE_TASK */
+}
+
+/*******************************************************************************
+* Function Name: ae_pipeline_feed_unlock
+********************************************************************************
+* Summary:
+* Releases the lock taken by ae_pipeline_feed_lock.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void ae_pipeline_feed_unlock(void)
+{
+#ifdef AE_EXEC_MODE_TASK
+    if (NULL != ae_pipeline_mutex)
+    {
+        (void)xSemaphoreGive(ae_pipeline_mutex);
+    }
+#endif /* AE_EXEC_MODE_TASK */
+}
+
+/*******************************************************************************
+* Function Name: ae_pipeline_reconfigure
+********************************************************************************
+* Summary:
+* Switches the pipeline to a new configuration. Waits for the AE feed to
+* finish the current frame, stops the PDM capture when the mics are no
+* longer the input, drops the frames captured for the old configuration and
+* re-creates the AE backend if its type or channel count changed. The
+* DEEPCRAFT(TM) middleware memory is returned to the arena and taken again,
+* so repeated reconfigurations do not grow the heap. A backend that cannot
+* be created leaves the previous configuration active.
+*
+* Called from task context. While the backend is re-created the AE feed
+* waits, the captured frames are queued in the frame pool. In ISR execution
+* mode the feed cannot wait and every reconfiguration is refused.
+*
+* Parameters:
+*  config - New configuration
+*
+* Return:
+*  CY_RSLT_SUCCESS on success, AE_PIPELINE_EXEC_MODE_FAILURE in ISR execution
+*  mode, AE_PIPELINE_FAILURE otherwise.
+*
+*******************************************************************************/
+cy_rslt_t ae_pipeline_reconfigure(const ae_pipeline_config_t *config)
+{
+#ifdef AE_EXEC_MODE_TASK
+    const audio_pipeline_config_t *audio_cfg = audio_pipeline_get_config();
+    ae_pipeline_input_t previous_source = ae_pipeline_config.input_source;
+    ae_rslt_t result = AE_RSLT_SUCCESS;
+    bool capture_stopped = false;
+    uint32_t max_channels = 0;
+    uint32_t start_cycles = 0;
+    uint32_t cycles_per_us = 0;
+    uint32_t elapsed_us = 0;
+
+    if ((NULL == config) || (NULL == config->backend) ||
+        (config->input_source > AE_PIPELINE_INPUT_USB))
+    {
+        ae_pipeline_stats.failures++;
+        return AE_PIPELINE_FAILURE;
+    }
+
+    /* USB input frames always carry the two channels of the USB speaker */
+    max_channels = (AE_PIPELINE_INPUT_MIC == config->input_source) ?
+            audio_cfg->mic_channels : audio_cfg->playback_channels;
+    if ((0u == config->num_channels) || (config->num_channels > max_channels) ||
+        ((0u != config->backend->fixed_channels) &&
+         (config->num_channels != config->backend->fixed_channels)))
+    {
+        ae_pipeline_stats.failures++;
+        return AE_PIPELINE_FAILURE;
+    }
+
+    if (pdTRUE != xSemaphoreTake(ae_pipeline_mutex, pdMS_TO_TICKS(AE_PIPELINE_LOCK_TIMEOUT_MS)))
+    {
+        ae_pipeline_stats.failures++;
+        return AE_PIPELINE_FAILURE;
+    }
+
+    /* Convert with the clock the count starts at, the power controller may
+     * change SystemCoreClock before the end of the measurement */
+    cycles_per_us = SystemCoreClock / 1000000u;
+    start_cycles = DWT->CYCCNT;
+
+    if ((AE_PIPELINE_INPUT_MIC == previous_source) &&
+        (AE_PIPELINE_INPUT_MIC != config->input_source))
+    {
+        pdm_mic_interface_stop();
+        capture_stopped = true;
+    }
+
+    /* Frames captured for the previous configuration are not fed */
+    while (NULL != ae_frame_next())
+    {
+        ae_frame_done();
+        ae_pipeline_stats.dropped_frames++;
+    }
+#if AE_DEADLINE_ENABLE
+    ae_deadline_resync();
+#endif /* AE_DEADLINE_ENABLE */
+
+    if ((config->backend != ae_pipeline_config.backend) ||
+        (config->num_channels != ae_pipeline_config.num_channels))
+    {
+        result = audio_enhancement_reconfigure(config->backend, config->num_channels);
+    }
+
+    if (AE_RSLT_SUCCESS == result)
+    {
+        ae_pipeline_config = *config;
+    }
+
+    /* Restart the mics if they are the input, also when the change failed */
+    if ((AE_PIPELINE_INPUT_MIC == ae_pipeline_config.input_source) &&
+        (capture_stopped || (AE_PIPELINE_INPUT_MIC != previous_source)))
+    {
+        pdm_mic_interface_start();
+    }
+
+    elapsed_us = (DWT->CYCCNT - start_cycles) / cycles_per_us;
+
+    (void)xSemaphoreGive(ae_pipeline_mutex);
+
+    if (AE_RSLT_SUCCESS != result)
+    {
+        ae_pipeline_stats.failures++;
+        app_log_print("Pipeline: %s backend with %u channel(s) failed (%d) \r\n",
+                config->backend->name, (unsigned int)config->num_channels, (int)result);
+        return AE_PIPELINE_FAILURE;
+    }
+
+    ae_pipeline_stats.reconfigurations++;
+    ae_pipeline_stats.last_us = elapsed_us;
+    if (elapsed_us > ae_pipeline_stats.max_us)
+    {
+        ae_pipeline_stats.max_us = elapsed_us;
+    }
+    app_log_print("Pipeline reconfigured in %lu us \r\n", (unsigned long)elapsed_us);
+
+    return CY_RSLT_SUCCESS;
+#else
+    (void)config;
+    ae_pipeline_stats.failures++;
+    app_log_print("Pipeline: reconfiguration is not supported in AE_EXEC_MODE_ISR, build with CONFIG_AE_EXEC_MODE=TASK \r\n");
+    return AE_PIPELINE_EXEC_MODE_FAILURE;
+#endif /* AE_EXEC_MODE_TASK */
+}
+
+/*******************************************************************************
+* Function Name: ae_pipeline_print
+********************************************************************************
+* Summary:
+* Prints the active configuration and the reconfiguration statistics.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+static void ae_pipeline_print(void)
+{
+    app_log_print("Pipeline: source=%s channels=%u backend=%s aecq=%u \r\n",
+            ae_pipeline_input_names[ae_pipeline_config.input_source],
+            (unsigned int)ae_pipeline_config.num_channels,
+            (NULL != ae_pipeline_config.backend) ? ae_pipeline_config.backend->name : "none",
+            (unsigned int)ae_pipeline_config.aec_quality_mode);
+    app_log_print("Pipeline: %lu reconfigurations, %lu failed, last %lu us, max %lu us, %lu frames dropped \r\n",
+            (unsigned long)ae_pipeline_stats.reconfigurations,
+            (unsigned long)ae_pipeline_stats.failures,
+            (unsigned long)ae_pipeline_stats.last_us,
+            (unsigned long)ae_pipeline_stats.max_us,
+            (unsigned long)ae_pipeline_stats.dropped_frames);
+#if AE_DEADLINE_ENABLE
+    {
+        ae_deadline_stats_t deadline;
+
+        ae_deadline_get_stats(&deadline);
+        app_log_print("Deadline: policy=%s, %lu frames, %lu late (max %lu us), %lu missed, %lu bypassed, %lu dropped, min slack %ld us \r\n",
+                ae_deadline_policy_name(ae_deadline_get_policy()),
+                (unsigned long)deadline.frames, (unsigned long)deadline.late,
+                (unsigned long)deadline.max_late_us, (unsigned long)deadline.missed,
+                (unsigned long)deadline.bypassed, (unsigned long)deadline.dropped,
+                (long)deadline.min_slack_us);
+    }
+#endif /* AE_DEADLINE_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: ae_pipeline_command
+********************************************************************************
+* Summary:
+* Executes a pipeline command line:
+*
+*   pipeline [source=mic|usb] [channels=<n>] [backend=<name>] [aecq=0|1]
+*            [deadline=none|bypass|drop]
+*
+* Settings that are not given keep their value. Without settings the
+* active configuration and the statistics are printed. A backend with fixed
+* channels, deepcraft with the mics of the AFE configurator, is rejected
+* with any other channel count before the pipeline is touched.
+*
+* Parameters:
+*  line - Command line
+*
+* Return:
+*  CY_RSLT_SUCCESS on success, the error of ae_pipeline_reconfigure if the
+*  switch fails, AE_PIPELINE_FAILURE otherwise.
+*
+*******************************************************************************/
+cy_rslt_t ae_pipeline_command(const char *line)
+{
+    char buffer[AE_PIPELINE_CONSOLE_LINE_SIZE];
+    ae_pipeline_config_t config = ae_pipeline_config;
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    bool changed = false;
+    char *save = NULL;
+    char *token = NULL;
+    char *value = NULL;
+
+    if ((NULL == line) || (strlen(line) >= sizeof(buffer)))
+    {
+        return AE_PIPELINE_FAILURE;
+    }
+    strcpy(buffer, line);
+
+    token = strtok_r(buffer, AE_PIPELINE_TOKEN_DELIMITERS, &save);
+    if ((NULL == token) || (0 != strcmp(token, AE_PIPELINE_COMMAND)))
+    {
+        return AE_PIPELINE_FAILURE;
+    }
+
+    for (token = strtok_r(NULL, AE_PIPELINE_TOKEN_DELIMITERS, &save); NULL != token;
+         token = strtok_r(NULL, AE_PIPELINE_TOKEN_DELIMITERS, &save))
+    {
+        value = strchr(token, '=');
+        if (NULL == value)
+        {
+            break;
+        }
+        *value++ = '\0';
+
+        if ((0 == strcmp(token, "source")) && (0 == strcmp(value, "mic")))
+        {
+            config.input_source = AE_PIPELINE_INPUT_MIC;
+        }
+        else if ((0 == strcmp(token, "source")) && (0 == strcmp(value, "usb")))
+        {
+            config.input_source = AE_PIPELINE_INPUT_USB;
+        }
+        else if (0 == strcmp(token, "channels"))
+        {
+            config.num_channels = (uint8_t)strtoul(value, NULL, 10);
+        }
+        else if (0 == strcmp(token, "backend"))
+        {
+            config.backend = audio_enhancement_find_backend(value);
+            if (NULL == config.backend)
+            {
+                break;
+            }
+        }
+        else if (0 == strcmp(token, "aecq"))
+        {
+            config.aec_quality_mode = (0u != strtoul(value, NULL, 10));
+        }
+#if AE_DEADLINE_ENABLE
+        /* The deadline policy applies from the next frame without reconfiguration */
+        else if ((0 == strcmp(token, "deadline")) && (0 == strcmp(value, "none")))
+        {
+            ae_deadline_set_policy(AE_DEADLINE_POLICY_NONE);
+            continue;
+        }
+        else if ((0 == strcmp(token, "deadline")) && (0 == strcmp(value, "bypass")))
+        {
+            ae_deadline_set_policy(AE_DEADLINE_POLICY_BYPASS);
+            continue;
+        }
+        else if ((0 == strcmp(token, "deadline")) && (0 == strcmp(value, "drop")))
+        {
+            ae_deadline_set_policy(AE_DEADLINE_POLICY_DROP);
+            continue;
+        }
+#endif /* AE_DEADLINE_ENABLE */
+        else
+        {
+            break;
+        }
+        changed = true;
+    }
+
+    if (NULL != token)
+    {
+        app_log_print("Usage: pipeline [source=mic|usb] [channels=<n>] [backend=<name>] [aecq=0|1] [deadline=none|bypass|drop] \r\n");
+        app_log_print("       backend=%s takes channels=%u only \r\n",
+                ae_backend_deepcraft.name, (unsigned int)ae_backend_deepcraft.fixed_channels);
+        return AE_PIPELINE_FAILURE;
+    }
+
+    if ((0u != config.backend->fixed_channels) &&
+        (config.num_channels != config.backend->fixed_channels))
+    {
+        app_log_print("Pipeline: backend=%s takes channels=%u only \r\n",
+                config.backend->name, (unsigned int)config.backend->fixed_channels);
+        return AE_PIPELINE_FAILURE;
+    }
+
+    if (changed)
+    {
+        result = ae_pipeline_reconfigure(&config);
+        if (CY_RSLT_SUCCESS != result)
+        {
+            return result;
+        }
+    }
+
+    ae_pipeline_print();
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: ae_pipeline_get_stats
+********************************************************************************
+* Summary:
+* Returns the reconfiguration statistics.
+*
+* Parameters:
+*  stats - Filled with the statistics
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void ae_pipeline_get_stats(ae_pipeline_stats_t *stats)
+{
+    if (NULL != stats)
+    {
+        *stats = ae_pipeline_stats;
+    }
+}
+
+#if AE_PIPELINE_CONSOLE_ENABLE
+/*******************************************************************************
+* Function Name: ae_pipeline_console_task
+********************************************************************************
+* Summary:
+* Executes the pipeline command lines received on the debug UART. The UART
+* driver takes the lines starting with the command out of the received
+* bytes, so the console works next to the UART tuner transport.
+*
+* Parameters:
+*  arg - Unused.
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+static void ae_pipeline_console_task(void *arg)
+{
+    char line[AE_PIPELINE_CONSOLE_LINE_SIZE];
+#if (TUNER_TRANSPORT != TUNER_TRANSPORT_UART)
+    uint8_t data[16];
+#endif /* TUNER_TRANSPORT */
+
+    (void)arg;
+
+    while (1)
+    {
+#if (TUNER_TRANSPORT != TUNER_TRANSPORT_UART)
+        /* No tuner reads the UART, discard the bytes of other lines */
+        while (0u != tuner_uart_read(data, sizeof(data)))
+        {
+        }
+#endif /* TUNER_TRANSPORT */
+
+        if (tuner_uart_read_console_line(line, sizeof(line)))
+        {
+            (void)ae_pipeline_command(line);
+        }
+        else
+        {
+            vTaskDelay(pdMS_TO_TICKS(AE_PIPELINE_CONSOLE_POLL_MS));
+        }
+    }
+}
+#endif /* AE_PIPELINE_CONSOLE_ENABLE */
+
+/* [] END OF FILE */
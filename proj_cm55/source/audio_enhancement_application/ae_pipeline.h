@@ -0,0 +1,127 @@
+/******************************************************************************
+* File Name : ae_pipeline.h
+*
+* Description :
+* Header file for the runtime configuration of the audio pipeline: input
+* source, number of AFE channels, AE backend and AEC quality mode.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __AE_PIPELINE_H__
+#define __AE_PIPELINE_H__
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_result.h"
+#include "ae_backend.h"
+#include "tuner_transport.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* For Speech Quality check for AEC where the test stream will have audio data
+ * in left channel and AEC reference in right channel - Set to zero unless
+ * benchmarking. Start-up value, it can be changed at runtime.
+ */
+#ifndef AEC_QUALITY_MODE
+#define AEC_QUALITY_MODE                        (0)
+#endif /* AEC_QUALITY_MODE */
+
+/* Line based console for pipeline commands on the debug UART. With the UART
+ * tuner transport the console shares the UART with the tuner: the lines that
+ * start with "pipeline" go to the console, all other bytes to the tuner.
+ */
+#ifndef AE_PIPELINE_CONSOLE_ENABLE
+#define AE_PIPELINE_CONSOLE_ENABLE              (1)
+#endif /* AE_PIPELINE_CONSOLE_ENABLE */
+
+/* Longest wait for the AE feed to finish the current frame */
+#define AE_PIPELINE_LOCK_TIMEOUT_MS             (100u)
+
+#define AE_PIPELINE_FAILURE                     (-1)
+/* Reconfiguration refused because the AE runs in AE_EXEC_MODE_ISR */
+#define AE_PIPELINE_EXEC_MODE_FAILURE           (-2)
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+typedef enum
+{
+    AE_PIPELINE_INPUT_MIC = 0,          /* PDM mics */
+    AE_PIPELINE_INPUT_USB,              /* Stereo stream of the USB speaker */
+} ae_pipeline_input_t;
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    ae_pipeline_input_t input_source;
+    uint8_t num_channels;               /* Mic channels fed to the backend */
+    bool aec_quality_mode;              /* USB input: right channel is the AEC reference */
+    const ae_backend_t *backend;
+} ae_pipeline_config_t;
+
+typedef struct
+{
+    uint32_t reconfigurations;          /* Successful reconfigurations */
+    uint32_t failures;                  /* Rejected or failed reconfigurations */
+    uint32_t last_us;                   /* Duration of the last reconfiguration */
+    uint32_t max_us;                    /* Longest reconfiguration */
+    uint32_t dropped_frames;            /* Pending frames discarded on reconfiguration */
+} ae_pipeline_stats_t;
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
+cy_rslt_t ae_pipeline_init(void);
+const ae_pipeline_config_t* ae_pipeline_get_config(void);
+cy_rslt_t ae_pipeline_reconfigure(const ae_pipeline_config_t *config);
+cy_rslt_t ae_pipeline_command(const char *line);
+void ae_pipeline_get_stats(ae_pipeline_stats_t *stats);
+
+/* Held by the AE feed while it feeds frames of the frame pool */
+void ae_pipeline_feed_lock(void);
+void ae_pipeline_feed_unlock(void);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* __AE_PIPELINE_H__ */
+
+/* [] END OF FILE */
@@ -0,0 +1,475 @@
+/******************************************************************************
+* File Name : ae_power.c
+*
+* Description :
+* Load adaptive clock scaling of the CM55. The AE busy cycles of every
+* frame select the lowest core clock profile that leaves the configured
+* headroom. Profiles change only between frames.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "ae_power.h"
+#include "FreeRTOS.h"
+#include "audio_pipeline_config.h"
+#ifndef AE_POWER_HOST
+#include "cy_pdl.h"
+#include "deferred_log.h"
+#include "ae_frame_pool.h"
+#include "ae_deadline.h"
+#include "latency_trace.h"
+#include "rt_stats.h"
+#endif /* AE_POWER_HOST */
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* The DWT cycle counter stops while the CPU sleeps. The deadlines, the
+ * latency trace, the ISR statistics and the task loads take it as a wall
+ * clock, so they cannot be built together with the idle sleep.
+ */
+#if AE_POWER_IDLE_SLEEP && (AE_DEADLINE_ENABLE || LATENCY_TRACE_ENABLE || RT_STATS_ENABLE || TASK_STATS_ENABLE)
+#error "AE_POWER_IDLE_SLEEP stops DWT->CYCCNT: set AE_DEADLINE_ENABLE, LATENCY_TRACE_ENABLE, RT_STATS_ENABLE and TASK_STATS_ENABLE to 0"
+#endif /* AE_POWER_IDLE_SLEEP */
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const uint32_t ae_power_dividers[AE_POWER_NUM_PROFILES] = AE_POWER_PROFILE_DIVIDERS;
+
+#if AE_POWER_ENABLE
+static ae_power_controller_t ae_power_controller;
+static ae_power_stats_t ae_power_stats = {0};
+
+/* Profile of the core clock, the controller may ask for another one */
+static uint32_t ae_power_active = AE_POWER_NUM_PROFILES - 1u;
+static uint32_t ae_power_full_clock_hz = 0;
+static uint32_t ae_power_frame_us = 0;
+
+static uint32_t ae_power_start_cycles = 0;
+static uint32_t ae_power_last_late = 0;
+
+/* Energy proxy metrics of the current report */
+static uint32_t ae_power_report_frames = 0;
+static uint64_t ae_power_report_busy_us = 0;
+static uint64_t ae_power_report_idle_us = 0;
+static uint64_t ae_power_report_mhz = 0;
+#endif /* AE_POWER_ENABLE */
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
+#if AE_POWER_ENABLE
+/* Tick timer setup of the FreeRTOS port, not declared in its headers */
+extern void vPortSetupTimerInterrupt(void);
+#endif /* AE_POWER_ENABLE */
+
+/*******************************************************************************
+* Function Name: ae_power_controller_init
+********************************************************************************
+* Summary:
+* Computes the work per frame every profile can do within the frame period
+* less the headroom and starts at the fastest profile.
+*
+* Parameters:
+*  controller - Controller state
+*  frame_us - Frame period in microseconds
+*  full_clock_hz - Core clock of the fastest profile
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void ae_power_controller_init(ae_power_controller_t *controller, uint32_t frame_us,
+                              uint32_t full_clock_hz)
+{
+    uint64_t full_cycles = ((uint64_t)frame_us * (full_clock_hz / 1000000u) *
+                            (100u - AE_POWER_HEADROOM_PERCENT)) / 100u;
+
+    memset(controller, 0, sizeof(*controller));
+    for (uint32_t profile = 0; profile < AE_POWER_NUM_PROFILES; profile++)
+    {
+        controller->capacity[profile] = (uint32_t)(full_cycles / ae_power_dividers[profile]);
+    }
+    controller->profile = AE_POWER_NUM_PROFILES - 1u;
+    controller->hold_windows = 1u;
+}
+
+/*******************************************************************************
+* Function Name: ae_power_controller_lowest
+********************************************************************************
+* Summary:
+* Returns the slowest profile whose capacity covers the work, the fastest
+* profile if none does.
+*
+*******************************************************************************/
+static uint32_t ae_power_controller_lowest(const ae_power_controller_t *controller,
+                                           uint32_t work_cycles)
+{
+    uint32_t profile = 0;
+
+    while ((profile < (AE_POWER_NUM_PROFILES - 1u)) &&
+           (work_cycles > controller->capacity[profile]))
+    {
+        profile++;
+    }
+    return profile;
+}
+
+/*******************************************************************************
+* Function Name: ae_power_controller_step
+********************************************************************************
+* Summary:
+* Selects the profile for the next frame from the work of the last one. The
+* clock is raised at once when a frame did not fit the active profile or was
+* late, and lowered only when all frames of a window fit a slower profile.
+* Late frames lengthen the window, so that periodic load peaks further
+* apart than a window do not lower the clock again and again.
+*
+* Parameters:
+*  controller - Controller state
+*  work_cycles - Work of the last frame in cycles of the fastest profile
+*  late - The last frame missed its deadline
+*
+* Return:
+*  Selected profile
+*
+*******************************************************************************/
+uint32_t ae_power_controller_step(ae_power_controller_t *controller, uint32_t work_cycles,
+                                  bool late)
+{
+    uint32_t target = controller->profile;
+
+    if (late)
+    {
+        target = AE_POWER_NUM_PROFILES - 1u;
+        controller->hold_windows = (2u * controller->hold_windows < AE_POWER_MAX_HOLD_WINDOWS) ?
+                                   (2u * controller->hold_windows) : AE_POWER_MAX_HOLD_WINDOWS;
+        controller->quiet_windows = 0;
+    }
+    else if (work_cycles > controller->capacity[controller->profile])
+    {
+        target = ae_power_controller_lowest(controller, work_cycles);
+    }
+
+    if (work_cycles > controller->window_max_work)
+    {
+        controller->window_max_work = work_cycles;
+    }
+    controller->window_frames++;
+
+    if ((target == controller->profile) &&
+        (controller->window_frames >= (AE_POWER_WINDOW_FRAMES * controller->hold_windows)))
+    {
+        target = ae_power_controller_lowest(controller, controller->window_max_work);
+        controller->window_frames = 0;
+        controller->window_max_work = 0;
+        controller->quiet_windows += controller->hold_windows;
+        if ((controller->hold_windows > 1u) &&
+            (controller->quiet_windows >= AE_POWER_MAX_HOLD_WINDOWS))
+        {
+            controller->hold_windows--;
+            controller->quiet_windows = 0;
+        }
+    }
+
+    /* A lower profile is tried only after a full window at the new one */
+    if (target != controller->profile)
+    {
+        controller->profile = target;
+        controller->window_frames = 0;
+        controller->window_max_work = 0;
+    }
+
+    return target;
+}
+
+#if AE_POWER_ENABLE
+/*******************************************************************************
+* Function Name: ae_power_apply
+********************************************************************************
+* Summary:
+* Switches the core clock to a profile. The flash wait states stay at the
+* start-up setting, which is valid for all slower clocks. The kernel tick
+* timer is set up again by the port for the new clock.
+*
+* Parameters:
+*  profile - Profile to switch to
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+static void ae_power_apply(uint32_t profile)
+{
+    cy_en_clkhf_dividers_t divider = CY_SYSCLK_CLKHF_NO_DIVIDE;
+    uint32_t interrupt_state = 0;
+
+    switch (ae_power_dividers[profile])
+    {
+        case 2u:
+            divider = CY_SYSCLK_CLKHF_DIVIDE_BY_2;
+            break;
+
+        case 4u:
+            divider = CY_SYSCLK_CLKHF_DIVIDE_BY_4;
+            break;
+
+        default:
+            divider = CY_SYSCLK_CLKHF_NO_DIVIDE;
+            break;
+    }
+
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+
+    /* A frame captured meanwhile is handled with the next batch */
+    if (0u != ae_frame_pending())
+    {
+        Cy_SysLib_ExitCriticalSection(interrupt_state);
+        return;
+    }
+
+    if (CY_SYSCLK_SUCCESS == Cy_SysClk_ClkHfSetDivider(AE_POWER_CLK_HF, divider))
+    {
+        SystemCoreClockUpdate();
+        /* The port derives the tick from configCPU_CLOCK_HZ, i.e.
+         * SystemCoreClock, and keeps its own tick timing state consistent
+         */
+        vPortSetupTimerInterrupt();
+        ae_power_active = profile;
+        ae_power_stats.switches++;
+#if AE_DEADLINE_ENABLE
+        ae_deadline_clock_changed();
+#endif /* AE_DEADLINE_ENABLE */
+    }
+
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+    ae_power_stats.clock_hz = SystemCoreClock;
+}
+
+/*******************************************************************************
+* Function Name: ae_power_init
+********************************************************************************
+* Summary:
+* Starts the load tracking at the start-up clock, the fastest profile. The
+* DWT cycle counter is enabled without being reset so that it can be shared
+* with the profiler.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  CY_RSLT_SUCCESS on success, AE_POWER_FAILURE otherwise.
+*
+*******************************************************************************/
+cy_rslt_t ae_power_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    SystemCoreClockUpdate();
+    ae_power_full_clock_hz = SystemCoreClock;
+    ae_power_frame_us = audio_pipeline_get_config()->frame_ms * 1000u;
+    if (ae_power_full_clock_hz < (1000000u * ae_power_dividers[0]))
+    {
+        return AE_POWER_FAILURE;
+    }
+
+    ae_power_controller_init(&ae_power_controller, ae_power_frame_us, ae_power_full_clock_hz);
+    ae_power_active = AE_POWER_NUM_PROFILES - 1u;
+    memset(&ae_power_stats, 0, sizeof(ae_power_stats));
+    ae_power_stats.clock_hz = ae_power_full_clock_hz;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: ae_power_frame_start
+********************************************************************************
+* Summary:
+* Marks the start of the AE processing of a frame.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void ae_power_frame_start(void)
+{
+    ae_power_start_cycles = DWT->CYCCNT;
+}
+
+/*******************************************************************************
+* Function Name: ae_power_frame_end
+********************************************************************************
+* Summary:
+* Accounts the AE processing of a frame and runs the controller. The metrics
+* are reported every AE_POWER_REPORT_FRAMES frames.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void ae_power_frame_end(void)
+{
+    uint32_t busy_cycles = DWT->CYCCNT - ae_power_start_cycles;
+    uint32_t clock_mhz = ae_power_stats.clock_hz / 1000000u;
+    uint32_t busy_us = 0;
+    uint32_t idle_us = 0;
+    bool late = false;
+
+    /* Not initialized */
+    if (0u == clock_mhz)
+    {
+        return;
+    }
+    busy_us = busy_cycles / clock_mhz;
+    idle_us = (busy_us < ae_power_frame_us) ? (ae_power_frame_us - busy_us) : 0u;
+
+#if AE_DEADLINE_ENABLE
+    {
+        ae_deadline_stats_t deadline;
+
+        ae_deadline_get_stats(&deadline);
+        late = (deadline.late != ae_power_last_late);
+        ae_power_last_late = deadline.late;
+    }
+#endif /* AE_DEADLINE_ENABLE */
+
+    (void)ae_power_controller_step(&ae_power_controller,
+            busy_cycles * ae_power_dividers[ae_power_active], late);
+
+    ae_power_stats.frames++;
+    ae_power_stats.busy_us += busy_us;
+    ae_power_stats.idle_us += idle_us;
+    ae_power_stats.clock_mhz_frames += clock_mhz;
+
+    ae_power_report_frames++;
+    ae_power_report_busy_us += busy_us;
+    ae_power_report_idle_us += idle_us;
+    ae_power_report_mhz += clock_mhz;
+    if (AE_POWER_REPORT_FRAMES <= ae_power_report_frames)
+    {
+        uint32_t busy_permille = (uint32_t)((ae_power_report_busy_us * 1000u) /
+                (ae_power_report_busy_us + ae_power_report_idle_us + 1u));
+
+        DEFERRED_LOG("AE power: %lu MHz average, busy %lu.%lu %%, idle %lu ms",
+                     (unsigned long)(ae_power_report_mhz / ae_power_report_frames),
+                     (unsigned long)(busy_permille / 10u), (unsigned long)(busy_permille % 10u),
+                     (unsigned long)(ae_power_report_idle_us / 1000u));
+        ae_power_report_frames = 0;
+        ae_power_report_busy_us = 0;
+        ae_power_report_idle_us = 0;
+        ae_power_report_mhz = 0;
+    }
+}
+
+/*******************************************************************************
+* Function Name: ae_power_update
+********************************************************************************
+* Summary:
+* Applies the profile selected by the controller. Called by the AE worker
+* task after a batch of frames, between two frames, never from an interrupt
+* (see AE_POWER_UPDATE). The switch is deferred while a captured frame
+* waits, since its deadline counts cycles of the old clock.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void ae_power_update(void)
+{
+    if (ae_power_controller.profile != ae_power_active)
+    {
+        ae_power_apply(ae_power_controller.profile);
+    }
+}
+
+/*******************************************************************************
+* Function Name: ae_power_get_stats
+********************************************************************************
+* Summary:
+* Returns the clock and the accumulated energy proxy metrics: AE busy time,
+* idle time and core clock per frame.
+*
+* Parameters:
+*  stats - Filled with the statistics
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void ae_power_get_stats(ae_power_stats_t *stats)
+{
+    if (NULL != stats)
+    {
+        *stats = ae_power_stats;
+    }
+}
+#endif /* AE_POWER_ENABLE */
+
+#if AE_POWER_IDLE_SLEEP
+/*******************************************************************************
+* Function Name: vApplicationIdleHook
+********************************************************************************
+* Summary:
+* Puts the CM55 in CPU sleep until the next interrupt whenever no task is
+* ready. The peripherals keep running. The DWT cycle counter stops while
+* the CPU sleeps, so the modules that use it as a clock are excluded at
+* build time, and the timestamps of the deferred log skip the sleep time.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void vApplicationIdleHook(void)
+{
+    (void)Cy_SysPm_CpuEnterSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+}
+#endif /* AE_POWER_IDLE_SLEEP */
+
+/* [] END OF FILE */
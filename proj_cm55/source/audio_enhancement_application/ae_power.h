@@ -0,0 +1,170 @@
+/******************************************************************************
+* File Name : ae_power.h
+*
+* Description :
+* Load adaptive clock scaling of the CM55. The AE busy cycles of every
+* frame select the lowest core clock profile that leaves the configured
+* headroom. Profiles change only between frames.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __AE_POWER_H__
+#define __AE_POWER_H__
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_result.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 to scale the CM55 clock with the AE load. The start-up clock of
+ * AE_POWER_CLK_HF is the fastest profile, the others divide it.
+ */
+#ifndef AE_POWER_ENABLE
+#define AE_POWER_ENABLE                         (0)
+#endif /* AE_POWER_ENABLE */
+
+/* AE_POWER_IDLE_SLEEP is defined in FreeRTOSConfig.h because it enables the
+ * idle hook of the kernel. With it the CM55 sleeps while no task is ready.
+ * The DWT cycle counter stops during the sleep, so it needs
+ * AE_DEADLINE_ENABLE, LATENCY_TRACE_ENABLE, RT_STATS_ENABLE and
+ * TASK_STATS_ENABLE set to 0.
+ */
+
+/* CLK_HF path of the CM55 core in the Device Configurator. It must not feed
+ * the audio, USB or UART peripherals.
+ */
+#ifndef AE_POWER_CLK_HF
+#define AE_POWER_CLK_HF                         (1u)
+#endif /* AE_POWER_CLK_HF */
+
+/* Share of the frame period in percent kept free for the other tasks and
+ * for load peaks
+ */
+#ifndef AE_POWER_HEADROOM_PERCENT
+#define AE_POWER_HEADROOM_PERCENT               (30u)
+#endif /* AE_POWER_HEADROOM_PERCENT */
+
+/* Frames a lower profile must fit before the clock is lowered */
+#ifndef AE_POWER_WINDOW_FRAMES
+#define AE_POWER_WINDOW_FRAMES                  (50u)
+#endif /* AE_POWER_WINDOW_FRAMES */
+
+/* Each late frame doubles the windows needed before the clock is lowered
+ * again, up to this number of windows. As many windows without late frames
+ * reduce it by one window.
+ */
+#ifndef AE_POWER_MAX_HOLD_WINDOWS
+#define AE_POWER_MAX_HOLD_WINDOWS               (32u)
+#endif /* AE_POWER_MAX_HOLD_WINDOWS */
+
+/* Frames between two reports of the energy proxy metrics */
+#define AE_POWER_REPORT_FRAMES                  (500u)
+
+/* Clock dividers of the profiles, slowest first */
+#define AE_POWER_PROFILE_DIVIDERS               { 4u, 2u, 1u }
+#define AE_POWER_NUM_PROFILES                   (3u)
+
+#define AE_POWER_FAILURE                        (-1)
+
+#if AE_POWER_ENABLE
+#define AE_POWER_FRAME_START()                  ae_power_frame_start()
+#define AE_POWER_FRAME_END()                    ae_power_frame_end()
+#else
+#define AE_POWER_FRAME_START()
+#define AE_POWER_FRAME_END()
+#endif /* AE_POWER_ENABLE */
+
+/* The clock is only switched by the AE worker task. In AE_EXEC_MODE_ISR the
+ * feed runs in the PDM interrupt, which must not reprogram the clock and the
+ * kernel tick, so the CM55 stays at the fastest profile and the load is only
+ * measured.
+ */
+#if AE_POWER_ENABLE && defined(AE_EXEC_MODE_TASK)
+#define AE_POWER_UPDATE()                       ae_power_update()
+#else
+#define AE_POWER_UPDATE()
+#endif /* AE_POWER_ENABLE && defined(AE_EXEC_MODE_TASK) */
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* State of the profile selection. Work is counted in cycles of the fastest
+ * profile, assuming a frame needs the same number of cycles at every clock.
+ */
+typedef struct
+{
+    uint32_t profile;                               /* Active profile, 0 is the slowest */
+    uint32_t capacity[AE_POWER_NUM_PROFILES];       /* Work per frame that fits a profile */
+    uint32_t window_frames;
+    uint32_t window_max_work;                       /* Largest work in the window */
+    uint32_t hold_windows;                          /* Windows before the clock is lowered */
+    uint32_t quiet_windows;                         /* Windows without late frames */
+} ae_power_controller_t;
+
+typedef struct
+{
+    uint32_t clock_hz;                  /* Active core clock */
+    uint32_t switches;                  /* Profile changes */
+    uint32_t frames;
+    uint64_t busy_us;                   /* AE time, summed over the frames */
+    uint64_t idle_us;                   /* Rest of the frame periods */
+    uint64_t clock_mhz_frames;          /* Core clock summed over the frames */
+} ae_power_stats_t;
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
+cy_rslt_t ae_power_init(void);
+void ae_power_frame_start(void);
+void ae_power_frame_end(void);
+void ae_power_update(void);
+void ae_power_get_stats(ae_power_stats_t *stats);
+
+void ae_power_controller_init(ae_power_controller_t *controller, uint32_t frame_us,
+                              uint32_t full_clock_hz);
+uint32_t ae_power_controller_step(ae_power_controller_t *controller, uint32_t work_cycles,
+                                  bool late);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* __AE_POWER_H__ */
+
+/* [] END OF FILE */
@@ -49,38 +49,47 @@
 #include "task.h"
 #include "cyabs_rtos.h"
 #include "ae_application.h"
+#include "ae_frame_pool.h"
 #include "cy_afe_audio_speech_enh.h"
+#include "rt_stats.h"
+#include "latency_trace.h"
+#include "aec_jitter_buffer.h"
+#include "ae_pipeline.h"
+#include "ae_deadline.h"
+#include "ae_power.h"
 
 /*******************************************************************************
 * Macros
 *******************************************************************************/
 
-/*For Speech Quality check for AEC where the test stream will have audio data
-* in left channel and AEC reference in right channel - Set to zero unless benchmarking*/
-#define AEC_QUALITY_MODE                            (0)
+/* Size in bytes of a mono and of a playback audio frame */
+#define FRAME_SIZE                                  (AUDIO_PIPELINE_FRAME_BYTES(1u))
+#define PLAYBACK_DATA_FRAME_SIZE                    (AUDIO_PIPELINE_FRAME_BYTES(AUDIO_PIPELINE_PLAYBACK_CHANNELS))
 
-#define MAX_SIZE_FOR_NON_INTERLEAVE_STEREO_IN_BYTES (320)
-/* Number of samples in an audio frame */
-#define FRAME_SIZE                                  (320u)
-#define PLAYBACK_DATA_FRAME_SIZE                    (2*FRAME_SIZE)
+/* 16-byte alignment for the MVE stores of audio_conv_replicate */
+#define PLAYBACK_DATA_FRAME_ALIGNMENT               (16u)
 
-#define BULK_DELAY_10MS                             (10u)
-#define BULK_DELAY_MIN_FRAME                        (0)
+/* Delay of the AEC reference used while measuring the bulk delay */
+#define BDM_AEC_REF_DELAY_SAMPLES                   (0u)
+
+/* AE worker task. The worker runs above the USB tasks so that a frame
+ * captured by the PDM ISR is processed before the next one arrives.
+ */
+#define AE_WORKER_TASK_NAME                         "ae_worker"
+#define AE_WORKER_TASK_PRIORITY                     (configMAX_PRIORITIES - 1)
+#define AE_WORKER_TASK_STACK_SIZE                   (configMINIMAL_STACK_SIZE * 8)
+
+/* Number of frames between two prints of the real-time statistics */
+#define AE_RT_STATS_PRINT_FRAMES                    (500u)
+
+#define AE_AUDIO_FEED_FAILURE                       (-1)
 
 /*******************************************************************************
 * Global Variables
 *******************************************************************************/
-int16_t non_interleaved_audio_ping[MAX_SIZE_FOR_NON_INTERLEAVE_STEREO_IN_BYTES] = {0};
-int16_t non_interleaved_audio_pong[MAX_SIZE_FOR_NON_INTERLEAVE_STEREO_IN_BYTES] = {0};
-int16_t aec_ref_buffer[MONO_AUDIO_DATA_IN_BYTES] = {0};
-int16_t usb_buffer[MONO_AUDIO_DATA_IN_BYTES*2] = {0};
-
 unsigned int bdm_aec_ref_sent_len = 0;
-char stereo_pdm[PLAYBACK_DATA_FRAME_SIZE] = {0};
-
-int16_t* actual_aec_ref = aec_ref_buffer;
-int8_t buff_toggle_flag = 0;
-int16_t* non_interleaved_audio = NULL;
+int16_t stereo_pdm[PLAYBACK_DATA_FRAME_SIZE / sizeof(int16_t)]
+        __attribute__((aligned(PLAYBACK_DATA_FRAME_ALIGNMENT))) = {0};
 
 extern int16_t* usb_aec_ref;
 extern int8_t aec_ref_flag;
@@ -88,29 +97,33 @@ extern uint32_t initial_buffer_count;
 extern unsigned int bdm_aec_ref_len;
 extern char *bdm_aec_ref_buffer;
 
-extern volatile int8_t ae_toggle_flag;
 uint8_t bulk_delay = AFE_CONFIG_BULK_DELAY;
-uint8_t bulk_delay_equivalent_frames = 0;
+
+#ifdef AE_EXEC_MODE_TASK
+static TaskHandle_t ae_worker_task_handle = NULL;
+#endif /* AE_EXEC_MODE_TASK */
 
 
 /*******************************************************************************
 * Function Name: ae_audio_data_feed
 ********************************************************************************
 * Summary:
-* Receive PDM mic frames and USB frames and feed it to the audio pipeline.
+* Attach the AEC reference to a captured frame and feed it to the audio
+* pipeline. The mic samples are used in place from the frame pool. The AEC
+* reference is consumed also for frames bypassed or dropped by the deadline
+* policy, so that it stays aligned with the mics.
 *
 * Parameters:
-*  audio_data - Pointer to audio buffer.
-*  length - length of audio data.
+*  frame - Pointer to the planar frame descriptor.
+*  action - Handling of the frame decided by the deadline tracking.
 * Return:
 *  None
 *
 *******************************************************************************/
-void ae_audio_data_feed(int16_t *audio_data,uint16_t length)
+void ae_audio_data_feed(ae_frame_t *frame, ae_deadline_action_t action)
 {
+    const audio_pipeline_config_t *cfg = audio_pipeline_get_config();
     int16_t* aec_reference = NULL;
-    cy_rslt_t ret_val  = CY_RSLT_SUCCESS;
-    uint16_t *stereo = (uint16_t*)&stereo_pdm[0];
 
 #ifndef ENABLE_IFX_AEC
     aec_reference = NULL;
@@ -119,19 +132,19 @@ void ae_audio_data_feed(int16_t *audio_data,uint16_t length)
     if(NULL != bdm_aec_ref_buffer)
     {
         aec_reference = (int16_t* )((char *)bdm_aec_ref_buffer+bdm_aec_ref_sent_len);
-        convert_mono_to_stereo_interleaved(stereo,(uint16_t *)aec_reference);
-        usb_mic_push( (short *)(stereo_pdm));
+        audio_conv_replicate((uint16_t *)aec_reference, (uint16_t *)stereo_pdm,
+                cfg->samples_per_frame, cfg->playback_channels);
+        usb_mic_push(stereo_pdm);
         bdm_aec_ref_sent_len = bdm_aec_ref_sent_len + FRAME_SIZE;
         if(bdm_aec_ref_len == bdm_aec_ref_sent_len)
         {
              bdm_aec_ref_sent_len = 0;
         }
-        ret_val=usb_aec_pop(usb_buffer,0);
-        if (ret_val==CY_RSLT_SUCCESS)
+        if (CY_RSLT_SUCCESS == aec_jb_read(frame->aec_ref, cfg->samples_per_frame,
+                BDM_AEC_REF_DELAY_SAMPLES))
         {
-        /* Convert Stereo AEC to Mono AEC reference */
-            convert_stereo_interleaved_to_mono((uint16_t*)usb_buffer,(uint16_t*)aec_ref_buffer);
-            aec_reference = aec_ref_buffer;
+            AE_FRAME_COUNT_COPY(sizeof(frame->aec_ref));
+            aec_reference = frame->aec_ref;
         } else {
             aec_reference = NULL;
         }
@@ -139,68 +152,208 @@ void ae_audio_data_feed(int16_t *audio_data,uint16_t length)
  /* End of Bulk Delay measurement */   
     else 
     {
-        bulk_delay_equivalent_frames =(bulk_delay/BULK_DELAY_10MS);
-    
-        ret_val=usb_aec_pop(usb_buffer,bulk_delay_equivalent_frames);
-        if (ret_val==CY_RSLT_SUCCESS)
+        CY_PROFILER_PROBE_BEGIN(CY_PROFILER_PROBE_AEC_POP);
+        /* The reference is delayed by the bulk delay with sample accuracy */
+        if (CY_RSLT_SUCCESS == aec_jb_read(frame->aec_ref, cfg->samples_per_frame,
+                (uint32_t)bulk_delay * cfg->samples_per_ms))
         {
-        /* Convert Stereo AEC to Mono AEC reference */
-            convert_stereo_interleaved_to_mono((uint16_t*)usb_buffer,(uint16_t*)aec_ref_buffer);
-            aec_reference = aec_ref_buffer;
+            AE_FRAME_COUNT_COPY(sizeof(frame->aec_ref));
+            aec_reference = frame->aec_ref;
         }
         else
         {
             aec_reference = NULL;
         }
+        CY_PROFILER_PROBE_END(CY_PROFILER_PROBE_AEC_POP);
     }
+    frame->aec_reference = aec_reference;
 
-    if (buff_toggle_flag == 0)
+/* Feed the data to Audio Enhancement. The output callback sends the AE
+ * output or, with AE off, the raw mics to USB */
+    if (AE_DEADLINE_DROP == action)
+    {
+        return;
+    }
+    LATENCY_TRACE_FEED(frame->timestamp);
+    if (AE_DEADLINE_BYPASS == action)
     {
-        non_interleaved_audio = non_interleaved_audio_ping;
-        buff_toggle_flag = 1;
+        ae_interface_bypass(frame);
+    }
+    else
+    {
+        ae_interface_feed(frame);
+    }
+}
 
-    } else if (buff_toggle_flag == 1)
+/*******************************************************************************
+* Function Name: ae_audio_process_pending_frames
+********************************************************************************
+* Summary:
+* Feeds all frames pending in the frame pool to the audio pipeline. Frames
+* that start behind their deadline are handled by the deadline policy.
+*
+* Parameters:
+*  None
+* Return:
+*  None
+*
+*******************************************************************************/
+static void ae_audio_process_pending_frames(void)
+{
+    ae_frame_t *frame = NULL;
+    ae_deadline_action_t action;
+
+    ae_pipeline_feed_lock();
+    frame = ae_frame_next();
+    while (NULL != frame)
     {
-        non_interleaved_audio = non_interleaved_audio_pong;
-        buff_toggle_flag = 0;
+        RT_STATS_BEGIN(start_cycles);
+        AE_POWER_FRAME_START();
+        action = AE_DEADLINE_BEGIN(frame);
+        ae_audio_data_feed(frame, action);
+        if (AE_DEADLINE_DROP != action)
+        {
+            AE_DEADLINE_COMPLETE(frame);
+        }
+        ae_frame_done();
+        AE_POWER_FRAME_END();
+        RT_STATS_END(&rt_stats_ae_frame, start_cycles);
+        frame = ae_frame_next();
     }
-#ifdef ENABLE_STEREO_INPUT_FEED
+    /* The core clock changes only between two frames */
+    AE_POWER_UPDATE();
+    ae_pipeline_feed_unlock();
+}
 
+#ifdef AE_EXEC_MODE_TASK
+/*******************************************************************************
+* Function Name: ae_worker_task
+********************************************************************************
+* Summary:
+* AE worker task. Waits for the capture path to signal a new frame and
+* runs the AE feed and output processing on all pending frames.
+*
+* Parameters:
+*  arg - Unused.
+* Return:
+*  None
+*
+*******************************************************************************/
+static void ae_worker_task(void *arg)
+{
+#if RT_STATS_ENABLE || LATENCY_TRACE_ENABLE
+    uint32_t frames_since_print = 0;
+#endif /* RT_STATS_ENABLE || LATENCY_TRACE_ENABLE */
+
+    (void)arg;
 
-        
-/* Mic is configured in STEREO mode */
-    convert_interleaved_to_stereo_non_interleaved((uint16_t *)audio_data,
-            (uint16_t *)non_interleaved_audio);
-            
-  
-    if (ae_toggle_flag==0)
+    while (1)
     {
-        usb_send_out_dbg_put(USB_CHANNEL_1,(int16_t *)non_interleaved_audio);
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        ae_audio_process_pending_frames();
+
+#if RT_STATS_ENABLE || LATENCY_TRACE_ENABLE
+        frames_since_print++;
+        if (AE_RT_STATS_PRINT_FRAMES <= frames_since_print)
+        {
+            frames_since_print = 0;
+#if RT_STATS_ENABLE
+            rt_stats_print();
+#endif /* RT_STATS_ENABLE */
+#if LATENCY_TRACE_ENABLE
+            latency_trace_print();
+#endif /* LATENCY_TRACE_ENABLE */
+        }
+#endif /* RT_STATS_ENABLE || LATENCY_TRACE_ENABLE */
+#if CY_PROFILER_PROBE_ENABLE
+        cy_profiler_probe_tick();
+#endif /* CY_PROFILER_PROBE_ENABLE */
     }
-    
-   
-/* Feed the data to Audio Enhancement */
-    ae_interface_feed(non_interleaved_audio, aec_reference);
+}
+#endif /* AE_EXEC_MODE_TASK */
 
-#else
-/* Mic is configured in MONO mode */
-    if (ae_toggle_flag==0)
+/*******************************************************************************
+* Function Name: ae_audio_feed_init
+********************************************************************************
+* Summary:
+* Initializes the AE feed. In task execution mode this creates the AE worker
+* task. Must be called before the capture path is started.
+*
+* Parameters:
+*  None
+* Return:
+*  CY_RSLT_SUCCESS on success, AE_AUDIO_FEED_FAILURE otherwise.
+*
+*******************************************************************************/
+cy_rslt_t ae_audio_feed_init(void)
+{
+#ifdef AE_EXEC_MODE_TASK
+    BaseType_t rtos_task_status;
+#endif /* AE_EXEC_MODE_TASK */
+
+#if LATENCY_TRACE_ENABLE
+    if (CY_RSLT_SUCCESS != latency_trace_init())
     {
-        usb_send_out_dbg_put(USB_CHANNEL_1,(int16_t *)audio_data);
+        return AE_AUDIO_FEED_FAILURE;
     }
-/* Feed the data to Audio Enhancement */
-    ae_interface_feed(audio_data, aec_reference);
-#endif /* ENABLE_STEREO_INPUT_FEED */
+#endif /* LATENCY_TRACE_ENABLE */
 
+#ifdef AE_EXEC_MODE_TASK
 
+    rtos_task_status = xTaskCreate(ae_worker_task, AE_WORKER_TASK_NAME,
+            AE_WORKER_TASK_STACK_SIZE, NULL, AE_WORKER_TASK_PRIORITY,
+            &ae_worker_task_handle);
+    if (pdPASS != rtos_task_status)
+    {
+        return AE_AUDIO_FEED_FAILURE;
+    }
+#endif /* AE_EXEC_MODE_TASK */
+
+    return CY_RSLT_SUCCESS;
 }
 
+/*******************************************************************************
+* Function Name: ae_audio_frame_ready
+********************************************************************************
+* Summary:
+* Called by the capture path from ISR context after a frame was submitted to
+* the frame pool. In task execution mode the AE worker task is notified;
+* otherwise all pending frames are fed to the audio pipeline from the ISR.
+*
+* Parameters:
+*  None
+* Return:
+*  None
+*
+*******************************************************************************/
+void ae_audio_frame_ready(void)
+{
+#ifdef AE_EXEC_MODE_TASK
+    BaseType_t higher_priority_task_woken = pdFALSE;
+
+    if (NULL == ae_worker_task_handle)
+    {
+        return;
+    }
+
+    vTaskNotifyGiveFromISR(ae_worker_task_handle, &higher_priority_task_woken);
+
+    /* Frames captured before the scheduler starts stay pending in the pool */
+    if (taskSCHEDULER_RUNNING == xTaskGetSchedulerState())
+    {
+        portYIELD_FROM_ISR(higher_priority_task_woken);
+    }
+#else
+    ae_audio_process_pending_frames();
+#endif /* AE_EXEC_MODE_TASK */
+}
 
 /*******************************************************************************
 * Function Name: ae_audio_data_feed_usb
 ********************************************************************************
 * Summary:
-* Receive USB frames and feed it to the audio pipeline.
+* Receive USB frames and feed it to the audio pipeline. The frame is dropped
+* if the pipeline input was switched to the mics meanwhile.
 *
 * Parameters:
 *  audio_data - Pointer to audio buffer.
@@ -210,35 +363,68 @@ void ae_audio_data_feed(int16_t *audio_data,uint16_t length)
 *******************************************************************************/
 void ae_audio_data_feed_usb(int16_t *audio_data)
 {
-    int16_t* aec_reference = NULL;
-
-/* Mic is configured in STEREO mode */
+    const audio_pipeline_config_t *cfg = audio_pipeline_get_config();
+    ae_frame_t *frame = NULL;
+    ae_deadline_action_t action;
 
-    if (buff_toggle_flag == 0)
+    ae_pipeline_feed_lock();
+    if (AE_PIPELINE_INPUT_USB != ae_pipeline_get_config()->input_source)
     {
-        non_interleaved_audio = non_interleaved_audio_ping;
-        buff_toggle_flag = 1;
+        ae_pipeline_feed_unlock();
+        return;
+    }
 
-    } else if (buff_toggle_flag == 1)
+    frame = ae_frame_acquire();
+    if (NULL == frame)
     {
-        non_interleaved_audio = non_interleaved_audio_pong;
-        buff_toggle_flag = 0;
+        ae_pipeline_feed_unlock();
+        return;
     }
+    /* The first sample of the frame arrived one frame period ago */
+    frame->timestamp = LATENCY_TRACE_BEFORE(cfg->frame_ms * 1000u);
 
-    convert_interleaved_to_stereo_non_interleaved((uint16_t *)audio_data,
-            (uint16_t *)non_interleaved_audio);
+/* USB input is always STEREO */
+    CY_PROFILER_PROBE_BEGIN(CY_PROFILER_PROBE_DEINTERLEAVE);
+    audio_conv_deinterleave((uint16_t *)audio_data, (uint16_t *)frame->mic,
+            cfg->samples_per_frame, cfg->playback_channels, AE_FRAME_CHANNEL_STRIDE);
+    CY_PROFILER_PROBE_END(CY_PROFILER_PROBE_DEINTERLEAVE);
+    AE_FRAME_COUNT_COPY(AUDIO_PIPELINE_FRAME_BYTES(cfg->playback_channels));
+    frame->num_channels = cfg->playback_channels;
 
-#if AEC_QUALITY_MODE
     /* Used for Quality benchmarking of AEC with L channel - Audio+echo and R channel - Echo reference
      * Used with mono mic settings in AFE configurator.
      */
-    aec_reference=non_interleaved_audio+160;
-#endif /* AEC_QUALITY_MODE */
-/* Feed the data to Audio Enhancement */
-    ae_interface_feed(non_interleaved_audio, aec_reference);
+    if (ae_pipeline_get_config()->aec_quality_mode)
+    {
+        frame->aec_reference = AE_FRAME_CHANNEL(frame, 1u);
+    }
+    ae_frame_submit();
 
+/* Feed the data to Audio Enhancement */
+    frame = ae_frame_next();
+    while (NULL != frame)
+    {
+        AE_POWER_FRAME_START();
+        action = AE_DEADLINE_BEGIN(frame);
+        if (AE_DEADLINE_DROP != action)
+        {
+            LATENCY_TRACE_FEED(frame->timestamp);
+            if (AE_DEADLINE_BYPASS == action)
+            {
+                ae_interface_bypass(frame);
+            }
+            else
+            {
+                ae_interface_feed(frame);
+            }
+            AE_DEADLINE_COMPLETE(frame);
+        }
+        ae_frame_done();
+        AE_POWER_FRAME_END();
+        frame = ae_frame_next();
+    }
+    AE_POWER_UPDATE();
+    ae_pipeline_feed_unlock();
 }
 
 /* [] END OF FILE */
-
-
@@ -0,0 +1,426 @@
+/******************************************************************************
+* File Name : ae_arena.c
+*
+* Description :
+* Tiered arena allocator for the Audio Enhancement middleware memory.
+* Blocks are placed in DTCM, SOCMem or heap following a per memory ID
+* placement policy.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include "ae_arena.h"
+#include "audio_enhancement.h"
+#include "deferred_log.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define AE_ARENA_ALIGN_UP(value, alignment)     (((value) + ((alignment) - 1u)) & ~((uintptr_t)(alignment) - 1u))
+#define AE_ARENA_IS_POWER_OF_2(value)           ((0u != (value)) && (0u == ((value) & ((value) - 1u))))
+
+/* Number of tiers backed by a fixed region */
+#define AE_ARENA_NUM_REGIONS                    (AE_ARENA_TIER_HEAP)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Fixed region of a tier. Blocks are allocated linearly and the region is
+ * rewound once all of its blocks are freed.
+ */
+typedef struct
+{
+    uint8_t *base;
+    uint32_t size;
+    uint32_t offset;
+    uint32_t high_water;
+    uint32_t blocks;
+} ae_arena_region_t;
+
+typedef struct
+{
+    void *buffer;
+    void *raw;
+    uint32_t size;
+    const ae_arena_placement_t *placement;
+    ae_arena_tier_t tier;
+} ae_arena_block_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static uint8_t ae_arena_dtcm[AE_ARENA_DTCM_SIZE] __attribute__((section(".dtcm_data"), aligned(AE_ARENA_DEFAULT_ALIGNMENT)));
+
+/* Returned for zero size requests */
+static uint8_t ae_arena_empty[AE_ARENA_DEFAULT_ALIGNMENT] __attribute__((aligned(AE_ARENA_DEFAULT_ALIGNMENT)));
+
+static ae_arena_region_t ae_arena_regions[AE_ARENA_NUM_REGIONS];
+static ae_arena_block_t ae_arena_blocks[AE_ARENA_MAX_BLOCKS];
+static ae_arena_tier_stats_t ae_arena_heap_stats;
+static bool ae_arena_initialized = false;
+
+static const char *ae_arena_tier_names[AE_ARENA_TIER_COUNT] =
+{
+    "DTCM",
+    "SOCMem",
+    "heap",
+};
+
+/*******************************************************************************
+* Function Name: ae_arena_init
+********************************************************************************
+* Summary:
+* Sets up the arena tiers. The SOCMem tier is reserved from the heap once.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  CY_RSLT_SUCCESS. A SOCMem tier that cannot be reserved is disabled.
+*
+*******************************************************************************/
+cy_rslt_t ae_arena_init(void)
+{
+    if (ae_arena_initialized)
+    {
+        return CY_RSLT_SUCCESS;
+    }
+
+    memset(ae_arena_regions, 0, sizeof(ae_arena_regions));
+    memset(ae_arena_blocks, 0, sizeof(ae_arena_blocks));
+    memset(&ae_arena_heap_stats, 0, sizeof(ae_arena_heap_stats));
+
+    ae_arena_regions[AE_ARENA_TIER_DTCM].base = ae_arena_dtcm;
+    ae_arena_regions[AE_ARENA_TIER_DTCM].size = AE_ARENA_DTCM_SIZE;
+
+#if AE_ARENA_SOCMEM_SIZE
+    ae_arena_regions[AE_ARENA_TIER_SOCMEM].base = (uint8_t *)malloc(AE_ARENA_SOCMEM_SIZE);
+    if (NULL != ae_arena_regions[AE_ARENA_TIER_SOCMEM].base)
+    {
+        ae_arena_regions[AE_ARENA_TIER_SOCMEM].size = AE_ARENA_SOCMEM_SIZE;
+    }
+    else
+    {
+        app_ae_log("SOCMem arena reservation of %lu bytes failed", (unsigned long)AE_ARENA_SOCMEM_SIZE);
+    }
+#endif /* AE_ARENA_SOCMEM_SIZE */
+
+    ae_arena_initialized = true;
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: ae_arena_region_alloc
+********************************************************************************
+* Summary:
+* Allocates an aligned block from a fixed region.
+*
+* Parameters:
+*  region - Region to allocate from
+*  size - Block size in bytes
+*  alignment - Block alignment in bytes
+*
+* Return:
+*  Pointer to the block or NULL if the region is full.
+*
+*******************************************************************************/
+static void* ae_arena_region_alloc(ae_arena_region_t *region, uint32_t size, uint32_t alignment)
+{
+    uintptr_t start = 0;
+    uint32_t offset = 0;
+
+    if (NULL == region->base)
+    {
+        return NULL;
+    }
+
+    start = AE_ARENA_ALIGN_UP((uintptr_t)region->base + region->offset, alignment);
+    offset = (uint32_t)(start - (uintptr_t)region->base);
+    if ((offset > region->size) || (size > (region->size - offset)))
+    {
+        return NULL;
+    }
+
+    region->offset = offset + size;
+    region->blocks++;
+    if (region->offset > region->high_water)
+    {
+        region->high_water = region->offset;
+    }
+
+    memset((void *)start, 0, size);
+    return (void *)start;
+}
+
+/*******************************************************************************
+* Function Name: ae_arena_alloc
+********************************************************************************
+* Summary:
+* Allocates a zero initialized block following the placement policy.
+*
+* Parameters:
+*  placement - Placement policy of the memory ID
+*  size - Block size in bytes
+*
+* Return:
+*  Pointer to the block or NULL if no tier can hold it.
+*
+*******************************************************************************/
+void* ae_arena_alloc(const ae_arena_placement_t *placement, uint32_t size)
+{
+    ae_arena_block_t *block = NULL;
+    uint32_t alignment = AE_ARENA_DEFAULT_ALIGNMENT;
+    void *buffer = NULL;
+    void *raw = NULL;
+    ae_arena_tier_t tier = AE_ARENA_TIER_NONE;
+    uint32_t i = 0;
+
+    if (0u == size)
+    {
+        return ae_arena_empty;
+    }
+
+    if (NULL == placement)
+    {
+        return NULL;
+    }
+
+    if (0u != placement->alignment)
+    {
+        alignment = placement->alignment;
+    }
+    if (!AE_ARENA_IS_POWER_OF_2(alignment))
+    {
+        return NULL;
+    }
+
+    for (i = 0; i < AE_ARENA_MAX_BLOCKS; i++)
+    {
+        if (NULL == ae_arena_blocks[i].buffer)
+        {
+            block = &ae_arena_blocks[i];
+            break;
+        }
+    }
+    if (NULL == block)
+    {
+        DEFERRED_LOG("AE arena out of block records");
+        return NULL;
+    }
+
+    for (i = 0; (i < AE_ARENA_TIER_COUNT) && (NULL == buffer); i++)
+    {
+        tier = placement->tiers[i];
+        if (AE_ARENA_TIER_HEAP == tier)
+        {
+            raw = calloc(size + alignment - 1u, 1);
+            if (NULL != raw)
+            {
+                buffer = (void *)AE_ARENA_ALIGN_UP((uintptr_t)raw, alignment);
+                ae_arena_heap_stats.used += size;
+                ae_arena_heap_stats.blocks++;
+                if (ae_arena_heap_stats.used > ae_arena_heap_stats.high_water)
+                {
+                    ae_arena_heap_stats.high_water = ae_arena_heap_stats.used;
+                }
+            }
+        }
+        else if (tier < AE_ARENA_NUM_REGIONS)
+        {
+            buffer = ae_arena_region_alloc(&ae_arena_regions[tier], size, alignment);
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if (NULL == buffer)
+    {
+        DEFERRED_LOG("AE arena allocation of %lu bytes for %s failed", (unsigned long)size, placement->name);
+        return NULL;
+    }
+
+    block->buffer = buffer;
+    block->raw = raw;
+    block->size = size;
+    block->placement = placement;
+    block->tier = tier;
+
+    return buffer;
+}
+
+/*******************************************************************************
+* Function Name: ae_arena_free
+********************************************************************************
+* Summary:
+* Frees a block returned by ae_arena_alloc. Heap blocks are returned to the
+* heap. Region blocks are released together: a region is rewound once its
+* last block is freed, so repeated create/delete cycles do not fragment it.
+* Pointers not owned by the arena are ignored.
+*
+* Parameters:
+*  buffer - Block to free
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void ae_arena_free(void *buffer)
+{
+    ae_arena_block_t *block = NULL;
+    ae_arena_region_t *region = NULL;
+    uint32_t i = 0;
+
+    if ((NULL == buffer) || (ae_arena_empty == buffer))
+    {
+        return;
+    }
+
+    for (i = 0; i < AE_ARENA_MAX_BLOCKS; i++)
+    {
+        if (buffer == ae_arena_blocks[i].buffer)
+        {
+            block = &ae_arena_blocks[i];
+            break;
+        }
+    }
+    if (NULL == block)
+    {
+        DEFERRED_LOG("AE arena free of unknown block ignored");
+        return;
+    }
+
+    if (AE_ARENA_TIER_HEAP == block->tier)
+    {
+        free(block->raw);
+        ae_arena_heap_stats.used -= block->size;
+        ae_arena_heap_stats.blocks--;
+    }
+    else
+    {
+        region = &ae_arena_regions[block->tier];
+        region->blocks--;
+        if (0u == region->blocks)
+        {
+            region->offset = 0;
+        }
+    }
+
+    memset(block, 0, sizeof(*block));
+}
+
+/*******************************************************************************
+* Function Name: ae_arena_get_stats
+********************************************************************************
+* Summary:
+* Returns the usage of a tier.
+*
+* Parameters:
+*  tier - Tier to query
+*  stats - Filled with the usage of the tier
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void ae_arena_get_stats(ae_arena_tier_t tier, ae_arena_tier_stats_t *stats)
+{
+    if (NULL == stats)
+    {
+        return;
+    }
+
+    if (AE_ARENA_TIER_HEAP == tier)
+    {
+        *stats = ae_arena_heap_stats;
+    }
+    else if (tier < AE_ARENA_NUM_REGIONS)
+    {
+        stats->size = ae_arena_regions[tier].size;
+        stats->used = ae_arena_regions[tier].offset;
+        stats->high_water = ae_arena_regions[tier].high_water;
+        stats->blocks = ae_arena_regions[tier].blocks;
+    }
+    else
+    {
+        memset(stats, 0, sizeof(*stats));
+    }
+}
+
+/*******************************************************************************
+* Function Name: ae_arena_print_report
+********************************************************************************
+* Summary:
+* Prints the placement of the live blocks and the usage of each tier.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void ae_arena_print_report(void)
+{
+    ae_arena_tier_stats_t stats;
+    uint32_t i = 0;
+
+    app_ae_log("AE memory placement:");
+    for (i = 0; i < AE_ARENA_MAX_BLOCKS; i++)
+    {
+        if (NULL != ae_arena_blocks[i].buffer)
+        {
+            app_ae_log("  %-12s %7lu bytes %-6s @ 0x%08lx",
+                    ae_arena_blocks[i].placement->name,
+                    (unsigned long)ae_arena_blocks[i].size,
+                    ae_arena_tier_names[ae_arena_blocks[i].tier],
+                    (unsigned long)(uintptr_t)ae_arena_blocks[i].buffer);
+        }
+    }
+
+    for (i = 0; i < AE_ARENA_TIER_COUNT; i++)
+    {
+        ae_arena_get_stats((ae_arena_tier_t)i, &stats);
+        app_ae_log("  %-6s used %lu / %lu bytes, high water %lu bytes",
+                ae_arena_tier_names[i], (unsigned long)stats.used,
+                (unsigned long)stats.size, (unsigned long)stats.high_water);
+    }
+}
+
+/* [] END OF FILE */
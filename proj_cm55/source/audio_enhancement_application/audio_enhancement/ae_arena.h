@@ -0,0 +1,123 @@
+/******************************************************************************
+* File Name : ae_arena.h
+*
+* Description :
+* Header file for the tiered arena allocator used for the Audio
+* Enhancement middleware memory.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __AE_ARENA_H__
+#define __AE_ARENA_H__
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include "cy_result.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Size of the DTCM arena. Covers the AFE persistent and scratch memory */
+#ifndef AE_ARENA_DTCM_SIZE
+#define AE_ARENA_DTCM_SIZE                      (200000u)
+#endif /* AE_ARENA_DTCM_SIZE */
+
+/* Size of the SOCMem arena. It is reserved from the heap (which is placed in
+ * SOCMem) once on init and never returned, so re-creating the AFE does not
+ * fragment the heap. 0 disables the tier.
+ */
+#ifndef AE_ARENA_SOCMEM_SIZE
+#define AE_ARENA_SOCMEM_SIZE                    (0u)
+#endif /* AE_ARENA_SOCMEM_SIZE */
+
+/* Default alignment of arena blocks in bytes. Must be a power of 2 */
+#define AE_ARENA_DEFAULT_ALIGNMENT              (16u)
+
+/* Maximum number of blocks allocated at the same time */
+#define AE_ARENA_MAX_BLOCKS                     (16u)
+
+#define AE_ARENA_FAILURE                        (-1)
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+typedef enum
+{
+    AE_ARENA_TIER_DTCM = 0,
+    AE_ARENA_TIER_SOCMEM,
+    AE_ARENA_TIER_HEAP,
+    AE_ARENA_TIER_COUNT,
+    AE_ARENA_TIER_NONE = AE_ARENA_TIER_COUNT,
+} ae_arena_tier_t;
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Placement policy for one memory ID. Tiers are tried in order; unused
+ * entries are set to AE_ARENA_TIER_NONE.
+ */
+typedef struct
+{
+    int mem_id;
+    const char *name;
+    uint32_t alignment;
+    ae_arena_tier_t tiers[AE_ARENA_TIER_COUNT];
+} ae_arena_placement_t;
+
+typedef struct
+{
+    uint32_t size;          /* Capacity of the tier in bytes, 0 for the heap */
+    uint32_t used;          /* Bytes currently allocated */
+    uint32_t high_water;    /* Largest number of bytes allocated at once */
+    uint32_t blocks;        /* Number of live blocks */
+} ae_arena_tier_stats_t;
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
+cy_rslt_t ae_arena_init(void);
+void* ae_arena_alloc(const ae_arena_placement_t *placement, uint32_t size);
+void ae_arena_free(void *buffer);
+void ae_arena_get_stats(ae_arena_tier_t tier, ae_arena_tier_stats_t *stats);
+void ae_arena_print_report(void);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* __AE_ARENA_H__ */
+
+/* [] END OF FILE */
@@ -0,0 +1,130 @@
+/******************************************************************************
+* File Name : ae_backend.h
+*
+* Description :
+* Header file for the Audio Enhancement backend interface. A backend
+* implements the audio processing behind audio_enhancement.c.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __AE_BACKEND_H__
+#define __AE_BACKEND_H__
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "audio_enhancement.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 to measure the cycles spent per frame in the backend and in the
+ * application output path. Uses the DWT cycle counter.
+ */
+#ifndef AE_BACKEND_STATS_ENABLE
+#define AE_BACKEND_STATS_ENABLE                 (1)
+#endif /* AE_BACKEND_STATS_ENABLE */
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+/* Provides the buffer the backend writes the processed frame to */
+typedef int16_t* (*ae_backend_get_buffer_cb_t)(void);
+
+/* Receives the processed frame. Called from within the feed operation */
+typedef void (*ae_backend_output_cb_t)(ae_buffer_info_t *output_buffer_info);
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Configuration passed to a backend on creation */
+typedef struct
+{
+    uint8_t num_channels;                   /* Number of mic channels per frame */
+    uint32_t frame_samples;                 /* Samples per channel per frame */
+    uint32_t channel_stride;                /* Samples between two mic channel planes */
+    ae_backend_get_buffer_cb_t get_buffer;  /* Output buffer provider */
+    ae_backend_output_cb_t output;          /* Output consumer */
+    bool tuner_enable;                      /* Connect the AFE tuner if supported */
+} ae_backend_config_t;
+
+/* Backend operations. Backends are single instance. */
+typedef struct
+{
+    const char *name;
+    uint32_t (*get_delay)(void);            /* Delay of output_buf against input_buf, NULL for none */
+    uint8_t fixed_channels;                 /* Only channel count accepted, 0 for any */
+    ae_rslt_t (*create)(const ae_backend_config_t *config);
+    ae_rslt_t (*feed)(int16_t *mic, int16_t *aec_reference);
+    ae_rslt_t (*destroy)(void);
+} ae_backend_t;
+
+/* Cycles per frame, common to all backends. Backend cycles exclude the time
+ * spent in the application output callback, which is reported separately.
+ */
+typedef struct
+{
+    const char *backend_name;
+    uint32_t frames;
+    uint32_t last_cycles;
+    uint32_t max_cycles;
+    uint64_t total_cycles;
+    uint64_t output_cycles;
+} ae_backend_stats_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern const ae_backend_t ae_backend_deepcraft;
+extern const ae_backend_t ae_backend_passthrough;
+extern const ae_backend_t ae_backend_reference;
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
+void audio_enhancement_get_backend_stats(ae_backend_stats_t *stats);
+void audio_enhancement_reset_backend_stats(void);
+ae_rslt_t audio_enhancement_reconfigure(const ae_backend_t *backend, uint8_t num_channels);
+const ae_backend_t* audio_enhancement_find_backend(const char *name);
+const ae_backend_t* audio_enhancement_get_backend(void);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* __AE_BACKEND_H__ */
+
+/* [] END OF FILE */
@@ -0,0 +1,536 @@
+/******************************************************************************
+* File Name : ae_backend_deepcraft.c
+*
+* Description :
+* Audio Enhancement backend for the DEEPCRAFT(TM) Audio Enhancement
+* (audio-front-end) middleware.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+#include "ae_backend.h"
+#include "ae_arena.h"
+#include "rt_stats.h"
+#include "deferred_log.h"
+#include "delay_estimator.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Interval of the tuner read requests issued by the middleware */
+#define AE_TUNER_POLL_INTERVAL_MS                       (100)
+
+/* The middleware takes mono or stereo input with the channels back to back */
+#define AE_DEEPCRAFT_MAX_CHANNELS                       (2u)
+
+/* Algorithmic delay of the middleware output against the input buffer it
+ * reports with it. It depends on the components enabled in the AFE
+ * configurator and is measured by correlating the output with the input
+ * after each create. Set AE_DEEPCRAFT_DELAY_MEASURE to 0 to use a fixed
+ * AE_DEEPCRAFT_DELAY_SAMPLES instead.
+ */
+#ifndef AE_DEEPCRAFT_DELAY_MEASURE
+#define AE_DEEPCRAFT_DELAY_MEASURE                      (1)
+#endif /* AE_DEEPCRAFT_DELAY_MEASURE */
+
+#ifndef AE_DEEPCRAFT_DELAY_SAMPLES
+#define AE_DEEPCRAFT_DELAY_SAMPLES                      (0u)
+#endif /* AE_DEEPCRAFT_DELAY_SAMPLES */
+
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+cy_afe_t ae_handle = NULL;
+
+/* Placement of the AFE memory. The persistent and scratch memory are accessed
+ * for every frame and are kept in DTCM. The DeepSilence models are large and
+ * need 16 byte alignment for the vector kernels.
+ */
+static const ae_arena_placement_t ae_deepcraft_placements[] =
+{
+    { CY_AFE_MEM_ID_ALGORITHM_PERSISTENT_MEMORY, "persistent", AE_ARENA_DEFAULT_ALIGNMENT,
+      { AE_ARENA_TIER_DTCM, AE_ARENA_TIER_SOCMEM, AE_ARENA_TIER_HEAP } },
+    { CY_AFE_MEM_ID_ALGORITHM_SCRATCH_MEMORY, "scratch", AE_ARENA_DEFAULT_ALIGNMENT,
+      { AE_ARENA_TIER_DTCM, AE_ARENA_TIER_SOCMEM, AE_ARENA_TIER_HEAP } },
+    { CY_AFE_MEM_ID_ALGORITHM_NS_MEMORY, "dsns", 16u,
+      { AE_ARENA_TIER_SOCMEM, AE_ARENA_TIER_HEAP, AE_ARENA_TIER_NONE } },
+    { CY_AFE_MEM_ID_ALGORITHM_ES_MEMORY, "dses", 16u,
+      { AE_ARENA_TIER_SOCMEM, AE_ARENA_TIER_HEAP, AE_ARENA_TIER_NONE } },
+};
+
+/* Placement of any other memory ID */
+static const ae_arena_placement_t ae_deepcraft_default_placement =
+{
+    -1, "other", AE_ARENA_DEFAULT_ALIGNMENT,
+    { AE_ARENA_TIER_HEAP, AE_ARENA_TIER_NONE, AE_ARENA_TIER_NONE }
+};
+
+static ae_backend_get_buffer_cb_t ae_deepcraft_get_buffer = NULL;
+static ae_backend_output_cb_t ae_deepcraft_output = NULL;
+static ae_buffer_info_t ae_deepcraft_buffer_info = {0};
+
+#if AE_DEEPCRAFT_DELAY_MEASURE
+static delay_estimator_t ae_deepcraft_delay_estimator;
+static uint32_t ae_deepcraft_frame_samples = 0;
+#endif /* AE_DEEPCRAFT_DELAY_MEASURE */
+
+/*******************************************************************************
+* Function Name: ae_output_callback
+********************************************************************************
+* Summary:
+* Output callback to process the output buffer from AFE middleware.
+*
+* Parameters:
+*  handle - AFE handle.
+*  output_buffer_info - Output buffer from MW.
+*  user_arg - User argument (unused).
+* 
+* Return:
+*  None
+*
+*******************************************************************************/
+static cy_rslt_t ae_output_callback(cy_afe_t handle, cy_afe_buffer_info_t *output_buffer_info, void *user_arg)
+{
+    ae_deepcraft_buffer_info.output_buf = (int16_t *) output_buffer_info->output_buf;
+    ae_deepcraft_buffer_info.input_buf = (int16_t *) output_buffer_info->input_buf;
+    ae_deepcraft_buffer_info.input_aec_ref_buf = (int16_t *) output_buffer_info->input_aec_ref_buf;
+#ifdef CY_AFE_ENABLE_TUNING_FEATURE
+    ae_deepcraft_buffer_info.dbg_output1 = (int16_t *) output_buffer_info->dbg_output1;
+    ae_deepcraft_buffer_info.dbg_output2 = (int16_t *) output_buffer_info->dbg_output2;
+    ae_deepcraft_buffer_info.dbg_output3 = (int16_t *) output_buffer_info->dbg_output3;
+    ae_deepcraft_buffer_info.dbg_output4 = (int16_t *) output_buffer_info->dbg_output4;
+#endif
+
+#if AE_DEEPCRAFT_DELAY_MEASURE
+    /* The first mic channel is compared with the output until the delay is
+     * known
+     */
+    if (!delay_estimator_is_valid(&ae_deepcraft_delay_estimator) &&
+        (NULL != ae_deepcraft_buffer_info.input_buf) && (NULL != ae_deepcraft_buffer_info.output_buf))
+    {
+        if (delay_estimator_update(&ae_deepcraft_delay_estimator, ae_deepcraft_buffer_info.input_buf,
+                ae_deepcraft_buffer_info.output_buf, ae_deepcraft_frame_samples))
+        {
+            DEFERRED_LOG("AFE delay measured at %lu samples",
+                    (unsigned long)delay_estimator_get_delay(&ae_deepcraft_delay_estimator));
+        }
+    }
+#endif /* AE_DEEPCRAFT_DELAY_MEASURE */
+
+    ae_deepcraft_output(&ae_deepcraft_buffer_info);
+    return CY_RSLT_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: ae_get_output_buffer_callback
+********************************************************************************
+* Summary:
+* Output callback to get the output buffer for AFE middleware.
+*
+* Parameters:
+*  context - context (unused)
+*  output_buffer - Get a free buffer.
+*  user_arg - User argument (unused).
+* 
+* Return:
+*  CY_RSLT_SUCCESS.
+*
+*******************************************************************************/
+static cy_rslt_t ae_get_output_buffer_callback(cy_afe_t context, uint32_t **output_buffer, void *user_args)
+{
+    *output_buffer = (uint32_t*) ae_deepcraft_get_buffer();
+
+    return CY_RSLT_SUCCESS;
+}
+/*******************************************************************************
+* Function Name: ae_alloc_memory
+********************************************************************************
+* Summary:
+* Callback from middleware to allocate memory for AFE. The memory is placed
+* according to the placement table of the memory ID.
+*
+* Parameters:
+*  mem_id - Memory ID of the request
+*  size - Size in bytes
+*  buffer - Allocated buffer
+*
+* Return:
+*  Result of memory allocation.
+*
+*******************************************************************************/
+cy_rslt_t ae_alloc_memory(cy_afe_mem_id_t mem_id, uint32_t size, void **buffer)
+{
+    const ae_arena_placement_t *placement = &ae_deepcraft_default_placement;
+    int ae_mem_id = (int)mem_id;
+    uint32_t i = 0;
+
+    if(NULL == buffer)
+    {
+        return CY_RSLT_SUCCESS;
+    }
+
+    for (i = 0; i < (sizeof(ae_deepcraft_placements) / sizeof(ae_deepcraft_placements[0])); i++)
+    {
+        if (ae_mem_id == ae_deepcraft_placements[i].mem_id)
+        {
+            placement = &ae_deepcraft_placements[i];
+            break;
+        }
+    }
+
+    *buffer = ae_arena_alloc(placement, size);
+    if (NULL == *buffer)
+    {
+        DEFERRED_LOG("AFE %s memory allocation of %ld bytes failed", placement->name, (long)size);
+        return AE_ARENA_FAILURE;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: ae_free_memory
+********************************************************************************
+* Summary:
+* Callback from middle-ware to free memory for AFE.
+*
+* Parameters:
+*  mem_id - Memory ID of the buffer (unused)
+*  buffer - Buffer returned by ae_alloc_memory
+*
+* Return:
+*  Result of freeing memory.
+*
+*******************************************************************************/
+cy_rslt_t ae_free_memory(cy_afe_mem_id_t mem_id, void *buffer)
+{
+    (void) mem_id;
+
+    ae_arena_free(buffer);
+
+    return CY_RSLT_SUCCESS;
+}
+
+#ifdef CY_AFE_ENABLE_TUNING_FEATURE
+/*******************************************************************************
+* Function Name: ae_tuner_notify_callback
+********************************************************************************
+* Summary:
+*  Tuner notification callback from AFE middleware.
+*
+* Parameters:
+*  handle - AFE handle
+*  config_setting - Configuration settings.
+*  user_arg - User argument.
+
+* Return:
+*  CY_RSLT_SUCCESS
+*
+*******************************************************************************/
+static cy_rslt_t ae_tuner_notify_callback(cy_afe_t handle, 
+                                          cy_afe_config_setting_t *config_setting, 
+                                          void *user_arg)
+{
+    (void) user_arg;
+
+    return audio_enhancement_tuner_notify(handle,config_setting);
+
+    //return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: ae_tuner_read_callback
+********************************************************************************
+* Summary:
+*  Callback for AFE read operation.
+*
+* Parameters:
+*  handle - AFE handle
+*  request_buffer - Buffer with read data.
+*  user_arg - user argument.
+*
+* Return:
+*  CY_RSLT_SUCCESS
+*
+*******************************************************************************/
+static cy_rslt_t ae_tuner_read_callback(cy_afe_t handle, 
+                                        cy_afe_tuner_buffer_t *request_buffer, 
+                                        void *user_arg)
+{
+    (void) user_arg;
+
+    audio_enhancement_tuner_read(request_buffer);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: ae_tuner_write_callback
+********************************************************************************
+* Summary:
+*  Callback for AFE write operation.
+*
+* Parameters:
+*  handle - AFE handle
+*  response_buffer - buffer with write data.
+*  user_arg - user argument.
+*
+* Return:
+*  CY_RSLT_SUCCESS
+*
+*******************************************************************************/
+static cy_rslt_t ae_tuner_write_callback(cy_afe_t handle, 
+                                         cy_afe_tuner_buffer_t *response_buffer, 
+                                         void *user_arg)
+{
+    return audio_enhancement_tuner_write(response_buffer);
+
+    //return CY_RSLT_SUCCESS;
+}
+
+#endif
+
+/*******************************************************************************
+ * Function Name: ae_deepcraft_create
+ *******************************************************************************
+ * Summary:
+ * Creates the audio-front-end middleware instance.
+ *
+ * Parameters:
+ *  config: backend configuration
+ *
+ * Return:
+ *  Returns AE_RSLT_SUCCESS if successful, otherwise returns an error code.
+ *
+ *******************************************************************************/
+static ae_rslt_t ae_deepcraft_create(const ae_backend_config_t *config)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_afe_config_t afe_config = {0};
+
+    /* The filter settings are generated for AFE_INPUT_NUMBER_CHANNELS mics */
+    if ((config->num_channels > AE_DEEPCRAFT_MAX_CHANNELS) ||
+        (config->num_channels != AFE_INPUT_NUMBER_CHANNELS) ||
+        ((config->num_channels > 1u) && (config->channel_stride != config->frame_samples)))
+    {
+        return AE_RSLT_INVALID_ARGUMENT;
+    }
+
+    ae_deepcraft_get_buffer = config->get_buffer;
+    ae_deepcraft_output = config->output;
+
+#if AE_DEEPCRAFT_DELAY_MEASURE
+    if (CY_RSLT_SUCCESS != delay_estimator_init(&ae_deepcraft_delay_estimator, DELAY_ESTIMATOR_MAX_LAG, 0u))
+    {
+        return AE_RSLT_FAIL;
+    }
+    ae_deepcraft_frame_samples = config->frame_samples;
+#endif /* AE_DEEPCRAFT_DELAY_MEASURE */
+
+    afe_config.filter_settings = AFE_FILTER_SETTINGS;
+    afe_config.mw_settings = NULL;
+    afe_config.afe_get_buffer_callback = ae_get_output_buffer_callback;
+    afe_config.afe_output_callback = ae_output_callback;
+    afe_config.user_arg_callbacks = NULL;
+
+#if AFE_MW_SETTINGS_SIZE
+    afe_config.mw_settings = AFE_MW_SETTINGS;
+    afe_config.mw_settings_length = AFE_MW_SETTINGS_SIZE;
+#else
+    afe_config.mw_settings = NULL;
+    afe_config.mw_settings_length = 0;
+#endif /* AFE_MW_SETTINGS_SIZE */
+
+
+#ifdef CY_AFE_ENABLE_TUNING_FEATURE
+    cy_afe_tuner_callbacks_t tuner_cb;
+
+    if (config->tuner_enable)
+    {
+        if (AE_RSLT_SUCCESS != audio_enhancement_tuner_init())
+        {
+            return AE_RSLT_FAIL;
+        }
+
+        /* Tuner callbacks */
+        tuner_cb.notify_settings_callback = ae_tuner_notify_callback;
+        tuner_cb.read_request_callback = ae_tuner_read_callback;
+        tuner_cb.write_response_callback = ae_tuner_write_callback;
+        afe_config.tuner_cb = tuner_cb;
+
+        afe_config.poll_interval_ms = AE_TUNER_POLL_INTERVAL_MS;
+    }
+#endif /* CY_AFE_ENABLE_TUNING_FEATURE */
+
+    afe_config.alloc_memory = ae_alloc_memory;
+    afe_config.free_memory = ae_free_memory;
+
+    result = ae_arena_init();
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return AE_RSLT_FAIL;
+    }
+
+    /* Create AFE instance (AFE Handle) */
+    result = cy_afe_create(&afe_config, &ae_handle);
+    if(CY_RSLT_SUCCESS != result)
+    {
+        return AE_RSLT_FAIL;
+    }
+
+    ae_arena_print_report();
+
+    return AE_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+ * Function Name: ae_deepcraft_feed
+ *******************************************************************************
+ * Summary:
+ * Feeds a frame to the audio-front-end middleware. The output callback is
+ * invoked from within the feed.
+ *
+ * Parameters:
+ *  mic: planar mic samples
+ *  aec_reference: AEC reference samples or NULL
+ *
+ * Return:
+ *  Returns AE_RSLT_SUCCESS if successful, otherwise returns an error code.
+ *
+ *******************************************************************************/
+static ae_rslt_t ae_deepcraft_feed(int16_t *mic, int16_t *aec_reference)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    CY_PROFILER_PROBE_BEGIN(CY_PROFILER_PROBE_AFE_FEED);
+
+    result = cy_afe_feed(ae_handle, mic, aec_reference);
+    CY_PROFILER_PROBE_END(CY_PROFILER_PROBE_AFE_FEED);
+
+    if (CY_RSLT_AFE_FUNCTIONALITY_RESTRICTED == result)
+    {
+        return AE_RSLT_LICENSE_ERROR;
+
+    }
+    else if (CY_RSLT_SUCCESS != result)
+    {
+        return AE_RSLT_FAIL;
+    }
+
+    return AE_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+ * Function Name: ae_deepcraft_destroy
+ *******************************************************************************
+ * Summary:
+ * Deletes the audio-front-end middleware instance. The middleware releases
+ * its memory through ae_free_memory.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  Returns AE_RSLT_SUCCESS if successful, otherwise returns an error code.
+ *
+ *******************************************************************************/
+static ae_rslt_t ae_deepcraft_destroy(void)
+{
+    ae_arena_tier_stats_t stats;
+    uint32_t blocks = 0;
+
+    if (NULL == ae_handle)
+    {
+        return AE_RSLT_SUCCESS;
+    }
+
+    if (CY_RSLT_SUCCESS != cy_afe_delete(&ae_handle))
+    {
+        return AE_RSLT_FAIL;
+    }
+    ae_handle = NULL;
+
+    /* Every block of the instance is back in the arena before the next create */
+    for (uint32_t tier = 0; tier < AE_ARENA_TIER_COUNT; tier++)
+    {
+        ae_arena_get_stats((ae_arena_tier_t)tier, &stats);
+        blocks += stats.blocks;
+    }
+    if (0u != blocks)
+    {
+        app_ae_log("AFE delete left %lu arena blocks allocated", (unsigned long)blocks);
+    }
+
+    return AE_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+ * Function Name: ae_deepcraft_get_delay
+ *******************************************************************************
+ * Summary:
+ * Returns the delay of the middleware output against its input.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  Delay in samples, 0 while it is being measured.
+ *
+ *******************************************************************************/
+static uint32_t ae_deepcraft_get_delay(void)
+{
+#if AE_DEEPCRAFT_DELAY_MEASURE
+    return delay_estimator_get_delay(&ae_deepcraft_delay_estimator);
+#else
+    return AE_DEEPCRAFT_DELAY_SAMPLES;
+#endif /* AE_DEEPCRAFT_DELAY_MEASURE */
+}
+
+const ae_backend_t ae_backend_deepcraft =
+{
+    .name = "deepcraft",
+    .get_delay = ae_deepcraft_get_delay,
+    /* The filter settings are generated for the mics of the AFE configurator */
+    .fixed_channels = AFE_INPUT_NUMBER_CHANNELS,
+    .create = ae_deepcraft_create,
+    .feed = ae_deepcraft_feed,
+    .destroy = ae_deepcraft_destroy,
+};
+
+/* [] END OF FILE */
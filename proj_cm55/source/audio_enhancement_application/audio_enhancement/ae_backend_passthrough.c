@@ -0,0 +1,150 @@
+/******************************************************************************
+* File Name : ae_backend_passthrough.c
+*
+* Description :
+* Passthrough Audio Enhancement backend. Copies the first mic channel to
+* the output without processing. Used to measure the application overhead.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "ae_backend.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static ae_backend_config_t ae_passthrough_config = {0};
+static ae_buffer_info_t ae_passthrough_buffer_info = {0};
+static int16_t ae_passthrough_zero_ref[AE_FRAME_SAMPLES_PER_CHANNEL] = {0};
+
+/*******************************************************************************
+ * Function Name: ae_passthrough_create
+ *******************************************************************************
+ * Summary:
+ * Stores the backend configuration.
+ *
+ * Parameters:
+ *  config: backend configuration
+ *
+ * Return:
+ *  Returns AE_RSLT_SUCCESS if successful, otherwise returns an error code.
+ *
+ *******************************************************************************/
+static ae_rslt_t ae_passthrough_create(const ae_backend_config_t *config)
+{
+    if ((NULL == config->get_buffer) || (NULL == config->output) ||
+        (config->frame_samples > AE_FRAME_SAMPLES_PER_CHANNEL))
+    {
+        return AE_RSLT_INVALID_ARGUMENT;
+    }
+
+    ae_passthrough_config = *config;
+    return AE_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+ * Function Name: ae_passthrough_feed
+ *******************************************************************************
+ * Summary:
+ * Copies the first mic channel to the output buffer and passes the frame to
+ * the output callback. In tuning builds the debug outputs carry the inputs.
+ *
+ * Parameters:
+ *  mic: planar mic samples
+ *  aec_reference: AEC reference samples or NULL
+ *
+ * Return:
+ *  Returns AE_RSLT_SUCCESS if successful, otherwise returns an error code.
+ *
+ *******************************************************************************/
+static ae_rslt_t ae_passthrough_feed(int16_t *mic, int16_t *aec_reference)
+{
+    int16_t *output = ae_passthrough_config.get_buffer();
+    int16_t *reference = (NULL != aec_reference) ? aec_reference : ae_passthrough_zero_ref;
+
+    if (NULL == output)
+    {
+        return AE_RSLT_FAIL;
+    }
+
+    memcpy(output, mic, ae_passthrough_config.frame_samples * sizeof(int16_t));
+
+    ae_passthrough_buffer_info.input_buf = mic;
+    ae_passthrough_buffer_info.input_aec_ref_buf = aec_reference;
+    ae_passthrough_buffer_info.output_buf = output;
+#ifdef CY_AFE_ENABLE_TUNING_FEATURE
+    ae_passthrough_buffer_info.dbg_output1 = mic;
+    ae_passthrough_buffer_info.dbg_output2 = (ae_passthrough_config.num_channels > 1) ?
+            (mic + ae_passthrough_config.channel_stride) : mic;
+    ae_passthrough_buffer_info.dbg_output3 = reference;
+    ae_passthrough_buffer_info.dbg_output4 = output;
+#endif /* CY_AFE_ENABLE_TUNING_FEATURE */
+    (void)reference;
+
+    ae_passthrough_config.output(&ae_passthrough_buffer_info);
+    return AE_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+ * Function Name: ae_passthrough_destroy
+ *******************************************************************************
+ * Summary:
+ * Releases the backend. Nothing is allocated by this backend.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  AE_RSLT_SUCCESS
+ *
+ *******************************************************************************/
+static ae_rslt_t ae_passthrough_destroy(void)
+{
+    memset(&ae_passthrough_config, 0, sizeof(ae_passthrough_config));
+    return AE_RSLT_SUCCESS;
+}
+
+const ae_backend_t ae_backend_passthrough =
+{
+    .name = "passthrough",
+    .get_delay = NULL,
+    .fixed_channels = 0u,
+    .create = ae_passthrough_create,
+    .feed = ae_passthrough_feed,
+    .destroy = ae_passthrough_destroy,
+};
+
+/* [] END OF FILE */
@@ -0,0 +1,347 @@
+/******************************************************************************
+* File Name : ae_backend_reference.c
+*
+* Description :
+* Reference Audio Enhancement backend. A simple NLMS echo canceller and
+* a frame based noise suppressor written in portable C, used as a
+* baseline for benchmarking.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "ae_backend.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Echo canceller filter length in samples (8 msec at 16 kHz) */
+#define AE_REF_AEC_TAPS                         (128u)
+/* NLMS step size and regularization */
+#define AE_REF_AEC_STEP_SIZE                    (0.1f)
+#define AE_REF_AEC_REGULARIZATION               (1.0e4f)
+
+/* Noise floor rise per frame when the frame power is above the estimate */
+#define AE_REF_NS_NOISE_RISE                    (1.02f)
+/* Minimum noise suppression gain (about -18 dB) */
+#define AE_REF_NS_MIN_GAIN                      (0.125f)
+/* Smoothing of the suppression gain between frames */
+#define AE_REF_NS_GAIN_SMOOTHING                (0.7f)
+
+#define AE_REF_SAMPLE_MAX                       (32767.0f)
+#define AE_REF_SAMPLE_MIN                       (-32768.0f)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static ae_backend_config_t ae_ref_config = {0};
+static ae_buffer_info_t ae_ref_buffer_info = {0};
+
+/* NLMS state. The reference history holds the previous AE_REF_AEC_TAPS - 1
+ * samples followed by the current frame.
+ */
+static float ae_ref_aec_weights[AE_REF_AEC_TAPS];
+static float ae_ref_history[AE_REF_AEC_TAPS - 1u + AE_FRAME_SAMPLES_PER_CHANNEL];
+static float ae_ref_history_energy = 0.0f;
+
+/* Echo canceller output of the current frame */
+static float ae_ref_error[AE_FRAME_SAMPLES_PER_CHANNEL];
+
+/* Noise suppressor state */
+static float ae_ref_noise_power = 0.0f;
+static float ae_ref_ns_gain = 1.0f;
+
+/*******************************************************************************
+* Function Name: ae_ref_saturate
+********************************************************************************
+* Summary:
+* Converts a sample to 16 bit with saturation.
+*
+*******************************************************************************/
+static inline int16_t ae_ref_saturate(float sample)
+{
+    if (sample > AE_REF_SAMPLE_MAX)
+    {
+        return (int16_t)AE_REF_SAMPLE_MAX;
+    }
+    if (sample < AE_REF_SAMPLE_MIN)
+    {
+        return (int16_t)AE_REF_SAMPLE_MIN;
+    }
+    return (int16_t)sample;
+}
+
+/*******************************************************************************
+* Function Name: ae_ref_reset
+********************************************************************************
+* Summary:
+* Clears the echo canceller and noise suppressor state.
+*
+*******************************************************************************/
+static void ae_ref_reset(void)
+{
+    memset(ae_ref_aec_weights, 0, sizeof(ae_ref_aec_weights));
+    memset(ae_ref_history, 0, sizeof(ae_ref_history));
+    ae_ref_history_energy = 0.0f;
+    ae_ref_noise_power = 0.0f;
+    ae_ref_ns_gain = 1.0f;
+}
+
+/*******************************************************************************
+* Function Name: ae_ref_aec_process
+********************************************************************************
+* Summary:
+* Removes the echo of the AEC reference from the mic frame with a time domain
+* NLMS filter. The result is written to ae_ref_error.
+*
+* Parameters:
+*  mic - First mic channel
+*  aec_reference - AEC reference or NULL
+*  frame_samples - Samples per frame
+*
+*******************************************************************************/
+static void ae_ref_aec_process(const int16_t *mic, const int16_t *aec_reference,
+        uint32_t frame_samples)
+{
+    const uint32_t taps = AE_REF_AEC_TAPS;
+    float *x = NULL;
+    float estimate = 0.0f;
+    float error = 0.0f;
+    float step = 0.0f;
+    uint32_t n = 0;
+    uint32_t k = 0;
+
+    if (NULL == aec_reference)
+    {
+        for (n = 0; n < frame_samples; n++)
+        {
+            ae_ref_error[n] = (float)mic[n];
+        }
+        return;
+    }
+
+    for (n = 0; n < frame_samples; n++)
+    {
+        ae_ref_history[taps - 1u + n] = (float)aec_reference[n];
+    }
+
+    for (n = 0; n < frame_samples; n++)
+    {
+        /* x[0] is the newest reference sample, x[-k] the k-th older one */
+        x = &ae_ref_history[taps - 1u + n];
+        ae_ref_history_energy += (x[0] * x[0]);
+
+        estimate = 0.0f;
+        for (k = 0; k < taps; k++)
+        {
+            estimate += ae_ref_aec_weights[k] * x[-(int32_t)k];
+        }
+
+        error = (float)mic[n] - estimate;
+        ae_ref_error[n] = error;
+
+        step = (AE_REF_AEC_STEP_SIZE * error) / (ae_ref_history_energy + AE_REF_AEC_REGULARIZATION);
+        for (k = 0; k < taps; k++)
+        {
+            ae_ref_aec_weights[k] += step * x[-(int32_t)k];
+        }
+
+        /* Drop the sample that leaves the filter window */
+        ae_ref_history_energy -= (x[-(int32_t)(taps - 1u)] * x[-(int32_t)(taps - 1u)]);
+        if (ae_ref_history_energy < 0.0f)
+        {
+            ae_ref_history_energy = 0.0f;
+        }
+    }
+
+    memmove(ae_ref_history, &ae_ref_history[frame_samples], (taps - 1u) * sizeof(float));
+}
+
+/*******************************************************************************
+* Function Name: ae_ref_ns_process
+********************************************************************************
+* Summary:
+* Applies a frame based Wiener style suppression gain derived from a
+* tracked noise floor and writes the result to the output buffer.
+*
+* Parameters:
+*  output - Output buffer
+*  frame_samples - Samples per frame
+*
+*******************************************************************************/
+static void ae_ref_ns_process(int16_t *output, uint32_t frame_samples)
+{
+    float power = 0.0f;
+    float gain = 1.0f;
+    float gain_step = 0.0f;
+    float current_gain = ae_ref_ns_gain;
+    uint32_t n = 0;
+
+    for (n = 0; n < frame_samples; n++)
+    {
+        power += ae_ref_error[n] * ae_ref_error[n];
+    }
+    power /= (float)frame_samples;
+
+    /* Follow the noise floor down immediately and up slowly */
+    if ((power < ae_ref_noise_power) || (0.0f == ae_ref_noise_power))
+    {
+        ae_ref_noise_power = power;
+    }
+    else
+    {
+        ae_ref_noise_power *= AE_REF_NS_NOISE_RISE;
+    }
+
+    if (power > 0.0f)
+    {
+        gain = 1.0f - (ae_ref_noise_power / power);
+    }
+    if (gain < AE_REF_NS_MIN_GAIN)
+    {
+        gain = AE_REF_NS_MIN_GAIN;
+    }
+    gain = (AE_REF_NS_GAIN_SMOOTHING * ae_ref_ns_gain) + ((1.0f - AE_REF_NS_GAIN_SMOOTHING) * gain);
+
+    /* Ramp from the previous gain to avoid steps at frame boundaries */
+    gain_step = (gain - ae_ref_ns_gain) / (float)frame_samples;
+    for (n = 0; n < frame_samples; n++)
+    {
+        current_gain += gain_step;
+        output[n] = ae_ref_saturate(ae_ref_error[n] * current_gain);
+    }
+    ae_ref_ns_gain = gain;
+}
+
+/*******************************************************************************
+ * Function Name: ae_ref_create
+ *******************************************************************************
+ * Summary:
+ * Stores the backend configuration and clears the processing state.
+ *
+ * Parameters:
+ *  config: backend configuration
+ *
+ * Return:
+ *  Returns AE_RSLT_SUCCESS if successful, otherwise returns an error code.
+ *
+ *******************************************************************************/
+static ae_rslt_t ae_ref_create(const ae_backend_config_t *config)
+{
+    if ((NULL == config->get_buffer) || (NULL == config->output) ||
+        (0u == config->frame_samples) ||
+        (config->frame_samples > AE_FRAME_SAMPLES_PER_CHANNEL))
+    {
+        return AE_RSLT_INVALID_ARGUMENT;
+    }
+
+    ae_ref_config = *config;
+    ae_ref_reset();
+    return AE_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+ * Function Name: ae_ref_feed
+ *******************************************************************************
+ * Summary:
+ * Runs the echo canceller and noise suppressor on the first mic channel and
+ * passes the frame to the output callback. In tuning builds the debug
+ * outputs carry the mic, AEC reference, echo canceller and final output.
+ *
+ * Parameters:
+ *  mic: planar mic samples
+ *  aec_reference: AEC reference samples or NULL
+ *
+ * Return:
+ *  Returns AE_RSLT_SUCCESS if successful, otherwise returns an error code.
+ *
+ *******************************************************************************/
+static ae_rslt_t ae_ref_feed(int16_t *mic, int16_t *aec_reference)
+{
+    int16_t *output = ae_ref_config.get_buffer();
+
+    if (NULL == output)
+    {
+        return AE_RSLT_FAIL;
+    }
+
+    ae_ref_aec_process(mic, aec_reference, ae_ref_config.frame_samples);
+    ae_ref_ns_process(output, ae_ref_config.frame_samples);
+
+    ae_ref_buffer_info.input_buf = mic;
+    ae_ref_buffer_info.input_aec_ref_buf = aec_reference;
+    ae_ref_buffer_info.output_buf = output;
+#ifdef CY_AFE_ENABLE_TUNING_FEATURE
+    ae_ref_buffer_info.dbg_output1 = mic;
+    ae_ref_buffer_info.dbg_output2 = (NULL != aec_reference) ? aec_reference : mic;
+    ae_ref_buffer_info.dbg_output3 = output;
+    ae_ref_buffer_info.dbg_output4 = output;
+#endif /* CY_AFE_ENABLE_TUNING_FEATURE */
+
+    ae_ref_config.output(&ae_ref_buffer_info);
+    return AE_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+ * Function Name: ae_ref_destroy
+ *******************************************************************************
+ * Summary:
+ * Releases the backend. All state is static.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  AE_RSLT_SUCCESS
+ *
+ *******************************************************************************/
+static ae_rslt_t ae_ref_destroy(void)
+{
+    memset(&ae_ref_config, 0, sizeof(ae_ref_config));
+    ae_ref_reset();
+    return AE_RSLT_SUCCESS;
+}
+
+const ae_backend_t ae_backend_reference =
+{
+    .name = "reference",
+    .get_delay = NULL,
+    .fixed_channels = 0u,
+    .create = ae_ref_create,
+    .feed = ae_ref_feed,
+    .destroy = ae_ref_destroy,
+};
+
+/* [] END OF FILE */
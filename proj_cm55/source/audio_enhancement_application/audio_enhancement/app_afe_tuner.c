@@ -51,11 +51,13 @@
 #include "audio_usb_send_utils.h"
 #include "pdm_mic_interface.h"
 #include "app_logger.h"
+#include "tuner_transport.h"
 
 /*******************************************************************************
 * Macros
 *******************************************************************************/
-#define UART_READ_TIMEOUT_MS             (1u)
+/* Maximum number of bytes handed to the middleware per read request */
+#define TUNER_READ_CHUNK_SIZE            (2048u)
 
 /*******************************************************************************
 * Global Variables
@@ -66,6 +68,11 @@ unsigned int bdm_aec_ref_len = 0;
 uint32_t* pbulk_delay = NULL;
 int8_t gain_change=0;
 
+/* Bytes returned by the last read request */
+static uint8_t tuner_read_chunk[TUNER_READ_CHUNK_SIZE];
+/* The transport is started once, the AFE is created again on reconfiguration */
+static bool tuner_transport_started = false;
+
 /*******************************************************************************
 * Extern Variables
 *******************************************************************************/
@@ -90,7 +97,6 @@ extern uint32_t initial_buffer_count;
 ae_rslt_t audio_enhancement_tuner_notify(cy_afe_t handle, cy_afe_config_setting_t *config_setting)
 {
     static int stored_input_gain=0;
-    int16_t input_gain_factor = 0 ;
     int* data = NULL;
     cy_afe_tuner_buffer_t response_buffer;
     float gain_db =0.0;
@@ -128,9 +134,7 @@ ae_rslt_t audio_enhancement_tuner_notify(cy_afe_t handle, cy_afe_config_setting_
 #endif /* GAIN_CONTROL_ON */            
             {
                 app_ae_log("Setting input gain to %f \r\n",gain_db);
-                input_gain_factor=convert_db_to_pdm_scale(gain_db);
-                app_ae_log("Setting input scale to %d \r\n",input_gain_factor);
-                set_pdm_pcm_gain((int16_t)input_gain_factor);
+                set_pdm_pcm_gain_db(gain_db);
                 stored_input_gain=*data;
             }
             else
@@ -191,11 +195,42 @@ ae_rslt_t audio_enhancement_tuner_notify(cy_afe_t handle, cy_afe_config_setting_
 
 }
 
+/*******************************************************************************
+* Function Name: audio_enhancement_tuner_init
+********************************************************************************
+* Summary:
+*  Starts the tuner transport selected by TUNER_TRANSPORT, on the first call
+*  only.
+*
+* Parameters:
+*  None
+* Return:
+*  AE_RSLT_SUCCESS or AE_RSLT_FAIL
+*
+*******************************************************************************/
+
+ae_rslt_t audio_enhancement_tuner_init(void)
+{
+    if (tuner_transport_started)
+    {
+        return AE_RSLT_SUCCESS;
+    }
+    if (CY_RSLT_SUCCESS != tuner_transport_get()->init())
+    {
+        app_log_print("Tuner %s transport init failed \r\n", tuner_transport_get()->name);
+        return AE_RSLT_FAIL;
+    }
+    tuner_transport_started = true;
+    return AE_RSLT_SUCCESS;
+}
+
 /*******************************************************************************
 * Function Name: audio_enhancement_tuner_read
 ********************************************************************************
 * Summary:
-*  Callback for AFE tuning read operation.
+*  Callback for AFE tuning read operation. Returns all bytes received since
+*  the last request, without blocking. The bytes are returned in a buffer of
+*  this module, like the NULL buffer returned when nothing was received.
 *
 * Parameters:
 *  handle - AFE handle
@@ -207,17 +242,12 @@ ae_rslt_t audio_enhancement_tuner_notify(cy_afe_t handle, cy_afe_config_setting_
 
 ae_rslt_t audio_enhancement_tuner_read(cy_afe_tuner_buffer_t *request_buffer)
 {
-    uint32_t read_value = Cy_SCB_UART_Get(CYBSP_DEBUG_UART_HW);
-    if (CY_SCB_UART_RX_NO_DATA == read_value)
-    {
-        vTaskDelay(pdMS_TO_TICKS(UART_READ_TIMEOUT_MS));
-        read_value = Cy_SCB_UART_Get(CYBSP_DEBUG_UART_HW);
-    }
+    uint32_t length = tuner_transport_get()->read(tuner_read_chunk, sizeof(tuner_read_chunk));
 
-    if (CY_SCB_UART_RX_NO_DATA != read_value)
+    if (0u != length)
     {
-        request_buffer->buffer[0] = (uint8_t)read_value;
-        request_buffer->length = 1;
+        request_buffer->buffer = tuner_read_chunk;
+        request_buffer->length = length;
     }
     else
     {
@@ -231,7 +261,9 @@ ae_rslt_t audio_enhancement_tuner_read(cy_afe_tuner_buffer_t *request_buffer)
 * Function Name: audio_enhancement_tuner_write
 ********************************************************************************
 * Summary:
-*  Callback for Audio Enhancment tuning write operation.
+*  Callback for Audio Enhancment tuning write operation. The response is
+*  queued and sent by the tuner transport. Bytes that do not fit in the
+*  queue are counted in the transport statistics.
 *
 * Parameters:
 *  response_buffer - Buffer with write data.
@@ -243,7 +275,7 @@ ae_rslt_t audio_enhancement_tuner_read(cy_afe_tuner_buffer_t *request_buffer)
 
 ae_rslt_t audio_enhancement_tuner_write(cy_afe_tuner_buffer_t *response_buffer)
 {
-    Cy_SCB_UART_PutArrayBlocking(CYBSP_DEBUG_UART_HW, response_buffer->buffer, response_buffer->length);
+    (void)tuner_transport_get()->write(response_buffer->buffer, response_buffer->length);
     return AE_RSLT_SUCCESS;
 }
 #endif /* CY_AFE_ENABLE_TUNING_FEATURE */
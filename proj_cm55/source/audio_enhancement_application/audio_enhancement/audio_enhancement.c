@@ -39,31 +39,54 @@
 /*******************************************************************************
 * Header Files
 *******************************************************************************/
+#include <string.h>
 #include "audio_enhancement.h"
+#include "ae_backend.h"
+#include "cy_pdl.h"
+#include "rt_stats.h"
 
 /*******************************************************************************
 * Macros
 *******************************************************************************/
 
-#define AE_APP_TEMP_MEMORY                              (2)
-#define AE_MAX_NUM_CHANNELS                             (2)
-#define AE_ALGO_SCRATCH_MEMORY                          (40000)
-#define AE_ALGO_PERSISTENT_MEMORY                       (160000)
+
+/* Backend selected at build time with CONFIG_AE_BACKEND */
+#if defined(AE_BACKEND_PASSTHROUGH)
+#define AE_SELECTED_BACKEND                             (&ae_backend_passthrough)
+#elif defined(AE_BACKEND_REFERENCE)
+#define AE_SELECTED_BACKEND                             (&ae_backend_reference)
+#else
+#define AE_SELECTED_BACKEND                             (&ae_backend_deepcraft)
+#endif
+
+#if AE_BACKEND_STATS_ENABLE
+#define AE_BACKEND_CYCLES()                             (DWT->CYCCNT)
+#else
+#define AE_BACKEND_CYCLES()                             (0u)
+#endif /* AE_BACKEND_STATS_ENABLE */
 
 
 /*******************************************************************************
 * Global Variables
 *******************************************************************************/
-uint8_t ae_scratch_memory[AE_ALGO_SCRATCH_MEMORY] __attribute__((section(".dtcm_data"), aligned(4)));
-uint8_t ae_persistent_memory[AE_ALGO_PERSISTENT_MEMORY] __attribute__((section(".dtcm_data"), aligned(4)));
-uint8_t ae_temp_mem[AE_APP_TEMP_MEMORY] = {0};
 uint8_t ae_output_buffer[AE_FRAME_BUFFER_MEMORY] __attribute__((section(".dtcm_data"), aligned(4)));
 
-cy_afe_t ae_handle = NULL;
-void    *ae_dsns_mem = NULL;
-void    *ae_dses_mem = NULL;
 ae_buffer_info_t ae_output_buffer_info = {0};
 
+/* Backends that can be selected at runtime, looked up by name */
+static const ae_backend_t *const ae_backends[] =
+{
+    &ae_backend_deepcraft,
+    &ae_backend_passthrough,
+    &ae_backend_reference,
+};
+
+static const ae_backend_t *ae_backend = NULL;
+static uint8_t ae_num_channels = 0;
+static ae_backend_stats_t ae_backend_stats = {0};
+/* Cycles spent in the output callback during the current feed */
+static uint32_t ae_output_cycles = 0;
+
 /****************************************************************************
 * Global variables
 *****************************************************************************/
@@ -73,30 +96,25 @@ extern volatile int8_t ae_toggle_flag;
 * Function Name: ae_output_callback
 ********************************************************************************
 * Summary:
-* Output callback to process the output buffer from AFE middleware.
+* Output callback to process the output buffer from the backend.
 *
 * Parameters:
-*  handle - AFE handle.
-*  output_buffer_info - Output buffer from MW.
-*  user_arg - User argument (unused).
+*  output_buffer_info - Output buffer from the backend.
 * 
 * Return:
 *  None
 *
 *******************************************************************************/
-static cy_rslt_t ae_output_callback(cy_afe_t handle, cy_afe_buffer_info_t *output_buffer_info, void *user_arg)
+static void ae_output_callback(ae_buffer_info_t *output_buffer_info)
 {
-    ae_output_buffer_info.output_buf = (int16_t *) output_buffer_info->output_buf;
-    ae_output_buffer_info.input_buf = (int16_t *) output_buffer_info->input_buf;
-    ae_output_buffer_info.input_aec_ref_buf = (int16_t *) output_buffer_info->input_aec_ref_buf;
-#ifdef CY_AFE_ENABLE_TUNING_FEATURE
-    ae_output_buffer_info.dbg_output1 = (int16_t *) output_buffer_info->dbg_output1;
-    ae_output_buffer_info.dbg_output2 = (int16_t *) output_buffer_info->dbg_output2;
-    ae_output_buffer_info.dbg_output3 = (int16_t *) output_buffer_info->dbg_output3;
-    ae_output_buffer_info.dbg_output4 = (int16_t *) output_buffer_info->dbg_output4;
-#endif
+    uint32_t start_cycles = AE_BACKEND_CYCLES();
+    CY_PROFILER_PROBE_BEGIN(CY_PROFILER_PROBE_OUTPUT_CB);
+
+    ae_output_buffer_info = *output_buffer_info;
     audio_enhancement_process_output(&ae_output_buffer_info);
-    return CY_RSLT_SUCCESS;
+
+    CY_PROFILER_PROBE_END(CY_PROFILER_PROBE_OUTPUT_CB);
+    ae_output_cycles += AE_BACKEND_CYCLES() - start_cycles;
 }
 
 
@@ -104,366 +122,307 @@ static cy_rslt_t ae_output_callback(cy_afe_t handle, cy_afe_buffer_info_t *outpu
 * Function Name: ae_get_output_buffer_callback
 ********************************************************************************
 * Summary:
-* Output callback to get the output buffer for AFE middleware.
+* Callback to get the output buffer for the backend.
 *
 * Parameters:
-*  context - context (unused)
-*  output_buffer - Get a free buffer.
-*  user_arg - User argument (unused).
+*  None
 * 
 * Return:
-*  CY_RSLT_SUCCESS.
+*  Output buffer.
 *
 *******************************************************************************/
-static cy_rslt_t ae_get_output_buffer_callback(cy_afe_t context, uint32_t **output_buffer, void *user_args)
+static int16_t* ae_get_output_buffer_callback(void)
 {
-    *output_buffer = (uint32_t*) ae_output_buffer;
-
-    return CY_RSLT_SUCCESS;
+    return (int16_t *) ae_output_buffer;
 }
+
 /*******************************************************************************
-* Function Name: ae_alloc_memory
-********************************************************************************
-* Summary:
-* Callback from middleware to allocate memory for AFE.
-*
-* Parameters:
-*  None
-*
-* Return:
-*  Result of memory allocation.
-*
-*******************************************************************************/
-cy_rslt_t ae_alloc_memory(cy_afe_mem_id_t mem_id, uint32_t size, void **buffer)
+ * Function Name: ae_backend_start
+ *******************************************************************************
+ * Summary:
+ * Creates a backend for the given number of mic channels.
+ *
+ * Parameters:
+ *  backend: backend to create
+ *  num_channels: number of mic channels
+ *
+ * Return:
+ *  Returns AE_RSLT_SUCCESS if successful, otherwise returns an error code.
+ *
+ *******************************************************************************/
+static ae_rslt_t ae_backend_start(const ae_backend_t *backend, uint8_t num_channels)
 {
-    cy_rslt_t  ret_val = CY_RSLT_SUCCESS;
-    int ae_mem_id = (int)mem_id;
-    if(NULL == buffer)
-    {
-        return ret_val;
-    }
-    *buffer = NULL;
-    app_ae_log("app afe alloc size %ld \r\n", (long)size);
-    /* If size equal ZERO, no allocation required */
-    if (size == 0)
-    {
-        app_ae_log("No allocation as size is zero \r\n");
-        *buffer = &ae_temp_mem[0];
-        return ret_val;
-    }
+    ae_rslt_t result = AE_RSLT_SUCCESS;
+    ae_backend_config_t backend_config = {0};
+
+    backend_config.num_channels = num_channels;
+    backend_config.frame_samples = audio_pipeline_get_config()->samples_per_frame;
+    backend_config.channel_stride = AE_FRAME_CHANNEL_STRIDE;
+    backend_config.get_buffer = ae_get_output_buffer_callback;
+    backend_config.output = ae_output_callback;
+#ifdef CY_AFE_ENABLE_TUNING_FEATURE
+    backend_config.tuner_enable = true;
+#endif /* CY_AFE_ENABLE_TUNING_FEATURE */
 
-    /* Allocate memory based on the memory ID */
-    switch(ae_mem_id)
+    result = backend->create(&backend_config);
+    if (AE_RSLT_SUCCESS != result)
     {
-        case CY_AFE_MEM_ID_ALGORITHM_NS_MEMORY:
-        {
-            app_ae_log("DSNS Memory requires %ld bytes \r\n", (long)size);
-            ae_dsns_mem = calloc(size+15,1);
-            if (ae_dsns_mem == NULL)
-            {
-                app_ae_log("DSNS memory allocation failed \r\n");
-                ret_val = -1;
-            }
-            else
-            {
-                *buffer = (void *) (((uintptr_t)ae_dsns_mem+15) & ~ (uintptr_t)0x0F);
-            }
-            break;
-        }
-        
-        case CY_AFE_MEM_ID_ALGORITHM_ES_MEMORY:
-        {
-            app_ae_log("DSES Memory requires %ld bytes \r\n", (long)size);
-            ae_dses_mem = calloc(size+15,1);
-            if (ae_dses_mem == NULL)
-            {
-                app_ae_log("DSES memory allocation failed \r\n");
-                ret_val = -1;
-            }
-            else
-            {
-                *buffer = (void *) (((uintptr_t)ae_dses_mem+15) & ~ (uintptr_t)0x0F);
-            }
-            break;
-        }
-        case CY_AFE_MEM_ID_ALGORITHM_PERSISTENT_MEMORY:
-        {
-            app_ae_log("Persistent Memory requires %ld bytes \r\n", (long)size);
-
-            if(size > AE_ALGO_PERSISTENT_MEMORY)
-            {
-                app_ae_log("Defaulting to heap allocation for persistent memory \r\n");
-                *buffer = (void *)calloc(size,1);
-                if (*buffer == NULL)
-                {
-                    app_ae_log("Persistent memory allocation failed \r\n");
-                    ret_val = -1;
-                }
-            }
-            else
-            {
-                *buffer = &ae_persistent_memory[0];
-                memset(*buffer, 0 , size);
-            }
-            break;
-        }
-        case CY_AFE_MEM_ID_ALGORITHM_SCRATCH_MEMORY:
-        {
-            app_ae_log("Scratch Memory requires %ld bytes \r\n", (long)size);
-            if(size > AE_ALGO_SCRATCH_MEMORY)
-            {
-                app_ae_log("Defaulting to heap allocation for scratch memory \r\n");
-                *buffer = (void *)calloc(size,1);
-                if (*buffer == NULL)
-                {
-                    ret_val = -1;
-                }
-            }
-            else
-            {
-                *buffer = &ae_scratch_memory[0];
-                memset(*buffer, 0 , size);
-            }
-            break;
-        }
-        default:
-        {
-            *buffer = (void *)calloc(size,1);
-            if (*buffer == NULL)
-            {
-                app_ae_log("AFE memory allocation failed \r\n");
-                ret_val = -1;
-            }
-            break;
-        }
+        return result;
     }
 
-    return ret_val;
+    ae_backend = backend;
+    ae_num_channels = num_channels;
+    audio_enhancement_reset_backend_stats();
+    app_ae_log("AE backend: %s, %u channel(s)", ae_backend->name, (unsigned int)num_channels);
+
+    return AE_RSLT_SUCCESS;
 }
 
 /*******************************************************************************
-* Function Name: ae_free_memory
-********************************************************************************
-* Summary:
-* Callback from middle-ware to free memory for AFE.
-*
-* Parameters:
-*  None
-*
-* Return:
-*  Result of freeing memory.
-*
-*******************************************************************************/
-cy_rslt_t ae_free_memory(cy_afe_mem_id_t mem_id, void *buffer)
+ * Function Name: audio_enhancement_init
+ *******************************************************************************
+ * Summary:
+ * Initializes the audio enhacement module. Internally, it creates the
+ * backend selected at build time (DEEPCRAFT(TM) middleware by default).
+ *
+ * Parameters:
+ *  num_channels: number of mic channels
+ *
+ * Return:
+ *  Returns AE_RSLT_SUCCESS if successful, otherwise returns an error code.
+ *
+ *******************************************************************************/
+ae_rslt_t audio_enhancement_init(uint8_t num_channels)
 {
-    int ae_mem_id = (int)mem_id;
-    if (buffer != NULL)
+    if ((0u == num_channels) || (num_channels > AE_FRAME_MAX_CHANNELS))
     {
-          free(buffer);
-          buffer = NULL;
-    }
-    switch(ae_mem_id)
-    {
-        case CY_AFE_MEM_ID_ALGORITHM_ES_MEMORY:
-        {
-            if (ae_dses_mem != NULL) 
-            {
-                free(ae_dses_mem);
-                ae_dses_mem=NULL;
-            }
-            break;
-        }
-        case CY_AFE_MEM_ID_ALGORITHM_NS_MEMORY:
-        {
-            if (ae_dsns_mem !=NULL)
-            {
-                free(ae_dsns_mem);
-                ae_dsns_mem=NULL;                
-            }
-            break;
-        }
-        default:
-            break;
+        return AE_RSLT_INVALID_ARGUMENT;
     }
 
-    return CY_RSLT_SUCCESS;
+#if AE_BACKEND_STATS_ENABLE
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif /* AE_BACKEND_STATS_ENABLE */
+
+    return ae_backend_start(AE_SELECTED_BACKEND, num_channels);
 }
 
-#ifdef CY_AFE_ENABLE_TUNING_FEATURE
 /*******************************************************************************
-* Function Name: ae_tuner_notify_callback
-********************************************************************************
-* Summary:
-*  Tuner notification callback from AFE middleware.
-*
-* Parameters:
-*  handle - AFE handle
-*  config_setting - Configuration settings.
-*  user_arg - User argument.
-
-* Return:
-*  CY_RSLT_SUCCESS
-*
-*******************************************************************************/
-static cy_rslt_t ae_tuner_notify_callback(cy_afe_t handle, 
-                                          cy_afe_config_setting_t *config_setting, 
-                                          void *user_arg)
+ * Function Name: audio_enhancement_deinit
+ *******************************************************************************
+ * Summary:
+ * Destroys the backend created by audio_enhancement_init.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  Returns AE_RSLT_SUCCESS if successful, otherwise returns an error code.
+ *
+ *******************************************************************************/
+ae_rslt_t audio_enhancement_deinit(void)
 {
-    (void) user_arg;
+    ae_rslt_t result = AE_RSLT_SUCCESS;
+
+    if (NULL == ae_backend)
+    {
+        return AE_RSLT_SUCCESS;
+    }
 
-    return audio_enhancement_tuner_notify(handle,config_setting);
+    result = ae_backend->destroy();
+    ae_backend = NULL;
 
-    //return CY_RSLT_SUCCESS;
+    return result;
 }
 
 /*******************************************************************************
-* Function Name: ae_tuner_read_callback
-********************************************************************************
-* Summary:
-*  Callback for AFE read operation.
-*
-* Parameters:
-*  handle - AFE handle
-*  request_buffer - Buffer with read data.
-*  user_arg - user argument.
-*
-* Return:
-*  CY_RSLT_SUCCESS
-*
-*******************************************************************************/
-static cy_rslt_t ae_tuner_read_callback(cy_afe_t handle, 
-                                        cy_afe_tuner_buffer_t *request_buffer, 
-                                        void *user_arg)
+ * Function Name: audio_enhancement_reconfigure
+ *******************************************************************************
+ * Summary:
+ * Replaces the active backend with the given backend and channel count. The
+ * backend is destroyed and created again, so the DEEPCRAFT(TM) middleware
+ * returns its memory to the arena and takes it back on creation. If the new
+ * backend cannot be created the previous one is restored.
+ *
+ * The caller must make sure no frame is fed during the call.
+ *
+ * Parameters:
+ *  backend: backend to create
+ *  num_channels: number of mic channels
+ *
+ * Return:
+ *  Returns AE_RSLT_SUCCESS if successful, otherwise returns the error code
+ *  of the new backend.
+ *
+ *******************************************************************************/
+ae_rslt_t audio_enhancement_reconfigure(const ae_backend_t *backend, uint8_t num_channels)
 {
-    (void) user_arg;
+    const ae_backend_t *previous_backend = ae_backend;
+    uint8_t previous_channels = ae_num_channels;
+    ae_rslt_t result = AE_RSLT_SUCCESS;
 
-    audio_enhancement_tuner_read(request_buffer);
+    if ((NULL == backend) || (0u == num_channels) || (num_channels > AE_FRAME_MAX_CHANNELS))
+    {
+        return AE_RSLT_INVALID_ARGUMENT;
+    }
 
-    return CY_RSLT_SUCCESS;
+    result = audio_enhancement_deinit();
+    if (AE_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    result = ae_backend_start(backend, num_channels);
+    if ((AE_RSLT_SUCCESS != result) && (NULL != previous_backend))
+    {
+        if (AE_RSLT_SUCCESS != ae_backend_start(previous_backend, previous_channels))
+        {
+            app_ae_log("AE backend %s could not be restored", previous_backend->name);
+        }
+    }
+
+    return result;
 }
 
 /*******************************************************************************
-* Function Name: ae_tuner_write_callback
-********************************************************************************
-* Summary:
-*  Callback for AFE write operation.
-*
-* Parameters:
-*  handle - AFE handle
-*  response_buffer - buffer with write data.
-*  user_arg - user argument.
-*
-* Return:
-*  CY_RSLT_SUCCESS
-*
-*******************************************************************************/
-static cy_rslt_t ae_tuner_write_callback(cy_afe_t handle, 
-                                         cy_afe_tuner_buffer_t *response_buffer, 
-                                         void *user_arg)
+ * Function Name: audio_enhancement_find_backend
+ *******************************************************************************
+ * Summary:
+ * Looks up a backend by name.
+ *
+ * Parameters:
+ *  name: backend name
+ *
+ * Return:
+ *  Pointer to the backend or NULL if there is no backend of that name.
+ *
+ *******************************************************************************/
+const ae_backend_t* audio_enhancement_find_backend(const char *name)
 {
-    return audio_enhancement_tuner_write(response_buffer);
+    if (NULL == name)
+    {
+        return NULL;
+    }
 
-    //return CY_RSLT_SUCCESS;
-}
+    for (uint32_t i = 0; i < (sizeof(ae_backends) / sizeof(ae_backends[0])); i++)
+    {
+        if (0 == strcmp(ae_backends[i]->name, name))
+        {
+            return ae_backends[i];
+        }
+    }
 
-#endif
+    return NULL;
+}
 
 /*******************************************************************************
- * Function Name: audio_enhancement_init
+ * Function Name: audio_enhancement_get_backend
  *******************************************************************************
  * Summary:
- * Initializes the audio enhacement module. Internally, it instantiates the
- * audio-front-end middleware and create an internal task to process the 
- * audio data.
+ * Returns the active backend.
  *
  * Parameters:
  *  void
  *
  * Return:
+ *  Pointer to the backend or NULL if no backend is created.
+ *
+ *******************************************************************************/
+const ae_backend_t* audio_enhancement_get_backend(void)
+{
+    return ae_backend;
+}
+
+/*******************************************************************************
+ * Function Name: audio_enhancement_feed_input
+ *******************************************************************************
+ * Summary:
+ * Feeds a captured frame to the audio enhancement module. The planar mic
+ * samples and the AEC reference are passed in place from the frame.
+ *
+ * Parameters:
+ *  frame: pointer to the frame descriptor. frame->aec_reference is NULL if
+ *         no AEC reference is available.
+ *
+ * Return:
  *  Returns AE_RSLT_SUCCESS if successful, otherwise returns an error code.
  *
  *******************************************************************************/
-ae_rslt_t audio_enhancement_init(uint8_t num_channels)
+ae_rslt_t audio_enhancement_feed_input(ae_frame_t *frame)
 {
-    cy_rslt_t result = CY_RSLT_SUCCESS;
-    cy_afe_config_t afe_config = {0};
+    ae_rslt_t result = AE_RSLT_SUCCESS;
+    uint32_t start_cycles = 0;
+    uint32_t backend_cycles = 0;
 
-    if (num_channels > AE_MAX_NUM_CHANNELS)
+    if (NULL == frame)
     {
         return AE_RSLT_INVALID_ARGUMENT;
     }
 
-    afe_config.filter_settings = AFE_FILTER_SETTINGS;
-    afe_config.mw_settings = NULL;
-    afe_config.afe_get_buffer_callback = ae_get_output_buffer_callback;
-    afe_config.afe_output_callback = ae_output_callback;
-    afe_config.user_arg_callbacks = NULL;
-
-#if AFE_MW_SETTINGS_SIZE
-    afe_config.mw_settings = AFE_MW_SETTINGS;
-    afe_config.mw_settings_length = AFE_MW_SETTINGS_SIZE;
-#else
-    afe_config.mw_settings = NULL;
-    afe_config.mw_settings_length = 0;
-#endif /* AFE_MW_SETTINGS_SIZE */
-
-
-#ifdef CY_AFE_ENABLE_TUNING_FEATURE
-    cy_afe_tuner_callbacks_t tuner_cb;
+    if (NULL == ae_backend)
+    {
+        return AE_RSLT_FAIL;
+    }
 
-    /* Tuner callbacks */
-    tuner_cb.notify_settings_callback = ae_tuner_notify_callback;
-    tuner_cb.read_request_callback = ae_tuner_read_callback;
-    tuner_cb.write_response_callback = ae_tuner_write_callback;
-    afe_config.tuner_cb = tuner_cb;
+    ae_output_cycles = 0;
+    start_cycles = AE_BACKEND_CYCLES();
 
-    afe_config.poll_interval_ms = 100; // Invoke next read after 5sec if no data received on previous read call
-#endif /* CY_AFE_ENABLE_TUNING_FEATURE */
+    result = ae_backend->feed(frame->mic, frame->aec_reference);
 
-    afe_config.alloc_memory = ae_alloc_memory;
-    afe_config.free_memory = ae_free_memory;
-    
-    /* Create AFE instance (AFE Handle) */
-    result = cy_afe_create(&afe_config, &ae_handle);
-    if(CY_RSLT_SUCCESS != result)
+    backend_cycles = (AE_BACKEND_CYCLES() - start_cycles) - ae_output_cycles;
+#if AE_BACKEND_STATS_ENABLE
+    ae_backend_stats.frames++;
+    ae_backend_stats.last_cycles = backend_cycles;
+    ae_backend_stats.total_cycles += backend_cycles;
+    ae_backend_stats.output_cycles += ae_output_cycles;
+    if (backend_cycles > ae_backend_stats.max_cycles)
     {
-        return AE_RSLT_FAIL;
+        ae_backend_stats.max_cycles = backend_cycles;
     }
+#endif /* AE_BACKEND_STATS_ENABLE */
+    (void)backend_cycles;
 
-    return AE_RSLT_SUCCESS;
+    return result;
 }
 
 /*******************************************************************************
- * Function Name: audio_enhancement_feed_input
+ * Function Name: audio_enhancement_get_backend_stats
  *******************************************************************************
  * Summary:
- * Feeds the input audio data to the audio enhancement module.
+ * Returns the cycles per frame statistics of the active backend.
  *
  * Parameters:
- *  input_buffer: pointer to the input audio data buffer.
- *  aec_buffer: pointer to the AEC reference buffer. If not used, set to NULL.
+ *  stats: filled with the statistics
  *
  * Return:
- *  Returns AE_RSLT_SUCCESS if successful, otherwise returns an error code.
+ *  void
  *
  *******************************************************************************/
-ae_rslt_t audio_enhancement_feed_input(int16_t *input_buffer, int16_t *aec_buffer)
+void audio_enhancement_get_backend_stats(ae_backend_stats_t *stats)
 {
-    cy_rslt_t result = CY_RSLT_SUCCESS;
-
-    result = cy_afe_feed(ae_handle, (int16_t*)input_buffer, (int16_t*)aec_buffer);
-
-    if (CY_RSLT_AFE_FUNCTIONALITY_RESTRICTED == result)
+    if (NULL != stats)
     {
-        return AE_RSLT_LICENSE_ERROR;
-
-    }
-    else if (CY_RSLT_SUCCESS != result)
-    {
-        return AE_RSLT_FAIL;
+        *stats = ae_backend_stats;
     }
+}
 
-    return AE_RSLT_SUCCESS;
+/*******************************************************************************
+ * Function Name: audio_enhancement_reset_backend_stats
+ *******************************************************************************
+ * Summary:
+ * Clears the backend statistics.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ *******************************************************************************/
+void audio_enhancement_reset_backend_stats(void)
+{
+    memset(&ae_backend_stats, 0, sizeof(ae_backend_stats));
+    ae_backend_stats.backend_name = (NULL != ae_backend) ? ae_backend->name : NULL;
 }
 
 /*******************************************************************************
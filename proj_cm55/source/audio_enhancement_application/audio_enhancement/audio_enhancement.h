@@ -47,6 +47,7 @@ extern "C" {
 #include "cy_afe_configurator_settings.h"
 #include "cy_audio_front_end.h"
 #include "cy_audio_front_end_error.h"
+#include "ae_frame_pool.h"
 
 #ifdef COMPONENT_APP_LOGGER
 #include "app_logger.h" 
@@ -59,9 +60,9 @@ extern "C" {
 
 #define NO_OF_CHANNELS_RECEIVED                 (AFE_INPUT_NUMBER_CHANNELS)
 #define NO_OF_BYTES_PER_SAMPLE                  (2)
-#define MONO_AUDIO_DATA_IN_BYTES                (320)
-#define STEREO_AUDIO_DATA_IN_BYTES              (640)
-#define AE_FRAME_BUFFER_MEMORY                  (320)
+#define MONO_AUDIO_DATA_IN_BYTES                (AUDIO_PIPELINE_FRAME_BYTES(1u))
+#define STEREO_AUDIO_DATA_IN_BYTES              (AUDIO_PIPELINE_FRAME_BYTES(2u))
+#define AE_FRAME_BUFFER_MEMORY                  (AUDIO_PIPELINE_FRAME_BYTES(1u))
 
 #ifdef COMPONENT_APP_LOGGER
 #define APP_AE_LOG_ENABLE                       (1)
@@ -133,11 +134,12 @@ typedef struct
  * Function Prototypes
  *******************************************************************************/
 ae_rslt_t audio_enhancement_init(uint8_t num_channels);
-ae_rslt_t audio_enhancement_feed_input(int16_t *input_buffer, 
-                                       int16_t *aec_buffer);
+ae_rslt_t audio_enhancement_deinit(void);
+ae_rslt_t audio_enhancement_feed_input(ae_frame_t *frame);
 void      audio_enhancement_process_output(ae_buffer_info_t *output_buffer);
 #ifdef CY_AFE_ENABLE_TUNING_FEATURE
 ae_rslt_t audio_enhancement_tuner_notify(cy_afe_t handle, cy_afe_config_setting_t *config_setting);
+ae_rslt_t audio_enhancement_tuner_init(void);
 ae_rslt_t audio_enhancement_tuner_read(cy_afe_tuner_buffer_t *buffer);
 ae_rslt_t audio_enhancement_tuner_write(cy_afe_tuner_buffer_t *buffer);
 #endif /* CY_AFE_ENABLE_TUNING_FEATURE */
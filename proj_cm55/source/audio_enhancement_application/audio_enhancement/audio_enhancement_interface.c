@@ -42,15 +42,36 @@
 
 #include "audio_enhancement_interface.h"
 #include "audio_usb_send_utils.h"
+#include "audio_pipeline_config.h"
+#include "deferred_log.h"
+#include "audio_ab_switch.h"
+#include "ae_backend.h"
+#include "ae_pipeline.h"
 
 /*******************************************************************************
 * Macros
 *******************************************************************************/
+/* Crossfade between the raw mics and the AE output when the user button
+ * toggles the AE
+ */
+#ifndef AE_SWITCH_CROSSFADE_MS
+#define AE_SWITCH_CROSSFADE_MS                        (20u)
+#endif /* AE_SWITCH_CROSSFADE_MS */
 
 /*******************************************************************************
 * Global Variables
 *******************************************************************************/
 extern volatile bool ae_toggle_flag;
+
+/* Switch of the USB channels between the raw mics (A) and the AE output (B) */
+static audio_ab_switch_t ae_output_switch;
+
+/* Set while a frame bypasses the AE, its raw mics replace the AE output */
+static bool ae_output_bypass = false;
+
+/* Backend delay last applied to the switch, before clamping */
+static uint32_t ae_output_delay = 0;
+
 /*******************************************************************************
 * Function Name: license_limitation_exit
 ********************************************************************************
@@ -63,12 +84,54 @@ void license_limitation_exit()
     while(1){}
 }
 
+/*******************************************************************************
+ * Function Name: ae_output_update_delay
+ *******************************************************************************
+ * Summary:
+ * Applies the backend delay to the raw side of the switch when it changes:
+ * a reconfigured pipeline may bring a backend with another delay, and a
+ * measured delay becomes known after the first frames. A delay beyond the
+ * switch delay line is clamped and reported once.
+ *
+ * Parameters:
+ *  backend: active backend or NULL
+ *
+ * Return:
+ *  void
+ *
+ *******************************************************************************/
+static void ae_output_update_delay(const ae_backend_t *backend)
+{
+    uint32_t delay_samples = 0;
+
+    if ((NULL != backend) && (NULL != backend->get_delay))
+    {
+        delay_samples = backend->get_delay();
+    }
+    if (delay_samples == ae_output_delay)
+    {
+        return;
+    }
+    ae_output_delay = delay_samples;
+
+    if (delay_samples > AUDIO_AB_SWITCH_MAX_DELAY_SAMPLES)
+    {
+        DEFERRED_LOG("AE delay of %lu samples clamped to %lu", (unsigned long)delay_samples,
+                (unsigned long)AUDIO_AB_SWITCH_MAX_DELAY_SAMPLES);
+        delay_samples = AUDIO_AB_SWITCH_MAX_DELAY_SAMPLES;
+    }
+    (void)audio_ab_switch_set_delay(&ae_output_switch, delay_samples);
+}
+
 /*******************************************************************************
  * Function Name: audio_enhancement_process_output
  *******************************************************************************
  * Summary:
  * Use case API
- * Sends back AE data/tuning data back to PC via USB Audio Class
+ * Sends back AE data/tuning data back to PC via USB Audio Class. The user
+ * button crossfades the USB channels between the AE output and the raw
+ * mics, delayed by the backend delay so that both stay time aligned. One
+ * frame per channel is sent whatever the switch state.
  *
  * Parameters:
  *  output_buffer: pointer to the output audio data buffer.
@@ -80,45 +143,52 @@ void license_limitation_exit()
  
 void audio_enhancement_process_output(ae_buffer_info_t *ae_output_buffer)
 {
-    
-#ifdef AE_FUNCTIONAL_MODE
-    int16_t *output_buffer = (int16_t *)ae_output_buffer->output_buf;
-#endif /*AE_FUNCTIONAL_MODE*/
-
-#ifdef AE_TUNING_MODE
-    char zero_buffer[AE_FRAME_BUFFER_MEMORY] = {0};
-    int16_t *output_dgb1 = (int16_t *)ae_output_buffer->dbg_output1;
-    int16_t *output_dgb2 = (int16_t *)ae_output_buffer->dbg_output2;
-    int16_t *output_dgb3 = (int16_t *)ae_output_buffer->dbg_output3;
-    int16_t *output_dgb4 = (int16_t *)ae_output_buffer->dbg_output4;
-#endif /* AE_TUNING_MODE */
+    const audio_pipeline_config_t *cfg = audio_pipeline_get_config();
+    const ae_backend_t *backend = audio_enhancement_get_backend();
+    const int16_t *raw[USB_OUT_NUM_CHANNELS] = {NULL};
+    const int16_t *processed[USB_OUT_NUM_CHANNELS] = {NULL};
+    const int16_t *output[USB_OUT_NUM_CHANNELS] = {NULL};
+    uint32_t raw_channels = ae_pipeline_get_config()->num_channels;
 
 #if AE_APP_PROFILE
     cy_afe_profile(AFE_PROFILE_CMD_PRINT_STATS_1SEC, NULL);
     cy_afe_profile(AFE_PROFILE_CMD_RESET, NULL);
 #endif /* AE_APP_PROFILE */
-    
-    if (ae_toggle_flag)
-    {
+
 #ifdef AE_FUNCTIONAL_MODE
-        usb_send_out_dbg_put(USB_CHANNEL_1,(int16_t *)output_buffer);
+    processed[0] = ae_output_buffer->output_buf;
 #endif /* AE_FUNCTIONAL_MODE*/
 
 #ifdef AE_TUNING_MODE
-        usb_send_out_dbg_put(USB_CHANNEL_1,(int16_t *)output_dgb1);
-        usb_send_out_dbg_put(USB_CHANNEL_2,(int16_t *)output_dgb2);
-        usb_send_out_dbg_put(USB_CHANNEL_3,(int16_t *)output_dgb3);
-        usb_send_out_dbg_put(USB_CHANNEL_4,(int16_t *)output_dgb4);
+    processed[0] = ae_output_buffer->dbg_output1;
+    processed[1] = ae_output_buffer->dbg_output2;
+    processed[2] = ae_output_buffer->dbg_output3;
+    processed[3] = ae_output_buffer->dbg_output4;
 #endif /* AE_TUNING_MODE */
+
+    /* The mics are monitored on the first channels, the rest is silent */
+    if (NULL != ae_output_buffer->input_buf)
+    {
+        for (uint32_t ch = 0; (ch < raw_channels) && (ch < USB_OUT_NUM_CHANNELS); ch++)
+        {
+            raw[ch] = ae_output_buffer->input_buf + (ch * AE_FRAME_CHANNEL_STRIDE);
+        }
     }
-    else
+
+    ae_output_update_delay(backend);
+
+    /* A frame bypassed by the deadline policy has no AE output. The raw mics
+     * are sent on both sides of the switch, through the same delay line so
+     * that the raw stream stays continuous and aligned.
+     */
+    audio_ab_switch_replace_b(&ae_output_switch, ae_output_bypass);
+    audio_ab_switch_select(&ae_output_switch, ae_toggle_flag);
+    audio_ab_switch_process(&ae_output_switch, raw, processed, output, cfg->samples_per_frame);
+
+    for (unsigned int channel = USB_CHANNEL_1; channel <= USB_OUT_NUM_CHANNELS; channel++)
     {
-#ifdef AE_TUNING_MODE
-        usb_send_out_dbg_put(USB_CHANNEL_2,(int16_t *)zero_buffer);
-        usb_send_out_dbg_put(USB_CHANNEL_3,(int16_t *)zero_buffer);
-        usb_send_out_dbg_put(USB_CHANNEL_4,(int16_t *)zero_buffer);
-#endif /* AE_TUNING_MODE */
-    } 
+        usb_send_out_dbg_put(channel, (int16_t *)output[channel - USB_CHANNEL_1]);
+    }
     return;
 }
 
@@ -142,6 +212,13 @@ int ae_interface_init(int channels)
 
     ae_rslt_t result = AE_RSLT_SUCCESS;
 
+    if (CY_RSLT_SUCCESS != audio_ab_switch_init(&ae_output_switch, USB_OUT_NUM_CHANNELS,
+            AE_SWITCH_CROSSFADE_MS * audio_pipeline_get_config()->samples_per_ms, ae_toggle_flag))
+    {
+        app_log_print("AE output switch initialization failed \r\n");
+    }
+    ae_output_delay = 0;
+
     result = audio_enhancement_init(channels);
     
     if (result != AE_RSLT_SUCCESS) 
@@ -156,6 +233,9 @@ int ae_interface_init(int channels)
     cy_profiler_init();
     cy_afe_profile(AFE_PROFILE_CMD_ENABLE,NULL);
 #endif /* AE_APP_PROFILE */
+#if CY_PROFILER_PROBE_ENABLE
+    cy_profiler_probe_init();
+#endif /* CY_PROFILER_PROBE_ENABLE */
     
     return result;
 }
@@ -164,15 +244,15 @@ int ae_interface_init(int channels)
 * Function Name: ae_interface_feed
 ********************************************************************************
 * Summary:
-*  Feed mic audio data and AEC reference to Audio Enhancement.
+*  Feed a frame of mic audio data and AEC reference to Audio Enhancement.
 *
 *******************************************************************************/
 
-int ae_interface_feed(void* audio_input, void* aec_buffer)
+int ae_interface_feed(ae_frame_t *frame)
 {
     cy_rslt_t result = CY_RSLT_SUCCESS;
 
-    result = audio_enhancement_feed_input((int16_t*)audio_input, (int16_t*)aec_buffer);
+    result = audio_enhancement_feed_input(frame);
     
     if (AE_RSLT_LICENSE_ERROR == result)
     {
@@ -183,9 +263,30 @@ int ae_interface_feed(void* audio_input, void* aec_buffer)
 
     if(AE_RSLT_SUCCESS != result)
     {
-        app_log_print("Failed to feed data to AE \r\n");
+        DEFERRED_LOG("Failed to feed data to AE (%ld)", (long)result);
         return result;
     }
     return result;
 }
+
+/*******************************************************************************
+* Function Name: ae_interface_bypass
+********************************************************************************
+* Summary:
+*  Sends the raw mics of a frame to USB without feeding it to Audio
+*  Enhancement. Used for frames that start behind their deadline.
+*
+*******************************************************************************/
+
+void ae_interface_bypass(ae_frame_t *frame)
+{
+    ae_buffer_info_t bypass_info = {0};
+
+    bypass_info.input_buf = frame->mic;
+    bypass_info.input_aec_ref_buf = frame->aec_reference;
+
+    ae_output_bypass = true;
+    audio_enhancement_process_output(&bypass_info);
+    ae_output_bypass = false;
+}
 /* [] END OF FILE */
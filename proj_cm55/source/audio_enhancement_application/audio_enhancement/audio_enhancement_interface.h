@@ -63,7 +63,8 @@ extern "C" {
  * Function Prototypes
  *******************************************************************************/
 
-int ae_interface_feed(void* audio_input, void* aec_buffer);
+int ae_interface_feed(ae_frame_t *frame);
+void ae_interface_bypass(ae_frame_t *frame);
 int ae_interface_init(int);
 
 #ifdef __cplusplus
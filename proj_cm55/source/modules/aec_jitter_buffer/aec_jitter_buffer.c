@@ -0,0 +1,565 @@
+/******************************************************************************
+* File Name : aec_jitter_buffer.c
+*
+* Description :
+* Adaptive jitter buffer for the AEC reference. The played out reference
+* is kept in a sample accurate delay line read once per pipeline frame.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include <stdbool.h>
+#include "aec_jitter_buffer.h"
+#include "clock_drift.h"
+#include "app_logger.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define AEC_JB_INDEX_MASK                       (AEC_JB_CAPACITY_SAMPLES - 1u)
+
+/* Consecutive empty reads after which playback is considered stopped */
+#define AEC_JB_IDLE_READS                       (50u)
+
+/* Samples needed after the read position by the interpolation */
+#define AEC_JB_INTERP_LOOKAHEAD                 (2u)
+
+#if (0u != (AEC_JB_CAPACITY_SAMPLES & AEC_JB_INDEX_MASK))
+#error "AEC_JB_CAPACITY_SAMPLES must be a power of 2"
+#endif
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Depth observed by the reads of one adaptation window */
+typedef struct
+{
+    uint32_t reads;
+    int32_t  min_depth;
+    int32_t  max_depth;
+    int64_t  total_depth;
+    bool     underrun;
+} aec_jb_window_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Delay line shared between one producer and one consumer. The producer
+ * owns 'write_pos', the consumer owns the read position and statistics.
+ * Positions are free running sample counters.
+ */
+static int16_t aec_jb_samples[AEC_JB_CAPACITY_SAMPLES];
+static volatile uint32_t aec_jb_write_pos = 0;
+static volatile uint32_t aec_jb_flush_request = 0;
+static uint32_t aec_jb_flush_ack = 0;
+
+static uint32_t aec_jb_read_pos = 0;
+static uint32_t aec_jb_idle_pos = 0;
+static uint32_t aec_jb_base = 0;
+static uint32_t aec_jb_empty_reads = 0;
+static int16_t  aec_jb_last_sample = 0;
+static bool     aec_jb_synced = false;
+
+/* Fractional part of the read position and the drift estimation. The
+ * estimator observes the write position against the nominal consumption,
+ * so neither the resampling nor the realignments feed back into it.
+ */
+static float    aec_jb_read_frac = 0.0f;
+static uint32_t aec_jb_drift_origin = 0;
+static uint32_t aec_jb_consumed = 0;
+static clock_drift_estimator_t aec_jb_drift;
+
+static aec_jb_window_t aec_jb_window;
+static aec_jb_stats_t aec_jb_stats;
+
+/*******************************************************************************
+* Function Name: aec_jb_window_reset
+********************************************************************************
+* Summary:
+* Starts a new adaptation window.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+static void aec_jb_window_reset(void)
+{
+    memset(&aec_jb_window, 0, sizeof(aec_jb_window));
+    aec_jb_window.min_depth = INT32_MAX;
+    aec_jb_window.max_depth = INT32_MIN;
+}
+
+/*******************************************************************************
+* Function Name: aec_jb_resync
+********************************************************************************
+* Summary:
+* Places the read position the target depth behind the write position.
+*
+* Parameters:
+*  write_pos - Current write position
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+static void aec_jb_resync(uint32_t write_pos)
+{
+    aec_jb_read_pos = write_pos - (aec_jb_base + aec_jb_stats.margin);
+    aec_jb_read_frac = 0.0f;
+    aec_jb_synced = true;
+    aec_jb_empty_reads = 0;
+    aec_jb_window_reset();
+
+    aec_jb_drift_origin = write_pos;
+    aec_jb_consumed = 0;
+    clock_drift_reset(&aec_jb_drift);
+    aec_jb_stats.drift_ppm = 0.0f;
+}
+
+/*******************************************************************************
+* Function Name: aec_jb_idle
+********************************************************************************
+* Summary:
+* Stops reading until new reference samples are written.
+*
+* Parameters:
+*  write_pos - Current write position
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+static void aec_jb_idle(uint32_t write_pos)
+{
+    aec_jb_synced = false;
+    aec_jb_idle_pos = write_pos;
+    aec_jb_last_sample = 0;
+    aec_jb_stats.margin = AEC_JB_INITIAL_MARGIN_SAMPLES;
+}
+
+/*******************************************************************************
+* Function Name: aec_jb_adapt
+********************************************************************************
+* Summary:
+* Depth control at the end of an adaptation window. The margin follows the
+* peak to peak depth seen by the reads: it grows at once and shrinks by one
+* step per window. The read position is moved when the mean depth drifts
+* away from the target.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+static void aec_jb_adapt(void)
+{
+    uint32_t wanted = 0;
+    int32_t threshold = 0;
+    int32_t mean = 0;
+    int32_t error = 0;
+
+    aec_jb_stats.jitter = (uint32_t)(aec_jb_window.max_depth - aec_jb_window.min_depth);
+
+    wanted = aec_jb_stats.jitter + AEC_JB_MARGIN_STEP_SAMPLES;
+    if (wanted > aec_jb_stats.margin)
+    {
+        aec_jb_stats.margin = wanted;
+    }
+    else if ((!aec_jb_window.underrun) &&
+             (aec_jb_stats.margin >= (wanted + AEC_JB_MARGIN_STEP_SAMPLES)))
+    {
+        aec_jb_stats.margin -= AEC_JB_MARGIN_STEP_SAMPLES;
+    }
+    if (aec_jb_stats.margin > AEC_JB_MAX_MARGIN_SAMPLES)
+    {
+        aec_jb_stats.margin = AEC_JB_MAX_MARGIN_SAMPLES;
+    }
+    aec_jb_stats.target_depth = aec_jb_base + aec_jb_stats.margin;
+
+    /* The mean of a jittery depth wanders, so the tolerance grows with the
+     * margin to avoid needless realignments.
+     */
+    threshold = (int32_t)(AEC_JB_REALIGN_THRESHOLD_SAMPLES + (aec_jb_stats.margin / 2u));
+    mean = (int32_t)(aec_jb_window.total_depth / (int64_t)aec_jb_window.reads);
+    error = mean - (int32_t)aec_jb_stats.target_depth;
+    if ((error > threshold) || (error < -threshold))
+    {
+        aec_jb_read_pos += (uint32_t)error;
+        aec_jb_stats.realignments++;
+    }
+
+    aec_jb_window_reset();
+}
+
+/*******************************************************************************
+* Function Name: aec_jb_interpolate
+********************************************************************************
+* Summary:
+* Reads up to frame_len samples advancing the read position by 'step' per
+* output sample, using Catmull-Rom interpolation between the four samples
+* around each position. Stops when the lookahead is not yet written.
+*
+* Parameters:
+*  reference - Output samples
+*  frame_len - Samples wanted
+*  depth - Samples buffered after the read position
+*  step - Input samples per output sample
+*
+* Return:
+*  Number of samples produced.
+*
+*******************************************************************************/
+static uint32_t aec_jb_interpolate(int16_t *reference, uint32_t frame_len, int32_t depth, float step)
+{
+    uint32_t produced = 0;
+    uint32_t offset = 0;
+    float pos = 0.0f;
+    float x = 0.0f;
+    float s0 = 0.0f;
+    float s1 = 0.0f;
+    float s2 = 0.0f;
+    float s3 = 0.0f;
+    float y = 0.0f;
+
+    for (produced = 0; produced < frame_len; produced++)
+    {
+        pos = aec_jb_read_frac + ((float)produced * step);
+        offset = (uint32_t)pos;
+        if ((int32_t)(offset + AEC_JB_INTERP_LOOKAHEAD) >= depth)
+        {
+            break;
+        }
+        x = pos - (float)offset;
+        offset += aec_jb_read_pos;
+
+        s0 = (float)aec_jb_samples[(offset - 1u) & AEC_JB_INDEX_MASK];
+        s1 = (float)aec_jb_samples[offset & AEC_JB_INDEX_MASK];
+        s2 = (float)aec_jb_samples[(offset + 1u) & AEC_JB_INDEX_MASK];
+        s3 = (float)aec_jb_samples[(offset + 2u) & AEC_JB_INDEX_MASK];
+
+        y = s1 + (0.5f * x * ((s2 - s0) + (x * (((2.0f * s0) - (5.0f * s1) + (4.0f * s2) - s3) +
+                (x * ((3.0f * (s1 - s2)) + s3 - s0))))));
+        if (y > 32767.0f)
+        {
+            y = 32767.0f;
+        }
+        else if (y < -32768.0f)
+        {
+            y = -32768.0f;
+        }
+        reference[produced] = (int16_t)y;
+    }
+
+    pos = aec_jb_read_frac + ((float)produced * step);
+    offset = (uint32_t)pos;
+    aec_jb_read_pos += offset;
+    aec_jb_read_frac = pos - (float)offset;
+
+    return produced;
+}
+
+/*******************************************************************************
+* Function Name: aec_jb_init
+********************************************************************************
+* Summary:
+* Clears the delay line and the statistics.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  CY_RSLT_SUCCESS
+*
+*******************************************************************************/
+cy_rslt_t aec_jb_init(void)
+{
+    memset(aec_jb_samples, 0, sizeof(aec_jb_samples));
+    memset(&aec_jb_stats, 0, sizeof(aec_jb_stats));
+    aec_jb_write_pos = 0;
+    aec_jb_flush_request = 0;
+    aec_jb_flush_ack = 0;
+    clock_drift_init(&aec_jb_drift, CLOCK_DRIFT_DEFAULT_TIME_CONSTANT);
+    aec_jb_idle(0);
+    aec_jb_window_reset();
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: aec_jb_write
+********************************************************************************
+* Summary:
+* Appends one channel of a played out frame to the delay line. Producer side,
+* may be called from ISR context.
+*
+* Parameters:
+*  frame - Interleaved frame
+*  frame_len - Samples per channel
+*  num_channels - Number of interleaved channels
+*  channel - Channel used as AEC reference
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void aec_jb_write(const int16_t *frame, uint32_t frame_len, uint32_t num_channels, uint32_t channel)
+{
+    uint32_t write_pos = aec_jb_write_pos;
+
+    for (uint32_t i = 0; i < frame_len; i++)
+    {
+        aec_jb_samples[(write_pos + i) & AEC_JB_INDEX_MASK] = frame[(i * num_channels) + channel];
+    }
+
+    aec_jb_write_pos = write_pos + frame_len;
+}
+
+/*******************************************************************************
+* Function Name: aec_jb_read
+********************************************************************************
+* Summary:
+* Reads the next reference frame. The read position advances by one frame
+* per call, scaled by the estimated drift between the playback and the mic
+* clocks, so that the reference stays sample aligned with the mic.
+* Missing samples are concealed with a fade to silence and the read position
+* slips by the concealed amount. Consumer side.
+*
+* Parameters:
+*  reference - Filled with frame_len samples
+*  frame_len - Samples per frame
+*  delay_samples - Requested delay of the reference in samples
+*
+* Return:
+*  CY_RSLT_SUCCESS, or AEC_JB_FAILURE while no reference is being played.
+*
+*******************************************************************************/
+cy_rslt_t aec_jb_read(int16_t *reference, uint32_t frame_len, uint32_t delay_samples)
+{
+    uint32_t write_pos = aec_jb_write_pos;
+    uint32_t base = (delay_samples > frame_len) ? delay_samples : frame_len;
+    uint32_t available = 0;
+    uint32_t missing = 0;
+    int32_t depth = 0;
+    float step = 1.0f;
+
+    if (aec_jb_flush_ack != aec_jb_flush_request)
+    {
+        aec_jb_flush_ack = aec_jb_flush_request;
+        aec_jb_idle(write_pos);
+    }
+
+    if (!aec_jb_synced)
+    {
+        if (write_pos == aec_jb_idle_pos)
+        {
+            return AEC_JB_FAILURE;
+        }
+        aec_jb_base = base;
+        aec_jb_resync(write_pos);
+    }
+    else if (base != aec_jb_base)
+    {
+        /* Sub-frame realignment to the new delay */
+        aec_jb_read_pos -= (base - aec_jb_base);
+        aec_jb_base = base;
+        aec_jb_stats.realignments++;
+        aec_jb_window_reset();
+    }
+    aec_jb_stats.target_depth = aec_jb_base + aec_jb_stats.margin;
+
+    depth = (int32_t)(write_pos - aec_jb_read_pos);
+    if (depth > (int32_t)(AEC_JB_CAPACITY_SAMPLES - frame_len))
+    {
+        /* The producer overwrote samples that were not read yet */
+        aec_jb_stats.overruns++;
+        aec_jb_resync(write_pos);
+        depth = (int32_t)(write_pos - aec_jb_read_pos);
+    }
+
+    aec_jb_stats.depth = depth;
+    aec_jb_window.reads++;
+    aec_jb_window.total_depth += depth;
+    if (depth < aec_jb_window.min_depth)
+    {
+        aec_jb_window.min_depth = depth;
+    }
+    if (depth > aec_jb_window.max_depth)
+    {
+        aec_jb_window.max_depth = depth;
+    }
+
+    clock_drift_update(&aec_jb_drift, aec_jb_consumed,
+            (int32_t)(write_pos - aec_jb_drift_origin - aec_jb_consumed));
+    aec_jb_consumed += frame_len;
+    aec_jb_stats.drift_ppm = clock_drift_get_ppm(&aec_jb_drift);
+    if ((aec_jb_stats.drift_ppm > AEC_JB_MIN_DRIFT_PPM) ||
+        (aec_jb_stats.drift_ppm < -AEC_JB_MIN_DRIFT_PPM))
+    {
+        step = 1.0f + (aec_jb_stats.drift_ppm * 1.0e-6f);
+    }
+
+    if ((1.0f != step) || (0.0f != aec_jb_read_frac))
+    {
+        available = aec_jb_interpolate(reference, frame_len, depth, step);
+    }
+    else
+    {
+        if (depth > 0)
+        {
+            available = ((uint32_t)depth < frame_len) ? (uint32_t)depth : frame_len;
+        }
+        for (uint32_t i = 0; i < available; i++)
+        {
+            reference[i] = aec_jb_samples[(aec_jb_read_pos + i) & AEC_JB_INDEX_MASK];
+        }
+        aec_jb_read_pos += available;
+    }
+    if (0u != available)
+    {
+        aec_jb_last_sample = reference[available - 1u];
+        aec_jb_empty_reads = 0;
+    }
+
+    missing = frame_len - available;
+    if (0u != missing)
+    {
+        for (uint32_t i = 0; i < missing; i++)
+        {
+            reference[available + i] = (i < AEC_JB_FADE_SAMPLES) ?
+                    (int16_t)(((int32_t)aec_jb_last_sample * (int32_t)(AEC_JB_FADE_SAMPLES - i)) / (int32_t)AEC_JB_FADE_SAMPLES) : 0;
+        }
+        aec_jb_last_sample = 0;
+        aec_jb_stats.underruns++;
+        aec_jb_stats.concealed_samples += missing;
+        aec_jb_window.underrun = true;
+
+        /* Raise the margin by the shortfall right away */
+        aec_jb_stats.margin += ((missing + AEC_JB_MARGIN_STEP_SAMPLES - 1u) /
+                AEC_JB_MARGIN_STEP_SAMPLES) * AEC_JB_MARGIN_STEP_SAMPLES;
+        if (aec_jb_stats.margin > AEC_JB_MAX_MARGIN_SAMPLES)
+        {
+            aec_jb_stats.margin = AEC_JB_MAX_MARGIN_SAMPLES;
+        }
+
+        if (0u == available)
+        {
+            aec_jb_empty_reads++;
+            if (AEC_JB_IDLE_READS <= aec_jb_empty_reads)
+            {
+                aec_jb_idle(write_pos);
+            }
+        }
+    }
+
+    aec_jb_stats.reads++;
+    if (AEC_JB_ADAPT_WINDOW_READS <= aec_jb_window.reads)
+    {
+        aec_jb_adapt();
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: aec_jb_flush
+********************************************************************************
+* Summary:
+* Requests the consumer to drop the buffered reference and to wait for new
+* samples. Safe to call from any context.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void aec_jb_flush(void)
+{
+    aec_jb_flush_request++;
+}
+
+/*******************************************************************************
+* Function Name: aec_jb_get_stats
+********************************************************************************
+* Summary:
+* Returns the depth and the underrun and realignment counters.
+*
+* Parameters:
+*  stats - Filled with the statistics
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void aec_jb_get_stats(aec_jb_stats_t *stats)
+{
+    *stats = aec_jb_stats;
+}
+
+/*******************************************************************************
+* Function Name: aec_jb_print_stats
+********************************************************************************
+* Summary:
+* Prints the jitter buffer statistics.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void aec_jb_print_stats(void)
+{
+    aec_jb_stats_t stats;
+
+    aec_jb_get_stats(&stats);
+    app_log_print("AEC ref: depth %ld target %lu margin %lu jitter %lu underruns %lu "
+            "concealed %lu overruns %lu realign %lu drift %.1f ppm \r\n",
+            (long)stats.depth, (unsigned long)stats.target_depth,
+            (unsigned long)stats.margin, (unsigned long)stats.jitter,
+            (unsigned long)stats.underruns, (unsigned long)stats.concealed_samples,
+            (unsigned long)stats.overruns, (unsigned long)stats.realignments,
+            (double)stats.drift_ppm);
+}
+
+/* [] END OF FILE */
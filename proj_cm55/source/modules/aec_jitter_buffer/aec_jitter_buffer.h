@@ -0,0 +1,119 @@
+/******************************************************************************
+* File Name : aec_jitter_buffer.h
+*
+* Description :
+* Adaptive jitter buffer for the AEC reference. The played out reference
+* is kept in a sample accurate delay line read once per pipeline frame.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __AEC_JITTER_BUFFER_H__
+#define __AEC_JITTER_BUFFER_H__
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include "cy_result.h"
+#include "audio_pipeline_config.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Capacity of the delay line in samples. Must be a power of 2 and hold the
+ * largest bulk delay (255 ms) plus the jitter margin.
+ */
+#define AEC_JB_CAPACITY_SAMPLES                 (8192u)
+
+/* Margin kept on top of the requested delay to absorb arrival jitter */
+#define AEC_JB_INITIAL_MARGIN_SAMPLES           (2u * AUDIO_PIPELINE_SAMPLES_PER_MS)
+#define AEC_JB_MAX_MARGIN_SAMPLES               (8u * AUDIO_PIPELINE_SAMPLES_PER_FRAME)
+#define AEC_JB_MARGIN_STEP_SAMPLES              (AUDIO_PIPELINE_SAMPLES_PER_MS)
+
+/* Number of reads between two depth control decisions */
+#define AEC_JB_ADAPT_WINDOW_READS               (200u)
+
+/* Deviation of the mean depth from the target that triggers a realignment,
+ * on top of half the margin
+ */
+#define AEC_JB_REALIGN_THRESHOLD_SAMPLES        (2u * AUDIO_PIPELINE_SAMPLES_PER_MS)
+
+/* Drift below which the reference is copied without resampling */
+#define AEC_JB_MIN_DRIFT_PPM                    (1.0f)
+
+/* Length of the fade to silence used to conceal an underrun */
+#define AEC_JB_FADE_SAMPLES                     (16u)
+
+#define AEC_JB_FAILURE                          (-1)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    int32_t  depth;                     /* Samples buffered at the last read */
+    uint32_t target_depth;              /* Requested delay plus margin */
+    uint32_t margin;                    /* Current jitter margin in samples */
+    uint32_t jitter;                    /* Peak to peak depth over the last window */
+    uint32_t reads;                     /* Frames read */
+    uint32_t underruns;                 /* Reads that had to be concealed */
+    uint32_t concealed_samples;         /* Samples replaced by the concealment */
+    uint32_t overruns;                  /* Resyncs because unread data was overwritten */
+    uint32_t realignments;              /* Read position adjustments */
+    float    drift_ppm;                 /* Playback clock relative to the mic clock */
+} aec_jb_stats_t;
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
+cy_rslt_t aec_jb_init(void);
+
+/* Producer (playback) side */
+void aec_jb_write(const int16_t *frame, uint32_t frame_len, uint32_t num_channels, uint32_t channel);
+
+/* Consumer (AE feed) side */
+cy_rslt_t aec_jb_read(int16_t *reference, uint32_t frame_len, uint32_t delay_samples);
+
+/* Any context */
+void aec_jb_flush(void);
+void aec_jb_get_stats(aec_jb_stats_t *stats);
+void aec_jb_print_stats(void);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* __AEC_JITTER_BUFFER_H__ */
+
+/* [] END OF FILE */
@@ -0,0 +1,285 @@
+/******************************************************************************
+* File Name : audio_ab_switch.c
+*
+* Description :
+* A/B switch stage. Crossfades linearly between two time aligned
+* multi-channel streams over a fixed window. The A stream passes a delay
+* line to compensate the delay of the B stream, e.g. raw mics against the
+* output of the audio enhancement.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "audio_ab_switch.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Gain format Q1.15, the crossfade weights sum to one */
+#define AUDIO_AB_SWITCH_GAIN_SHIFT              (15u)
+#define AUDIO_AB_SWITCH_GAIN_ONE                (1 << AUDIO_AB_SWITCH_GAIN_SHIFT)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Stands in for a missing stream, shared by all switches */
+static const int16_t audio_ab_switch_silence[AUDIO_AB_SWITCH_MAX_FRAME_SAMPLES] = {0};
+
+/*******************************************************************************
+* Function Name: audio_ab_switch_init
+********************************************************************************
+* Summary:
+* Initializes a switch without delay, settled on the selected stream.
+*
+* Parameters:
+*  ab_switch - Switch state
+*  num_channels - Number of channels of each stream
+*  fade_samples - Length of the crossfade in samples, at least 1
+*  select_b - Start on the B stream
+*
+* Return:
+*  CY_RSLT_SUCCESS on success, AUDIO_AB_SWITCH_FAILURE otherwise.
+*
+*******************************************************************************/
+cy_rslt_t audio_ab_switch_init(audio_ab_switch_t *ab_switch, uint32_t num_channels,
+        uint32_t fade_samples, bool select_b)
+{
+    if ((NULL == ab_switch) || (0u == num_channels) ||
+        (num_channels > AUDIO_AB_SWITCH_MAX_CHANNELS) || (0u == fade_samples))
+    {
+        return AUDIO_AB_SWITCH_FAILURE;
+    }
+
+    memset(ab_switch, 0, sizeof(*ab_switch));
+    ab_switch->num_channels = num_channels;
+    ab_switch->fade_samples = fade_samples;
+    ab_switch->fade_recip_q31 = (uint32_t)((1ull << 31) / fade_samples);
+    ab_switch->select_b = select_b;
+    ab_switch->fade_pos = select_b ? fade_samples : 0u;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: audio_ab_switch_set_delay
+********************************************************************************
+* Summary:
+* Sets the delay of the A stream. The delay line restarts with silence.
+*
+* Parameters:
+*  ab_switch - Switch state
+*  delay_samples - Delay in samples
+*
+* Return:
+*  CY_RSLT_SUCCESS on success, AUDIO_AB_SWITCH_FAILURE otherwise.
+*
+*******************************************************************************/
+cy_rslt_t audio_ab_switch_set_delay(audio_ab_switch_t *ab_switch, uint32_t delay_samples)
+{
+    if (delay_samples > AUDIO_AB_SWITCH_MAX_DELAY_SAMPLES)
+    {
+        return AUDIO_AB_SWITCH_FAILURE;
+    }
+
+    memset(ab_switch->delay_line, 0, sizeof(ab_switch->delay_line));
+    ab_switch->delay_samples = delay_samples;
+    ab_switch->delay_pos = 0;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: audio_ab_switch_select
+********************************************************************************
+* Summary:
+* Selects the stream to fade to. A switch requested during a crossfade
+* reverses it from the current gain.
+*
+* Parameters:
+*  ab_switch - Switch state
+*  select_b - Fade to the B stream
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void audio_ab_switch_select(audio_ab_switch_t *ab_switch, bool select_b)
+{
+    ab_switch->select_b = select_b;
+}
+
+/*******************************************************************************
+* Function Name: audio_ab_switch_replace_b
+********************************************************************************
+* Summary:
+* Replaces the B stream with the delayed A stream, for frames that have no
+* B stream. Both sides of the switch then carry A through its delay line, so
+* A stays continuous and aligned whichever stream is selected.
+*
+* Parameters:
+*  ab_switch - Switch state
+*  replace_b - Take B from the delayed A stream until cleared
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void audio_ab_switch_replace_b(audio_ab_switch_t *ab_switch, bool replace_b)
+{
+    ab_switch->replace_b = replace_b;
+}
+
+/*******************************************************************************
+* Function Name: audio_ab_switch_delay
+********************************************************************************
+* Summary:
+* Passes one channel through its delay line.
+*
+*******************************************************************************/
+static void audio_ab_switch_delay(int16_t *line, uint32_t delay, uint32_t pos,
+        const int16_t *in, int16_t *out, uint32_t samples)
+{
+    for (uint32_t i = 0; i < samples; i++)
+    {
+        out[i] = line[pos];
+        line[pos] = in[i];
+        pos++;
+        if (delay == pos)
+        {
+            pos = 0;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: audio_ab_switch_process
+********************************************************************************
+* Summary:
+* Switches one frame. Settled on a stream the output points to the B input
+* or to the delayed A stream, only a crossfade mixes the two. A NULL input
+* channel is taken as silence. The B input is ignored while it is replaced.
+*
+* Parameters:
+*  ab_switch - Switch state
+*  a - num_channels pointers to the A stream, entries may be NULL
+*  b - num_channels pointers to the B stream, entries may be NULL
+*  out - Receives num_channels pointers to the output, valid until the
+*        next call
+*  samples - Samples per channel, up to AUDIO_AB_SWITCH_MAX_FRAME_SAMPLES
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void audio_ab_switch_process(audio_ab_switch_t *ab_switch, const int16_t *const *a,
+        const int16_t *const *b, const int16_t **out, uint32_t samples)
+{
+    const uint32_t target = ab_switch->select_b ? ab_switch->fade_samples : 0u;
+    const int16_t *in_a = NULL;
+    const int16_t *in_b = NULL;
+    int16_t *mix = NULL;
+    uint32_t pos = 0;
+    int32_t gain = 0;
+
+    if (samples > AUDIO_AB_SWITCH_MAX_FRAME_SAMPLES)
+    {
+        samples = AUDIO_AB_SWITCH_MAX_FRAME_SAMPLES;
+    }
+
+    for (uint32_t ch = 0; ch < ab_switch->num_channels; ch++)
+    {
+        in_a = (NULL != a[ch]) ? a[ch] : audio_ab_switch_silence;
+        in_b = (NULL != b[ch]) ? b[ch] : audio_ab_switch_silence;
+        mix = ab_switch->output[ch];
+
+        /* The delay line runs on both sides of the switch to stay aligned */
+        if (0u != ab_switch->delay_samples)
+        {
+            audio_ab_switch_delay(ab_switch->delay_line[ch], ab_switch->delay_samples,
+                    ab_switch->delay_pos, in_a, mix, samples);
+            in_a = mix;
+        }
+
+        if (ab_switch->replace_b)
+        {
+            in_b = in_a;
+        }
+
+        if (ab_switch->fade_pos == target)
+        {
+            out[ch] = ab_switch->select_b ? in_b : in_a;
+            continue;
+        }
+
+        pos = ab_switch->fade_pos;
+        for (uint32_t i = 0; i < samples; i++)
+        {
+            if (pos < target)
+            {
+                pos++;
+            }
+            else if (pos > target)
+            {
+                pos--;
+            }
+            /* pos / fade_samples from Q31 to the Q15 gain */
+            gain = (int32_t)(((uint64_t)pos * ab_switch->fade_recip_q31) >> (31u - AUDIO_AB_SWITCH_GAIN_SHIFT));
+            mix[i] = (int16_t)((((int32_t)in_a[i] * (AUDIO_AB_SWITCH_GAIN_ONE - gain)) +
+                                ((int32_t)in_b[i] * gain) + (1 << (AUDIO_AB_SWITCH_GAIN_SHIFT - 1u)))
+                               >> AUDIO_AB_SWITCH_GAIN_SHIFT);
+        }
+        out[ch] = mix;
+    }
+
+    if (0u != ab_switch->delay_samples)
+    {
+        ab_switch->delay_pos = (ab_switch->delay_pos + samples) % ab_switch->delay_samples;
+    }
+
+    /* All channels share the gain ramp */
+    if (ab_switch->fade_pos < target)
+    {
+        ab_switch->fade_pos = ((target - ab_switch->fade_pos) > samples) ?
+                (ab_switch->fade_pos + samples) : target;
+    }
+    else if (ab_switch->fade_pos > target)
+    {
+        ab_switch->fade_pos = ((ab_switch->fade_pos - target) > samples) ?
+                (ab_switch->fade_pos - samples) : target;
+    }
+}
+
+/* [] END OF FILE */
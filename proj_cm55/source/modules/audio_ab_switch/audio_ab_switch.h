@@ -0,0 +1,103 @@
+/******************************************************************************
+* File Name : audio_ab_switch.h
+*
+* Description :
+* Header file of the A/B switch stage. Crossfades between two time aligned
+* multi-channel streams, the A stream is delayed to match the B stream.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __AUDIO_AB_SWITCH_H__
+#define __AUDIO_AB_SWITCH_H__
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_result.h"
+#include "audio_pipeline_config.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Largest number of channels switched together */
+#define AUDIO_AB_SWITCH_MAX_CHANNELS            (4u)
+
+/* Largest delay of the A stream, 32 msec at 16 kHz */
+#define AUDIO_AB_SWITCH_MAX_DELAY_SAMPLES       (512u)
+
+/* Largest number of samples per channel processed per call */
+#define AUDIO_AB_SWITCH_MAX_FRAME_SAMPLES       (AUDIO_PIPELINE_SAMPLES_PER_FRAME)
+
+#define AUDIO_AB_SWITCH_FAILURE                 (-1)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Switch state. fade_pos runs from 0 (A only) to fade_samples (B only), the
+ * gain of B is fade_pos / fade_samples.
+ */
+typedef struct
+{
+    uint32_t num_channels;
+    uint32_t fade_samples;
+    uint32_t fade_recip_q31;            /* 1 / fade_samples in Q31 */
+    uint32_t fade_pos;
+    bool     select_b;
+    bool     replace_b;                 /* B is taken from the delayed A stream */
+    uint32_t delay_samples;
+    uint32_t delay_pos;
+    int16_t  delay_line[AUDIO_AB_SWITCH_MAX_CHANNELS][AUDIO_AB_SWITCH_MAX_DELAY_SAMPLES];
+    int16_t  output[AUDIO_AB_SWITCH_MAX_CHANNELS][AUDIO_AB_SWITCH_MAX_FRAME_SAMPLES];
+} audio_ab_switch_t;
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
+cy_rslt_t audio_ab_switch_init(audio_ab_switch_t *ab_switch, uint32_t num_channels,
+        uint32_t fade_samples, bool select_b);
+cy_rslt_t audio_ab_switch_set_delay(audio_ab_switch_t *ab_switch, uint32_t delay_samples);
+void      audio_ab_switch_select(audio_ab_switch_t *ab_switch, bool select_b);
+void      audio_ab_switch_replace_b(audio_ab_switch_t *ab_switch, bool replace_b);
+void      audio_ab_switch_process(audio_ab_switch_t *ab_switch, const int16_t *const *a,
+        const int16_t *const *b, const int16_t **out, uint32_t samples);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* __AUDIO_AB_SWITCH_H__ */
+
+/* [] END OF FILE */
@@ -39,22 +39,605 @@
 /*******************************************************************************
 * Header Files
 *******************************************************************************/
+#include <string.h>
 #include "cy_pdl.h"
 #include "cycfg.h"
 #include "cy_pdl.h"
 #include "cy_log.h"
+#include "audio_conv_utils.h"
+
+#if AUDIO_CONV_USE_MVE
+#include <arm_mve.h>
+#endif /* AUDIO_CONV_USE_MVE */
 
 
 /*******************************************************************************
 * Macros
 *******************************************************************************/
-#define MAX_AUD_SAMPLES_PER_CHANNEL_FOR_10MS_DATA (160)
+/* Samples per channel of the fixed size converters */
+#define AUDIO_CONV_FRAME_SAMPLES                  (AUDIO_PIPELINE_SAMPLES_PER_FRAME)
+
+#if AUDIO_CONV_USE_MVE
+/* Number of 16-bit lanes in an MVE vector */
+#define AUDIO_CONV_MVE_LANES                      (8u)
+
+/* The vector kernels process whole vectors only */
+#define AUDIO_CONV_MVE_LEN_OK(frame_len)          (0u == ((frame_len) % AUDIO_CONV_MVE_LANES))
+
+#if (AUDIO_CONV_FRAME_SAMPLES % AUDIO_CONV_MVE_LANES) == 0
+#define AUDIO_CONV_FIXED_USE_MVE                  (1)
+#else
+#define AUDIO_CONV_FIXED_USE_MVE                  (0)
+#endif
+#else
+#define AUDIO_CONV_FIXED_USE_MVE                  (0)
+#endif /* AUDIO_CONV_USE_MVE */
 
 /*******************************************************************************
-* Function Name: convert_stereo_non_interleaved_to_stereo_interleaved
+* Function Name: audio_conv_deinterleave_scalar
+********************************************************************************
+* Summary:
+* Splits interleaved samples into channel planes.
+*
+* Parameters:
+*  interleaved - (In) interleaved data
+*  planar - (Out) channel planes, planar_stride samples apart
+*  frame_len - Samples per channel
+*  num_channels - Number of channels
+*  planar_stride - Distance in samples between two channel planes
+* Return:
+*  None
+*
+*******************************************************************************/
+static inline void audio_conv_deinterleave_scalar(const uint16_t *interleaved,
+        uint16_t *planar, uint32_t frame_len, uint32_t num_channels,
+        uint32_t planar_stride)
+{
+    uint32_t i = 0;
+    uint32_t ch = 0;
+
+    for (i = 0; i < frame_len; i++)
+    {
+        for (ch = 0; ch < num_channels; ch++)
+        {
+            planar[(ch * planar_stride) + i] = *interleaved++;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: audio_conv_interleave_scalar
+********************************************************************************
+* Summary:
+* Merges channel planes into interleaved samples.
+*
+* Parameters:
+*  planar - (In) channel planes, planar_stride samples apart
+*  interleaved - (Out) interleaved data
+*  frame_len - Samples per channel
+*  num_channels - Number of channels
+*  planar_stride - Distance in samples between two channel planes
+* Return:
+*  None
+*
+*******************************************************************************/
+static inline void audio_conv_interleave_scalar(const uint16_t *planar,
+        uint16_t *interleaved, uint32_t frame_len, uint32_t num_channels,
+        uint32_t planar_stride)
+{
+    uint32_t i = 0;
+    uint32_t ch = 0;
+
+    for (i = 0; i < frame_len; i++)
+    {
+        for (ch = 0; ch < num_channels; ch++)
+        {
+            *interleaved++ = planar[(ch * planar_stride) + i];
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: audio_conv_extract_channel_scalar
+********************************************************************************
+* Summary:
+* Copies one channel of interleaved samples into a mono buffer.
+*
+* Parameters:
+*  interleaved - (In) interleaved data
+*  mono - (Out) mono data
+*  frame_len - Samples per channel
+*  num_channels - Number of interleaved channels
+*  channel - Index of the channel to extract
+* Return:
+*  None
+*
+*******************************************************************************/
+static inline void audio_conv_extract_channel_scalar(const uint16_t *interleaved,
+        uint16_t *mono, uint32_t frame_len, uint32_t num_channels, uint32_t channel)
+{
+    uint32_t i = 0;
+
+    interleaved += channel;
+    for (i = 0; i < frame_len; i++)
+    {
+        *mono++ = *interleaved;
+        interleaved += num_channels;
+    }
+}
+
+/*******************************************************************************
+* Function Name: audio_conv_replicate_scalar
+********************************************************************************
+* Summary:
+* Copies a mono buffer into every channel of an interleaved buffer.
+*
+* Parameters:
+*  mono - (In) mono data
+*  interleaved - (Out) interleaved data
+*  frame_len - Samples per channel
+*  num_channels - Number of interleaved channels
+* Return:
+*  None
+*
+*******************************************************************************/
+static inline void audio_conv_replicate_scalar(const uint16_t *mono,
+        uint16_t *interleaved, uint32_t frame_len, uint32_t num_channels)
+{
+    uint32_t i = 0;
+    uint32_t ch = 0;
+
+    for (i = 0; i < frame_len; i++)
+    {
+        for (ch = 0; ch < num_channels; ch++)
+        {
+            *interleaved++ = *mono;
+        }
+        mono++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: audio_conv_interleave_planes_scalar
+********************************************************************************
+* Summary:
+* Merges separately stored channel planes into interleaved samples.
+*
+* Parameters:
+*  planes - (In) one pointer per channel
+*  interleaved - (Out) interleaved data
+*  frame_len - Samples per channel
+*  num_channels - Number of channels
+* Return:
+*  None
+*
+*******************************************************************************/
+static inline void audio_conv_interleave_planes_scalar(const uint16_t *const *planes,
+        uint16_t *interleaved, uint32_t frame_len, uint32_t num_channels)
+{
+    const uint16_t *src = NULL;
+    uint16_t *dst = NULL;
+    uint32_t i = 0;
+    uint32_t ch = 0;
+
+    /* Fixed width loops for the common layouts, the compiler unrolls these */
+    if (2u == num_channels)
+    {
+        const uint16_t *ch0 = planes[0];
+        const uint16_t *ch1 = planes[1];
+
+        for (i = 0; i < frame_len; i++)
+        {
+            *interleaved++ = ch0[i];
+            *interleaved++ = ch1[i];
+        }
+        return;
+    }
+    if (4u == num_channels)
+    {
+        const uint16_t *ch0 = planes[0];
+        const uint16_t *ch1 = planes[1];
+        const uint16_t *ch2 = planes[2];
+        const uint16_t *ch3 = planes[3];
+
+        for (i = 0; i < frame_len; i++)
+        {
+            *interleaved++ = ch0[i];
+            *interleaved++ = ch1[i];
+            *interleaved++ = ch2[i];
+            *interleaved++ = ch3[i];
+        }
+        return;
+    }
+
+    for (ch = 0; ch < num_channels; ch++)
+    {
+        src = planes[ch];
+        dst = interleaved + ch;
+        for (i = 0; i < frame_len; i++)
+        {
+            *dst = src[i];
+            dst += num_channels;
+        }
+    }
+}
+
+#if AUDIO_CONV_USE_MVE
+/*******************************************************************************
+* Function Name: audio_conv_deinterleave_2ch_mve
+********************************************************************************
+* Summary:
+* Stereo de-interleave using MVE VLD2, 8 samples per channel per iteration.
+* frame_len must be a multiple of AUDIO_CONV_MVE_LANES.
+*
+*******************************************************************************/
+static inline void audio_conv_deinterleave_2ch_mve(const uint16_t *interleaved,
+        uint16_t *planar, uint32_t frame_len, uint32_t planar_stride)
+{
+    uint16x8x2_t samples;
+    uint32_t i = 0;
+
+    for (i = 0; i < frame_len; i += AUDIO_CONV_MVE_LANES)
+    {
+        samples = vld2q_u16(interleaved + (2u * i));
+        vst1q_u16(planar + i, samples.val[0]);
+        vst1q_u16(planar + planar_stride + i, samples.val[1]);
+    }
+}
+
+/*******************************************************************************
+* Function Name: audio_conv_interleave_2ch_mve
+********************************************************************************
+* Summary:
+* Stereo interleave using MVE VST2, 8 samples per channel per iteration.
+* frame_len must be a multiple of AUDIO_CONV_MVE_LANES.
+*
+*******************************************************************************/
+static inline void audio_conv_interleave_2ch_mve(const uint16_t *planar,
+        uint16_t *interleaved, uint32_t frame_len, uint32_t planar_stride)
+{
+    uint16x8x2_t samples;
+    uint32_t i = 0;
+
+    for (i = 0; i < frame_len; i += AUDIO_CONV_MVE_LANES)
+    {
+        samples.val[0] = vld1q_u16(planar + i);
+        samples.val[1] = vld1q_u16(planar + planar_stride + i);
+        vst2q_u16(interleaved + (2u * i), samples);
+    }
+}
+
+/*******************************************************************************
+* Function Name: audio_conv_deinterleave_4ch_mve
+********************************************************************************
+* Summary:
+* Quad de-interleave using MVE VLD4, 8 samples per channel per iteration.
+* frame_len must be a multiple of AUDIO_CONV_MVE_LANES.
+*
+*******************************************************************************/
+static inline void audio_conv_deinterleave_4ch_mve(const uint16_t *interleaved,
+        uint16_t *planar, uint32_t frame_len, uint32_t planar_stride)
+{
+    uint16x8x4_t samples;
+    uint32_t i = 0;
+
+    for (i = 0; i < frame_len; i += AUDIO_CONV_MVE_LANES)
+    {
+        samples = vld4q_u16(interleaved + (4u * i));
+        vst1q_u16(planar + i, samples.val[0]);
+        vst1q_u16(planar + planar_stride + i, samples.val[1]);
+        vst1q_u16(planar + (2u * planar_stride) + i, samples.val[2]);
+        vst1q_u16(planar + (3u * planar_stride) + i, samples.val[3]);
+    }
+}
+
+/*******************************************************************************
+* Function Name: audio_conv_interleave_4ch_mve
+********************************************************************************
+* Summary:
+* Quad interleave using MVE VST4, 8 samples per channel per iteration.
+* frame_len must be a multiple of AUDIO_CONV_MVE_LANES.
+*
+*******************************************************************************/
+static inline void audio_conv_interleave_4ch_mve(const uint16_t *planar,
+        uint16_t *interleaved, uint32_t frame_len, uint32_t planar_stride)
+{
+    uint16x8x4_t samples;
+    uint32_t i = 0;
+
+    for (i = 0; i < frame_len; i += AUDIO_CONV_MVE_LANES)
+    {
+        samples.val[0] = vld1q_u16(planar + i);
+        samples.val[1] = vld1q_u16(planar + planar_stride + i);
+        samples.val[2] = vld1q_u16(planar + (2u * planar_stride) + i);
+        samples.val[3] = vld1q_u16(planar + (3u * planar_stride) + i);
+        vst4q_u16(interleaved + (4u * i), samples);
+    }
+}
+
+/*******************************************************************************
+* Function Name: audio_conv_extract_channel_2ch_mve
+********************************************************************************
+* Summary:
+* Extracts one channel of stereo interleaved samples using MVE VLD2.
+* frame_len must be a multiple of AUDIO_CONV_MVE_LANES.
+*
+*******************************************************************************/
+static inline void audio_conv_extract_channel_2ch_mve(const uint16_t *interleaved,
+        uint16_t *mono, uint32_t frame_len, uint32_t channel)
+{
+    uint16x8x2_t samples;
+    uint32_t i = 0;
+
+    for (i = 0; i < frame_len; i += AUDIO_CONV_MVE_LANES)
+    {
+        samples = vld2q_u16(interleaved + (2u * i));
+        vst1q_u16(mono + i, samples.val[channel]);
+    }
+}
+
+/*******************************************************************************
+* Function Name: audio_conv_replicate_2ch_mve
+********************************************************************************
+* Summary:
+* Copies a mono buffer into both channels of a stereo interleaved buffer
+* using MVE VST2. frame_len must be a multiple of AUDIO_CONV_MVE_LANES.
+*
+*******************************************************************************/
+static inline void audio_conv_replicate_2ch_mve(const uint16_t *mono,
+        uint16_t *interleaved, uint32_t frame_len)
+{
+    uint16x8x2_t samples;
+    uint32_t i = 0;
+
+    for (i = 0; i < frame_len; i += AUDIO_CONV_MVE_LANES)
+    {
+        samples.val[0] = vld1q_u16(mono + i);
+        samples.val[1] = samples.val[0];
+        vst2q_u16(interleaved + (2u * i), samples);
+    }
+}
+
+/*******************************************************************************
+* Function Name: audio_conv_interleave_planes_2ch_mve
+********************************************************************************
+* Summary:
+* Stereo interleave of two separate planes using MVE VST2, 8 samples per
+* channel per iteration. frame_len must be a multiple of AUDIO_CONV_MVE_LANES.
+*
+*******************************************************************************/
+static inline void audio_conv_interleave_planes_2ch_mve(const uint16_t *const *planes,
+        uint16_t *interleaved, uint32_t frame_len)
+{
+    uint16x8x2_t samples;
+    uint32_t i = 0;
+
+    for (i = 0; i < frame_len; i += AUDIO_CONV_MVE_LANES)
+    {
+        samples.val[0] = vld1q_u16(planes[0] + i);
+        samples.val[1] = vld1q_u16(planes[1] + i);
+        vst2q_u16(interleaved + (2u * i), samples);
+    }
+}
+
+/*******************************************************************************
+* Function Name: audio_conv_interleave_planes_4ch_mve
+********************************************************************************
+* Summary:
+* Quad interleave of four separate planes using MVE VST4, 8 samples per
+* channel per iteration. frame_len must be a multiple of AUDIO_CONV_MVE_LANES.
+*
+*******************************************************************************/
+static inline void audio_conv_interleave_planes_4ch_mve(const uint16_t *const *planes,
+        uint16_t *interleaved, uint32_t frame_len)
+{
+    uint16x8x4_t samples;
+    uint32_t i = 0;
+
+    for (i = 0; i < frame_len; i += AUDIO_CONV_MVE_LANES)
+    {
+        samples.val[0] = vld1q_u16(planes[0] + i);
+        samples.val[1] = vld1q_u16(planes[1] + i);
+        samples.val[2] = vld1q_u16(planes[2] + i);
+        samples.val[3] = vld1q_u16(planes[3] + i);
+        vst4q_u16(interleaved + (4u * i), samples);
+    }
+}
+#endif /* AUDIO_CONV_USE_MVE */
+
+/*******************************************************************************
+* Function Name: audio_conv_deinterleave
+********************************************************************************
+* Summary:
+* Splits interleaved samples into channel planes. Stereo and quad frames use
+* the MVE kernels when available.
+*
+* Parameters:
+*  interleaved - (In) interleaved data
+*  planar - (Out) channel planes, planar_stride samples apart
+*  frame_len - Samples per channel
+*  num_channels - Number of channels
+*  planar_stride - Distance in samples between two channel planes
+* Return:
+*  None
+*
+*******************************************************************************/
+void audio_conv_deinterleave(const uint16_t *interleaved, uint16_t *planar,
+        uint32_t frame_len, uint32_t num_channels, uint32_t planar_stride)
+{
+#if AUDIO_CONV_USE_MVE
+    if (AUDIO_CONV_MVE_LEN_OK(frame_len))
+    {
+        if (2u == num_channels)
+        {
+            audio_conv_deinterleave_2ch_mve(interleaved, planar, frame_len, planar_stride);
+            return;
+        }
+        if (4u == num_channels)
+        {
+            audio_conv_deinterleave_4ch_mve(interleaved, planar, frame_len, planar_stride);
+            return;
+        }
+    }
+#endif /* AUDIO_CONV_USE_MVE */
+    audio_conv_deinterleave_scalar(interleaved, planar, frame_len, num_channels, planar_stride);
+}
+
+/*******************************************************************************
+* Function Name: audio_conv_interleave
+********************************************************************************
+* Summary:
+* Merges channel planes into interleaved samples. Stereo and quad frames use
+* the MVE kernels when available.
+*
+* Parameters:
+*  planar - (In) channel planes, planar_stride samples apart
+*  interleaved - (Out) interleaved data
+*  frame_len - Samples per channel
+*  num_channels - Number of channels
+*  planar_stride - Distance in samples between two channel planes
+* Return:
+*  None
+*
+*******************************************************************************/
+void audio_conv_interleave(const uint16_t *planar, uint16_t *interleaved,
+        uint32_t frame_len, uint32_t num_channels, uint32_t planar_stride)
+{
+#if AUDIO_CONV_USE_MVE
+    if (AUDIO_CONV_MVE_LEN_OK(frame_len))
+    {
+        if (2u == num_channels)
+        {
+            audio_conv_interleave_2ch_mve(planar, interleaved, frame_len, planar_stride);
+            return;
+        }
+        if (4u == num_channels)
+        {
+            audio_conv_interleave_4ch_mve(planar, interleaved, frame_len, planar_stride);
+            return;
+        }
+    }
+#endif /* AUDIO_CONV_USE_MVE */
+    audio_conv_interleave_scalar(planar, interleaved, frame_len, num_channels, planar_stride);
+}
+
+/*******************************************************************************
+* Function Name: audio_conv_interleave_planes
+********************************************************************************
+* Summary:
+* Merges separately stored channel planes, for example frames of different
+* rings, into interleaved samples. Stereo and quad use the MVE kernels for
+* the largest multiple of AUDIO_CONV_MVE_LANES samples and the scalar loop
+* for the rest, so any frame_len is accepted. Planes only need 16-bit
+* alignment.
+*
+* Parameters:
+*  planes - (In) one pointer per channel
+*  interleaved - (Out) interleaved data
+*  frame_len - Samples per channel
+*  num_channels - Number of channels
+* Return:
+*  None
+*
+*******************************************************************************/
+void audio_conv_interleave_planes(const uint16_t *const *planes, uint16_t *interleaved,
+        uint32_t frame_len, uint32_t num_channels)
+{
+#if AUDIO_CONV_USE_MVE
+    const uint16_t *tail[4];
+    uint32_t vector_len = frame_len - (frame_len % AUDIO_CONV_MVE_LANES);
+    uint32_t ch = 0;
+
+    if (((2u == num_channels) || (4u == num_channels)) && (0u != vector_len))
+    {
+        if (2u == num_channels)
+        {
+            audio_conv_interleave_planes_2ch_mve(planes, interleaved, vector_len);
+        }
+        else
+        {
+            audio_conv_interleave_planes_4ch_mve(planes, interleaved, vector_len);
+        }
+        for (ch = 0; ch < num_channels; ch++)
+        {
+            tail[ch] = planes[ch] + vector_len;
+        }
+        audio_conv_interleave_planes_scalar(tail, interleaved + (vector_len * num_channels),
+                frame_len - vector_len, num_channels);
+        return;
+    }
+#endif /* AUDIO_CONV_USE_MVE */
+    if (1u == num_channels)
+    {
+        memcpy(interleaved, planes[0], frame_len * sizeof(uint16_t));
+        return;
+    }
+    audio_conv_interleave_planes_scalar(planes, interleaved, frame_len, num_channels);
+}
+
+/*******************************************************************************
+* Function Name: audio_conv_extract_channel
+********************************************************************************
+* Summary:
+* Copies one channel of interleaved samples into a mono buffer.
+*
+* Parameters:
+*  interleaved - (In) interleaved data
+*  mono - (Out) mono data
+*  frame_len - Samples per channel
+*  num_channels - Number of interleaved channels
+*  channel - Index of the channel to extract
+* Return:
+*  None
+*
+*******************************************************************************/
+void audio_conv_extract_channel(const uint16_t *interleaved, uint16_t *mono,
+        uint32_t frame_len, uint32_t num_channels, uint32_t channel)
+{
+#if AUDIO_CONV_USE_MVE
+    if ((2u == num_channels) && (channel < 2u) && AUDIO_CONV_MVE_LEN_OK(frame_len))
+    {
+        audio_conv_extract_channel_2ch_mve(interleaved, mono, frame_len, channel);
+        return;
+    }
+#endif /* AUDIO_CONV_USE_MVE */
+    audio_conv_extract_channel_scalar(interleaved, mono, frame_len, num_channels, channel);
+}
+
+/*******************************************************************************
+* Function Name: audio_conv_replicate
+********************************************************************************
+* Summary:
+* Copies a mono buffer into every channel of an interleaved buffer.
+*
+* Parameters:
+*  mono - (In) mono data
+*  interleaved - (Out) interleaved data
+*  frame_len - Samples per channel
+*  num_channels - Number of interleaved channels
+* Return:
+*  None
+*
+*******************************************************************************/
+void audio_conv_replicate(const uint16_t *mono, uint16_t *interleaved,
+        uint32_t frame_len, uint32_t num_channels)
+{
+#if AUDIO_CONV_USE_MVE
+    if ((2u == num_channels) && AUDIO_CONV_MVE_LEN_OK(frame_len))
+    {
+        audio_conv_replicate_2ch_mve(mono, interleaved, frame_len);
+        return;
+    }
+#endif /* AUDIO_CONV_USE_MVE */
+    audio_conv_replicate_scalar(mono, interleaved, frame_len, num_channels);
+}
+
+/*******************************************************************************
+* Function Name: convert_stereo_non_interleaved_to_stereo_interleaved_ref
 ********************************************************************************
 * Summary:
-* Converts non interleaved audio to interleaved stereo (16kHz, 10ms frame)
+* Converts non interleaved audio to interleaved stereo (pipeline frame)
+* Scalar reference implementation.
 *
 * Parameters:
 *  stereo_non_interleaved - (In) non interleaved data
@@ -64,16 +647,16 @@
 *
 *******************************************************************************/
 
-void convert_stereo_non_interleaved_to_stereo_interleaved(
+void convert_stereo_non_interleaved_to_stereo_interleaved_ref(
         uint16_t *stereo_non_interleaved,
         uint16_t *stereo_interleaved)
 {
-    int i = 0;
-    for (i = 0; i < MAX_AUD_SAMPLES_PER_CHANNEL_FOR_10MS_DATA; i++)
+    uint32_t i = 0;
+    for (i = 0; i < AUDIO_CONV_FRAME_SAMPLES; i++)
     {
         *stereo_interleaved = *stereo_non_interleaved;
         stereo_interleaved++;
-        *stereo_interleaved = *(stereo_non_interleaved+MAX_AUD_SAMPLES_PER_CHANNEL_FOR_10MS_DATA);
+        *stereo_interleaved = *(stereo_non_interleaved+AUDIO_CONV_FRAME_SAMPLES);
         stereo_interleaved++;
         stereo_non_interleaved++;
     }
@@ -81,10 +664,11 @@ void convert_stereo_non_interleaved_to_stereo_interleaved(
 }
 
 /*******************************************************************************
-* Function Name: convert_interleaved_to_stereo_non_interleaved
+* Function Name: convert_interleaved_to_stereo_non_interleaved_ref
 ********************************************************************************
 * Summary:
-* Converts interleaved stereo to non interleaved audio (16kHz, 10ms frame)
+* Converts interleaved stereo to non interleaved audio (pipeline frame)
+* Scalar reference implementation.
 *
 * Parameters:
 *  stereo_interleaved - (In) interleaved data
@@ -94,17 +678,17 @@ void convert_stereo_non_interleaved_to_stereo_interleaved(
 *
 *******************************************************************************/
 
-void convert_interleaved_to_stereo_non_interleaved(
+void convert_interleaved_to_stereo_non_interleaved_ref(
         uint16_t *stereo_interleaved,
         uint16_t *stereo_non_interleaved)
 {
-    int i = 0;
-    for (i = 0; i < MAX_AUD_SAMPLES_PER_CHANNEL_FOR_10MS_DATA; i++)
+    uint32_t i = 0;
+    for (i = 0; i < AUDIO_CONV_FRAME_SAMPLES; i++)
     {
         *stereo_non_interleaved = *stereo_interleaved;
         stereo_interleaved++;
 
-        *(stereo_non_interleaved + MAX_AUD_SAMPLES_PER_CHANNEL_FOR_10MS_DATA) =
+        *(stereo_non_interleaved + AUDIO_CONV_FRAME_SAMPLES) =
                 *stereo_interleaved;
         stereo_interleaved++;
 
@@ -114,10 +698,11 @@ void convert_interleaved_to_stereo_non_interleaved(
 }
 
 /*******************************************************************************
-* Function Name: convert_stereo_interleaved_to_mono
+* Function Name: convert_stereo_interleaved_to_mono_ref
 ********************************************************************************
 * Summary:
-* Converts interleaved stereo to mono (16kHz, 10ms frame) 
+* Converts interleaved stereo to mono (pipeline frame)
+* Scalar reference implementation.
 *
 * Parameters:
 *  stereo - (In) interleaved data
@@ -127,11 +712,11 @@ void convert_interleaved_to_stereo_non_interleaved(
 *
 *******************************************************************************/
 
-void convert_stereo_interleaved_to_mono(uint16_t *stereo, uint16_t *mono)
+void convert_stereo_interleaved_to_mono_ref(uint16_t *stereo, uint16_t *mono)
 {
-    int i =0;
+    uint32_t i = 0;
 
-    for (i = 0; i < MAX_AUD_SAMPLES_PER_CHANNEL_FOR_10MS_DATA; i++)
+    for (i = 0; i < AUDIO_CONV_FRAME_SAMPLES; i++)
     {
         *mono = *stereo;
         stereo += 2;
@@ -140,10 +725,11 @@ void convert_stereo_interleaved_to_mono(uint16_t *stereo, uint16_t *mono)
 }
 
 /*******************************************************************************
-* Function Name: convert_mono_to_stereo_interleaved
+* Function Name: convert_mono_to_stereo_interleaved_ref
 ********************************************************************************
 * Summary:
-* Converts mono to stereo (16kHz, 10ms frame) 
+* Converts mono to stereo (pipeline frame)
+* Scalar reference implementation.
 *
 * Parameters:
 *  stereo - interleaved data
@@ -152,11 +738,11 @@ void convert_stereo_interleaved_to_mono(uint16_t *stereo, uint16_t *mono)
 *  None
 *
 *******************************************************************************/
-void convert_mono_to_stereo_interleaved(uint16_t *stereo,uint16_t *mono)
+void convert_mono_to_stereo_interleaved_ref(uint16_t *stereo,uint16_t *mono)
 {
-    int i =0;
+    uint32_t i = 0;
 
-    for (i = 0; i < MAX_AUD_SAMPLES_PER_CHANNEL_FOR_10MS_DATA; i++)
+    for (i = 0; i < AUDIO_CONV_FRAME_SAMPLES; i++)
     {
         *stereo = *mono;
         stereo++;
@@ -166,5 +752,105 @@ void convert_mono_to_stereo_interleaved(uint16_t *stereo,uint16_t *mono)
     }
 }
 
+/*******************************************************************************
+* Function Name: convert_stereo_non_interleaved_to_stereo_interleaved
+********************************************************************************
+* Summary:
+* Converts non interleaved audio to interleaved stereo (pipeline frame).
+* Fixed size specialization of audio_conv_interleave.
+*
+* Parameters:
+*  stereo_non_interleaved - (In) non interleaved data
+*  stereo_interleaved - (Out) interleaved data
+* Return:
+*  None
+*
+*******************************************************************************/
+void convert_stereo_non_interleaved_to_stereo_interleaved(
+        uint16_t *stereo_non_interleaved,
+        uint16_t *stereo_interleaved)
+{
+#if AUDIO_CONV_FIXED_USE_MVE
+    audio_conv_interleave_2ch_mve(stereo_non_interleaved, stereo_interleaved,
+            AUDIO_CONV_FRAME_SAMPLES, AUDIO_CONV_FRAME_SAMPLES);
+#else
+    convert_stereo_non_interleaved_to_stereo_interleaved_ref(stereo_non_interleaved,
+            stereo_interleaved);
+#endif /* AUDIO_CONV_FIXED_USE_MVE */
+}
+
+/*******************************************************************************
+* Function Name: convert_interleaved_to_stereo_non_interleaved
+********************************************************************************
+* Summary:
+* Converts interleaved stereo to non interleaved audio (pipeline frame).
+* Fixed size specialization of audio_conv_deinterleave.
+*
+* Parameters:
+*  stereo_interleaved - (In) interleaved data
+*  stereo_non_interleaved - (Out) non interleaved data
+* Return:
+*  None
+*
+*******************************************************************************/
+void convert_interleaved_to_stereo_non_interleaved(
+        uint16_t *stereo_interleaved,
+        uint16_t *stereo_non_interleaved)
+{
+#if AUDIO_CONV_FIXED_USE_MVE
+    audio_conv_deinterleave_2ch_mve(stereo_interleaved, stereo_non_interleaved,
+            AUDIO_CONV_FRAME_SAMPLES, AUDIO_CONV_FRAME_SAMPLES);
+#else
+    convert_interleaved_to_stereo_non_interleaved_ref(stereo_interleaved,
+            stereo_non_interleaved);
+#endif /* AUDIO_CONV_FIXED_USE_MVE */
+}
+
+/*******************************************************************************
+* Function Name: convert_stereo_interleaved_to_mono
+********************************************************************************
+* Summary:
+* Converts interleaved stereo to mono (pipeline frame). The left channel is
+* kept. Fixed size specialization of audio_conv_extract_channel.
+*
+* Parameters:
+*  stereo - (In) interleaved data
+*  mono - (Out) mono data
+* Return:
+*  None
+*
+*******************************************************************************/
+void convert_stereo_interleaved_to_mono(uint16_t *stereo, uint16_t *mono)
+{
+#if AUDIO_CONV_FIXED_USE_MVE
+    audio_conv_extract_channel_2ch_mve(stereo, mono, AUDIO_CONV_FRAME_SAMPLES, 0u);
+#else
+    convert_stereo_interleaved_to_mono_ref(stereo, mono);
+#endif /* AUDIO_CONV_FIXED_USE_MVE */
+}
+
+/*******************************************************************************
+* Function Name: convert_mono_to_stereo_interleaved
+********************************************************************************
+* Summary:
+* Converts mono to stereo (pipeline frame). Fixed size specialization of
+* audio_conv_replicate.
+*
+* Parameters:
+*  stereo - interleaved data
+*  mono -  mono data
+* Return:
+*  None
+*
+*******************************************************************************/
+void convert_mono_to_stereo_interleaved(uint16_t *stereo, uint16_t *mono)
+{
+#if AUDIO_CONV_FIXED_USE_MVE
+    audio_conv_replicate_2ch_mve(mono, stereo, AUDIO_CONV_FRAME_SAMPLES);
+#else
+    convert_mono_to_stereo_interleaved_ref(stereo, mono);
+#endif /* AUDIO_CONV_FIXED_USE_MVE */
+}
+
 
 /* [] END OF FILE */
@@ -41,16 +41,53 @@
 
 #include "cy_result.h"
 #include <stdbool.h>
+#include <stdint.h>
+#include "audio_pipeline_config.h"
 
 #ifdef __cplusplus
 extern "C"
 {
 #endif /* __cplusplus */
 
+/****************************************************************************
+* Macros
+*****************************************************************************/
+/* Use the Helium (MVE) converters when the target supports MVE integer
+ * instructions. Set to 0 to build the scalar reference converters only.
+ */
+#ifndef AUDIO_CONV_USE_MVE
+#if defined(__ARM_FEATURE_MVE) && (__ARM_FEATURE_MVE & 1)
+#define AUDIO_CONV_USE_MVE                  (1)
+#else
+#define AUDIO_CONV_USE_MVE                  (0)
+#endif
+#endif /* AUDIO_CONV_USE_MVE */
+
 /****************************************************************************
 * Functions Prototypes
 *****************************************************************************/
 
+/* Generic converters. frame_len is the number of samples per channel and
+ * planar_stride the distance in samples between two channel planes.
+ */
+void audio_conv_deinterleave(const uint16_t *interleaved, uint16_t *planar,
+        uint32_t frame_len, uint32_t num_channels, uint32_t planar_stride);
+
+void audio_conv_interleave(const uint16_t *planar, uint16_t *interleaved,
+        uint32_t frame_len, uint32_t num_channels, uint32_t planar_stride);
+
+/* Same as audio_conv_interleave with one pointer per channel plane */
+void audio_conv_interleave_planes(const uint16_t *const *planes, uint16_t *interleaved,
+        uint32_t frame_len, uint32_t num_channels);
+
+void audio_conv_extract_channel(const uint16_t *interleaved, uint16_t *mono,
+        uint32_t frame_len, uint32_t num_channels, uint32_t channel);
+
+void audio_conv_replicate(const uint16_t *mono, uint16_t *interleaved,
+        uint32_t frame_len, uint32_t num_channels);
+
+/* Fixed size converters for one pipeline frame */
+
 void convert_stereo_non_interleaved_to_stereo_interleaved(
         uint16_t *stereo_non_interleaved,
         uint16_t *stereo_interleaved);
@@ -67,6 +104,23 @@ void convert_mono_to_stereo_interleaved(
         uint16_t *stereo,
         uint16_t *mono);
 
+/* Bit-exact scalar reference converters, always available */
+void convert_stereo_non_interleaved_to_stereo_interleaved_ref(
+        uint16_t *stereo_non_interleaved,
+        uint16_t *stereo_interleaved);
+
+void convert_interleaved_to_stereo_non_interleaved_ref(
+        uint16_t *stereo_interleaved,
+        uint16_t *stereo_non_interleaved);
+
+void convert_stereo_interleaved_to_mono_ref(
+        uint16_t *stereo,
+        uint16_t *mono);
+
+void convert_mono_to_stereo_interleaved_ref(
+        uint16_t *stereo,
+        uint16_t *mono);
+
 
 #ifdef __cplusplus
 }
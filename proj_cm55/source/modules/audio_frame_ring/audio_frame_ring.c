@@ -0,0 +1,346 @@
+/******************************************************************************
+* File Name : audio_frame_ring.c
+*
+* Description :
+* Lock-free single-producer/single-consumer ring of fixed size audio frames.
+* Frames are accessed in place through reserve/commit and peek/release.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "audio_frame_ring.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define RING_LOAD(var)                  __atomic_load_n(&(var), __ATOMIC_ACQUIRE)
+#define RING_STORE(var, val)            __atomic_store_n(&(var), (val), __ATOMIC_RELEASE)
+
+/*******************************************************************************
+* Function Name: ring_next_index
+********************************************************************************
+* Summary:
+* Advances a ring index, wrapping at twice the slot count.
+*
+*******************************************************************************/
+static inline uint32_t ring_next_index(audio_frame_ring_t *ring, uint32_t index)
+{
+    index++;
+    if (index >= (2u * ring->slot_count))
+    {
+        index = 0;
+    }
+    return index;
+}
+
+/*******************************************************************************
+* Function Name: ring_slot
+********************************************************************************
+* Summary:
+* Returns the frame slot addressed by a ring index.
+*
+*******************************************************************************/
+static inline uint8_t* ring_slot(audio_frame_ring_t *ring, uint32_t index)
+{
+    if (index >= ring->slot_count)
+    {
+        index -= ring->slot_count;
+    }
+    return ring->storage + (index * ring->slot_size);
+}
+
+/*******************************************************************************
+* Function Name: ring_depth
+********************************************************************************
+* Summary:
+* Returns the number of committed frames between two ring indices.
+*
+*******************************************************************************/
+static inline uint32_t ring_depth(audio_frame_ring_t *ring, uint32_t head, uint32_t tail)
+{
+    if (head >= tail)
+    {
+        return head - tail;
+    }
+    return (2u * ring->slot_count) - tail + head;
+}
+
+/*******************************************************************************
+* Function Name: audio_frame_ring_init
+********************************************************************************
+* Summary:
+* Initializes a frame ring over caller provided storage.
+*
+* Parameters:
+*  ring - Ring instance.
+*  storage - Storage for slot_count * slot_size bytes.
+*  slot_size - Size of one frame in bytes.
+*  slot_count - Number of frames the ring can hold.
+*
+* Return:
+*  CY_RSLT_SUCCESS or AUDIO_FRAME_RING_FAILURE.
+*
+*******************************************************************************/
+cy_rslt_t audio_frame_ring_init(audio_frame_ring_t *ring, void *storage,
+                                uint32_t slot_size, uint32_t slot_count)
+{
+    if ((NULL == ring) || (NULL == storage) || (0 == slot_size) || (0 == slot_count))
+    {
+        return AUDIO_FRAME_RING_FAILURE;
+    }
+
+    memset(ring, 0, sizeof(audio_frame_ring_t));
+    ring->storage = (uint8_t *)storage;
+    ring->slot_size = slot_size;
+    ring->slot_count = slot_count;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: audio_frame_ring_reserve
+********************************************************************************
+* Summary:
+* Producer side. Returns the next free slot to be filled in place, or NULL if
+* the ring is full (counted as an overrun). The slot becomes visible to the
+* consumer only after audio_frame_ring_commit.
+*
+*******************************************************************************/
+void* audio_frame_ring_reserve(audio_frame_ring_t *ring)
+{
+    uint32_t head = ring->head;
+    uint32_t tail = RING_LOAD(ring->tail);
+
+    if (ring_depth(ring, head, tail) >= ring->slot_count)
+    {
+        ring->overruns++;
+        return NULL;
+    }
+    return ring_slot(ring, head);
+}
+
+/*******************************************************************************
+* Function Name: audio_frame_ring_reserve_ahead
+********************************************************************************
+* Summary:
+* Producer side. Returns the slot 'offset' frames after the next free slot,
+* so that a DMA producer can be pointed at the following frame while the
+* current one is still being filled. Offset 0 is the slot returned by the next
+* reserve. Returns NULL, without counting an overrun, if fewer than
+* offset + 1 slots are free. A returned slot stays free until it is reserved
+* and committed.
+*
+*******************************************************************************/
+void* audio_frame_ring_reserve_ahead(audio_frame_ring_t *ring, uint32_t offset)
+{
+    uint32_t head = ring->head;
+    uint32_t tail = RING_LOAD(ring->tail);
+
+    if ((ring_depth(ring, head, tail) + offset) >= ring->slot_count)
+    {
+        return NULL;
+    }
+    head += offset;
+    if (head >= (2u * ring->slot_count))
+    {
+        head -= 2u * ring->slot_count;
+    }
+    return ring_slot(ring, head);
+}
+
+/*******************************************************************************
+* Function Name: audio_frame_ring_commit
+********************************************************************************
+* Summary:
+* Producer side. Publishes the slot returned by the last successful reserve.
+*
+*******************************************************************************/
+void audio_frame_ring_commit(audio_frame_ring_t *ring)
+{
+    uint32_t head = ring_next_index(ring, ring->head);
+    uint32_t depth = ring_depth(ring, head, RING_LOAD(ring->tail));
+
+    RING_STORE(ring->head, head);
+
+    if (depth > ring->max_depth)
+    {
+        ring->max_depth = depth;
+    }
+}
+
+/*******************************************************************************
+* Function Name: audio_frame_ring_write
+********************************************************************************
+* Summary:
+* Producer side. Copies one frame into the ring.
+*
+*******************************************************************************/
+cy_rslt_t audio_frame_ring_write(audio_frame_ring_t *ring, const void *frame)
+{
+    void *slot = audio_frame_ring_reserve(ring);
+
+    if (NULL == slot)
+    {
+        return AUDIO_FRAME_RING_FAILURE;
+    }
+    memcpy(slot, frame, ring->slot_size);
+    audio_frame_ring_commit(ring);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: audio_frame_ring_peek
+********************************************************************************
+* Summary:
+* Consumer side. Returns the oldest committed frame without removing it, or
+* NULL if the ring is empty. Pending flush requests are applied here so that
+* only the consumer ever moves the tail.
+*
+*******************************************************************************/
+void* audio_frame_ring_peek(audio_frame_ring_t *ring)
+{
+    uint32_t head = RING_LOAD(ring->head);
+    uint32_t flush_request = RING_LOAD(ring->flush_request);
+
+    if (flush_request != ring->flush_ack)
+    {
+        ring->flush_ack = flush_request;
+        RING_STORE(ring->tail, head);
+    }
+
+    if (head == ring->tail)
+    {
+        return NULL;
+    }
+    return ring_slot(ring, ring->tail);
+}
+
+/*******************************************************************************
+* Function Name: audio_frame_ring_release
+********************************************************************************
+* Summary:
+* Consumer side. Returns the frame obtained by the last peek to the producer.
+*
+*******************************************************************************/
+void audio_frame_ring_release(audio_frame_ring_t *ring)
+{
+    uint32_t tail = ring->tail;
+
+    /* A flush may already have consumed the peeked slot */
+    if (tail != RING_LOAD(ring->head))
+    {
+        RING_STORE(ring->tail, ring_next_index(ring, tail));
+    }
+}
+
+/*******************************************************************************
+* Function Name: audio_frame_ring_read
+********************************************************************************
+* Summary:
+* Consumer side. Copies the oldest frame out of the ring and releases it.
+*
+*******************************************************************************/
+cy_rslt_t audio_frame_ring_read(audio_frame_ring_t *ring, void *frame)
+{
+    void *slot = audio_frame_ring_peek(ring);
+
+    if (NULL == slot)
+    {
+        return AUDIO_FRAME_RING_FAILURE;
+    }
+    memcpy(frame, slot, ring->slot_size);
+    audio_frame_ring_release(ring);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: audio_frame_ring_count_underrun
+********************************************************************************
+* Summary:
+* Consumer side. Counts an underrun. Called by consumers that needed a frame
+* and found the ring empty, e.g. a packet or a playback period sent without
+* data. Polling an empty ring is not an underrun.
+*
+*******************************************************************************/
+void audio_frame_ring_count_underrun(audio_frame_ring_t *ring)
+{
+    ring->underruns++;
+}
+
+/*******************************************************************************
+* Function Name: audio_frame_ring_flush
+********************************************************************************
+* Summary:
+* Requests that all committed frames are dropped. Safe from any context; the
+* consumer applies the request on its next peek.
+*
+*******************************************************************************/
+void audio_frame_ring_flush(audio_frame_ring_t *ring)
+{
+    __atomic_fetch_add(&ring->flush_request, 1u, __ATOMIC_RELEASE);
+}
+
+/*******************************************************************************
+* Function Name: audio_frame_ring_depth
+********************************************************************************
+* Summary:
+* Returns the number of committed frames waiting in the ring.
+*
+*******************************************************************************/
+uint32_t audio_frame_ring_depth(audio_frame_ring_t *ring)
+{
+    return ring_depth(ring, RING_LOAD(ring->head), RING_LOAD(ring->tail));
+}
+
+/*******************************************************************************
+* Function Name: audio_frame_ring_get_stats
+********************************************************************************
+* Summary:
+* Returns a snapshot of the ring depth, high-water mark and error counters.
+*
+*******************************************************************************/
+void audio_frame_ring_get_stats(audio_frame_ring_t *ring,
+                                audio_frame_ring_stats_t *stats)
+{
+    stats->depth = audio_frame_ring_depth(ring);
+    stats->max_depth = ring->max_depth;
+    stats->overruns = ring->overruns;
+    stats->underruns = ring->underruns;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,116 @@
+/******************************************************************************
+* File Name : audio_frame_ring.h
+*
+* Description :
+* Header file for the lock-free single-producer/single-consumer audio frame
+* ring buffer.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __AUDIO_FRAME_RING_H__
+#define __AUDIO_FRAME_RING_H__
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_result.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define AUDIO_FRAME_RING_FAILURE                (-1)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Frame ring shared between exactly one producer and one consumer context
+ * (ISR or task). The producer owns 'head' and 'overruns', the consumer owns
+ * 'tail' and 'underruns'. Indices run from 0 to (2 * slot_count - 1) so that
+ * a full ring can be told apart from an empty one without a spare slot.
+ */
+typedef struct
+{
+    uint8_t *storage;                   /* slot_count * slot_size bytes */
+    uint32_t slot_size;                 /* Size of one frame slot in bytes */
+    uint32_t slot_count;                /* Number of frame slots */
+    volatile uint32_t head;             /* Producer index */
+    volatile uint32_t tail;             /* Consumer index */
+    volatile uint32_t flush_request;    /* Incremented by flush requester */
+    volatile uint32_t flush_ack;        /* Updated by the consumer */
+    volatile uint32_t overruns;         /* Frames dropped because ring was full */
+    volatile uint32_t underruns;        /* Frames the consumer needed from an empty ring */
+    volatile uint32_t max_depth;        /* High-water mark of the ring depth */
+} audio_frame_ring_t;
+
+typedef struct
+{
+    uint32_t depth;
+    uint32_t max_depth;
+    uint32_t overruns;
+    uint32_t underruns;
+} audio_frame_ring_stats_t;
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
+cy_rslt_t audio_frame_ring_init(audio_frame_ring_t *ring, void *storage,
+                                uint32_t slot_size, uint32_t slot_count);
+
+/* Producer side */
+void*     audio_frame_ring_reserve(audio_frame_ring_t *ring);
+void*     audio_frame_ring_reserve_ahead(audio_frame_ring_t *ring, uint32_t offset);
+void      audio_frame_ring_commit(audio_frame_ring_t *ring);
+cy_rslt_t audio_frame_ring_write(audio_frame_ring_t *ring, const void *frame);
+
+/* Consumer side */
+void*     audio_frame_ring_peek(audio_frame_ring_t *ring);
+void      audio_frame_ring_release(audio_frame_ring_t *ring);
+cy_rslt_t audio_frame_ring_read(audio_frame_ring_t *ring, void *frame);
+void      audio_frame_ring_count_underrun(audio_frame_ring_t *ring);
+
+/* Any context */
+void      audio_frame_ring_flush(audio_frame_ring_t *ring);
+uint32_t  audio_frame_ring_depth(audio_frame_ring_t *ring);
+void      audio_frame_ring_get_stats(audio_frame_ring_t *ring,
+                                     audio_frame_ring_stats_t *stats);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* __AUDIO_FRAME_RING_H__ */
+
+/* [] END OF FILE */
@@ -0,0 +1,114 @@
+/******************************************************************************
+* File Name : audio_pipeline_config.h
+*
+* Description :
+* Header file for the audio pipeline configuration shared by the capture,
+* AE feed, playback and USB modules.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __AUDIO_PIPELINE_CONFIG_H__
+#define __AUDIO_PIPELINE_CONFIG_H__
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Pipeline sample rate in Hz */
+#ifndef AUDIO_PIPELINE_SAMPLE_RATE_HZ
+#define AUDIO_PIPELINE_SAMPLE_RATE_HZ           (16000u)
+#endif /* AUDIO_PIPELINE_SAMPLE_RATE_HZ */
+
+/* Pipeline frame length in msec. The AFE middleware processes 10 msec frames */
+#ifndef AUDIO_PIPELINE_FRAME_MS
+#define AUDIO_PIPELINE_FRAME_MS                 (10u)
+#endif /* AUDIO_PIPELINE_FRAME_MS */
+
+/* Maximum number of microphone channels in a frame. Raise it for mic arrays,
+ * each channel adds one plane to every frame of the pool.
+ */
+#ifndef AUDIO_PIPELINE_MAX_MIC_CHANNELS
+#define AUDIO_PIPELINE_MAX_MIC_CHANNELS         (2u)
+#endif /* AUDIO_PIPELINE_MAX_MIC_CHANNELS */
+
+/* Number of channels played out on I2S and received from the USB speaker */
+#define AUDIO_PIPELINE_PLAYBACK_CHANNELS        (2u)
+
+/* Samples per channel in 1 msec and in one frame */
+#define AUDIO_PIPELINE_SAMPLES_PER_MS           (AUDIO_PIPELINE_SAMPLE_RATE_HZ / 1000u)
+#define AUDIO_PIPELINE_SAMPLES_PER_FRAME        (AUDIO_PIPELINE_SAMPLES_PER_MS * AUDIO_PIPELINE_FRAME_MS)
+
+/* Size in bytes of one frame of 16-bit samples with the given channel count */
+#define AUDIO_PIPELINE_FRAME_BYTES(channels)    (AUDIO_PIPELINE_SAMPLES_PER_FRAME * (channels) * sizeof(int16_t))
+
+#if (AUDIO_PIPELINE_SAMPLE_RATE_HZ % 1000u) != 0
+#error "Pipeline sample rate must be a multiple of 1 kHz"
+#endif
+
+#if (AUDIO_PIPELINE_MAX_MIC_CHANNELS < 1u) || (AUDIO_PIPELINE_MAX_MIC_CHANNELS > 8u)
+#error "Between 1 and 8 microphone channels are supported"
+#endif
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Audio pipeline configuration. Static buffers are sized from the macros
+ * above; the modules use this structure for all frame geometry at runtime.
+ */
+typedef struct
+{
+    uint32_t sample_rate_hz;
+    uint32_t frame_ms;
+    uint32_t samples_per_ms;
+    uint32_t samples_per_frame;
+    uint8_t mic_channels;
+    uint8_t playback_channels;
+} audio_pipeline_config_t;
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
+const audio_pipeline_config_t* audio_pipeline_get_config(void);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* __AUDIO_PIPELINE_CONFIG_H__ */
+
+/* [] END OF FILE */
@@ -0,0 +1,327 @@
+/******************************************************************************
+* File Name : audio_resampler.c
+*
+* Description :
+* Fixed-point polyphase resampler for small rational rate ratios between
+* the USB sample rate and the audio pipeline rate.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <math.h>
+#include <string.h>
+#include "audio_resampler.h"
+
+#if AUDIO_RESAMPLER_USE_MVE
+#include <arm_mve.h>
+#endif /* AUDIO_RESAMPLER_USE_MVE */
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Passband edge as a fraction of the lower Nyquist frequency */
+#define AUDIO_RESAMPLER_PASSBAND                (0.9f)
+
+#define AUDIO_RESAMPLER_PI                      (3.14159265358979f)
+
+/* Coefficient format Q1.15 */
+#define AUDIO_RESAMPLER_COEFF_SHIFT             (15u)
+
+#if AUDIO_RESAMPLER_USE_MVE
+/* Number of 16-bit lanes in an MVE vector */
+#define AUDIO_RESAMPLER_MVE_LANES               (8u)
+#endif /* AUDIO_RESAMPLER_USE_MVE */
+
+/*******************************************************************************
+* Function Name: audio_resampler_gcd
+********************************************************************************
+* Summary:
+* Greatest common divisor of two rates.
+*
+*******************************************************************************/
+static uint32_t audio_resampler_gcd(uint32_t a, uint32_t b)
+{
+    uint32_t t = 0;
+
+    while (0u != b)
+    {
+        t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+/*******************************************************************************
+* Function Name: audio_resampler_design
+********************************************************************************
+* Summary:
+* Designs the Blackman windowed sinc low pass prototype at up times the input
+* rate, with the cutoff below the lower of both Nyquist frequencies, and
+* stores it as Q15 polyphase coefficients. Each phase has a DC gain of one.
+*
+* Parameters:
+*  resampler - Resampler with up, down and taps_per_phase set
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+static void audio_resampler_design(audio_resampler_t *resampler)
+{
+    uint32_t up = resampler->up;
+    uint32_t taps = resampler->taps_per_phase;
+    uint32_t length = taps * up;
+    uint32_t factor = (up > resampler->down) ? up : resampler->down;
+    float cutoff = (AUDIO_RESAMPLER_PASSBAND * 0.5f) / (float)factor;
+    float center = (float)(length - 1u) * 0.5f;
+    float t = 0.0f;
+    float h = 0.0f;
+    float w = 0.0f;
+    int32_t q = 0;
+    uint32_t n = 0;
+    uint32_t phase = 0;
+    uint32_t j = 0;
+
+    for (n = 0; n < length; n++)
+    {
+        t = (float)n - center;
+        h = 2.0f * cutoff;
+        if (0.0f != t)
+        {
+            h = sinf(2.0f * AUDIO_RESAMPLER_PI * cutoff * t) / (AUDIO_RESAMPLER_PI * t);
+        }
+        w = 0.42f - (0.5f * cosf((2.0f * AUDIO_RESAMPLER_PI * (float)n) / (float)(length - 1u)))
+                  + (0.08f * cosf((4.0f * AUDIO_RESAMPLER_PI * (float)n) / (float)(length - 1u)));
+        q = (int32_t)lrintf(h * w * (float)up * (float)(1u << AUDIO_RESAMPLER_COEFF_SHIFT));
+        if (q > INT16_MAX)
+        {
+            q = INT16_MAX;
+        }
+
+        /* h[phase + k * up] is applied to the input k samples back, which is
+         * element taps - 1 - k of the window.
+         */
+        phase = n % up;
+        j = taps - 1u - (n / up);
+        resampler->coeffs[(phase * taps) + j] = (int16_t)q;
+    }
+}
+
+/*******************************************************************************
+* Function Name: audio_resampler_dot
+********************************************************************************
+* Summary:
+* Filters one window with one phase and returns the saturated Q15 result.
+*
+* Parameters:
+*  window - Oldest sample of the window
+*  coeffs - Coefficients of the phase
+*  taps - Window length
+*
+* Return:
+*  Output sample
+*
+*******************************************************************************/
+static inline int16_t audio_resampler_dot(const int16_t *window, const int16_t *coeffs, uint32_t taps)
+{
+    int64_t acc = 0;
+    uint32_t i = 0;
+
+#if AUDIO_RESAMPLER_USE_MVE
+    for (; (i + AUDIO_RESAMPLER_MVE_LANES) <= taps; i += AUDIO_RESAMPLER_MVE_LANES)
+    {
+        acc = vmlaldavaq_s16(acc, vld1q_s16(window + i), vld1q_s16(coeffs + i));
+    }
+#endif /* AUDIO_RESAMPLER_USE_MVE */
+    for (; i < taps; i++)
+    {
+        acc += (int32_t)window[i] * coeffs[i];
+    }
+
+    acc = (acc + (1 << (AUDIO_RESAMPLER_COEFF_SHIFT - 1u))) >> AUDIO_RESAMPLER_COEFF_SHIFT;
+    if (acc > INT16_MAX)
+    {
+        acc = INT16_MAX;
+    }
+    else if (acc < INT16_MIN)
+    {
+        acc = INT16_MIN;
+    }
+    return (int16_t)acc;
+}
+
+/*******************************************************************************
+* Function Name: audio_resampler_init
+********************************************************************************
+* Summary:
+* Sets up a resampler for a rate pair. Equal rates give a plain copy.
+*
+* Parameters:
+*  resampler - Resampler to initialize
+*  in_rate_hz - Input sample rate
+*  out_rate_hz - Output sample rate
+*  channels - Interleaved channels, up to AUDIO_RESAMPLER_MAX_CHANNELS
+*
+* Return:
+*  CY_RSLT_SUCCESS, or AUDIO_RESAMPLER_FAILURE if the reduced ratio exceeds
+*  AUDIO_RESAMPLER_MAX_FACTOR or the channel count is not supported.
+*
+*******************************************************************************/
+cy_rslt_t audio_resampler_init(audio_resampler_t *resampler, uint32_t in_rate_hz,
+        uint32_t out_rate_hz, uint32_t channels)
+{
+    uint32_t gcd = 0;
+    uint32_t up = 0;
+    uint32_t down = 0;
+
+    if ((0u == in_rate_hz) || (0u == out_rate_hz) ||
+        (0u == channels) || (channels > AUDIO_RESAMPLER_MAX_CHANNELS))
+    {
+        return AUDIO_RESAMPLER_FAILURE;
+    }
+
+    gcd = audio_resampler_gcd(in_rate_hz, out_rate_hz);
+    up = out_rate_hz / gcd;
+    down = in_rate_hz / gcd;
+    if ((up > AUDIO_RESAMPLER_MAX_FACTOR) || (down > AUDIO_RESAMPLER_MAX_FACTOR))
+    {
+        return AUDIO_RESAMPLER_FAILURE;
+    }
+
+    memset(resampler, 0, sizeof(*resampler));
+    resampler->up = up;
+    resampler->down = down;
+    resampler->channels = channels;
+    if (up != down)
+    {
+        resampler->taps_per_phase = (2u * AUDIO_RESAMPLER_ZERO_CROSSINGS *
+                ((up > down) ? up : down)) / up;
+        audio_resampler_design(resampler);
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: audio_resampler_reset
+********************************************************************************
+* Summary:
+* Clears the history. Call when the stream restarts.
+*
+* Parameters:
+*  resampler - Resampler to reset
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void audio_resampler_reset(audio_resampler_t *resampler)
+{
+    resampler->phase = 0;
+    resampler->pos = 0;
+    memset(resampler->history, 0, sizeof(resampler->history));
+}
+
+/*******************************************************************************
+* Function Name: audio_resampler_process
+********************************************************************************
+* Summary:
+* Resamples interleaved frames. Every input frame produces the outputs whose
+* time falls before the next input frame, so the output count of a call
+* varies by one for ratios with down > 1. The output buffer must hold
+* AUDIO_RESAMPLER_MAX_OUTPUT(in_frames, up, down) frames.
+*
+* Parameters:
+*  resampler - Resampler
+*  in - Interleaved input frames
+*  in_frames - Number of input frames
+*  out - Interleaved output frames
+*
+* Return:
+*  Number of output frames
+*
+*******************************************************************************/
+uint32_t audio_resampler_process(audio_resampler_t *resampler, const int16_t *in,
+        uint32_t in_frames, int16_t *out)
+{
+    uint32_t channels = resampler->channels;
+    uint32_t taps = resampler->taps_per_phase;
+    uint32_t out_frames = 0;
+    uint32_t pos = resampler->pos;
+    uint32_t phase = resampler->phase;
+    const int16_t *coeffs = NULL;
+    uint32_t i = 0;
+    uint32_t ch = 0;
+
+    if (resampler->up == resampler->down)
+    {
+        memcpy(out, in, in_frames * channels * sizeof(int16_t));
+        return in_frames;
+    }
+
+    for (i = 0; i < in_frames; i++)
+    {
+        for (ch = 0; ch < channels; ch++)
+        {
+            resampler->history[ch][pos] = *in;
+            resampler->history[ch][pos + taps] = *in;
+            in++;
+        }
+        pos++;
+        if (pos == taps)
+        {
+            pos = 0;
+        }
+
+        while (phase < resampler->up)
+        {
+            coeffs = &resampler->coeffs[phase * taps];
+            for (ch = 0; ch < channels; ch++)
+            {
+                *out++ = audio_resampler_dot(&resampler->history[ch][pos], coeffs, taps);
+            }
+            out_frames++;
+            phase += resampler->down;
+        }
+        phase -= resampler->up;
+    }
+
+    resampler->pos = pos;
+    resampler->phase = phase;
+    return out_frames;
+}
+
+/* [] END OF FILE */
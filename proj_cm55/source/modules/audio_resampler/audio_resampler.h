@@ -0,0 +1,120 @@
+/******************************************************************************
+* File Name : audio_resampler.h
+*
+* Description :
+* Fixed-point polyphase resampler for small rational rate ratios between
+* the USB sample rate and the audio pipeline rate.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __AUDIO_RESAMPLER_H__
+#define __AUDIO_RESAMPLER_H__
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include "cy_result.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Largest interpolation or decimation factor after reducing the ratio,
+ * 3 covers 16 kHz against 48 kHz.
+ */
+#define AUDIO_RESAMPLER_MAX_FACTOR              (3u)
+
+/* Largest number of interleaved channels */
+#define AUDIO_RESAMPLER_MAX_CHANNELS            (4u)
+
+/* Zero crossings of the windowed sinc on each side of its center. The
+ * prototype filter has 2 * ZERO_CROSSINGS * max(up, down) taps.
+ */
+#define AUDIO_RESAMPLER_ZERO_CROSSINGS          (8u)
+
+#define AUDIO_RESAMPLER_MAX_TAPS                (2u * AUDIO_RESAMPLER_ZERO_CROSSINGS * AUDIO_RESAMPLER_MAX_FACTOR)
+
+/* Use the Helium (MVE) dot product when the target supports MVE integer
+ * instructions.
+ */
+#ifndef AUDIO_RESAMPLER_USE_MVE
+#if defined(__ARM_FEATURE_MVE) && (__ARM_FEATURE_MVE & 1)
+#define AUDIO_RESAMPLER_USE_MVE                 (1)
+#else
+#define AUDIO_RESAMPLER_USE_MVE                 (0)
+#endif
+#endif /* AUDIO_RESAMPLER_USE_MVE */
+
+#define AUDIO_RESAMPLER_FAILURE                 (-1)
+
+/* Output frames produced from in_frames input frames, rounded up */
+#define AUDIO_RESAMPLER_MAX_OUTPUT(in_frames, up, down) \
+    ((((in_frames) * (up)) + (down) - 1u) / (down))
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Resampler state. The coefficients are stored per phase in the order of
+ * the history window, oldest sample first. Each channel keeps its history
+ * twice, so the window of the last taps_per_phase samples is always
+ * contiguous.
+ */
+typedef struct
+{
+    uint32_t up;
+    uint32_t down;
+    uint32_t channels;
+    uint32_t taps_per_phase;
+    uint32_t phase;
+    uint32_t pos;
+    int16_t  coeffs[AUDIO_RESAMPLER_MAX_TAPS];
+    int16_t  history[AUDIO_RESAMPLER_MAX_CHANNELS][2u * AUDIO_RESAMPLER_MAX_TAPS];
+} audio_resampler_t;
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
+cy_rslt_t audio_resampler_init(audio_resampler_t *resampler, uint32_t in_rate_hz,
+        uint32_t out_rate_hz, uint32_t channels);
+void      audio_resampler_reset(audio_resampler_t *resampler);
+uint32_t  audio_resampler_process(audio_resampler_t *resampler, const int16_t *in,
+        uint32_t in_frames, int16_t *out);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* __AUDIO_RESAMPLER_H__ */
+
+/* [] END OF FILE */
@@ -0,0 +1,221 @@
+/******************************************************************************
+* File Name : clock_drift.c
+*
+* Description :
+* Clock drift estimation between two audio clock domains from the fill
+* level of the buffer that connects them.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "clock_drift.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* USB full speed feedback format: samples per 1 ms frame in 10.14 */
+#define CLOCK_DRIFT_FEEDBACK_FRAC_BITS          (14u)
+
+/*******************************************************************************
+* Function Name: clock_drift_init
+********************************************************************************
+* Summary:
+* Initializes an estimator.
+*
+* Parameters:
+*  estimator - Estimator to initialize
+*  time_constant - Averaging length in updates
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void clock_drift_init(clock_drift_estimator_t *estimator, uint32_t time_constant)
+{
+    estimator->time_constant = (0u != time_constant) ? time_constant : CLOCK_DRIFT_DEFAULT_TIME_CONSTANT;
+    clock_drift_reset(estimator);
+}
+
+/*******************************************************************************
+* Function Name: clock_drift_reset
+********************************************************************************
+* Summary:
+* Restarts the estimation. Call when either stream restarts.
+*
+* Parameters:
+*  estimator - Estimator to reset
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void clock_drift_reset(clock_drift_estimator_t *estimator)
+{
+    uint32_t time_constant = estimator->time_constant;
+
+    memset(estimator, 0, sizeof(*estimator));
+    estimator->time_constant = time_constant;
+}
+
+/*******************************************************************************
+* Function Name: clock_drift_update
+********************************************************************************
+* Summary:
+* Adds one observation of the buffer fill. The consumer sample count is the
+* time base, so no separate timer is needed. The averaging window grows
+* with the number of updates up to the time constant, which gives a fast
+* first estimate.
+*
+* Parameters:
+*  estimator - Estimator to update
+*  consumed_samples - Free running count of samples taken by the consumer
+*  fill_samples - Buffer fill in samples
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void clock_drift_update(clock_drift_estimator_t *estimator, uint32_t consumed_samples, int32_t fill_samples)
+{
+    float weight = 0.0f;
+    float dt = estimator->lag;
+    float df = 0.0f;
+    float slope = 0.0f;
+
+    /* Distance of the new observation from the mean time */
+    if (0u != estimator->updates)
+    {
+        dt += (float)(uint32_t)(consumed_samples - estimator->last_time);
+    }
+    estimator->last_time = consumed_samples;
+
+    if (estimator->updates < estimator->time_constant)
+    {
+        estimator->updates++;
+    }
+    weight = 1.0f / (float)estimator->updates;
+
+    df = (float)fill_samples - estimator->mean_fill;
+    estimator->lag = dt - (weight * dt);
+    estimator->mean_fill += weight * df;
+    estimator->var_time = (1.0f - weight) * (estimator->var_time + (weight * dt * dt));
+    estimator->cov_time_fill = (1.0f - weight) * (estimator->cov_time_fill + (weight * dt * df));
+
+    if (estimator->var_time > 0.0f)
+    {
+        slope = estimator->cov_time_fill / estimator->var_time;
+        estimator->ppm = slope * 1000000.0f;
+        if (estimator->ppm > CLOCK_DRIFT_MAX_PPM)
+        {
+            estimator->ppm = CLOCK_DRIFT_MAX_PPM;
+        }
+        else if (estimator->ppm < -CLOCK_DRIFT_MAX_PPM)
+        {
+            estimator->ppm = -CLOCK_DRIFT_MAX_PPM;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: clock_drift_is_valid
+********************************************************************************
+* Summary:
+* Tells whether enough observations were made to use the estimate.
+*
+* Parameters:
+*  estimator - Estimator to query
+*
+* Return:
+*  true if the estimate can be used.
+*
+*******************************************************************************/
+bool clock_drift_is_valid(const clock_drift_estimator_t *estimator)
+{
+    return (estimator->updates >= CLOCK_DRIFT_MIN_UPDATES);
+}
+
+/*******************************************************************************
+* Function Name: clock_drift_get_ppm
+********************************************************************************
+* Summary:
+* Returns the estimated drift of the producer relative to the consumer.
+*
+* Parameters:
+*  estimator - Estimator to query
+*
+* Return:
+*  Drift in ppm, 0 while the estimate is not valid.
+*
+*******************************************************************************/
+float clock_drift_get_ppm(const clock_drift_estimator_t *estimator)
+{
+    return clock_drift_is_valid(estimator) ? estimator->ppm : 0.0f;
+}
+
+/*******************************************************************************
+* Function Name: clock_drift_feedback_10_14
+********************************************************************************
+* Summary:
+* Computes the value of an asynchronous USB OUT feedback endpoint: the rate
+* at which the device consumes samples, in samples per 1 ms frame in 10.14
+* format. The drift estimate (host relative to device) sets the rate and a
+* slow servo term drives the buffer fill error back to zero.
+*
+* Parameters:
+*  sample_rate_hz - Nominal sample rate
+*  ppm - Host drift relative to the device
+*  fill_error_samples - Buffer fill minus its target
+*
+* Return:
+*  Feedback value.
+*
+*******************************************************************************/
+uint32_t clock_drift_feedback_10_14(uint32_t sample_rate_hz, float ppm, int32_t fill_error_samples)
+{
+    float samples_per_ms = (float)sample_rate_hz / 1000.0f;
+    float rate = samples_per_ms / (1.0f + (ppm * 1.0e-6f));
+
+    rate -= (float)fill_error_samples / (float)CLOCK_DRIFT_FEEDBACK_SERVO_MS;
+
+    if (rate < 0.0f)
+    {
+        rate = 0.0f;
+    }
+
+    return (uint32_t)((rate * (float)(1u << CLOCK_DRIFT_FEEDBACK_FRAC_BITS)) + 0.5f);
+}
+
+/* [] END OF FILE */
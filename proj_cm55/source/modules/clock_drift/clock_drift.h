@@ -0,0 +1,104 @@
+/******************************************************************************
+* File Name : clock_drift.h
+*
+* Description :
+* Clock drift estimation between two audio clock domains from the fill
+* level of the buffer that connects them.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __CLOCK_DRIFT_H__
+#define __CLOCK_DRIFT_H__
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Default averaging length of the estimator in updates. At one update per
+ * 10 ms frame this is about one minute.
+ */
+#define CLOCK_DRIFT_DEFAULT_TIME_CONSTANT       (6000u)
+
+/* Updates needed before the estimate is used */
+#define CLOCK_DRIFT_MIN_UPDATES                 (500u)
+
+/* Largest drift the estimator reports, in ppm */
+#define CLOCK_DRIFT_MAX_PPM                     (1000.0f)
+
+/* Time in milliseconds over which the USB feedback corrects a fill error */
+#define CLOCK_DRIFT_FEEDBACK_SERVO_MS           (10000u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Exponentially weighted linear regression of the buffer fill against the
+ * consumer sample count. The slope is the relative rate difference between
+ * producer and consumer; it is positive when the producer is faster.
+ * The time is kept relative to its weighted mean, which stays within a few
+ * time constants, so single precision holds over any run time.
+ */
+typedef struct
+{
+    uint32_t time_constant;
+    uint32_t updates;
+    uint32_t last_time;
+    float    lag;                       /* Consumer samples since the mean time */
+    float    mean_fill;
+    float    var_time;
+    float    cov_time_fill;
+    float    ppm;
+} clock_drift_estimator_t;
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
+void  clock_drift_init(clock_drift_estimator_t *estimator, uint32_t time_constant);
+void  clock_drift_reset(clock_drift_estimator_t *estimator);
+void  clock_drift_update(clock_drift_estimator_t *estimator, uint32_t consumed_samples, int32_t fill_samples);
+bool  clock_drift_is_valid(const clock_drift_estimator_t *estimator);
+float clock_drift_get_ppm(const clock_drift_estimator_t *estimator);
+uint32_t clock_drift_feedback_10_14(uint32_t sample_rate_hz, float ppm, int32_t fill_error_samples);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* __CLOCK_DRIFT_H__ */
+
+/* [] END OF FILE */
@@ -0,0 +1,465 @@
+/******************************************************************************
+* File Name : deferred_log.c
+*
+* Description :
+* Deferred logging. Log calls store a binary record in a lock-free ring
+* and a low priority task formats and prints the records on the debug UART.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <stdbool.h>
+#include "deferred_log.h"
+#include "cy_pdl.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define DEFERRED_LOG_TASK_NAME                  "deferred_log"
+#define DEFERRED_LOG_TASK_PRIORITY              (tskIDLE_PRIORITY + 1)
+#define DEFERRED_LOG_TASK_STACK_SIZE            (configMINIMAL_STACK_SIZE * 4)
+
+#define DEFERRED_LOG_RING_MASK                  (DEFERRED_LOG_RING_RECORDS - 1u)
+
+/* Longest formatted line and conversion specification */
+#define DEFERRED_LOG_LINE_SIZE                  (160u)
+#define DEFERRED_LOG_SPEC_SIZE                  (16u)
+
+/* Frame header: sync bytes, argument count, sequence, format, timestamp */
+#define DEFERRED_LOG_FRAME_HEADER_SIZE          (12u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* A record is owned by its writer from the reservation of its index until
+ * the format is stored, which publishes it to the drain task. The drain task
+ * clears the format before it releases the index.
+ */
+typedef struct
+{
+    volatile uint32_t format;           /* Format string address, 0 while written */
+    uint32_t timestamp;                 /* DWT cycle count */
+    uint32_t nargs;
+    uint32_t args[DEFERRED_LOG_MAX_ARGS];
+} deferred_log_record_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static deferred_log_record_t deferred_log_ring[DEFERRED_LOG_RING_RECORDS];
+/* Indices reserved by the writers and released by the drain task */
+static volatile uint32_t deferred_log_head = 0;
+static volatile uint32_t deferred_log_tail = 0;
+static volatile uint32_t deferred_log_dropped = 0;
+static volatile uint32_t deferred_log_max_depth = 0;
+
+/* Drops already reported by the drain task */
+static uint32_t deferred_log_dropped_reported = 0;
+
+#if DEFERRED_LOG_BINARY_OUTPUT
+static uint8_t deferred_log_sequence = 0;
+#else
+/* Time of the last record printed, extended to 64 bits */
+static bool deferred_log_time_valid = false;
+static uint32_t deferred_log_last_cycles = 0;
+static uint64_t deferred_log_time_cycles = 0;
+#endif /* DEFERRED_LOG_BINARY_OUTPUT */
+
+static const char deferred_log_dropped_format[] = "deferred log: %lu records dropped";
+
+static TaskHandle_t deferred_log_task_handle = NULL;
+
+/*******************************************************************************
+* Function Name: deferred_log_write
+********************************************************************************
+* Summary:
+*  Stores a log record. Writers from any context reserve a record with a
+*  compare and swap on the head index, fill it and publish it by storing the
+*  format address. The record is dropped if the ring is full.
+*
+* Parameters:
+*  format - Format string, its address identifies the record
+*  nargs - Number of valid arguments
+*  arg0 .. arg3 - Arguments
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void deferred_log_write(const char *format, uint32_t nargs,
+                        uint32_t arg0, uint32_t arg1, uint32_t arg2, uint32_t arg3)
+{
+    deferred_log_record_t *record;
+    uint32_t head = __atomic_load_n(&deferred_log_head, __ATOMIC_RELAXED);
+    uint32_t depth;
+
+    do
+    {
+        depth = head - __atomic_load_n(&deferred_log_tail, __ATOMIC_ACQUIRE);
+        if (depth >= DEFERRED_LOG_RING_RECORDS)
+        {
+            __atomic_fetch_add(&deferred_log_dropped, 1u, __ATOMIC_RELAXED);
+            return;
+        }
+    } while (!__atomic_compare_exchange_n(&deferred_log_head, &head, head + 1u, true,
+                                          __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+    if (depth >= deferred_log_max_depth)
+    {
+        deferred_log_max_depth = depth + 1u;
+    }
+
+    record = &deferred_log_ring[head & DEFERRED_LOG_RING_MASK];
+    record->timestamp = DWT->CYCCNT;
+    record->nargs = nargs;
+    record->args[0] = arg0;
+    record->args[1] = arg1;
+    record->args[2] = arg2;
+    record->args[3] = arg3;
+    __atomic_store_n(&record->format, (uint32_t)(uintptr_t)format, __ATOMIC_RELEASE);
+}
+
+#if DEFERRED_LOG_BINARY_OUTPUT
+/*******************************************************************************
+* Function Name: deferred_log_put_u32
+********************************************************************************
+* Summary:
+*  Stores a 32-bit value little endian.
+*
+*******************************************************************************/
+static uint8_t* deferred_log_put_u32(uint8_t *pos, uint32_t value)
+{
+    pos[0] = (uint8_t)value;
+    pos[1] = (uint8_t)(value >> 8);
+    pos[2] = (uint8_t)(value >> 16);
+    pos[3] = (uint8_t)(value >> 24);
+    return pos + 4;
+}
+
+/*******************************************************************************
+* Function Name: deferred_log_output
+********************************************************************************
+* Summary:
+*  Sends a record as binary frame. The sequence number lets the decoder
+*  detect lost frames.
+*
+* Parameters:
+*  record - Record to send
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void deferred_log_output(const deferred_log_record_t *record)
+{
+    uint8_t frame[DEFERRED_LOG_FRAME_HEADER_SIZE + (DEFERRED_LOG_MAX_ARGS * sizeof(uint32_t))];
+    uint8_t *pos = frame;
+
+    *pos++ = DEFERRED_LOG_SYNC_0;
+    *pos++ = DEFERRED_LOG_SYNC_1;
+    *pos++ = (uint8_t)record->nargs;
+    *pos++ = deferred_log_sequence++;
+    pos = deferred_log_put_u32(pos, record->format);
+    pos = deferred_log_put_u32(pos, record->timestamp);
+    for (uint32_t i = 0; i < record->nargs; i++)
+    {
+        pos = deferred_log_put_u32(pos, record->args[i]);
+    }
+
+    fwrite(frame, 1, (size_t)(pos - frame), stdout);
+    fflush(stdout);
+}
+#else
+/*******************************************************************************
+* Function Name: deferred_log_output
+********************************************************************************
+* Summary:
+*  Formats a record and prints it with its time in seconds. Each conversion
+*  of the format string is printed with one 32-bit argument: floats from
+*  their bit pattern, strings and pointers as addresses, integers as is.
+*
+* Parameters:
+*  record - Record to print
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void deferred_log_output(const deferred_log_record_t *record)
+{
+    char line[DEFERRED_LOG_LINE_SIZE];
+    char spec[DEFERRED_LOG_SPEC_SIZE];
+    const char *format = (const char *)(uintptr_t)record->format;
+    uint32_t cycles_per_us = SystemCoreClock / 1000000u;
+    uint64_t time_us;
+    uint32_t arg = 0;
+    uint32_t value;
+    uint32_t spec_len;
+    size_t len = 0;
+    float float_value;
+    int written;
+
+    /* Records are drained in the order they were reserved, which may differ
+     * slightly from their time order. The drain period is far below the
+     * cycle counter wrap time.
+     */
+    if (!deferred_log_time_valid)
+    {
+        deferred_log_time_cycles = record->timestamp;
+        deferred_log_time_valid = true;
+    }
+    else
+    {
+        deferred_log_time_cycles += (uint64_t)(int64_t)(int32_t)(record->timestamp - deferred_log_last_cycles);
+    }
+    deferred_log_last_cycles = record->timestamp;
+    time_us = deferred_log_time_cycles / ((0u != cycles_per_us) ? cycles_per_us : 1u);
+
+    while (('\0' != *format) && (len < (sizeof(line) - 1u)))
+    {
+        if ('%' != *format)
+        {
+            line[len++] = *format++;
+            continue;
+        }
+
+        spec_len = 0;
+        spec[spec_len++] = *format++;
+        while (('\0' != *format) && (NULL == strchr("diouxXcspfFeEgGaA%", *format)) &&
+               (spec_len < (sizeof(spec) - 2u)))
+        {
+            spec[spec_len++] = *format++;
+        }
+        if ('\0' == *format)
+        {
+            break;
+        }
+        spec[spec_len++] = *format;
+        spec[spec_len] = '\0';
+
+        value = (arg < record->nargs) ? record->args[arg] : 0u;
+        switch (*format++)
+        {
+            case '%':
+                line[len++] = '%';
+                continue;
+            case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+                memcpy(&float_value, &value, sizeof(float_value));
+                written = snprintf(&line[len], sizeof(line) - len, spec, (double)float_value);
+                break;
+            case 's':
+                written = snprintf(&line[len], sizeof(line) - len, spec, (const char *)(uintptr_t)value);
+                break;
+            case 'p':
+                written = snprintf(&line[len], sizeof(line) - len, spec, (void *)(uintptr_t)value);
+                break;
+            case 'd': case 'i':
+                if (NULL != strchr(spec, 'l'))
+                {
+                    written = snprintf(&line[len], sizeof(line) - len, spec, (long)(int32_t)value);
+                }
+                else
+                {
+                    written = snprintf(&line[len], sizeof(line) - len, spec, (int)(int32_t)value);
+                }
+                break;
+            default:
+                if (NULL != strchr(spec, 'l'))
+                {
+                    written = snprintf(&line[len], sizeof(line) - len, spec, (unsigned long)value);
+                }
+                else
+                {
+                    written = snprintf(&line[len], sizeof(line) - len, spec, (unsigned int)value);
+                }
+                break;
+        }
+        arg++;
+        if (written > 0)
+        {
+            len += (size_t)written;
+        }
+        if (len > (sizeof(line) - 1u))
+        {
+            len = sizeof(line) - 1u;
+        }
+    }
+    line[len] = '\0';
+
+    printf("[%5lu.%06lu] %s\r\n", (unsigned long)(time_us / 1000000u),
+           (unsigned long)(time_us % 1000000u), line);
+}
+#endif /* DEFERRED_LOG_BINARY_OUTPUT */
+
+/*******************************************************************************
+* Function Name: deferred_log_drain
+********************************************************************************
+* Summary:
+*  Outputs all published records in order and reports dropped records. Stops
+*  at a record that is still being written. Called by the drain task only.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void deferred_log_drain(void)
+{
+    deferred_log_record_t record;
+    deferred_log_record_t *slot;
+    uint32_t tail = deferred_log_tail;
+    uint32_t dropped;
+
+    while (tail != __atomic_load_n(&deferred_log_head, __ATOMIC_ACQUIRE))
+    {
+        slot = &deferred_log_ring[tail & DEFERRED_LOG_RING_MASK];
+        record.format = __atomic_load_n(&slot->format, __ATOMIC_ACQUIRE);
+        if (0u == record.format)
+        {
+            break;
+        }
+        record.timestamp = slot->timestamp;
+        record.nargs = (slot->nargs <= DEFERRED_LOG_MAX_ARGS) ? slot->nargs : DEFERRED_LOG_MAX_ARGS;
+        memcpy(record.args, slot->args, sizeof(record.args));
+
+        /* The writer may reuse the record once the tail moved past it */
+        slot->format = 0u;
+        tail++;
+        __atomic_store_n(&deferred_log_tail, tail, __ATOMIC_RELEASE);
+
+        deferred_log_output(&record);
+    }
+
+    dropped = __atomic_load_n(&deferred_log_dropped, __ATOMIC_RELAXED);
+    if (dropped != deferred_log_dropped_reported)
+    {
+        record.format = (uint32_t)(uintptr_t)deferred_log_dropped_format;
+        record.timestamp = DWT->CYCCNT;
+        record.nargs = 1u;
+        record.args[0] = dropped - deferred_log_dropped_reported;
+        deferred_log_dropped_reported = dropped;
+        deferred_log_output(&record);
+    }
+}
+
+/*******************************************************************************
+* Function Name: deferred_log_task
+********************************************************************************
+* Summary:
+*  Drains the log ring periodically.
+*
+* Parameters:
+*  arg - Unused
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void deferred_log_task(void *arg)
+{
+    (void)arg;
+
+    for (;;)
+    {
+        deferred_log_drain();
+        vTaskDelay(pdMS_TO_TICKS(DEFERRED_LOG_DRAIN_PERIOD_MS));
+    }
+}
+
+/*******************************************************************************
+* Function Name: deferred_log_init
+********************************************************************************
+* Summary:
+*  Enables the DWT cycle counter for the timestamps and creates the drain
+*  task. Records logged before are kept in the ring. The cycle counter is
+*  enabled without being reset so that it can be shared with the profiler.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  CY_RSLT_SUCCESS on success, DEFERRED_LOG_FAILURE otherwise.
+*
+*******************************************************************************/
+cy_rslt_t deferred_log_init(void)
+{
+    BaseType_t rtos_task_status;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    if (NULL != deferred_log_task_handle)
+    {
+        return CY_RSLT_SUCCESS;
+    }
+
+    rtos_task_status = xTaskCreate(deferred_log_task, DEFERRED_LOG_TASK_NAME,
+            DEFERRED_LOG_TASK_STACK_SIZE, NULL, DEFERRED_LOG_TASK_PRIORITY,
+            &deferred_log_task_handle);
+    if (pdPASS != rtos_task_status)
+    {
+        return DEFERRED_LOG_FAILURE;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: deferred_log_get_stats
+********************************************************************************
+* Summary:
+*  Returns the number of records written and dropped and the ring high-water
+*  mark.
+*
+* Parameters:
+*  stats - Receives the statistics
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void deferred_log_get_stats(deferred_log_stats_t *stats)
+{
+    stats->records = deferred_log_head;
+    stats->dropped = deferred_log_dropped;
+    stats->max_depth = deferred_log_max_depth;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,161 @@
+/******************************************************************************
+* File Name : deferred_log.h
+*
+* Description :
+* Deferred logging. Log calls store a binary record in a lock-free ring
+* and a low priority task formats and prints the records on the debug UART.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __DEFERRED_LOG_H__
+#define __DEFERRED_LOG_H__
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include <string.h>
+#include "cy_result.h"
+#include "app_logger.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 0 to print the deferred logs synchronously with app_log_print */
+#ifndef DEFERRED_LOG_ENABLE
+#define DEFERRED_LOG_ENABLE                     (1)
+#endif /* DEFERRED_LOG_ENABLE */
+
+/* Set to 1 to send the records as binary frames instead of text. The frames
+ * are decoded on the host with deferred_log_decode.py and the application
+ * ELF file. Plain text output of app_log_print passes through the decoder.
+ * The AFE configurator cannot tune over a UART carrying binary frames.
+ */
+#ifndef DEFERRED_LOG_BINARY_OUTPUT
+#define DEFERRED_LOG_BINARY_OUTPUT              (0)
+#endif /* DEFERRED_LOG_BINARY_OUTPUT */
+
+/* Number of records in the ring, a power of two */
+#ifndef DEFERRED_LOG_RING_RECORDS
+#define DEFERRED_LOG_RING_RECORDS               (128u)
+#endif /* DEFERRED_LOG_RING_RECORDS */
+
+/* Maximum number of arguments of a log call. Arguments are 32 bits wide */
+#define DEFERRED_LOG_MAX_ARGS                   (4u)
+
+/* Interval at which the drain task empties the ring */
+#define DEFERRED_LOG_DRAIN_PERIOD_MS            (20u)
+
+/* Start of a binary frame: sync bytes, argument count, sequence number,
+ * format string address, timestamp and arguments, all little endian.
+ */
+#define DEFERRED_LOG_SYNC_0                     (0xA5u)
+#define DEFERRED_LOG_SYNC_1                     (0x5Au)
+
+#define DEFERRED_LOG_FAILURE                    (-1)
+
+#if (DEFERRED_LOG_RING_RECORDS & (DEFERRED_LOG_RING_RECORDS - 1u)) != 0
+#error "DEFERRED_LOG_RING_RECORDS must be a power of two"
+#endif
+
+/* Logs a line without formatting it. The format string is a literal without
+ * line ending. Its address identifies the record, so %s arguments must point
+ * to constant strings. Float arguments are passed through DEFERRED_LOG_FLOAT.
+ * Safe to call from interrupts.
+ */
+#if DEFERRED_LOG_ENABLE
+#define DEFERRED_LOG(format, ...)                                               \
+    do                                                                          \
+    {                                                                           \
+        static const char deferred_log_format[] = format;                       \
+        DEFERRED_LOG_WRITE_(deferred_log_format, ##__VA_ARGS__, 4u, 3u, 2u, 1u, 0u); \
+    } while (0)
+#define DEFERRED_LOG_FLOAT(value)               deferred_log_float_bits(value)
+#else
+#define DEFERRED_LOG(format, ...)               app_log_print(format "\r\n", ##__VA_ARGS__)
+#define DEFERRED_LOG_FLOAT(value)               ((double)(value))
+#endif /* DEFERRED_LOG_ENABLE */
+
+/* Pads the argument list to DEFERRED_LOG_MAX_ARGS, nargs counts the real ones */
+#define DEFERRED_LOG_WRITE_(format, a0, a1, a2, a3, nargs, ...)                \
+    deferred_log_write((format), (nargs), (uint32_t)(uintptr_t)(a0), (uint32_t)(uintptr_t)(a1), \
+                       (uint32_t)(uintptr_t)(a2), (uint32_t)(uintptr_t)(a3))
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    uint32_t records;                   /* Records written */
+    uint32_t dropped;                   /* Records lost because the ring was full */
+    uint32_t max_depth;                 /* High-water mark of the ring depth */
+} deferred_log_stats_t;
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
+cy_rslt_t deferred_log_init(void);
+void deferred_log_write(const char *format, uint32_t nargs,
+                        uint32_t arg0, uint32_t arg1, uint32_t arg2, uint32_t arg3);
+void deferred_log_drain(void);
+void deferred_log_get_stats(deferred_log_stats_t *stats);
+
+/*******************************************************************************
+* Function Name: deferred_log_float_bits
+********************************************************************************
+* Summary:
+*  Returns the bit pattern of a float to store it as a log argument.
+*
+* Parameters:
+*  value - Float argument
+*
+* Return:
+*  IEEE 754 single precision bits of the value
+*
+*******************************************************************************/
+static inline uint32_t deferred_log_float_bits(float value)
+{
+    uint32_t bits;
+
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* __DEFERRED_LOG_H__ */
+
+/* [] END OF FILE */
@@ -0,0 +1,226 @@
+#!/usr/bin/env python3
+################################################################################
+# File Name : deferred_log_decode.py
+#
+# Description :
+# Host decoder of the binary deferred log output (DEFERRED_LOG_BINARY_OUTPUT).
+# Format strings are looked up by address in the application ELF file.
+# Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+# an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+#
+# This software, including source code, documentation and related
+# materials ("Software") is owned by Cypress Semiconductor Corporation
+# or one of its affiliates ("Cypress") and is protected by and subject to
+# worldwide patent protection (United States and foreign),
+# United States copyright laws and international treaty provisions.
+# Therefore, you may use this Software only as provided in the license
+# agreement accompanying the software package from which you
+# obtained this Software ("EULA").
+# If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+# non-transferable license to copy, modify, and compile the Software
+# source code solely for use in connection with Cypress's
+# integrated circuit products.  Any reproduction, modification, translation,
+# compilation, or representation of this Software except as specified
+# above is prohibited without the express written permission of Cypress.
+#
+# Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+# reserves the right to make changes to the Software without notice. Cypress
+# does not assume any liability arising out of the application or use of the
+# Software or any product or circuit described in the Software. Cypress does
+# not authorize its products for use in any products where a malfunction or
+# failure of the Cypress product may reasonably be expected to result in
+# significant property damage, injury or death ("High Risk Product"). By
+# including Cypress's product in a High Risk Product, the manufacturer
+# of such system or application assumes all risk of such use and in doing
+# so agrees to indemnify Cypress against all liability.
+################################################################################
+"""
+Decodes the deferred log frames sent by the CM55 when the firmware is built
+with DEFERRED_LOG_BINARY_OUTPUT=1. Text printed with app_log_print between
+the frames is passed through unchanged.
+
+Usage:
+    deferred_log_decode.py <proj_cm55.elf> <capture file | serial port | ->
+                           [--baud 115200] [--clock-hz 400000000]
+
+Reading a serial port needs the pyserial package.
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+SYNC = b"\xa5\x5a"
+HEADER_SIZE = 12
+MAX_ARGS = 4
+
+SHF_ALLOC = 0x2
+SHT_NOBITS = 8
+
+CONVERSION = re.compile(r"%([-+ #0]*[0-9*]*(?:\.[0-9*]+)?)(hh|h|ll|l|z|j|t)?([diouxXcspfFeEgGaA%])")
+
+
+class ElfImage:
+    """Allocated sections of an ELF file, to read strings by address."""
+
+    def __init__(self, path):
+        with open(path, "rb") as elf_file:
+            data = elf_file.read()
+        if data[:4] != b"\x7fELF":
+            raise ValueError("%s is not an ELF file" % path)
+        is_64 = data[4] == 2
+        endian = "<" if data[5] == 1 else ">"
+        if is_64:
+            shoff, = struct.unpack_from(endian + "Q", data, 0x28)
+            shentsize, shnum = struct.unpack_from(endian + "HH", data, 0x3A)
+            section_format = endian + "IIQQQQIIQQ"
+        else:
+            shoff, = struct.unpack_from(endian + "I", data, 0x20)
+            shentsize, shnum = struct.unpack_from(endian + "HH", data, 0x2E)
+            section_format = endian + "IIIIIIIIII"
+
+        self.sections = []
+        for index in range(shnum):
+            fields = struct.unpack_from(section_format, data, shoff + index * shentsize)
+            sh_type, sh_flags, sh_addr, sh_offset, sh_size = fields[1:6]
+            if (sh_flags & SHF_ALLOC) and sh_type != SHT_NOBITS and sh_size > 0:
+                self.sections.append((sh_addr, data[sh_offset:sh_offset + sh_size]))
+
+    def string(self, address):
+        """Returns the NUL terminated string at the address or None."""
+        for base, content in self.sections:
+            if base <= address < base + len(content):
+                end = content.find(b"\0", address - base)
+                if end < 0:
+                    return None
+                return content[address - base:end].decode("utf-8", "replace")
+        return None
+
+
+def format_record(elf, fmt, args):
+    """Formats a record like the firmware text output does."""
+    values = iter(args)
+
+    def convert(match):
+        flags, _, conversion = match.groups()
+        if conversion == "%":
+            return "%"
+        value = next(values, 0)
+        if conversion in "fFeEgGaA":
+            number = struct.unpack("<f", struct.pack("<I", value))[0]
+            return ("%" + flags + ("f" if conversion in "aA" else conversion)) % number
+        if conversion == "s":
+            text = elf.string(value)
+            return ("%" + flags + "s") % (text if text is not None else "<0x%08x>" % value)
+        if conversion == "p":
+            return "0x%08x" % value
+        if conversion in "di":
+            value = value - (1 << 32) if value & 0x80000000 else value
+            return ("%" + flags + "d") % value
+        if conversion == "c":
+            return chr(value & 0xFF)
+        return ("%" + flags + ("d" if conversion == "u" else conversion)) % value
+
+    return CONVERSION.sub(convert, fmt)
+
+
+class Decoder:
+    """Splits the byte stream into text and frames."""
+
+    def __init__(self, elf, clock_hz, out):
+        self.elf = elf
+        self.clock_hz = clock_hz
+        self.out = out
+        self.buffer = b""
+        self.sequence = None
+        self.last_cycles = None
+        self.time_cycles = 0
+
+    def feed(self, data):
+        self.buffer += data
+        while True:
+            start = self.buffer.find(SYNC)
+            if start < 0:
+                # Keep a trailing first sync byte
+                keep = 1 if self.buffer.endswith(SYNC[:1]) else 0
+                self.text(self.buffer[:len(self.buffer) - keep])
+                self.buffer = self.buffer[len(self.buffer) - keep:]
+                return
+            self.text(self.buffer[:start])
+            self.buffer = self.buffer[start:]
+            if len(self.buffer) < HEADER_SIZE:
+                return
+            nargs, sequence, address, cycles = struct.unpack_from("<BBII", self.buffer, 2)
+            fmt = self.elf.string(address) if nargs <= MAX_ARGS else None
+            if fmt is None:
+                # Not a frame
+                self.text(self.buffer[:1])
+                self.buffer = self.buffer[1:]
+                continue
+            size = HEADER_SIZE + 4 * nargs
+            if len(self.buffer) < size:
+                return
+            args = struct.unpack_from("<%dI" % nargs, self.buffer, HEADER_SIZE)
+            self.buffer = self.buffer[size:]
+            self.record(sequence, cycles, fmt, args)
+
+    def text(self, data):
+        if data:
+            self.out.write(data.decode("utf-8", "replace"))
+
+    def record(self, sequence, cycles, fmt, args):
+        if self.sequence is not None and sequence != (self.sequence + 1) & 0xFF:
+            self.out.write("[deferred log: %d frames lost]\n" % ((sequence - self.sequence - 1) & 0xFF))
+        self.sequence = sequence
+
+        if self.last_cycles is None:
+            self.time_cycles = cycles
+        else:
+            delta = (cycles - self.last_cycles) & 0xFFFFFFFF
+            self.time_cycles += delta - (1 << 32) if delta & 0x80000000 else delta
+        self.last_cycles = cycles
+
+        seconds = self.time_cycles / float(self.clock_hz)
+        self.out.write("[%12.6f] %s\n" % (seconds, format_record(self.elf, fmt, args)))
+        self.out.flush()
+
+
+def open_input(source, baud):
+    if source == "-":
+        return sys.stdin.buffer
+    try:
+        return open(source, "rb")
+    except OSError:
+        import serial  # pylint: disable=import-outside-toplevel
+        return serial.Serial(source, baud, timeout=0.1)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode the deferred log output of the CM55")
+    parser.add_argument("elf", help="Application ELF file of the CM55 project")
+    parser.add_argument("source", help="Capture file, serial port or - for stdin")
+    parser.add_argument("--baud", type=int, default=115200, help="Serial port baud rate")
+    parser.add_argument("--clock-hz", type=int, default=400000000, help="CM55 core clock")
+    options = parser.parse_args()
+
+    decoder = Decoder(ElfImage(options.elf), options.clock_hz, sys.stdout)
+    stream = open_input(options.source, options.baud)
+    try:
+        while True:
+            data = stream.read(256)
+            if not data:
+                if hasattr(stream, "in_waiting"):
+                    continue
+                break
+            decoder.feed(data)
+    except KeyboardInterrupt:
+        pass
+    decoder.text(decoder.buffer)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,240 @@
+/******************************************************************************
+* File Name : delay_estimator.c
+*
+* Description :
+* Estimation of the delay of a processed audio stream against its input
+* by cross-correlation, for the alignment of the two streams.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include <math.h>
+#include "delay_estimator.h"
+
+/*******************************************************************************
+* Function Name: delay_estimator_init
+********************************************************************************
+* Summary:
+* Initializes an estimator.
+*
+* Parameters:
+*  estimator - Estimator to initialize
+*  max_lag - Largest delay searched, up to DELAY_ESTIMATOR_MAX_LAG
+*  window_frames - Frames per correlation window, 0 for the default
+*
+* Return:
+*  CY_RSLT_SUCCESS on success, DELAY_ESTIMATOR_FAILURE otherwise.
+*
+*******************************************************************************/
+cy_rslt_t delay_estimator_init(delay_estimator_t *estimator, uint32_t max_lag, uint32_t window_frames)
+{
+    if ((NULL == estimator) || (max_lag > DELAY_ESTIMATOR_MAX_LAG))
+    {
+        return DELAY_ESTIMATOR_FAILURE;
+    }
+
+    estimator->max_lag = max_lag;
+    estimator->window_frames = (0u != window_frames) ? window_frames : DELAY_ESTIMATOR_DEFAULT_WINDOW_FRAMES;
+    delay_estimator_reset(estimator);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: delay_estimator_reset
+********************************************************************************
+* Summary:
+* Drops the estimate and restarts the measurement. Call when the processing
+* that delays the stream is recreated.
+*
+* Parameters:
+*  estimator - Estimator to reset
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void delay_estimator_reset(delay_estimator_t *estimator)
+{
+    uint32_t max_lag = estimator->max_lag;
+    uint32_t window_frames = estimator->window_frames;
+
+    memset(estimator, 0, sizeof(*estimator));
+    estimator->max_lag = max_lag;
+    estimator->window_frames = window_frames;
+}
+
+/*******************************************************************************
+* Function Name: delay_estimator_evaluate
+********************************************************************************
+* Summary:
+* Takes the peak of the correlation of a complete window as the delay if it
+* is strong enough, and starts the next window.
+*
+*******************************************************************************/
+static void delay_estimator_evaluate(delay_estimator_t *estimator)
+{
+    uint32_t best = 0;
+    float peak = 0.0f;
+    float norm = 0.0f;
+
+    for (uint32_t lag = 1; lag <= estimator->max_lag; lag++)
+    {
+        if (estimator->corr[lag] > estimator->corr[best])
+        {
+            best = lag;
+        }
+    }
+
+    /* Silent windows carry no delay information */
+    if (((float)estimator->out_energy >= (DELAY_ESTIMATOR_MIN_POWER * (float)estimator->window_samples)) &&
+        (estimator->corr[best] > 0))
+    {
+        peak = (float)estimator->corr[best];
+        norm = sqrtf((float)estimator->in_energy) * sqrtf((float)estimator->out_energy);
+        estimator->correlation = peak / norm;
+        if (estimator->correlation >= DELAY_ESTIMATOR_MIN_CORRELATION)
+        {
+            estimator->delay = best;
+            estimator->valid = true;
+        }
+    }
+
+    memset(estimator->corr, 0, sizeof(estimator->corr));
+    estimator->in_energy = 0;
+    estimator->out_energy = 0;
+    estimator->window_samples = 0;
+    estimator->frames = 0;
+}
+
+/*******************************************************************************
+* Function Name: delay_estimator_update
+********************************************************************************
+* Summary:
+* Correlates one frame of the output with the input of the same frame and
+* the max_lag input samples before it. Each frame costs (max_lag + 1) *
+* samples multiply-accumulates until the delay is known, later frames are
+* ignored.
+*
+* Parameters:
+*  estimator - Estimator to update
+*  in - Input samples of the frame
+*  out - Output samples delivered with the frame
+*  samples - Samples per frame, up to DELAY_ESTIMATOR_MAX_FRAME_SAMPLES
+*
+* Return:
+*  true once the delay is known.
+*
+*******************************************************************************/
+bool delay_estimator_update(delay_estimator_t *estimator, const int16_t *in,
+        const int16_t *out, uint32_t samples)
+{
+    const int16_t *history = NULL;
+    int64_t acc = 0;
+
+    if (estimator->valid || (0u == samples) || (samples > DELAY_ESTIMATOR_MAX_FRAME_SAMPLES))
+    {
+        return estimator->valid;
+    }
+
+    memcpy(&estimator->history[estimator->max_lag], in, samples * sizeof(int16_t));
+
+    for (uint32_t i = 0; i < samples; i++)
+    {
+        estimator->in_energy += (int32_t)in[i] * in[i];
+        estimator->out_energy += (int32_t)out[i] * out[i];
+    }
+    estimator->window_samples += samples;
+
+    for (uint32_t lag = 0; lag <= estimator->max_lag; lag++)
+    {
+        history = &estimator->history[estimator->max_lag - lag];
+        acc = 0;
+        for (uint32_t i = 0; i < samples; i++)
+        {
+            acc += (int32_t)out[i] * history[i];
+        }
+        estimator->corr[lag] += acc;
+    }
+
+    memmove(estimator->history, &estimator->history[samples], estimator->max_lag * sizeof(int16_t));
+
+    estimator->frames++;
+    if (estimator->frames >= estimator->window_frames)
+    {
+        delay_estimator_evaluate(estimator);
+    }
+
+    return estimator->valid;
+}
+
+/*******************************************************************************
+* Function Name: delay_estimator_is_valid
+********************************************************************************
+* Summary:
+* Tells whether the delay was measured.
+*
+* Parameters:
+*  estimator - Estimator to query
+*
+* Return:
+*  true if the delay is known.
+*
+*******************************************************************************/
+bool delay_estimator_is_valid(const delay_estimator_t *estimator)
+{
+    return estimator->valid;
+}
+
+/*******************************************************************************
+* Function Name: delay_estimator_get_delay
+********************************************************************************
+* Summary:
+* Returns the measured delay of the output against the input.
+*
+* Parameters:
+*  estimator - Estimator to query
+*
+* Return:
+*  Delay in samples, 0 while it is not known.
+*
+*******************************************************************************/
+uint32_t delay_estimator_get_delay(const delay_estimator_t *estimator)
+{
+    return estimator->valid ? estimator->delay : 0u;
+}
+
+/* [] END OF FILE */
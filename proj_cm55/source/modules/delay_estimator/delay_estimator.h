@@ -0,0 +1,110 @@
+/******************************************************************************
+* File Name : delay_estimator.h
+*
+* Description :
+* Estimation of the delay of a processed audio stream against its input
+* by cross-correlation, for the alignment of the two streams.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __DELAY_ESTIMATOR_H__
+#define __DELAY_ESTIMATOR_H__
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_result.h"
+#include "audio_pipeline_config.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Largest delay searched, 32 msec at 16 kHz */
+#define DELAY_ESTIMATOR_MAX_LAG                 (512u)
+
+/* Largest number of samples per update */
+#define DELAY_ESTIMATOR_MAX_FRAME_SAMPLES       (AUDIO_PIPELINE_SAMPLES_PER_FRAME)
+
+/* Frames correlated before the peak is evaluated */
+#define DELAY_ESTIMATOR_DEFAULT_WINDOW_FRAMES   (50u)
+
+/* Normalized correlation the peak must reach to be taken as the delay */
+#define DELAY_ESTIMATOR_MIN_CORRELATION         (0.4f)
+
+/* Mean square of the output below which a window is taken as silence */
+#define DELAY_ESTIMATOR_MIN_POWER               (16.0f)
+
+#define DELAY_ESTIMATOR_FAILURE                 (-1)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* The correlation of the output with the input delayed by each lag is
+ * accumulated over a window of frames. The input history holds the max_lag
+ * samples before the current frame, oldest first.
+ */
+typedef struct
+{
+    uint32_t max_lag;
+    uint32_t window_frames;
+    uint32_t frames;                    /* Frames in the current window */
+    uint32_t delay;
+    bool     valid;
+    float    correlation;               /* Normalized peak of the last window */
+    int64_t  in_energy;
+    int64_t  out_energy;
+    uint32_t window_samples;
+    int64_t  corr[DELAY_ESTIMATOR_MAX_LAG + 1u];
+    int16_t  history[DELAY_ESTIMATOR_MAX_LAG + DELAY_ESTIMATOR_MAX_FRAME_SAMPLES];
+} delay_estimator_t;
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
+cy_rslt_t delay_estimator_init(delay_estimator_t *estimator, uint32_t max_lag, uint32_t window_frames);
+void      delay_estimator_reset(delay_estimator_t *estimator);
+bool      delay_estimator_update(delay_estimator_t *estimator, const int16_t *in,
+        const int16_t *out, uint32_t samples);
+bool      delay_estimator_is_valid(const delay_estimator_t *estimator);
+uint32_t  delay_estimator_get_delay(const delay_estimator_t *estimator);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* __DELAY_ESTIMATOR_H__ */
+
+/* [] END OF FILE */
@@ -63,6 +63,33 @@ const cy_stc_sysint_t i2s_isr_txcfg = {
 uint32_t i2s_txcount = 0;
 volatile bool i2s_flag = false;
 
+#if I2S_PLAYBACK_DMA
+/* TX interrupts left to the CPU, the FIFO trigger is routed to the DMA */
+#define I2S_TX_INTR_MASK                  (CY_TDM_INTR_TX_FIFO_UNDERFLOW)
+
+const cy_stc_sysint_t i2s_dma_isr_cfg = {
+    .intrSrc = (IRQn_Type) CYBSP_DMA_I2S_TX_IRQ,
+    .intrPriority = I2S_ISR_PRIORITY,
+};
+
+static cy_stc_dma_descriptor_t i2s_dma_descriptors[I2S_DMA_SLOT_COUNT];
+
+static cy_rslt_t app_i2s_dma_setup(int16_t *const slots[], uint32_t slot_count, uint32_t frame_samples);
+static void app_i2s_dma_start(void);
+static void app_i2s_dma_stop(void);
+static void app_i2s_dma_sync(const int16_t *slot, uint32_t size_bytes);
+
+const i2s_dma_hw_t app_i2s_dma_hw =
+{
+    .setup = app_i2s_dma_setup,
+    .start = app_i2s_dma_start,
+    .stop  = app_i2s_dma_stop,
+    .sync  = app_i2s_dma_sync,
+};
+#else
+#define I2S_TX_INTR_MASK                  (CY_TDM_INTR_TX_MASK)
+#endif /* I2S_PLAYBACK_DMA */
+
 /*******************************************************************************
  * Function Name: app_i2s_init
  ********************************************************************************
@@ -90,7 +117,7 @@ void app_i2s_init(void)
 
     /* Clear TX interrupts */
     Cy_AudioTDM_ClearTxInterrupt(TDM_STRUCT0_TX, CY_TDM_INTR_TX_MASK);
-    Cy_AudioTDM_SetTxInterruptMask(TDM_STRUCT0_TX, CY_TDM_INTR_TX_MASK);
+    Cy_AudioTDM_SetTxInterruptMask(TDM_STRUCT0_TX, I2S_TX_INTR_MASK);
 }
 
 /*******************************************************************************
@@ -222,7 +249,7 @@ void app_i2s_enable(void)
 {
     /* Clear TX interrupts */
     Cy_AudioTDM_ClearTxInterrupt(TDM_STRUCT0_TX, CY_TDM_INTR_TX_MASK);
-    Cy_AudioTDM_SetTxInterruptMask(TDM_STRUCT0_TX, CY_TDM_INTR_TX_MASK);
+    Cy_AudioTDM_SetTxInterruptMask(TDM_STRUCT0_TX, I2S_TX_INTR_MASK);
 
     /* Start the I2S TX */
     Cy_AudioTDM_EnableTx(TDM_STRUCT0_TX);
@@ -245,3 +272,159 @@ void app_i2s_deactivate(void)
     /* Deactivate and enable I2S TX interrupts */
     Cy_AudioTDM_DeActivateTx(TDM_STRUCT0_TX);
 }
+
+#if I2S_PLAYBACK_DMA
+/*******************************************************************************
+ * Function Name: app_i2s_dma_setup
+ ********************************************************************************
+* Summary: Builds a circular chain of 2D descriptors, one per frame slot. Each
+*  FIFO trigger moves one burst of 16-bit samples to the 32-bit TX FIFO and
+*  the completion of a descriptor raises the frame interrupt.
+*
+* Parameters:
+*  slots - Frame slots
+*  slot_count - Number of slots
+*  frame_samples - Interleaved samples per slot
+*
+* Return:
+*  CY_RSLT_SUCCESS on success, I2S_DMA_FAILURE otherwise.
+*
+*******************************************************************************/
+static cy_rslt_t app_i2s_dma_setup(int16_t *const slots[], uint32_t slot_count, uint32_t frame_samples)
+{
+    cy_stc_dma_descriptor_config_t descriptor_config =
+    {
+        .retrigger       = CY_DMA_RETRIG_16CYC,
+        .interruptType   = CY_DMA_DESCR,
+        .triggerOutType  = CY_DMA_1ELEMENT,
+        .channelState    = CY_DMA_CHANNEL_ENABLED,
+        .triggerInType   = CY_DMA_X_LOOP,
+        .dataSize        = CY_DMA_HALFWORD,
+        .srcTransferSize = CY_DMA_TRANSFER_SIZE_DATA,
+        .dstTransferSize = CY_DMA_TRANSFER_SIZE_WORD,
+        .descriptorType  = CY_DMA_2D_TRANSFER,
+        .srcAddress      = NULL,
+        .dstAddress      = (void *)&TDM_STRUCT0_TX->TX_FIFO_WR,
+        .srcXincrement   = 1,
+        .dstXincrement   = 0,
+        .xCount          = I2S_DMA_BURST_SAMPLES,
+        .srcYincrement   = I2S_DMA_BURST_SAMPLES,
+        .dstYincrement   = 0,
+        .yCount          = frame_samples / I2S_DMA_BURST_SAMPLES,
+        .nextDescriptor  = NULL,
+    };
+    cy_stc_dma_channel_config_t channel_config =
+    {
+        .descriptor  = &i2s_dma_descriptors[0],
+        .preemptable = false,
+        .priority    = 0,
+        .enable      = false,
+        .bufferable  = false,
+    };
+
+    if ((slot_count > I2S_DMA_SLOT_COUNT) || (0u != (frame_samples % I2S_DMA_BURST_SAMPLES)))
+    {
+        return I2S_DMA_FAILURE;
+    }
+
+    for (uint32_t i = 0; i < slot_count; i++)
+    {
+        descriptor_config.srcAddress = slots[i];
+        descriptor_config.nextDescriptor = &i2s_dma_descriptors[(i + 1u) % slot_count];
+        if (CY_DMA_SUCCESS != Cy_DMA_Descriptor_Init(&i2s_dma_descriptors[i], &descriptor_config))
+        {
+            return I2S_DMA_FAILURE;
+        }
+    }
+
+    if (CY_DMA_SUCCESS != Cy_DMA_Channel_Init(CYBSP_DMA_I2S_TX_HW, CYBSP_DMA_I2S_TX_CHANNEL, &channel_config))
+    {
+        return I2S_DMA_FAILURE;
+    }
+    Cy_DMA_Channel_SetInterruptMask(CYBSP_DMA_I2S_TX_HW, CYBSP_DMA_I2S_TX_CHANNEL, CY_DMA_INTR_MASK);
+
+    Cy_SysInt_Init(&i2s_dma_isr_cfg, i2s_dma_interrupt_handler);
+    NVIC_EnableIRQ(i2s_dma_isr_cfg.intrSrc);
+
+    Cy_DMA_Enable(CYBSP_DMA_I2S_TX_HW);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+ * Function Name: app_i2s_dma_start
+ ********************************************************************************
+* Summary: Enables the DMA channel from the first descriptor
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+static void app_i2s_dma_start(void)
+{
+    Cy_DMA_Channel_SetDescriptor(CYBSP_DMA_I2S_TX_HW, CYBSP_DMA_I2S_TX_CHANNEL, &i2s_dma_descriptors[0]);
+    Cy_DMA_Channel_Enable(CYBSP_DMA_I2S_TX_HW, CYBSP_DMA_I2S_TX_CHANNEL);
+}
+
+/*******************************************************************************
+ * Function Name: app_i2s_dma_stop
+ ********************************************************************************
+* Summary: Disables the DMA channel
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+static void app_i2s_dma_stop(void)
+{
+    Cy_DMA_Channel_Disable(CYBSP_DMA_I2S_TX_HW, CYBSP_DMA_I2S_TX_CHANNEL);
+}
+
+/*******************************************************************************
+ * Function Name: app_i2s_dma_sync
+ ********************************************************************************
+* Summary: Writes a refilled slot back from the data cache
+*
+* Parameters:
+*  slot - Frame slot
+*  size_bytes - Bytes written
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+static void app_i2s_dma_sync(const int16_t *slot, uint32_t size_bytes)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_CleanDCache_by_Addr((void *)slot, (int32_t)size_bytes);
+#else
+    CY_UNUSED_PARAMETER(slot);
+    CY_UNUSED_PARAMETER(size_bytes);
+#endif
+}
+
+/*******************************************************************************
+ * Function Name: app_i2s_dma_clear_interrupt
+ ********************************************************************************
+* Summary: Clears the DMA descriptor completion interrupt
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_i2s_dma_clear_interrupt(void)
+{
+    Cy_DMA_Channel_ClearInterrupt(CYBSP_DMA_I2S_TX_HW, CYBSP_DMA_I2S_TX_CHANNEL);
+}
+#endif /* I2S_PLAYBACK_DMA */
+
+/* [] END OF FILE */
@@ -52,6 +52,7 @@ extern "C" {
 #include "cybsp.h"
 
 #include "mtb_tlv320dac3100.h"
+#include "i2s_dma_playback.h"
 
 /*******************************************************************************
 * Macros
@@ -70,10 +71,40 @@ extern "C" {
 
 #define I2S_HW_FIFO_SIZE                  (128u)
 
+/* Period of the I2S TX trigger interrupt. Half of the hardware FIFO is
+ * refilled per interrupt with 2 channels per sample.
+ */
+#define I2S_ISR_PERIOD_US                 (((I2S_HW_FIFO_SIZE / 4) * 1000000u) / SAMPLE_RATE_HZ)
+
 #define I2S_TLV_CODEC_VOLUME              (110)
 
 #define I2S_ISR_PRIORITY                  (2)
 
+/* Playback through a DMA descriptor chain when the BSP has a DMA channel
+ * named CYBSP_DMA_I2S_TX triggered by the TDM TX FIFO trigger. Otherwise
+ * the I2S ISR writes the FIFO.
+ *
+ * Opt-in: the design.modus files in templates/ do not define that channel,
+ * so the default build plays through the ISR. To use the DMA path add a DMA
+ * channel with the alias CYBSP_DMA_I2S_TX in the Device Configurator and
+ * route the TDM TX trigger to it. The playback engine (i2s_dma_playback.c)
+ * is covered by the host tests; the PDL layer below has not been run on
+ * hardware yet.
+ */
+#if !defined(I2S_PLAYBACK_DMA)
+#if defined(CYBSP_DMA_I2S_TX_HW) && defined(CYBSP_DMA_I2S_TX_CHANNEL) && defined(CYBSP_DMA_I2S_TX_IRQ)
+#define I2S_PLAYBACK_DMA                  (1)
+#else
+#define I2S_PLAYBACK_DMA                  (0)
+#endif
+#endif /* I2S_PLAYBACK_DMA */
+
+/* Samples moved by the DMA per FIFO trigger, half of the hardware FIFO */
+#define I2S_DMA_BURST_SAMPLES             (I2S_HW_FIFO_SIZE / 2)
+
+/* Period of the DMA frame interrupt */
+#define I2S_DMA_FRAME_PERIOD_US           (AUDIO_PIPELINE_FRAME_MS * 1000u)
+
 
 
 /*******************************************************************************
@@ -92,6 +123,11 @@ void i2s_tx_interrupt_handler(void);
 void app_i2s_enable(void);
 void app_i2s_activate(void);
 void app_i2s_deactivate(void);
+#if I2S_PLAYBACK_DMA
+void i2s_dma_interrupt_handler(void);
+void app_i2s_dma_clear_interrupt(void);
+extern const i2s_dma_hw_t app_i2s_dma_hw;
+#endif /* I2S_PLAYBACK_DMA */
 
 #ifdef __cplusplus
 }
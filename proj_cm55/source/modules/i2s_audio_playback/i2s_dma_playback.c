@@ -0,0 +1,239 @@
+/******************************************************************************
+* File Name : i2s_dma_playback.c
+*
+* Description :
+* Frame based I2S playback engine for a chain of DMA descriptors.
+* Hardware independent: the DMA is driven through i2s_dma_hw_t.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "i2s_dma_playback.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static int16_t i2s_dma_slot_buffer[I2S_DMA_SLOT_COUNT][I2S_DMA_SLOT_SAMPLES]
+        __attribute__((aligned(I2S_DMA_SLOT_ALIGNMENT)));
+static int16_t *const i2s_dma_slots[I2S_DMA_SLOT_COUNT] =
+{
+    i2s_dma_slot_buffer[0],
+    i2s_dma_slot_buffer[1]
+};
+
+#if (2u != I2S_DMA_SLOT_COUNT)
+#error "Update i2s_dma_slots for I2S_DMA_SLOT_COUNT"
+#endif
+
+static const i2s_dma_hw_t *i2s_dma_hw = NULL;
+static const i2s_dma_stream_t *i2s_dma_stream = NULL;
+static uint32_t i2s_dma_frame_samples = 0;
+
+/* State of the slots, owned by the completion interrupt once started */
+static bool i2s_dma_slot_valid[I2S_DMA_SLOT_COUNT];
+static uint32_t i2s_dma_playing = 0;
+static bool i2s_dma_streaming = false;
+static i2s_dma_stats_t i2s_dma_stats;
+
+/*******************************************************************************
+* Function Name: i2s_dma_refill
+********************************************************************************
+* Summary:
+* Loads the next frame into a slot that is not being played, or silence when
+* no frame is available.
+*
+* Parameters:
+*  slot - Slot to refill
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+static void i2s_dma_refill(uint32_t slot)
+{
+    uint32_t size_bytes = i2s_dma_frame_samples * sizeof(int16_t);
+
+    if (CY_RSLT_SUCCESS == i2s_dma_stream->fetch(i2s_dma_slots[slot]))
+    {
+        i2s_dma_slot_valid[slot] = true;
+        i2s_dma_streaming = true;
+        i2s_dma_hw->sync(i2s_dma_slots[slot], size_bytes);
+        return;
+    }
+
+    if (i2s_dma_streaming)
+    {
+        i2s_dma_stats.underruns++;
+        i2s_dma_streaming = false;
+    }
+
+    /* A silent slot stays silent, so it is cleared only once */
+    if (i2s_dma_slot_valid[slot])
+    {
+        i2s_dma_slot_valid[slot] = false;
+        memset(i2s_dma_slots[slot], 0, size_bytes);
+        i2s_dma_hw->sync(i2s_dma_slots[slot], size_bytes);
+    }
+}
+
+/*******************************************************************************
+* Function Name: i2s_dma_playback_init
+********************************************************************************
+* Summary:
+* Clears the slots and sets up the descriptor chain over them.
+*
+* Parameters:
+*  hw - Hardware layer
+*  stream - Audio source and sink
+*  frame_samples - Interleaved samples per frame
+*
+* Return:
+*  CY_RSLT_SUCCESS on success, I2S_DMA_FAILURE otherwise.
+*
+*******************************************************************************/
+cy_rslt_t i2s_dma_playback_init(const i2s_dma_hw_t *hw, const i2s_dma_stream_t *stream,
+                                uint32_t frame_samples)
+{
+    if ((NULL == hw) || (NULL == stream) || (0u == frame_samples) ||
+        (frame_samples > I2S_DMA_SLOT_SAMPLES))
+    {
+        return I2S_DMA_FAILURE;
+    }
+
+    i2s_dma_hw = hw;
+    i2s_dma_stream = stream;
+    i2s_dma_frame_samples = frame_samples;
+
+    memset(i2s_dma_slot_buffer, 0, sizeof(i2s_dma_slot_buffer));
+    memset(i2s_dma_slot_valid, 0, sizeof(i2s_dma_slot_valid));
+    memset(&i2s_dma_stats, 0, sizeof(i2s_dma_stats));
+    i2s_dma_playing = 0;
+    i2s_dma_streaming = false;
+    for (uint32_t slot = 0; slot < I2S_DMA_SLOT_COUNT; slot++)
+    {
+        i2s_dma_hw->sync(i2s_dma_slots[slot], sizeof(i2s_dma_slot_buffer[slot]));
+    }
+
+    return i2s_dma_hw->setup(i2s_dma_slots, I2S_DMA_SLOT_COUNT, frame_samples);
+}
+
+/*******************************************************************************
+* Function Name: i2s_dma_playback_start
+********************************************************************************
+* Summary:
+* Starts playing the chain from the first slot. The slots start out silent.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void i2s_dma_playback_start(void)
+{
+    i2s_dma_playing = 0;
+    i2s_dma_hw->start();
+}
+
+/*******************************************************************************
+* Function Name: i2s_dma_playback_stop
+********************************************************************************
+* Summary:
+* Stops the DMA.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void i2s_dma_playback_stop(void)
+{
+    i2s_dma_hw->stop();
+}
+
+/*******************************************************************************
+* Function Name: i2s_dma_playback_frame_done
+********************************************************************************
+* Summary:
+* Called once per frame when the DMA finished a slot. The slot that was just
+* played is handed to the sink, then refilled with the next frame while the
+* DMA plays the following slot.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void i2s_dma_playback_frame_done(void)
+{
+    uint32_t slot = i2s_dma_playing;
+
+    i2s_dma_stats.frames++;
+    if (i2s_dma_slot_valid[slot])
+    {
+        i2s_dma_stats.valid_frames++;
+        i2s_dma_stream->played(i2s_dma_slots[slot]);
+    }
+
+    i2s_dma_refill(slot);
+
+    i2s_dma_playing = (slot + 1u) % I2S_DMA_SLOT_COUNT;
+}
+
+/*******************************************************************************
+* Function Name: i2s_dma_playback_get_stats
+********************************************************************************
+* Summary:
+* Returns the frame and underrun counters.
+*
+* Parameters:
+*  stats - Filled with the counters
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void i2s_dma_playback_get_stats(i2s_dma_stats_t *stats)
+{
+    *stats = i2s_dma_stats;
+}
+
+/* [] END OF FILE */
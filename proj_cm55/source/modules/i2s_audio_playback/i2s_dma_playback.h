@@ -0,0 +1,120 @@
+/******************************************************************************
+* File Name : i2s_dma_playback.h
+*
+* Description :
+* Frame based I2S playback engine for a chain of DMA descriptors.
+* Hardware independent: the DMA is driven through i2s_dma_hw_t.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __I2S_DMA_PLAYBACK_H__
+#define __I2S_DMA_PLAYBACK_H__
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_result.h"
+#include "audio_pipeline_config.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Number of frame slots, one DMA descriptor each, chained in a circle. While
+ * the DMA plays one slot the CPU refills the other ones.
+ */
+#define I2S_DMA_SLOT_COUNT                      (2u)
+
+/* Alignment of the slots, a data cache line */
+#define I2S_DMA_SLOT_ALIGNMENT                  (32u)
+
+/* Interleaved samples of the largest frame a slot holds */
+#define I2S_DMA_SLOT_SAMPLES                    (AUDIO_PIPELINE_SAMPLES_PER_FRAME * AUDIO_PIPELINE_PLAYBACK_CHANNELS)
+
+#define I2S_DMA_FAILURE                         (-1)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Hardware layer. 'setup' builds the descriptor chain over the slots and
+ * arranges for i2s_dma_playback_frame_done to be called from the descriptor
+ * completion interrupt, once per played slot, in slot order. 'sync' makes a
+ * refilled slot visible to the DMA (data cache clean).
+ */
+typedef struct
+{
+    cy_rslt_t (*setup)(int16_t *const slots[], uint32_t slot_count, uint32_t frame_samples);
+    void      (*start)(void);
+    void      (*stop)(void);
+    void      (*sync)(const int16_t *slot, uint32_t size_bytes);
+} i2s_dma_hw_t;
+
+/* Audio source and sink. 'fetch' copies the next frame to play and fails
+ * when none is available; 'played' receives each frame of valid audio once
+ * it has been played out completely.
+ */
+typedef struct
+{
+    cy_rslt_t (*fetch)(int16_t *frame);
+    void      (*played)(const int16_t *frame);
+} i2s_dma_stream_t;
+
+typedef struct
+{
+    uint32_t frames;                    /* Slots played */
+    uint32_t valid_frames;              /* Slots played with audio */
+    uint32_t underruns;                 /* Silent slots played while streaming */
+} i2s_dma_stats_t;
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
+cy_rslt_t i2s_dma_playback_init(const i2s_dma_hw_t *hw, const i2s_dma_stream_t *stream,
+                                uint32_t frame_samples);
+void i2s_dma_playback_start(void);
+void i2s_dma_playback_stop(void);
+
+/* Descriptor completion interrupt */
+void i2s_dma_playback_frame_done(void);
+
+void i2s_dma_playback_get_stats(i2s_dma_stats_t *stats);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* __I2S_DMA_PLAYBACK_H__ */
+
+/* [] END OF FILE */
@@ -55,6 +55,8 @@
 #include "app_logger.h"
 #include "audio_usb_send_utils.h"
 #include "audio_conv_utils.h"
+#include "rt_stats.h"
+#include "audio_pipeline_config.h"
 
 /*******************************************************************************
 * Macros
@@ -63,19 +65,35 @@
 #define HW_FIFO_SIZE                        (I2S_HW_FIFO_SIZE / 2)
 
 /* Number of samples (for 2 channels) in the audio frame in the queue */
-#define FRAME_SIZE                          (2 * 160u)
-
-/* Number of I2S TX transactions per audio frame */
-#define NUM_I2S_BUFFERS_IN_AUDIO_FRAME      (FRAME_SIZE / HW_FIFO_SIZE)
+#define FRAME_SIZE                          (AUDIO_PIPELINE_SAMPLES_PER_FRAME * AUDIO_PIPELINE_PLAYBACK_CHANNELS)
 
 /*******************************************************************************
 * Global Variables
 *******************************************************************************/
 extern uint32_t initial_buffer_count;
-int16_t i2s_usb_buffer[FRAME_SIZE] = {0};
-uint32_t i2s_tx_frame_count = 0;
+static const int16_t i2s_zero_buffer[FRAME_SIZE] = {0};
+/* Frame being played. Points into the USB mic ring slot or the zero buffer */
+int16_t *i2s_usb_buffer = (int16_t *)i2s_zero_buffer;
+/* Number of samples of the current frame already written to I2S */
+uint32_t i2s_tx_frame_pos = 0;
+/* Number of samples (for all channels) per audio frame */
+uint32_t i2s_frame_samples = FRAME_SIZE;
 int8_t i2s_write_flag = 0;
 int8_t valid_audio_frame =0;
+/* Free running count of USB frames played out, the time base of the USB
+ * clock drift estimation */
+static volatile uint32_t i2s_played_frames = 0;
+
+#if I2S_PLAYBACK_DMA
+static cy_rslt_t i2s_dma_fetch(int16_t *frame);
+static void i2s_dma_played(const int16_t *frame);
+
+static const i2s_dma_stream_t i2s_dma_usb_stream =
+{
+    .fetch  = i2s_dma_fetch,
+    .played = i2s_dma_played,
+};
+#endif /* I2S_PLAYBACK_DMA */
 
 
 /*******************************************************************************
@@ -93,6 +111,8 @@ int8_t valid_audio_frame =0;
 *******************************************************************************/
 void i2s_init(void)
 {
+    const audio_pipeline_config_t *cfg = audio_pipeline_get_config();
+
     /* TLV codec initiailization */
     app_tlv_codec_init();
 
@@ -107,9 +127,26 @@ void i2s_init(void)
         Cy_AudioTDM_WriteTxData(TDM_STRUCT0_TX, (uint32_t) 0);
     }
 
-    app_i2s_activate();
+    i2s_frame_samples = cfg->samples_per_frame * cfg->playback_channels;
+    i2s_tx_frame_pos = 0;
+
+#if I2S_PLAYBACK_DMA
+#if RT_STATS_ENABLE
+    rt_stats_init(I2S_DMA_FRAME_PERIOD_US);
+#endif /* RT_STATS_ENABLE */
+
+    if (CY_RSLT_SUCCESS != i2s_dma_playback_init(&app_i2s_dma_hw, &i2s_dma_usb_stream, i2s_frame_samples))
+    {
+        CY_ASSERT(0);
+    }
+    i2s_dma_playback_start();
+#else
+#if RT_STATS_ENABLE
+    rt_stats_init(I2S_ISR_PERIOD_US);
+#endif /* RT_STATS_ENABLE */
+#endif /* I2S_PLAYBACK_DMA */
 
-    i2s_tx_frame_count = 0;
+    app_i2s_activate();
 }
 
 /*******************************************************************************
@@ -122,47 +159,69 @@ void i2s_init(void)
 *******************************************************************************/
 void i2s_tx_interrupt_handler(void)
 {
-    cy_rslt_t ret_val  = CY_RSLT_SUCCESS;
     int16_t* i2s_tx_ptr = NULL;
+    uint32_t remaining = 0;
+    uint32_t chunk = 0;
+    RT_STATS_BEGIN(entry_cycles);
+    CY_PROFILER_PROBE_BEGIN(CY_PROFILER_PROBE_I2S_ISR);
 
     /* Get interrupt status and check for tigger interrupt and errors */
     uint32_t intr_status = Cy_AudioTDM_GetTxInterruptStatusMasked(TDM_STRUCT0_TX);
 
     if(CY_TDM_INTR_TX_FIFO_TRIGGER & intr_status)
     {
+        RT_STATS_PERIOD(&rt_stats_i2s_latency, entry_cycles);
         i2s_write_flag = 1;
         if (i2s_write_flag)
         {
-            if (0 == i2s_tx_frame_count)
+            /* A FIFO refill may span the end of one frame and the start of
+             * the next one when the frame is not a multiple of the refill.
+             */
+            remaining = HW_FIFO_SIZE;
+            while (remaining > 0)
             {
-                ret_val = usb_mic_pop(i2s_usb_buffer);
-                if (ret_val!= CY_RSLT_SUCCESS)
+                if (0 == i2s_tx_frame_pos)
                 {
-                    initial_buffer_count = 0;
-                    memset(i2s_usb_buffer, 0, sizeof(i2s_usb_buffer));
-                    valid_audio_frame=0;
+                    /* Play the frame in place from the USB mic ring */
+                    i2s_usb_buffer = usb_mic_peek();
+                    if (NULL == i2s_usb_buffer)
+                    {
+                        initial_buffer_count = 0;
+                        i2s_usb_buffer = (int16_t *)i2s_zero_buffer;
+                        valid_audio_frame=0;
+                    }
+                    else
+                    {
+                        valid_audio_frame=1;
+                    }
                 }
-                else
+
+                chunk = i2s_frame_samples - i2s_tx_frame_pos;
+                if (chunk > remaining)
                 {
-                    valid_audio_frame=1;
+                    chunk = remaining;
                 }
-            }
 
-            /* Write the data from the buffer to I2S */
-            i2s_tx_ptr = i2s_usb_buffer + (i2s_tx_frame_count * HW_FIFO_SIZE);
-            for (uint32_t i = 0; i < HW_FIFO_SIZE; i++)
-            {
-                Cy_AudioTDM_WriteTxData(TDM_STRUCT0_TX, (uint32_t) i2s_tx_ptr[i]);
-            }
+                /* Write the data from the buffer to I2S */
+                i2s_tx_ptr = i2s_usb_buffer + i2s_tx_frame_pos;
+                for (uint32_t i = 0; i < chunk; i++)
+                {
+                    Cy_AudioTDM_WriteTxData(TDM_STRUCT0_TX, (uint32_t) i2s_tx_ptr[i]);
+                }
+                remaining -= chunk;
+                i2s_tx_frame_pos += chunk;
 
-            i2s_tx_frame_count ++;
-            if (i2s_tx_frame_count >= NUM_I2S_BUFFERS_IN_AUDIO_FRAME)
-            {
-                i2s_tx_frame_count = 0;
-                if (valid_audio_frame==1)
+                if (i2s_tx_frame_pos >= i2s_frame_samples)
                 {
-                    usb_aec_push(i2s_usb_buffer);
-                    valid_audio_frame=0;
+                    i2s_tx_frame_pos = 0;
+                    if (valid_audio_frame==1)
+                    {
+                        /* The played out frame becomes the AEC reference */
+                        usb_aec_push(i2s_usb_buffer);
+                        usb_mic_release();
+                        valid_audio_frame=0;
+                        i2s_played_frames++;
+                    }
                 }
             }
         }
@@ -174,6 +233,94 @@ void i2s_tx_interrupt_handler(void)
 
     /* Clear all Tx I2S Interrupt */
     Cy_AudioTDM_ClearTxInterrupt(TDM_STRUCT0_TX, CY_TDM_INTR_TX_MASK);
+
+    RT_STATS_END(&rt_stats_i2s_isr, entry_cycles);
+    CY_PROFILER_PROBE_END(CY_PROFILER_PROBE_I2S_ISR);
+}
+
+#if I2S_PLAYBACK_DMA
+/*******************************************************************************
+* Function Name: i2s_dma_fetch
+********************************************************************************
+* Summary:
+*  Copies the next USB frame into a DMA slot.
+*
+* Parameters:
+*  frame - Slot to fill
+*
+* Return:
+*  CY_RSLT_SUCCESS, or a failure when no frame was received.
+*
+*******************************************************************************/
+static cy_rslt_t i2s_dma_fetch(int16_t *frame)
+{
+    cy_rslt_t result = usb_mic_pop(frame);
+
+    if (CY_RSLT_SUCCESS != result)
+    {
+        initial_buffer_count = 0;
+    }
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: i2s_dma_played
+********************************************************************************
+* Summary:
+*  Hands a frame that was played out completely to the AEC reference.
+*
+* Parameters:
+*  frame - Played frame
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+static void i2s_dma_played(const int16_t *frame)
+{
+    usb_aec_push((short *)frame);
+    i2s_played_frames++;
+}
+
+/*******************************************************************************
+* Function Name: i2s_dma_interrupt_handler
+********************************************************************************
+* Summary:
+*  DMA descriptor completion ISR, once per played frame.
+* Return:
+*  None
+*******************************************************************************/
+void i2s_dma_interrupt_handler(void)
+{
+    RT_STATS_BEGIN(entry_cycles);
+    CY_PROFILER_PROBE_BEGIN(CY_PROFILER_PROBE_I2S_ISR);
+
+    app_i2s_dma_clear_interrupt();
+    RT_STATS_PERIOD(&rt_stats_i2s_latency, entry_cycles);
+
+    i2s_dma_playback_frame_done();
+
+    RT_STATS_END(&rt_stats_i2s_isr, entry_cycles);
+    CY_PROFILER_PROBE_END(CY_PROFILER_PROBE_I2S_ISR);
+}
+#endif /* I2S_PLAYBACK_DMA */
+
+/*******************************************************************************
+* Function Name: i2s_get_played_frames
+********************************************************************************
+* Summary:
+*  Returns the number of USB frames played out since power up.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  Free running frame count
+*
+*******************************************************************************/
+uint32_t i2s_get_played_frames(void)
+{
+    return i2s_played_frames;
 }
 
 /* [] END OF FILE */
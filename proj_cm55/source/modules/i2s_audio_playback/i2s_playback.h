@@ -42,7 +42,10 @@
 extern "C" {
 #endif /* __cplusplus */
 
+#include <stdint.h>
+
 void i2s_init(void);
+uint32_t i2s_get_played_frames(void);
 
 #ifdef __cplusplus
 }
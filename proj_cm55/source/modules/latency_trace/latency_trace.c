@@ -0,0 +1,467 @@
+/******************************************************************************
+* File Name : latency_trace.c
+*
+* Description :
+* Mic-to-USB latency measurement. Frames are time stamped on capture and
+* their age is recorded when they are packed for the USB IN endpoint.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include <stdbool.h>
+#include "latency_trace.h"
+#include "audio_frame_ring.h"
+
+#ifdef LATENCY_TRACE_HOST
+#include <stdio.h>
+#else
+#include "cy_pdl.h"
+#include "app_logger.h"
+#endif /* LATENCY_TRACE_HOST */
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#ifdef LATENCY_TRACE_HOST
+/* The host build runs on a synthetic clock in microseconds */
+#define LATENCY_TRACE_TICKS_PER_US              (1u)
+#define LATENCY_TRACE_LOG(format, ...)          printf(format, ##__VA_ARGS__)
+#define LATENCY_TRACE_ENTER_CRITICAL()          (0u)
+#define LATENCY_TRACE_EXIT_CRITICAL(state)      ((void)(state))
+#else
+#define LATENCY_TRACE_TICKS_PER_US              (SystemCoreClock / 1000000u)
+#define LATENCY_TRACE_LOG(format, ...)          app_log_print(format, ##__VA_ARGS__)
+#define LATENCY_TRACE_ENTER_CRITICAL()          Cy_SysLib_EnterCriticalSection()
+#define LATENCY_TRACE_EXIT_CRITICAL(state)      Cy_SysLib_ExitCriticalSection(state)
+#endif /* LATENCY_TRACE_HOST */
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    uint32_t frames;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t total_us;
+    uint32_t depth_min;
+    uint32_t depth_max;
+    uint32_t depth_last;
+    uint32_t untracked;
+    uint32_t hist[LATENCY_TRACE_BUCKETS];
+} latency_trace_window_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Capture timestamps of the frames queued for the USB IN endpoint, in the
+ * same order as the frames in the USB channel ring.
+ */
+static uint32_t latency_trace_storage[LATENCY_TRACE_MAX_FRAMES];
+static audio_frame_ring_t latency_trace_ring;
+
+/* Capture timestamp of the frame being fed to the AE */
+static uint32_t latency_trace_feed_timestamp = 0;
+static bool latency_trace_feed_valid = false;
+
+static latency_trace_window_t latency_trace_window;
+static latency_trace_window_t latency_trace_snapshot;
+
+#ifdef LATENCY_TRACE_HOST
+static uint32_t latency_trace_clock_us = 0;
+#endif /* LATENCY_TRACE_HOST */
+
+/*******************************************************************************
+* Function Name: latency_trace_init
+********************************************************************************
+* Summary:
+* Initializes the timestamp queue and clears the statistics.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  CY_RSLT_SUCCESS or LATENCY_TRACE_FAILURE.
+*
+*******************************************************************************/
+cy_rslt_t latency_trace_init(void)
+{
+    cy_rslt_t result = audio_frame_ring_init(&latency_trace_ring, latency_trace_storage,
+            sizeof(latency_trace_storage[0]), LATENCY_TRACE_MAX_FRAMES);
+
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return LATENCY_TRACE_FAILURE;
+    }
+
+    latency_trace_feed_valid = false;
+    latency_trace_reset();
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: latency_trace_now
+********************************************************************************
+* Summary:
+* Returns the timestamp used for captured frames: the DWT cycle counter on
+* the target, the synthetic clock in microseconds in the host build.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  Current timestamp.
+*
+*******************************************************************************/
+uint32_t latency_trace_now(void)
+{
+#ifdef LATENCY_TRACE_HOST
+    return latency_trace_clock_us;
+#else
+    return DWT->CYCCNT;
+#endif /* LATENCY_TRACE_HOST */
+}
+
+/*******************************************************************************
+* Function Name: latency_trace_before
+********************************************************************************
+* Summary:
+* Returns the timestamp of age_us microseconds ago. Used for frames whose
+* first sample was captured before the frame is handed over.
+*
+* Parameters:
+*  age_us - Age in microseconds
+*
+* Return:
+*  Timestamp of that time.
+*
+*******************************************************************************/
+uint32_t latency_trace_before(uint32_t age_us)
+{
+    return latency_trace_now() - (age_us * LATENCY_TRACE_TICKS_PER_US);
+}
+
+#ifdef LATENCY_TRACE_HOST
+/*******************************************************************************
+* Function Name: latency_trace_set_clock_us
+********************************************************************************
+* Summary:
+* Sets the synthetic clock of the host build. The replay driver advances it
+* by one frame period per captured frame.
+*
+* Parameters:
+*  now_us - Current time in microseconds
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void latency_trace_set_clock_us(uint32_t now_us)
+{
+    latency_trace_clock_us = now_us;
+}
+#endif /* LATENCY_TRACE_HOST */
+
+/*******************************************************************************
+* Function Name: latency_trace_feed
+********************************************************************************
+* Summary:
+* Latches the capture timestamp of the frame about to be fed to the AE. The
+* AE output of the frame is queued for USB from within the feed.
+*
+* Parameters:
+*  timestamp - Capture timestamp of the frame
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void latency_trace_feed(uint32_t timestamp)
+{
+    latency_trace_feed_timestamp = timestamp;
+    latency_trace_feed_valid = true;
+}
+
+/*******************************************************************************
+* Function Name: latency_trace_queued
+********************************************************************************
+* Summary:
+* Records that the AE output of the current frame was queued for USB. Call
+* only when the frame was accepted by the USB channel ring.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void latency_trace_queued(void)
+{
+    if (latency_trace_feed_valid)
+    {
+        (void)audio_frame_ring_write(&latency_trace_ring, &latency_trace_feed_timestamp);
+        latency_trace_feed_valid = false;
+    }
+}
+
+/*******************************************************************************
+* Function Name: latency_trace_sent
+********************************************************************************
+* Summary:
+* Records the age of the frame that starts being packed for the USB IN
+* endpoint and the depth of the USB queue at that time.
+*
+* Parameters:
+*  queue_depth - Frames in the USB channel ring, including this one
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void latency_trace_sent(uint32_t queue_depth)
+{
+    uint32_t timestamp = 0;
+    uint32_t age_us = 0;
+    uint32_t bucket = 0;
+    latency_trace_window_t *window = &latency_trace_window;
+
+    if (0u == window->frames + window->untracked)
+    {
+        window->depth_min = queue_depth;
+    }
+    window->depth_last = queue_depth;
+    if (queue_depth < window->depth_min)
+    {
+        window->depth_min = queue_depth;
+    }
+    if (queue_depth > window->depth_max)
+    {
+        window->depth_max = queue_depth;
+    }
+
+    if (CY_RSLT_SUCCESS != audio_frame_ring_read(&latency_trace_ring, &timestamp))
+    {
+        window->untracked++;
+        return;
+    }
+
+    age_us = (latency_trace_now() - timestamp) / LATENCY_TRACE_TICKS_PER_US;
+
+    window->frames++;
+    window->total_us += age_us;
+    if (age_us < window->min_us)
+    {
+        window->min_us = age_us;
+    }
+    if (age_us > window->max_us)
+    {
+        window->max_us = age_us;
+    }
+
+    bucket = age_us / LATENCY_TRACE_BUCKET_US;
+    if (bucket >= LATENCY_TRACE_BUCKETS)
+    {
+        bucket = LATENCY_TRACE_BUCKETS - 1u;
+    }
+    window->hist[bucket]++;
+}
+
+/*******************************************************************************
+* Function Name: latency_trace_flush
+********************************************************************************
+* Summary:
+* Drops the queued timestamps. Call when the USB channel ring is flushed.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void latency_trace_flush(void)
+{
+    audio_frame_ring_flush(&latency_trace_ring);
+    latency_trace_feed_valid = false;
+}
+
+/*******************************************************************************
+* Function Name: latency_trace_percentile
+********************************************************************************
+* Summary:
+* Returns the upper bound of the histogram bucket holding a percentile.
+*
+* Parameters:
+*  window - Window to evaluate
+*  percent - Percentile, 1 to 100
+*
+* Return:
+*  Percentile in microseconds.
+*
+*******************************************************************************/
+static uint32_t latency_trace_percentile(const latency_trace_window_t *window, uint32_t percent)
+{
+    uint32_t rank = (uint32_t)((((uint64_t)window->frames * percent) + 99u) / 100u);
+    uint32_t seen = 0;
+    uint32_t bound = 0;
+    uint32_t i = 0;
+
+    for (i = 0; i < LATENCY_TRACE_BUCKETS; i++)
+    {
+        seen += window->hist[i];
+        if (seen >= rank)
+        {
+            break;
+        }
+    }
+    bound = ((i + 1u) * LATENCY_TRACE_BUCKET_US) - 1u;
+    if ((i >= (LATENCY_TRACE_BUCKETS - 1u)) || (bound > window->max_us))
+    {
+        return window->max_us;
+    }
+
+    return bound;
+}
+
+/*******************************************************************************
+* Function Name: latency_trace_get_summary
+********************************************************************************
+* Summary:
+* Returns the statistics of the current window and starts a new one.
+*
+* Parameters:
+*  summary - Filled with the window statistics
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void latency_trace_get_summary(latency_trace_summary_t *summary)
+{
+    const latency_trace_window_t *window = &latency_trace_snapshot;
+    uint32_t state = LATENCY_TRACE_ENTER_CRITICAL();
+
+    latency_trace_snapshot = latency_trace_window;
+    memset(&latency_trace_window, 0, sizeof(latency_trace_window));
+    latency_trace_window.min_us = UINT32_MAX;
+
+    LATENCY_TRACE_EXIT_CRITICAL(state);
+
+    memset(summary, 0, sizeof(*summary));
+    summary->depth_min = window->depth_min;
+    summary->depth_max = window->depth_max;
+    summary->depth_last = window->depth_last;
+    summary->untracked = window->untracked;
+    if (0u == window->frames)
+    {
+        return;
+    }
+
+    summary->frames = window->frames;
+    summary->min_us = window->min_us;
+    summary->avg_us = (uint32_t)(window->total_us / window->frames);
+    summary->p50_us = latency_trace_percentile(window, 50u);
+    summary->p99_us = latency_trace_percentile(window, 99u);
+    summary->max_us = window->max_us;
+}
+
+/*******************************************************************************
+* Function Name: latency_trace_print
+********************************************************************************
+* Summary:
+* Prints the latency distribution and USB queue depth of the current window
+* and starts a new one. Printing periodically gives the evolution over time.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void latency_trace_print(void)
+{
+    latency_trace_summary_t summary;
+    uint32_t i = 0;
+
+    latency_trace_get_summary(&summary);
+
+    LATENCY_TRACE_LOG("mic-to-USB n=%lu min=%luus avg=%luus p50=%luus p99=%luus max=%luus "
+            "depth=%lu [%lu..%lu] untracked=%lu\r\n",
+            (unsigned long)summary.frames, (unsigned long)summary.min_us,
+            (unsigned long)summary.avg_us, (unsigned long)summary.p50_us,
+            (unsigned long)summary.p99_us, (unsigned long)summary.max_us,
+            (unsigned long)summary.depth_last, (unsigned long)summary.depth_min,
+            (unsigned long)summary.depth_max, (unsigned long)summary.untracked);
+
+    for (i = 0; i < LATENCY_TRACE_BUCKETS; i++)
+    {
+        if (0u != latency_trace_snapshot.hist[i])
+        {
+            LATENCY_TRACE_LOG("  %3lu-%3lums %lu\r\n",
+                    (unsigned long)((i * LATENCY_TRACE_BUCKET_US) / 1000u),
+                    (unsigned long)(((i + 1u) * LATENCY_TRACE_BUCKET_US) / 1000u),
+                    (unsigned long)latency_trace_snapshot.hist[i]);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: latency_trace_reset
+********************************************************************************
+* Summary:
+* Clears the statistics of the current window.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void latency_trace_reset(void)
+{
+    uint32_t state = LATENCY_TRACE_ENTER_CRITICAL();
+
+    memset(&latency_trace_window, 0, sizeof(latency_trace_window));
+    latency_trace_window.min_us = UINT32_MAX;
+
+    LATENCY_TRACE_EXIT_CRITICAL(state);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,132 @@
+/******************************************************************************
+* File Name : latency_trace.h
+*
+* Description :
+* Mic-to-USB latency measurement. Frames are time stamped on capture and
+* their age is recorded when they are packed for the USB IN endpoint.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __LATENCY_TRACE_H__
+#define __LATENCY_TRACE_H__
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include "cy_result.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 to measure the mic-to-USB latency. The report is printed
+ * periodically on the debug UART, so keep this disabled while tuning with
+ * the AFE configurator.
+ */
+#ifndef LATENCY_TRACE_ENABLE
+#define LATENCY_TRACE_ENABLE                    (0)
+#endif /* LATENCY_TRACE_ENABLE */
+
+/* Width and number of the latency histogram buckets. The last bucket
+ * collects all larger values.
+ */
+#define LATENCY_TRACE_BUCKET_US                 (2000u)
+#define LATENCY_TRACE_BUCKETS                   (64u)
+
+/* Maximum number of frames in flight between the AE output and the USB IN
+ * endpoint. Must not be lower than the USB channel ring.
+ */
+#define LATENCY_TRACE_MAX_FRAMES                (128u)
+
+#define LATENCY_TRACE_FAILURE                   (-1)
+
+#if LATENCY_TRACE_ENABLE
+#define LATENCY_TRACE_NOW()                     latency_trace_now()
+#define LATENCY_TRACE_BEFORE(age_us)            latency_trace_before(age_us)
+#define LATENCY_TRACE_FEED(timestamp)           latency_trace_feed(timestamp)
+#define LATENCY_TRACE_QUEUED()                  latency_trace_queued()
+#define LATENCY_TRACE_SENT(queue_depth)         latency_trace_sent(queue_depth)
+#define LATENCY_TRACE_FLUSH()                   latency_trace_flush()
+#else
+#define LATENCY_TRACE_NOW()                     (0u)
+#define LATENCY_TRACE_BEFORE(age_us)            (0u)
+#define LATENCY_TRACE_FEED(timestamp)
+#define LATENCY_TRACE_QUEUED()
+#define LATENCY_TRACE_SENT(queue_depth)
+#define LATENCY_TRACE_FLUSH()
+#endif /* LATENCY_TRACE_ENABLE */
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Latency and USB queue depth over one report window */
+typedef struct
+{
+    uint32_t frames;                    /* Frames sent in the window */
+    uint32_t min_us;
+    uint32_t avg_us;
+    uint32_t p50_us;                    /* Upper bound of the bucket */
+    uint32_t p99_us;                    /* Upper bound of the bucket */
+    uint32_t max_us;
+    uint32_t depth_min;                 /* USB queue depth in frames */
+    uint32_t depth_max;
+    uint32_t depth_last;
+    uint32_t untracked;                 /* Frames sent without timestamp */
+} latency_trace_summary_t;
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
+cy_rslt_t latency_trace_init(void);
+uint32_t latency_trace_now(void);
+uint32_t latency_trace_before(uint32_t age_us);
+void latency_trace_feed(uint32_t timestamp);
+void latency_trace_queued(void);
+void latency_trace_sent(uint32_t queue_depth);
+void latency_trace_flush(void);
+void latency_trace_get_summary(latency_trace_summary_t *summary);
+void latency_trace_print(void);
+void latency_trace_reset(void);
+
+#ifdef LATENCY_TRACE_HOST
+void latency_trace_set_clock_us(uint32_t now_us);
+#endif /* LATENCY_TRACE_HOST */
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* __LATENCY_TRACE_H__ */
+
+/* [] END OF FILE */
@@ -48,6 +48,18 @@ extern "C" {
 #define ENABLE_STEREO_INPUT_FEED
 #endif /* AFE_INPUT_NUMBER_CHANNELS */
 
+/* Number of microphones captured into each frame. The AFE processes the first
+ * AFE_INPUT_NUMBER_CHANNELS of them, mic arrays capture more channels for
+ * beamforming and raise AUDIO_PIPELINE_MAX_MIC_CHANNELS accordingly.
+ */
+#ifndef AUDIO_INPUT_MIC_CHANNELS
+#define AUDIO_INPUT_MIC_CHANNELS                (AFE_INPUT_NUMBER_CHANNELS)
+#endif /* AUDIO_INPUT_MIC_CHANNELS */
+
+#if AUDIO_INPUT_MIC_CHANNELS < AFE_INPUT_NUMBER_CHANNELS
+#error "The AFE input channels must be captured"
+#endif
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
@@ -46,68 +46,120 @@
 #include "pdm_mic_interface.h"
 #include "audio_input_configuration.h"
 #include "app_logger.h"
+#include "ae_frame_pool.h"
+#include "rt_stats.h"
+#include "latency_trace.h"
+#include "audio_pipeline_config.h"
 #include <math.h>
+#include <string.h>
 
 /*******************************************************************************
 * Macros
 *******************************************************************************/
-#ifdef ENABLE_STEREO_INPUT_FEED
-#define MIC_MODE                         (2u)
-#else
-#define MIC_MODE                         (1u)
-#endif /* ENABLE_STEREO_INPUT_FEED */
+#define MIC_MODE                         (PDM_MIC_NUM_CHANNELS)
 
 
 #define PDM_PCM_HW_FIFO_SIZE             (64u)
-#define PDM_PCM_FRAME_INTR_CNT           (5u)
-#define MIC_RX_SAMPLES_COUNT             (160*MIC_MODE)
+#define MIC_RX_SAMPLES_COUNT             (AUDIO_PIPELINE_SAMPLES_PER_FRAME*MIC_MODE)
 
 #define PDM_SET_GAIN_ERROR               (-1)
+#define PDM_DMA_FAILURE                  (-1)
 
 
-/* The number of interrupts to get frame of 10 msec samples.
-    5 interrupts of 2msec makes 10msec frame */
-/* 10msec data is 320 samples in STEREO mode*/
-/* 10msec data is 160 samples in STEREO mode*/
-#ifdef ENABLE_STEREO_INPUT_FEED
-#define HALF_FIFO_SIZE              (PDM_PCM_HW_FIFO_SIZE)
-#else
-#define HALF_FIFO_SIZE              (PDM_PCM_HW_FIFO_SIZE/2)
-#endif /* ENABLE_STEREO_INPUT_FEED */
+/* Each interrupt delivers 2 msec of samples. A frame is complete once
+   samples_per_frame samples per channel were read, which may happen in the
+   middle of an interrupt for frame lengths that are not a multiple of 2 msec */
+#define HALF_FIFO_SIZE              ((PDM_PCM_HW_FIFO_SIZE/2) * MIC_MODE)
+
+#if PDM_CAPTURE_DMA
+/* Capture slots, one DMA descriptor per slot and channel. Each slot targets
+ * the planes of a frame from the pool; the DMA fills one slot while the
+ * frame of the other one is submitted and the slot is retargeted.
+ */
+#define PDM_DMA_SLOT_COUNT          (2u)
+/* Interrupts left to the CPU, the RX trigger is routed to the DMA */
+#define PDM_DMA_INTR_MASK           (CY_PDM_PCM_INTR_MASK & ~CY_PDM_PCM_INTR_RX_TRIGGER)
+#endif /* PDM_CAPTURE_DMA */
 
 /*******************************************************************************
 * Global Variables
 *******************************************************************************/
-int16_t mic_audio_app_buffer_ping[MIC_RX_SAMPLES_COUNT] = {0};
-int16_t mic_audio_app_buffer_pong[MIC_RX_SAMPLES_COUNT] = {0};
+/* Frame being captured. Samples are de-interleaved straight into the planar
+ * frame from the pool. If the pool is exhausted the frame is captured into
+ * pdm_drop_frame and discarded.
+ */
+static ae_frame_t pdm_drop_frame;
+ae_frame_t* pdm_frame = NULL;
+uint32_t pdm_dropped_frames = 0;
+
+/* PDM channel, configuration and gain trim of each frame channel */
+static const uint8_t pdm_mic_channel_map[MIC_MODE] = PDM_MIC_CHANNEL_MAP;
+static const cy_stc_pdm_pcm_channel_config_t* const pdm_mic_channel_config[MIC_MODE] = PDM_MIC_CHANNEL_CONFIGS;
+static const float pdm_mic_gain_trim_db[MIC_MODE] = PDM_MIC_CHANNEL_GAIN_TRIM_DB;
 
 volatile bool pdm_pcm_flag = false;
 volatile bool pdm_pcm_frame_flag = false;
-volatile uint8_t pdm_pcm_intr_cnt = 0;
-int16_t audio_frame[HALF_FIFO_SIZE] = {0};
-
-int16_t* ping_pong_local_pointer = NULL;
-int16_t* ping_pong_buffer_pointer = NULL;
+/* Number of samples per channel captured into the current frame */
+volatile uint32_t pdm_frame_pos = 0;
+/* Number of samples per channel in a frame */
+uint32_t pdm_frame_samples = AUDIO_PIPELINE_SAMPLES_PER_FRAME;
 
 volatile int16_t *audio_data_ptr = NULL;
 
 /* PDM/PCM interrupt configuration parameters */
 const cy_stc_sysint_t PDM_IRQ_cfg = {
-    .intrSrc = (IRQn_Type)CYBSP_PDM_CHANNEL_3_IRQ,
+    .intrSrc = (IRQn_Type)PDM_MIC_TRIGGER_IRQ,
     .intrPriority = PDM_PCM_INTR_PRIORITY
 };
 
+/* True when the frames are captured by DMA instead of the PDM ISR */
+static bool pdm_capture_dma = false;
+
+#if PDM_CAPTURE_DMA
+/* Frame each capture slot is filled into: a frame reserved ahead in the pool,
+ * or pdm_drop_frame if the pool had no free frame for it.
+ */
+static ae_frame_t *pdm_dma_target[PDM_DMA_SLOT_COUNT];
+static cy_stc_dma_descriptor_t pdm_dma_descriptors[MIC_MODE][PDM_DMA_SLOT_COUNT];
+
+#if MIC_MODE > 1
+static const uint32_t pdm_dma_channel[MIC_MODE] = { CYBSP_DMA_PDM_LEFT_CHANNEL, CYBSP_DMA_PDM_RIGHT_CHANNEL };
+static const cy_stc_sysint_t pdm_dma_irq_cfg[MIC_MODE] = {
+    { .intrSrc = (IRQn_Type)CYBSP_DMA_PDM_LEFT_IRQ, .intrPriority = PDM_PCM_INTR_PRIORITY },
+    { .intrSrc = (IRQn_Type)CYBSP_DMA_PDM_RIGHT_IRQ, .intrPriority = PDM_PCM_INTR_PRIORITY }
+};
+#else
+static const uint32_t pdm_dma_channel[MIC_MODE] = { CYBSP_DMA_PDM_RIGHT_CHANNEL };
+static const cy_stc_sysint_t pdm_dma_irq_cfg[MIC_MODE] = {
+    { .intrSrc = (IRQn_Type)CYBSP_DMA_PDM_RIGHT_IRQ, .intrPriority = PDM_PCM_INTR_PRIORITY }
+};
+#endif /* MIC_MODE */
+
+/* Slots completed per channel and frames handed to the pool */
+static volatile uint32_t pdm_dma_done_count[MIC_MODE];
+static uint32_t pdm_dma_frames = 0;
+/* Age of the first sample of a slot when the slot completes */
+static uint32_t pdm_dma_frame_us = 0;
+#endif /* PDM_CAPTURE_DMA */
+
 /*******************************************************************************
 * Functions Prototypes
 *******************************************************************************/
-extern void ae_audio_data_feed(int16_t *audio_data,uint16_t length);
+extern void ae_audio_frame_ready(void);
+
+#if PDM_CAPTURE_DMA
+static cy_rslt_t pdm_dma_init(void);
+static void pdm_dma_left_interrupt_handler(void);
+static void pdm_dma_right_interrupt_handler(void);
+#endif /* PDM_CAPTURE_DMA */
 
 /*******************************************************************************
  * Function Name: pdm_interrupt_handler
  ********************************************************************************
  * Summary:
  *  PDM PCM converter ISR callback.
- *  Populates ping/pong audio data buffer every 10msec.
+ *  De-interleaves the FIFO data into a planar frame from the frame pool and
+ *  submits the frame once per pipeline frame.
  *
  * Parameters:
  *  void
@@ -118,77 +170,345 @@ extern void ae_audio_data_feed(int16_t *audio_data,uint16_t length);
  *******************************************************************************/
 void pdm_interrupt_handler(void)
 {
-    static bool ping_pong = false;
     volatile uint32_t int_stat;
+    bool frame_ready = false;
+    RT_STATS_BEGIN(entry_cycles);
+    CY_PROFILER_PROBE_BEGIN(CY_PROFILER_PROBE_PDM_ISR);
 
-    /* Choose the ping pong buffer */
-    if(pdm_pcm_intr_cnt == 0)
+    int_stat = Cy_PDM_PCM_Channel_GetInterruptStatusMasked(PDM0, PDM_MIC_TRIGGER_CH_INDEX);
+    if(CY_PDM_PCM_INTR_RX_TRIGGER & int_stat)
     {
-        if (ping_pong)
+        for(uint8_t i=0; i < RX_FIFO_TRIG_LEVEL; i++)
         {
-            ping_pong_local_pointer = mic_audio_app_buffer_ping;
+            /* Start a new frame */
+            if (NULL == pdm_frame)
+            {
+                pdm_frame = ae_frame_acquire();
+                if (NULL == pdm_frame)
+                {
+                    pdm_frame = &pdm_drop_frame;
+                }
+                pdm_frame->num_channels = MIC_MODE;
+                pdm_frame->timestamp = LATENCY_TRACE_NOW();
+            }
+
+            for (uint32_t ch = 0; ch < MIC_MODE; ch++)
+            {
+                AE_FRAME_CHANNEL(pdm_frame, ch)[pdm_frame_pos] =
+                        (int16_t)Cy_PDM_PCM_Channel_ReadFifo(PDM0, pdm_mic_channel_map[ch]);
+            }
+
+            pdm_frame_pos++;
+            if (pdm_frame_samples == pdm_frame_pos)
+            {
+                pdm_frame_pos = 0;
+                if (&pdm_drop_frame != pdm_frame)
+                {
+                    AE_FRAME_COUNT_COPY(MIC_RX_SAMPLES_COUNT * sizeof(int16_t));
+                    ae_frame_submit();
+                    frame_ready = true;
+                }
+                else
+                {
+                    pdm_dropped_frames++;
+                }
+                pdm_frame = NULL;
+            }
         }
-        else
+
+        /* The FIFO is drained before the AE feed is signalled */
+        if (frame_ready)
         {
-            ping_pong_local_pointer = mic_audio_app_buffer_pong;
+            ae_audio_frame_ready();
         }
-        ping_pong_buffer_pointer = ping_pong_local_pointer;
+
+        Cy_PDM_PCM_Channel_ClearInterrupt(PDM0, PDM_MIC_TRIGGER_CH_INDEX, CY_PDM_PCM_INTR_RX_TRIGGER);
     }
 
-    int_stat = Cy_PDM_PCM_Channel_GetInterruptStatusMasked(PDM0, RIGHT_CH_INDEX);
-    if(CY_PDM_PCM_INTR_RX_TRIGGER & int_stat)
+    if((CY_PDM_PCM_INTR_RX_FIR_OVERFLOW | CY_PDM_PCM_INTR_RX_OVERFLOW |
+        CY_PDM_PCM_INTR_RX_IF_OVERFLOW | CY_PDM_PCM_INTR_RX_UNDERFLOW) & int_stat)
     {
-        for(uint8_t i=0; i < RX_FIFO_TRIG_LEVEL; i++)
-        {
-#ifdef ENABLE_STEREO_INPUT_FEED
-            int32_t data = (int32_t)Cy_PDM_PCM_Channel_ReadFifo(PDM0, LEFT_CH_INDEX);
-            *(ping_pong_buffer_pointer) = (int16_t)(data);
-            ping_pong_buffer_pointer++;
-
-            data = (int32_t)Cy_PDM_PCM_Channel_ReadFifo(PDM0, RIGHT_CH_INDEX);
-            *(ping_pong_buffer_pointer) = (int16_t)(data);
-            ping_pong_buffer_pointer++;
-#else
-            int32_t data = (int32_t)Cy_PDM_PCM_Channel_ReadFifo(PDM0, LEFT_CH_INDEX);
-            data = (int32_t)Cy_PDM_PCM_Channel_ReadFifo(PDM0, RIGHT_CH_INDEX);
-            *(ping_pong_buffer_pointer) = (int16_t)(data);
-            ping_pong_buffer_pointer++;
+        /*app_log_print("Error: channel %lu RX FIFO Error INTR_STATUS = %lu\n",
+               (unsigned long int) PDM_MIC_TRIGGER_CH_INDEX, (unsigned long int) int_stat);*/
+        Cy_PDM_PCM_Channel_ClearInterrupt(PDM0, PDM_MIC_TRIGGER_CH_INDEX, CY_PDM_PCM_INTR_MASK);
+    }
+
+    RT_STATS_END(&rt_stats_pdm_isr, entry_cycles);
+    RT_STATS_LOAD(&rt_stats_capture_load, entry_cycles);
+    CY_PROFILER_PROBE_END(CY_PROFILER_PROBE_PDM_ISR);
+}
+
+#if PDM_CAPTURE_DMA
+/*******************************************************************************
+ * Function Name: pdm_dma_reserve
+ ********************************************************************************
+ * Summary:
+ *  Returns the frame a capture slot is to be filled into: the free pool frame
+ *  after the ones already targeted by the other slot, or pdm_drop_frame if
+ *  the pool has none.
+ *
+ * Parameters:
+ *  other_slot - The capture slot the DMA is filling meanwhile
+ *
+ * Return:
+ *  Target frame
+ *
+ *******************************************************************************/
+static ae_frame_t* pdm_dma_reserve(uint32_t other_slot)
+{
+    uint32_t offset = (&pdm_drop_frame != pdm_dma_target[other_slot]) ? 1u : 0u;
+    ae_frame_t *frame = ae_frame_reserve_ahead(offset);
+
+    return (NULL != frame) ? frame : &pdm_drop_frame;
+}
+
+/*******************************************************************************
+ * Function Name: pdm_dma_set_target
+ ********************************************************************************
+ * Summary:
+ *  Points the descriptors of a capture slot at the channel planes of a frame.
+ *  The slot is not being filled, its descriptors are next in the chain once
+ *  the DMA completes the other slot.
+ *
+ * Parameters:
+ *  slot - Capture slot
+ *  frame - Frame to fill
+ *
+ * Return:
+ *  void
+ *
+ *******************************************************************************/
+static void pdm_dma_set_target(uint32_t slot, ae_frame_t *frame)
+{
+    pdm_dma_target[slot] = frame;
+
+    /* No dirty line of the planes may be written back over DMA data */
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_CleanInvalidateDCache_by_Addr((void *)frame->mic,
+            (int32_t)(MIC_MODE * AE_FRAME_CHANNEL_STRIDE * sizeof(int16_t)));
 #endif
-        }
 
-        if (pdm_pcm_intr_cnt < PDM_PCM_FRAME_INTR_CNT)
+    for (uint32_t ch = 0; ch < MIC_MODE; ch++)
+    {
+        Cy_DMA_Descriptor_SetDstAddress(&pdm_dma_descriptors[ch][slot], AE_FRAME_CHANNEL(frame, ch));
+    }
+}
+
+/*******************************************************************************
+ * Function Name: pdm_dma_frame_done
+ ********************************************************************************
+ * Summary:
+ *  Submits the frame the completed capture slot was filled into and points
+ *  the slot at the next free frame. The DMA meanwhile fills the other slot.
+ *  The frame of a slot is the oldest one targeted, so it is the one
+ *  ae_frame_acquire returns.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *
+ *******************************************************************************/
+static void pdm_dma_frame_done(void)
+{
+    uint32_t slot = pdm_dma_frames % PDM_DMA_SLOT_COUNT;
+    ae_frame_t *filled = pdm_dma_target[slot];
+    ae_frame_t *frame = NULL;
+
+    pdm_dma_frames++;
+
+    if (&pdm_drop_frame != filled)
+    {
+        frame = ae_frame_acquire();
+    }
+
+    if ((NULL == frame) || (filled != frame))
+    {
+        pdm_dropped_frames++;
+    }
+    else
+    {
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+        SCB_InvalidateDCache_by_Addr((void *)frame->mic,
+                (int32_t)(MIC_MODE * AE_FRAME_CHANNEL_STRIDE * sizeof(int16_t)));
+#endif
+        frame->num_channels = MIC_MODE;
+        frame->timestamp = LATENCY_TRACE_BEFORE(pdm_dma_frame_us);
+        ae_frame_submit();
+
+        ae_audio_frame_ready();
+    }
+
+    pdm_dma_set_target(slot, pdm_dma_reserve((slot + 1u) % PDM_DMA_SLOT_COUNT));
+}
+
+/*******************************************************************************
+ * Function Name: pdm_dma_channel_done
+ ********************************************************************************
+ * Summary:
+ *  Descriptor completion of one channel. The frame is complete once every
+ *  channel finished the slot.
+ *
+ * Parameters:
+ *  ch - Channel in frame order
+ *
+ * Return:
+ *  void
+ *
+ *******************************************************************************/
+static void pdm_dma_channel_done(uint32_t ch)
+{
+    bool frame_complete = true;
+    RT_STATS_BEGIN(entry_cycles);
+    CY_PROFILER_PROBE_BEGIN(CY_PROFILER_PROBE_PDM_ISR);
+
+    Cy_DMA_Channel_ClearInterrupt(CYBSP_DMA_PDM_RIGHT_HW, pdm_dma_channel[ch]);
+    pdm_dma_done_count[ch]++;
+
+    for (uint32_t i = 0; i < MIC_MODE; i++)
+    {
+        if (pdm_dma_done_count[i] == pdm_dma_frames)
         {
-            pdm_pcm_intr_cnt++;
+            frame_complete = false;
         }
+    }
+    if (frame_complete)
+    {
+        pdm_dma_frame_done();
+    }
 
-        if (PDM_PCM_FRAME_INTR_CNT == pdm_pcm_intr_cnt)
-        {
-            pdm_pcm_intr_cnt = 0;
-            ae_audio_data_feed(ping_pong_local_pointer, MIC_RX_SAMPLES_COUNT * 2);
+    RT_STATS_END(&rt_stats_pdm_isr, entry_cycles);
+    RT_STATS_LOAD(&rt_stats_capture_load, entry_cycles);
+    CY_PROFILER_PROBE_END(CY_PROFILER_PROBE_PDM_ISR);
+}
 
-            ping_pong = !ping_pong;
-            if (ping_pong)
-            {
-                ping_pong_local_pointer = mic_audio_app_buffer_ping;
-            }
-            else
+/*******************************************************************************
+ * Function Name: pdm_dma_left_interrupt_handler
+ ********************************************************************************
+ * Summary:
+ *  Left channel capture DMA ISR, once per frame. Stereo input only.
+ *
+ *******************************************************************************/
+static void pdm_dma_left_interrupt_handler(void)
+{
+    pdm_dma_channel_done(0u);
+}
+
+/*******************************************************************************
+ * Function Name: pdm_dma_right_interrupt_handler
+ ********************************************************************************
+ * Summary:
+ *  Right channel capture DMA ISR, once per frame.
+ *
+ *******************************************************************************/
+static void pdm_dma_right_interrupt_handler(void)
+{
+    pdm_dma_channel_done(MIC_MODE - 1u);
+}
+
+/*******************************************************************************
+ * Function Name: pdm_dma_init
+ ********************************************************************************
+ * Summary:
+ *  Sets up one DMA channel per mic channel, each with a circular chain of
+ *  2D descriptors over the capture slots. Each FIFO trigger moves one burst
+ *  from the 32-bit RX FIFO into 16-bit samples of a frame plane and the
+ *  completion of a descriptor, one frame, raises the interrupt.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  CY_RSLT_SUCCESS on success, PDM_DMA_FAILURE otherwise.
+ *
+ *******************************************************************************/
+static cy_rslt_t pdm_dma_init(void)
+{
+    cy_stc_dma_descriptor_config_t descriptor_config =
+    {
+        .retrigger       = CY_DMA_RETRIG_16CYC,
+        .interruptType   = CY_DMA_DESCR,
+        .triggerOutType  = CY_DMA_1ELEMENT,
+        .channelState    = CY_DMA_CHANNEL_ENABLED,
+        .triggerInType   = CY_DMA_X_LOOP,
+        .dataSize        = CY_DMA_HALFWORD,
+        .srcTransferSize = CY_DMA_TRANSFER_SIZE_WORD,
+        .dstTransferSize = CY_DMA_TRANSFER_SIZE_DATA,
+        .descriptorType  = CY_DMA_2D_TRANSFER,
+        .srcAddress      = NULL,
+        .dstAddress      = NULL,
+        .srcXincrement   = 0,
+        .dstXincrement   = 1,
+        .xCount          = PDM_DMA_BURST_SAMPLES,
+        .srcYincrement   = 0,
+        .dstYincrement   = PDM_DMA_BURST_SAMPLES,
+        .yCount          = pdm_frame_samples / PDM_DMA_BURST_SAMPLES,
+        .nextDescriptor  = NULL,
+    };
+    cy_stc_dma_channel_config_t channel_config =
+    {
+        .descriptor  = NULL,
+        .preemptable = false,
+        .priority    = 0,
+        .enable      = false,
+        .bufferable  = false,
+    };
+    cy_en_sysint_status_t sysint_status = CY_SYSINT_SUCCESS;
+
+    memset((void *)pdm_dma_done_count, 0, sizeof(pdm_dma_done_count));
+    pdm_dma_frames = 0;
+    pdm_dma_frame_us = (pdm_frame_samples * 1000u) / AUDIO_PIPELINE_SAMPLES_PER_MS;
+
+    /* Slot 0 is filled first, into the next free frame */
+    pdm_dma_target[1] = &pdm_drop_frame;
+    pdm_dma_target[0] = pdm_dma_reserve(1u);
+    pdm_dma_target[1] = pdm_dma_reserve(0u);
+
+    for (uint32_t ch = 0; ch < MIC_MODE; ch++)
+    {
+        descriptor_config.srcAddress = (void *)&PDM0->CH[pdm_mic_channel_map[ch]].RX_FIFO_RD;
+        for (uint32_t slot = 0; slot < PDM_DMA_SLOT_COUNT; slot++)
+        {
+            descriptor_config.dstAddress = AE_FRAME_CHANNEL(pdm_dma_target[slot], ch);
+            descriptor_config.nextDescriptor = &pdm_dma_descriptors[ch][(slot + 1u) % PDM_DMA_SLOT_COUNT];
+            if (CY_DMA_SUCCESS != Cy_DMA_Descriptor_Init(&pdm_dma_descriptors[ch][slot], &descriptor_config))
             {
-                ping_pong_local_pointer = mic_audio_app_buffer_pong;
+                return PDM_DMA_FAILURE;
             }
-            ping_pong_buffer_pointer = ping_pong_local_pointer;
         }
 
-        Cy_PDM_PCM_Channel_ClearInterrupt(PDM0, RIGHT_CH_INDEX, CY_PDM_PCM_INTR_RX_TRIGGER);
+        channel_config.descriptor = &pdm_dma_descriptors[ch][0];
+        if (CY_DMA_SUCCESS != Cy_DMA_Channel_Init(CYBSP_DMA_PDM_RIGHT_HW, pdm_dma_channel[ch], &channel_config))
+        {
+            return PDM_DMA_FAILURE;
+        }
+        Cy_DMA_Channel_SetInterruptMask(CYBSP_DMA_PDM_RIGHT_HW, pdm_dma_channel[ch], CY_DMA_INTR_MASK);
+
+        sysint_status = Cy_SysInt_Init(&pdm_dma_irq_cfg[ch], ((MIC_MODE - 1u) == ch) ?
+                pdm_dma_right_interrupt_handler : pdm_dma_left_interrupt_handler);
+        if (CY_SYSINT_SUCCESS != sysint_status)
+        {
+            return PDM_DMA_FAILURE;
+        }
+        NVIC_ClearPendingIRQ(pdm_dma_irq_cfg[ch].intrSrc);
+        NVIC_EnableIRQ(pdm_dma_irq_cfg[ch].intrSrc);
     }
 
-    if((CY_PDM_PCM_INTR_RX_FIR_OVERFLOW | CY_PDM_PCM_INTR_RX_OVERFLOW |
-        CY_PDM_PCM_INTR_RX_IF_OVERFLOW | CY_PDM_PCM_INTR_RX_UNDERFLOW) & int_stat)
+    for (uint32_t slot = 0; slot < PDM_DMA_SLOT_COUNT; slot++)
     {
-        /*app_log_print("Error: channel %lu RX FIFO Error INTR_STATUS = %lu\n",
-               (unsigned long int) RIGHT_CH_INDEX, (unsigned long int) int_stat);*/
-        Cy_PDM_PCM_Channel_ClearInterrupt(PDM0, RIGHT_CH_INDEX, CY_PDM_PCM_INTR_MASK);
+        pdm_dma_set_target(slot, pdm_dma_target[slot]);
+    }
+
+    Cy_DMA_Enable(CYBSP_DMA_PDM_RIGHT_HW);
+    for (uint32_t ch = 0; ch < MIC_MODE; ch++)
+    {
+        Cy_DMA_Channel_Enable(CYBSP_DMA_PDM_RIGHT_HW, pdm_dma_channel[ch]);
     }
+
+    return CY_RSLT_SUCCESS;
 }
+#endif /* PDM_CAPTURE_DMA */
 
 /*******************************************************************************
 * Function Name: pdm_mic_interface_init
@@ -208,6 +528,19 @@ cy_rslt_t pdm_mic_interface_init(void)
     cy_rslt_t result = CY_RSLT_SUCCESS;
     int16_t gain_scale = 0;
 
+    pdm_frame_samples = audio_pipeline_get_config()->samples_per_frame;
+    pdm_frame_pos = 0;
+
+#if PDM_CAPTURE_DMA
+    /* The DMA moves whole FIFO bursts, other frame lengths use the ISR */
+    pdm_capture_dma = (0u == (pdm_frame_samples % PDM_DMA_BURST_SAMPLES));
+    if (!pdm_capture_dma)
+    {
+        app_log_print("PDM DMA capture needs a frame of N x %u samples, using the ISR \r\n",
+                (unsigned int)PDM_DMA_BURST_SAMPLES);
+    }
+#endif /* PDM_CAPTURE_DMA */
+
     /* Initialize PDM/PCM block */
     cy_en_pdm_pcm_status_t volatile status = Cy_PDM_PCM_Init(PDM0, &CYBSP_PDM_config);
     
@@ -217,23 +550,33 @@ cy_rslt_t pdm_mic_interface_init(void)
         CY_ASSERT(0);
     }
 
-    /* Enable PDM channel, we will activate channel for record later */
-    Cy_PDM_PCM_Channel_Enable(PDM0, LEFT_CH_INDEX);
-    Cy_PDM_PCM_Channel_Enable(PDM0, RIGHT_CH_INDEX);
-
-    /* Initialize PDM/PCM channel 0 -Left, 1 -Right */
-    Cy_PDM_PCM_Channel_Init(PDM0, &LEFT_CH_CONFIG, (uint8_t)LEFT_CH_INDEX);
-    Cy_PDM_PCM_Channel_Init(PDM0, &RIGHT_CH_CONFIG, (uint8_t)RIGHT_CH_INDEX);
+    /* Enable and initialize the mapped PDM channels, we will activate them
+     * for record later
+     */
+    for (uint32_t ch = 0; ch < MIC_MODE; ch++)
+    {
+        Cy_PDM_PCM_Channel_Enable(PDM0, pdm_mic_channel_map[ch]);
+        Cy_PDM_PCM_Channel_Init(PDM0, pdm_mic_channel_config[ch], pdm_mic_channel_map[ch]);
+    }
 
-    /* Set the gain for both left and right channels. */
- 
+    /* Set the gain for all channels. */
     gain_scale = convert_db_to_pdm_scale((float)PDM_MIC_GAIN_VALUE);
     app_log_print("Setting default PDM gain to %f dB and %d scale \r\n",(float)PDM_MIC_GAIN_VALUE,gain_scale);
-    set_pdm_pcm_gain(gain_scale);
+    set_pdm_pcm_gain_db((float)PDM_MIC_GAIN_VALUE);
 
-    /* As registred for right channel, clear and set maks for it. */
-    Cy_PDM_PCM_Channel_ClearInterrupt(PDM0, RIGHT_CH_INDEX, CY_PDM_PCM_INTR_MASK);
-    Cy_PDM_PCM_Channel_SetInterruptMask(PDM0, RIGHT_CH_INDEX, CY_PDM_PCM_INTR_MASK);
+    /* As registred for the trigger channel, clear and set maks for it. */
+    Cy_PDM_PCM_Channel_ClearInterrupt(PDM0, PDM_MIC_TRIGGER_CH_INDEX, CY_PDM_PCM_INTR_MASK);
+#if PDM_CAPTURE_DMA
+    Cy_PDM_PCM_Channel_SetInterruptMask(PDM0, PDM_MIC_TRIGGER_CH_INDEX,
+            pdm_capture_dma ? PDM_DMA_INTR_MASK : CY_PDM_PCM_INTR_MASK);
+    if (pdm_capture_dma && (CY_RSLT_SUCCESS != pdm_dma_init()))
+    {
+        app_log_print("PDM DMA capture initialization has failed! \r\n");
+        CY_ASSERT(0);
+    }
+#else
+    Cy_PDM_PCM_Channel_SetInterruptMask(PDM0, PDM_MIC_TRIGGER_CH_INDEX, CY_PDM_PCM_INTR_MASK);
+#endif /* PDM_CAPTURE_DMA */
 
     /* Register the PDM/PCM hardware block IRQ handler */
     if(CY_SYSINT_SUCCESS != Cy_SysInt_Init(&PDM_IRQ_cfg, &pdm_interrupt_handler))
@@ -272,7 +615,7 @@ cy_rslt_t pdm_mic_interface_deinit(void)
 /*******************************************************************************
  * Function Name: app_pdm_pcm_activate
  ********************************************************************************
-* Summary: This function activates the left and righ channel.
+* Summary: This function activates the mapped mic channels.
 *
 * Parameters:
 *  None
@@ -283,15 +626,17 @@ cy_rslt_t pdm_mic_interface_deinit(void)
 *******************************************************************************/
 void app_pdm_pcm_activate(void)
 {
-    /* Activate recording from channel after init Activate Channel */
-    Cy_PDM_PCM_Activate_Channel(PDM0, LEFT_CH_INDEX);
-    Cy_PDM_PCM_Activate_Channel(PDM0, RIGHT_CH_INDEX);
+    /* Activate recording from channel after init Activate Channel. */
+    for (uint32_t ch = 0; ch < MIC_MODE; ch++)
+    {
+        Cy_PDM_PCM_Activate_Channel(PDM0, pdm_mic_channel_map[ch]);
+    }
 }
 
 /*******************************************************************************
 * Function Name: app_pdm_pcm_deactivate
 ********************************************************************************
-* Summary: This function activates the left and righ channel.
+* Summary: This function deactivates the mapped mic channels.
 *
 * Parameters:
 *  none
@@ -302,8 +647,79 @@ void app_pdm_pcm_activate(void)
 *******************************************************************************/
 void app_pdm_pcm_deactivate(void)
 {
-    Cy_PDM_PCM_DeActivate_Channel(PDM0, LEFT_CH_INDEX);
-    Cy_PDM_PCM_DeActivate_Channel(PDM0, RIGHT_CH_INDEX);
+    for (uint32_t ch = 0; ch < MIC_MODE; ch++)
+    {
+        Cy_PDM_PCM_DeActivate_Channel(PDM0, pdm_mic_channel_map[ch]);
+    }
+}
+
+/*******************************************************************************
+* Function Name: pdm_mic_interface_stop
+********************************************************************************
+* Summary:
+*  Stops the capture. The mic channels are deactivated and the capture
+*  interrupts disabled, so the capture path no longer produces frames into
+*  the frame pool. A partially captured frame is discarded; its pool slot
+*  was only reserved and is reused by the next producer.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void pdm_mic_interface_stop(void)
+{
+    app_pdm_pcm_deactivate();
+
+    NVIC_DisableIRQ(PDM_IRQ_cfg.intrSrc);
+#if PDM_CAPTURE_DMA
+    if (pdm_capture_dma)
+    {
+        for (uint32_t ch = 0; ch < MIC_MODE; ch++)
+        {
+            NVIC_DisableIRQ(pdm_dma_irq_cfg[ch].intrSrc);
+        }
+    }
+#endif /* PDM_CAPTURE_DMA */
+
+    pdm_frame = NULL;
+    pdm_frame_pos = 0;
+}
+
+/*******************************************************************************
+* Function Name: pdm_mic_interface_start
+********************************************************************************
+* Summary:
+*  Restarts the capture stopped by pdm_mic_interface_stop. In DMA capture
+*  mode the descriptor chain resumes the slot it was filling, so the first
+*  frame after a restart may start with samples captured before the stop.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void pdm_mic_interface_start(void)
+{
+    Cy_PDM_PCM_Channel_ClearInterrupt(PDM0, PDM_MIC_TRIGGER_CH_INDEX, CY_PDM_PCM_INTR_MASK);
+    NVIC_ClearPendingIRQ(PDM_IRQ_cfg.intrSrc);
+    NVIC_EnableIRQ(PDM_IRQ_cfg.intrSrc);
+#if PDM_CAPTURE_DMA
+    if (pdm_capture_dma)
+    {
+        for (uint32_t ch = 0; ch < MIC_MODE; ch++)
+        {
+            NVIC_ClearPendingIRQ(pdm_dma_irq_cfg[ch].intrSrc);
+            NVIC_EnableIRQ(pdm_dma_irq_cfg[ch].intrSrc);
+        }
+    }
+#endif /* PDM_CAPTURE_DMA */
+
+    app_pdm_pcm_activate();
 }
 
 /*******************************************************************************
@@ -466,10 +882,33 @@ int16_t convert_db_to_pdm_scale(float db)
  *******************************************************************************/
 void set_pdm_pcm_gain(int16_t gain)
 {
+    for (uint32_t ch = 0; ch < MIC_MODE; ch++)
+    {
+        Cy_PDM_PCM_SetGain(PDM0, pdm_mic_channel_map[ch], gain);
+    }
+}
 
-    Cy_PDM_PCM_SetGain(PDM0, RIGHT_CH_INDEX, gain);
-    Cy_PDM_PCM_SetGain(PDM0, LEFT_CH_INDEX, gain);
-
+/*******************************************************************************
+ * Function Name: set_pdm_pcm_gain_db
+ ********************************************************************************
+ * Summary:
+ *  Sets the mic gain in dB. Each channel gets the gain plus its trim from
+ *  PDM_MIC_CHANNEL_GAIN_TRIM_DB, rounded to the PDM gain steps.
+ *
+ * Parameters:
+ *  db - Common mic gain in dB
+ *
+ * Return:
+ *  void
+ *
+ *******************************************************************************/
+void set_pdm_pcm_gain_db(float db)
+{
+    for (uint32_t ch = 0; ch < MIC_MODE; ch++)
+    {
+        Cy_PDM_PCM_SetGain(PDM0, pdm_mic_channel_map[ch],
+                convert_db_to_pdm_scale(db + pdm_mic_gain_trim_db[ch]));
+    }
 }
 
 /* [] END OF FILE */
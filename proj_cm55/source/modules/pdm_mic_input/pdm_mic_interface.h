@@ -43,7 +43,9 @@ extern "C" {
 #endif /* __cplusplus */
 
 #include "cy_result.h"
+#include "cybsp.h"
 #include "audio_input_configuration.h"
+#include "audio_pipeline_config.h"
 
 /*******************************************************************************
 * Macros
@@ -57,6 +59,75 @@ extern "C" {
 #define LEFT_CH_CONFIG                          channel_2_config
 #define RIGHT_CH_CONFIG                         channel_3_config
 
+/* Number of PDM mics captured into a frame */
+#define PDM_MIC_NUM_CHANNELS                    (AUDIO_INPUT_MIC_CHANNELS)
+
+#if PDM_MIC_NUM_CHANNELS > AUDIO_PIPELINE_MAX_MIC_CHANNELS
+#error "AUDIO_PIPELINE_MAX_MIC_CHANNELS is lower than the number of PDM mics"
+#endif
+
+/* PDM channel and device configurator settings of each frame channel, in
+ * frame order. The first AFE_INPUT_NUMBER_CHANNELS frame channels feed the
+ * AFE.
+ *
+ * By default mic arrays keep the two kit mics first and add the other PDM
+ * channels in the order 0, 1, 4, 5, 6, 7. Each added channel needs its data
+ * pin and must be enabled in the Device Configurator, which generates its
+ * channel_<n>_config. Arrays wired differently define both lists.
+ */
+#if !defined(PDM_MIC_CHANNEL_MAP)
+#if PDM_MIC_NUM_CHANNELS == 1
+#define PDM_MIC_CHANNEL_MAP                     { RIGHT_CH_INDEX }
+#define PDM_MIC_CHANNEL_CONFIGS                 { &RIGHT_CH_CONFIG }
+#elif PDM_MIC_NUM_CHANNELS == 2
+#define PDM_MIC_CHANNEL_MAP                     { LEFT_CH_INDEX, RIGHT_CH_INDEX }
+#define PDM_MIC_CHANNEL_CONFIGS                 { &LEFT_CH_CONFIG, &RIGHT_CH_CONFIG }
+#elif PDM_MIC_NUM_CHANNELS == 3
+#define PDM_MIC_CHANNEL_MAP                     { LEFT_CH_INDEX, RIGHT_CH_INDEX, 0u }
+#define PDM_MIC_CHANNEL_CONFIGS                 { &LEFT_CH_CONFIG, &RIGHT_CH_CONFIG, &channel_0_config }
+#elif PDM_MIC_NUM_CHANNELS == 4
+#define PDM_MIC_CHANNEL_MAP                     { LEFT_CH_INDEX, RIGHT_CH_INDEX, 0u, 1u }
+#define PDM_MIC_CHANNEL_CONFIGS                 { &LEFT_CH_CONFIG, &RIGHT_CH_CONFIG, &channel_0_config, \
+                                                  &channel_1_config }
+#elif PDM_MIC_NUM_CHANNELS == 5
+#define PDM_MIC_CHANNEL_MAP                     { LEFT_CH_INDEX, RIGHT_CH_INDEX, 0u, 1u, 4u }
+#define PDM_MIC_CHANNEL_CONFIGS                 { &LEFT_CH_CONFIG, &RIGHT_CH_CONFIG, &channel_0_config, \
+                                                  &channel_1_config, &channel_4_config }
+#elif PDM_MIC_NUM_CHANNELS == 6
+#define PDM_MIC_CHANNEL_MAP                     { LEFT_CH_INDEX, RIGHT_CH_INDEX, 0u, 1u, 4u, 5u }
+#define PDM_MIC_CHANNEL_CONFIGS                 { &LEFT_CH_CONFIG, &RIGHT_CH_CONFIG, &channel_0_config, \
+                                                  &channel_1_config, &channel_4_config, &channel_5_config }
+#elif PDM_MIC_NUM_CHANNELS == 7
+#define PDM_MIC_CHANNEL_MAP                     { LEFT_CH_INDEX, RIGHT_CH_INDEX, 0u, 1u, 4u, 5u, 6u }
+#define PDM_MIC_CHANNEL_CONFIGS                 { &LEFT_CH_CONFIG, &RIGHT_CH_CONFIG, &channel_0_config, \
+                                                  &channel_1_config, &channel_4_config, &channel_5_config, \
+                                                  &channel_6_config }
+#elif PDM_MIC_NUM_CHANNELS == 8
+#define PDM_MIC_CHANNEL_MAP                     { LEFT_CH_INDEX, RIGHT_CH_INDEX, 0u, 1u, 4u, 5u, 6u, 7u }
+#define PDM_MIC_CHANNEL_CONFIGS                 { &LEFT_CH_CONFIG, &RIGHT_CH_CONFIG, &channel_0_config, \
+                                                  &channel_1_config, &channel_4_config, &channel_5_config, \
+                                                  &channel_6_config, &channel_7_config }
+#else
+#error "Define PDM_MIC_CHANNEL_MAP and PDM_MIC_CHANNEL_CONFIGS for the mic array"
+#endif
+#endif /* PDM_MIC_CHANNEL_MAP */
+
+/* Gain trim in dB of each frame channel on top of the common mic gain, to
+ * match the sensitivity of the mics of an array. Missing entries are 0 dB.
+ */
+#if !defined(PDM_MIC_CHANNEL_GAIN_TRIM_DB)
+#define PDM_MIC_CHANNEL_GAIN_TRIM_DB            { 0.0f }
+#endif /* PDM_MIC_CHANNEL_GAIN_TRIM_DB */
+
+/* PDM channel whose RX FIFO trigger runs the capture ISR and its interrupt.
+ * The channels share the PDM clock, so all mapped FIFOs fill together. It
+ * must be one of the mapped channels.
+ */
+#if !defined(PDM_MIC_TRIGGER_CH_INDEX)
+#define PDM_MIC_TRIGGER_CH_INDEX                (RIGHT_CH_INDEX)
+#define PDM_MIC_TRIGGER_IRQ                     (CYBSP_PDM_CHANNEL_3_IRQ)
+#endif /* PDM_MIC_TRIGGER_CH_INDEX */
+
 /* PDM PCM hardware FIFO size */
 #define PDM_HW_FIFO_SIZE                        (64u)
 /* PDM Half FIFO Size */
@@ -70,6 +141,33 @@ extern "C" {
 /* PDM PCM interrupt priority */
 #define PDM_PCM_INTR_PRIORITY                   (7u)
 
+/* Capture through DMA when the BSP has a DMA channel named CYBSP_DMA_PDM_RIGHT
+ * triggered by the right channel RX FIFO trigger, and for stereo input one
+ * named CYBSP_DMA_PDM_LEFT on the same DMA block triggered by the left one.
+ * Otherwise, and for arrays of more than 2 mics, the PDM ISR drains the
+ * FIFOs.
+ *
+ * Opt-in: the design.modus files in templates/ do not define these channels,
+ * so the default build captures through the ISR. To use the DMA path add the
+ * DMA channels with the aliases above in the Device Configurator and route
+ * the PDM RX FIFO triggers to them. The DMA capture has not been run on
+ * hardware yet.
+ */
+#if !defined(PDM_CAPTURE_DMA)
+#if defined(CYBSP_DMA_PDM_RIGHT_HW) && defined(CYBSP_DMA_PDM_RIGHT_CHANNEL) && defined(CYBSP_DMA_PDM_RIGHT_IRQ) && \
+    (PDM_MIC_NUM_CHANNELS <= 2) && \
+    ((PDM_MIC_NUM_CHANNELS == 1) || (defined(CYBSP_DMA_PDM_LEFT_CHANNEL) && defined(CYBSP_DMA_PDM_LEFT_IRQ)))
+#define PDM_CAPTURE_DMA                         (1)
+#else
+#define PDM_CAPTURE_DMA                         (0)
+#endif
+#endif /* PDM_CAPTURE_DMA */
+
+/* Samples moved by the DMA per FIFO trigger. The frame length must be a
+ * multiple of it.
+ */
+#define PDM_DMA_BURST_SAMPLES                   (RX_FIFO_TRIG_LEVEL)
+
 
 #define PDM_MIC_GAIN_VALUE                      (AFE_MIC_INPUT_GAIN_DB)
 
@@ -121,10 +219,13 @@ extern "C" {
 *******************************************************************************/
 cy_rslt_t pdm_mic_interface_init(void);
 cy_rslt_t pdm_mic_interface_deinit(void);
+void pdm_mic_interface_start(void);
+void pdm_mic_interface_stop(void);
 void app_pdm_pcm_activate(void);
 
 int16_t convert_db_to_pdm_scale(float db);
 void set_pdm_pcm_gain(int16_t gain);
+void set_pdm_pcm_gain_db(float db);
 
 #if defined(__cplusplus)
 }
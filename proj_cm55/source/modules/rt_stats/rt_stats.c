@@ -0,0 +1,276 @@
+/******************************************************************************
+* File Name : rt_stats.c
+*
+* Description :
+* Real-time instrumentation of interrupt durations and interrupt entry
+* latency using the DWT cycle counter.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "rt_stats.h"
+#include "app_logger.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define RT_STATS_CYCLES_PER_US                  (SystemCoreClock / 1000000u)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* PDM receive interrupt execution time */
+rt_duration_stats_t rt_stats_pdm_isr;
+
+/* I2S transmit interrupt execution time */
+rt_duration_stats_t rt_stats_i2s_isr;
+
+/* Time spent by the AE on one frame (feed and output) */
+rt_duration_stats_t rt_stats_ae_frame;
+
+/* I2S transmit interrupt entry lateness */
+rt_period_stats_t rt_stats_i2s_latency;
+
+/* CPU time of the mic capture (PDM ISR or capture DMA interrupt) */
+rt_load_stats_t rt_stats_capture_load;
+
+/*******************************************************************************
+* Function Name: rt_stats_init
+********************************************************************************
+* Summary:
+* Enables the DWT cycle counter and clears the statistics. The cycle counter
+* is enabled without being reset so that it can be shared with the profiler.
+*
+* Parameters:
+*  i2s_period_us - Nominal period of the I2S transmit interrupt in
+*                  microseconds
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void rt_stats_init(uint32_t i2s_period_us)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    rt_stats_reset();
+    rt_stats_i2s_latency.nominal_cycles = i2s_period_us * RT_STATS_CYCLES_PER_US;
+}
+
+/*******************************************************************************
+* Function Name: rt_stats_reset
+********************************************************************************
+* Summary:
+* Clears the collected statistics. The nominal period is retained.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void rt_stats_reset(void)
+{
+    uint32_t nominal_cycles = rt_stats_i2s_latency.nominal_cycles;
+    uint32_t interrupt_state = Cy_SysLib_EnterCriticalSection();
+
+    memset(&rt_stats_pdm_isr, 0, sizeof(rt_stats_pdm_isr));
+    memset(&rt_stats_i2s_isr, 0, sizeof(rt_stats_i2s_isr));
+    memset(&rt_stats_ae_frame, 0, sizeof(rt_stats_ae_frame));
+    memset(&rt_stats_i2s_latency, 0, sizeof(rt_stats_i2s_latency));
+    memset(&rt_stats_capture_load, 0, sizeof(rt_stats_capture_load));
+    rt_stats_i2s_latency.nominal_cycles = nominal_cycles;
+
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+}
+
+/*******************************************************************************
+* Function Name: rt_stats_record_duration
+********************************************************************************
+* Summary:
+* Records the execution time of a code section that started at start_cycles.
+*
+* Parameters:
+*  stats - Statistics to update
+*  start_cycles - DWT cycle count captured at the start of the section
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void rt_stats_record_duration(rt_duration_stats_t *stats, uint32_t start_cycles)
+{
+    uint32_t cycles = DWT->CYCCNT - start_cycles;
+
+    stats->count++;
+    stats->last_cycles = cycles;
+    stats->total_cycles += cycles;
+    if (cycles > stats->max_cycles)
+    {
+        stats->max_cycles = cycles;
+    }
+}
+
+/*******************************************************************************
+* Function Name: rt_stats_record_period
+********************************************************************************
+* Summary:
+* Records the entry of a periodic interrupt. The first entry only latches the
+* timestamp.
+*
+* Parameters:
+*  stats - Statistics to update
+*  now_cycles - DWT cycle count captured on interrupt entry
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void rt_stats_record_period(rt_period_stats_t *stats, uint32_t now_cycles)
+{
+    uint32_t period;
+    uint32_t late;
+
+    if (0u != stats->last_entry)
+    {
+        period = now_cycles - stats->last_entry;
+        late = (period > stats->nominal_cycles) ? (period - stats->nominal_cycles) : 0u;
+
+        stats->count++;
+        stats->total_late_cycles += late;
+        if (late > stats->max_late_cycles)
+        {
+            stats->max_late_cycles = late;
+        }
+    }
+    stats->last_entry = now_cycles;
+}
+
+/*******************************************************************************
+* Function Name: rt_stats_record_load
+********************************************************************************
+* Summary:
+* Adds the execution time of a code section that started at start_cycles to
+* the current one second window. The window is closed by the first record
+* after one second, so the section must run at least every few seconds for
+* the 32-bit cycle counter not to wrap within a window.
+*
+* Parameters:
+*  stats - Statistics to update
+*  start_cycles - DWT cycle count captured at the start of the section
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void rt_stats_record_load(rt_load_stats_t *stats, uint32_t start_cycles)
+{
+    uint32_t now = DWT->CYCCNT;
+
+    if (0u == stats->window_start)
+    {
+        stats->window_start = start_cycles;
+    }
+    stats->window_cycles += now - start_cycles;
+
+    if ((now - stats->window_start) >= SystemCoreClock)
+    {
+        stats->cycles_per_second = stats->window_cycles;
+        stats->window_cycles = 0;
+        stats->window_start = now;
+    }
+}
+
+/*******************************************************************************
+* Function Name: rt_stats_print_duration
+********************************************************************************
+* Summary:
+* Prints one set of duration statistics in microseconds.
+*
+* Parameters:
+*  name - Label of the statistics
+*  stats - Statistics to print
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+static void rt_stats_print_duration(const char *name, const rt_duration_stats_t *stats)
+{
+    uint32_t cycles_per_us = RT_STATS_CYCLES_PER_US;
+    uint32_t avg = (0u != stats->count) ? (uint32_t)(stats->total_cycles / stats->count) : 0u;
+
+    app_log_print("%-10s n=%lu last=%luus avg=%luus max=%luus\r\n", name,
+            (unsigned long)stats->count,
+            (unsigned long)(stats->last_cycles / cycles_per_us),
+            (unsigned long)(avg / cycles_per_us),
+            (unsigned long)(stats->max_cycles / cycles_per_us));
+}
+
+/*******************************************************************************
+* Function Name: rt_stats_print
+********************************************************************************
+* Summary:
+* Prints the collected statistics on the debug UART.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void rt_stats_print(void)
+{
+    uint32_t cycles_per_us = RT_STATS_CYCLES_PER_US;
+    const rt_period_stats_t *lat = &rt_stats_i2s_latency;
+    uint32_t avg_late = (0u != lat->count) ? (uint32_t)(lat->total_late_cycles / lat->count) : 0u;
+
+    rt_stats_print_duration("PDM ISR", &rt_stats_pdm_isr);
+    rt_stats_print_duration("I2S ISR", &rt_stats_i2s_isr);
+    rt_stats_print_duration("AE frame", &rt_stats_ae_frame);
+    app_log_print("%-10s n=%lu avg=%luus max=%luus\r\n", "I2S late",
+            (unsigned long)lat->count,
+            (unsigned long)(avg_late / cycles_per_us),
+            (unsigned long)(lat->max_late_cycles / cycles_per_us));
+    app_log_print("%-10s %lu cycles/s (%lu us/s)\r\n", "Capture",
+            (unsigned long)rt_stats_capture_load.cycles_per_second,
+            (unsigned long)(rt_stats_capture_load.cycles_per_second / cycles_per_us));
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,146 @@
+/******************************************************************************
+* File Name : rt_stats.h
+*
+* Description :
+* Header file for real-time instrumentation of interrupt durations and
+* interrupt entry latency using the DWT cycle counter.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __RT_STATS_H__
+#define __RT_STATS_H__
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include "cy_pdl.h"
+#ifdef PROFILER_ENABLE
+#include "cy_profiler.h"
+#endif /* PROFILER_ENABLE */
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 to collect ISR duration and latency statistics. The statistics
+ * are printed periodically on the debug UART, so keep this disabled while
+ * tuning with the AFE configurator.
+ */
+#ifndef RT_STATS_ENABLE
+#define RT_STATS_ENABLE                         (0)
+#endif /* RT_STATS_ENABLE */
+
+/* RT_STATS_BEGIN declares the start timestamp 'name' of a measured section.
+ * The timestamp and every macro using it compile out when RT_STATS_ENABLE is 0.
+ */
+#if RT_STATS_ENABLE
+#define RT_STATS_BEGIN(name)                    uint32_t name = DWT->CYCCNT
+#define RT_STATS_END(stats, name)               rt_stats_record_duration((stats), (name))
+#define RT_STATS_PERIOD(stats, name)            rt_stats_record_period((stats), (name))
+#define RT_STATS_LOAD(stats, name)              rt_stats_record_load((stats), (name))
+#else
+#define RT_STATS_BEGIN(name)
+#define RT_STATS_END(stats, name)
+#define RT_STATS_PERIOD(stats, name)
+#define RT_STATS_LOAD(stats, name)
+#endif /* RT_STATS_ENABLE */
+
+/* Latency probes of the profiler component. See cy_profiler.h */
+#ifndef PROFILER_ENABLE
+#define CY_PROFILER_PROBE_ENABLE                (0)
+#define CY_PROFILER_PROBE_BEGIN(probe)
+#define CY_PROFILER_PROBE_END(probe)
+#endif /* PROFILER_ENABLE */
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Execution time of a code section in CPU cycles */
+typedef struct
+{
+    uint32_t count;
+    uint32_t last_cycles;
+    uint32_t max_cycles;
+    uint64_t total_cycles;
+} rt_duration_stats_t;
+
+/* Lateness of a periodic interrupt relative to its nominal period. The
+ * lateness of an entry is the part of the measured period that exceeds the
+ * nominal period, which bounds the extra entry latency of that interrupt.
+ */
+typedef struct
+{
+    uint32_t nominal_cycles;
+    uint32_t last_entry;
+    uint32_t count;
+    uint32_t max_late_cycles;
+    uint64_t total_late_cycles;
+} rt_period_stats_t;
+
+/* CPU cycles spent in a code section per second of run time, measured over
+ * one second windows
+ */
+typedef struct
+{
+    uint32_t window_start;
+    uint32_t window_cycles;
+    uint32_t cycles_per_second;         /* Result of the last full window */
+} rt_load_stats_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern rt_duration_stats_t rt_stats_pdm_isr;
+extern rt_duration_stats_t rt_stats_i2s_isr;
+extern rt_duration_stats_t rt_stats_ae_frame;
+extern rt_period_stats_t   rt_stats_i2s_latency;
+extern rt_load_stats_t     rt_stats_capture_load;
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
+void rt_stats_init(uint32_t i2s_period_us);
+void rt_stats_record_duration(rt_duration_stats_t *stats, uint32_t start_cycles);
+void rt_stats_record_period(rt_period_stats_t *stats, uint32_t now_cycles);
+void rt_stats_record_load(rt_load_stats_t *stats, uint32_t start_cycles);
+void rt_stats_print(void);
+void rt_stats_reset(void);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* __RT_STATS_H__ */
+
+/* [] END OF FILE */
@@ -0,0 +1,359 @@
+/******************************************************************************
+* File Name : task_stats.c
+*
+* Description :
+* Per-task CPU load and stack telemetry. The DWT cycle counter is the
+* FreeRTOS run time counter and a low priority task reports the load of
+* every task, the interrupt time and the stack high-water marks each period.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "task_stats.h"
+#include "cy_pdl.h"
+#include "app_logger.h"
+#include "rt_stats.h"
+
+#if TASK_STATS_ENABLE
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TASK_STATS_TASK_NAME                    "task_stats"
+#define TASK_STATS_TASK_PRIORITY                (tskIDLE_PRIORITY + 1)
+#define TASK_STATS_TASK_STACK_SIZE              (configMINIMAL_STACK_SIZE * 4)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Kernel snapshot, filled by the task_stats task only */
+static TaskStatus_t task_stats_status[TASK_STATS_MAX_TASKS];
+
+/* Last two samples, task_stats_current indexes the newest */
+static task_stats_sample_t task_stats_samples[2];
+static uint32_t task_stats_current = 0;
+
+#if RT_STATS_ENABLE
+static uint64_t task_stats_isr_cycles = 0;
+#endif /* RT_STATS_ENABLE */
+
+static TaskHandle_t task_stats_task_handle = NULL;
+#endif /* TASK_STATS_ENABLE */
+
+/*******************************************************************************
+* Function Name: task_stats_counter_init
+********************************************************************************
+* Summary:
+*  Enables the DWT cycle counter used as run time counter. Called by the
+*  kernel when the scheduler starts. The cycle counter is enabled without
+*  being reset so that it can be shared with the profiler and the logs.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void task_stats_counter_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/*******************************************************************************
+* Function Name: task_stats_counter_get
+********************************************************************************
+* Summary:
+*  Returns the run time counter of the kernel. It wraps every 2^32 CPU
+*  cycles, the kernel and task_stats_update only use differences.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  DWT cycle count
+*
+*******************************************************************************/
+uint32_t task_stats_counter_get(void)
+{
+    return DWT->CYCCNT;
+}
+
+/*******************************************************************************
+* Function Name: task_stats_load
+********************************************************************************
+* Summary:
+*  Converts cycles spent during a period to a load in 1/100 %.
+*
+* Parameters:
+*  cycles - Cycles spent
+*  period_cycles - Length of the period
+*
+* Return:
+*  Load, saturated at TASK_STATS_LOAD_SCALE
+*
+*******************************************************************************/
+uint32_t task_stats_load(uint32_t cycles, uint32_t period_cycles)
+{
+    if ((0u == period_cycles) || (cycles >= period_cycles))
+    {
+        return (0u == period_cycles) ? 0u : TASK_STATS_LOAD_SCALE;
+    }
+
+    return (uint32_t)(((uint64_t)cycles * TASK_STATS_LOAD_SCALE) / period_cycles);
+}
+
+/*******************************************************************************
+* Function Name: task_stats_update
+********************************************************************************
+* Summary:
+*  Computes a sample from a kernel snapshot and the previous sample, passed
+*  in sample. Tasks are matched by task number, a task created since the
+*  previous sample is charged its whole run time. Counters are subtracted
+*  modulo 2^32, so the result is right across a wrap of the cycle counter as
+*  long as the period is shorter than one wrap. Interrupt time is charged by
+*  the kernel to the task that was interrupted.
+*
+* Parameters:
+*  sample - Previous sample on entry, new sample on return
+*  status - Kernel snapshot from uxTaskGetSystemState
+*  num_tasks - Entries in status, at most TASK_STATS_MAX_TASKS
+*  total_cycles - Total run time returned with the snapshot
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void task_stats_update(task_stats_sample_t *sample, const TaskStatus_t *status,
+                       uint32_t num_tasks, uint32_t total_cycles)
+{
+    task_stats_task_t tasks[TASK_STATS_MAX_TASKS];
+    uint32_t period_cycles = total_cycles - sample->total_cycles;
+    uint32_t i;
+    uint32_t j;
+
+    if (num_tasks > TASK_STATS_MAX_TASKS)
+    {
+        num_tasks = TASK_STATS_MAX_TASKS;
+    }
+
+    for (i = 0u; i < num_tasks; i++)
+    {
+        uint32_t run_cycles = (uint32_t)status[i].ulRunTimeCounter;
+        uint32_t cycles = run_cycles;
+
+        for (j = 0u; j < sample->num_tasks; j++)
+        {
+            if (sample->tasks[j].task_number == status[i].xTaskNumber)
+            {
+                cycles = run_cycles - sample->tasks[j].run_cycles;
+                break;
+            }
+        }
+
+        tasks[i].name = status[i].pcTaskName;
+        tasks[i].task_number = status[i].xTaskNumber;
+        tasks[i].priority = status[i].uxCurrentPriority;
+        tasks[i].run_cycles = run_cycles;
+        tasks[i].load = task_stats_load(cycles, period_cycles);
+        tasks[i].stack_free_bytes = (uint32_t)status[i].usStackHighWaterMark *
+                                    (uint32_t)sizeof(StackType_t);
+    }
+
+    memcpy(sample->tasks, tasks, num_tasks * sizeof(tasks[0]));
+    sample->sequence++;
+    sample->total_cycles = total_cycles;
+    sample->period_cycles = period_cycles;
+    sample->isr_load = 0u;
+    sample->num_tasks = num_tasks;
+}
+
+#if TASK_STATS_ENABLE
+/*******************************************************************************
+* Function Name: task_stats_print
+********************************************************************************
+* Summary:
+*  Prints a sample as comma separated lines parsed by task_stats_collect.py:
+*  TS,<sequence>,P,<period cycles>,<tasks>
+*  TS,<sequence>,T,<name>,<priority>,<load %>,<free stack bytes>
+*  TS,<sequence>,I,<interrupt load %>       (with RT_STATS_ENABLE)
+*
+* Parameters:
+*  sample - Sample to print
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void task_stats_print(const task_stats_sample_t *sample)
+{
+    uint32_t i;
+
+    app_log_print("TS,%lu,P,%lu,%lu\r\n", (unsigned long)sample->sequence,
+                  (unsigned long)sample->period_cycles, (unsigned long)sample->num_tasks);
+
+    for (i = 0u; i < sample->num_tasks; i++)
+    {
+        const task_stats_task_t *task = &sample->tasks[i];
+
+        app_log_print("TS,%lu,T,%s,%lu,%lu.%02lu,%lu\r\n", (unsigned long)sample->sequence,
+                      task->name, (unsigned long)task->priority,
+                      (unsigned long)(task->load / 100u), (unsigned long)(task->load % 100u),
+                      (unsigned long)task->stack_free_bytes);
+    }
+
+#if RT_STATS_ENABLE
+    app_log_print("TS,%lu,I,%lu.%02lu\r\n", (unsigned long)sample->sequence,
+                  (unsigned long)(sample->isr_load / 100u), (unsigned long)(sample->isr_load % 100u));
+#endif /* RT_STATS_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: task_stats_task
+********************************************************************************
+* Summary:
+*  Takes a sample of every task each TASK_STATS_PERIOD_MS and prints it.
+*
+* Parameters:
+*  arg - Unused
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void task_stats_task(void *arg)
+{
+    TickType_t wake_time = xTaskGetTickCount();
+    (void)arg;
+
+    for (;;)
+    {
+        configRUN_TIME_COUNTER_TYPE total_cycles = 0;
+        task_stats_sample_t *sample = &task_stats_samples[task_stats_current ^ 1u];
+        UBaseType_t num_tasks;
+
+        vTaskDelayUntil(&wake_time, pdMS_TO_TICKS(TASK_STATS_PERIOD_MS));
+
+        num_tasks = uxTaskGetSystemState(task_stats_status, TASK_STATS_MAX_TASKS, &total_cycles);
+        if (0u == num_tasks)
+        {
+            app_log_print("task stats: more than %u tasks\r\n", (unsigned)TASK_STATS_MAX_TASKS);
+            continue;
+        }
+
+        /* The older sample slot is not read by task_stats_get while it is
+         * rebuilt from the newest one
+         */
+        *sample = task_stats_samples[task_stats_current];
+        task_stats_update(sample, task_stats_status, (uint32_t)num_tasks, (uint32_t)total_cycles);
+
+#if RT_STATS_ENABLE
+        {
+            uint32_t interrupt_state = Cy_SysLib_EnterCriticalSection();
+            uint64_t isr_cycles = rt_stats_pdm_isr.total_cycles + rt_stats_i2s_isr.total_cycles;
+            Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+            /* rt_stats_reset clears the totals */
+            sample->isr_load = task_stats_load((uint32_t)((isr_cycles >= task_stats_isr_cycles) ?
+                    (isr_cycles - task_stats_isr_cycles) : isr_cycles), sample->period_cycles);
+            task_stats_isr_cycles = isr_cycles;
+        }
+#endif /* RT_STATS_ENABLE */
+
+        taskENTER_CRITICAL();
+        task_stats_current ^= 1u;
+        taskEXIT_CRITICAL();
+
+        task_stats_print(sample);
+    }
+}
+
+/*******************************************************************************
+* Function Name: task_stats_init
+********************************************************************************
+* Summary:
+*  Creates the task_stats task. The first report covers the time since the
+*  scheduler started.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  CY_RSLT_SUCCESS on success, TASK_STATS_FAILURE otherwise.
+*
+*******************************************************************************/
+cy_rslt_t task_stats_init(void)
+{
+    BaseType_t rtos_task_status;
+
+    if (NULL != task_stats_task_handle)
+    {
+        return CY_RSLT_SUCCESS;
+    }
+
+    rtos_task_status = xTaskCreate(task_stats_task, TASK_STATS_TASK_NAME,
+            TASK_STATS_TASK_STACK_SIZE, NULL, TASK_STATS_TASK_PRIORITY,
+            &task_stats_task_handle);
+    if (pdPASS != rtos_task_status)
+    {
+        return TASK_STATS_FAILURE;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: task_stats_get
+********************************************************************************
+* Summary:
+*  Returns the newest sample.
+*
+* Parameters:
+*  sample - Receives the sample
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void task_stats_get(task_stats_sample_t *sample)
+{
+    taskENTER_CRITICAL();
+    *sample = task_stats_samples[task_stats_current];
+    taskEXIT_CRITICAL();
+}
+#endif /* TASK_STATS_ENABLE */
+
+/* [] END OF FILE */
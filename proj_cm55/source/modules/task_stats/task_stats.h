@@ -0,0 +1,118 @@
+/******************************************************************************
+* File Name : task_stats.h
+*
+* Description :
+* Per-task CPU load and stack telemetry. The DWT cycle counter is the
+* FreeRTOS run time counter and a low priority task reports the load of
+* every task, the interrupt time and the stack high-water marks each period.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __TASK_STATS_H__
+#define __TASK_STATS_H__
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include "cy_result.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* TASK_STATS_ENABLE is defined in FreeRTOSConfig.h because it also enables
+ * the run time counter of the kernel. The report is printed on the debug
+ * UART, so keep it disabled while tuning with the AFE configurator over UART.
+ */
+
+/* Interval of the reports. Must stay below one wrap of the 32 bit cycle
+ * counter, about 10 s at 400 MHz.
+ */
+#ifndef TASK_STATS_PERIOD_MS
+#define TASK_STATS_PERIOD_MS                    (1000u)
+#endif /* TASK_STATS_PERIOD_MS */
+
+/* Tasks tracked, the report is skipped while more tasks exist */
+#ifndef TASK_STATS_MAX_TASKS
+#define TASK_STATS_MAX_TASKS                    (16u)
+#endif /* TASK_STATS_MAX_TASKS */
+
+/* Loads are reported in hundredths of a percent */
+#define TASK_STATS_LOAD_SCALE                   (10000u)
+
+#define TASK_STATS_FAILURE                      (-1)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    const char *name;
+    UBaseType_t task_number;            /* Unique number, matches samples */
+    UBaseType_t priority;
+    uint32_t run_cycles;                /* Run time counter of the kernel */
+    uint32_t load;                      /* Share of the period, 1/100 % */
+    uint32_t stack_free_bytes;          /* Stack high-water mark */
+} task_stats_task_t;
+
+typedef struct
+{
+    uint32_t sequence;                  /* Number of samples taken */
+    uint32_t total_cycles;              /* Total run time at the sample */
+    uint32_t period_cycles;             /* Run time since the previous sample */
+    uint32_t isr_load;                  /* PDM and I2S interrupts, 1/100 % */
+    uint32_t num_tasks;
+    task_stats_task_t tasks[TASK_STATS_MAX_TASKS];
+} task_stats_sample_t;
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
+cy_rslt_t task_stats_init(void);
+void task_stats_counter_init(void);
+uint32_t task_stats_counter_get(void);
+void task_stats_update(task_stats_sample_t *sample, const TaskStatus_t *status,
+                       uint32_t num_tasks, uint32_t total_cycles);
+uint32_t task_stats_load(uint32_t cycles, uint32_t period_cycles);
+void task_stats_get(task_stats_sample_t *sample);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* __TASK_STATS_H__ */
+
+/* [] END OF FILE */
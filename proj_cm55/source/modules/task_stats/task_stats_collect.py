@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+################################################################################
+# File Name : task_stats_collect.py
+#
+# Description :
+# Host collector of the per-task CPU load reports of the task_stats module
+# (TASK_STATS_ENABLE).
+# Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+# an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+#
+# This software, including source code, documentation and related
+# materials ("Software") is owned by Cypress Semiconductor Corporation
+# or one of its affiliates ("Cypress") and is protected by and subject to
+# worldwide patent protection (United States and foreign),
+# United States copyright laws and international treaty provisions.
+# Therefore, you may use this Software only as provided in the license
+# agreement accompanying the software package from which you
+# obtained this Software ("EULA").
+# If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+# non-transferable license to copy, modify, and compile the Software
+# source code solely for use in connection with Cypress's
+# integrated circuit products.  Any reproduction, modification, translation,
+# compilation, or representation of this Software except as specified
+# above is prohibited without the express written permission of Cypress.
+#
+# Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+# reserves the right to make changes to the Software without notice. Cypress
+# does not assume any liability arising out of the application or use of the
+# Software or any product or circuit described in the Software. Cypress does
+# not authorize its products for use in any products where a malfunction or
+# failure of the Cypress product may reasonably be expected to result in
+# significant property damage, injury or death ("High Risk Product"). By
+# including Cypress's product in a High Risk Product, the manufacturer
+# of such system or application assumes all risk of such use and in doing
+# so agrees to indemnify Cypress against all liability.
+################################################################################
+"""
+Collects the TS,... lines printed by the CM55 when the firmware is built with
+TASK_STATS_ENABLE=1 and prints one table per report, or CSV rows with --csv.
+Other lines are ignored. On exit the peak load and the lowest free stack seen
+of every task are printed.
+
+Usage:
+    task_stats_collect.py <capture file | serial port | -> [--baud 115200]
+                          [--csv]
+
+Reading a serial port needs the pyserial package.
+"""
+
+import argparse
+import sys
+
+PREFIX = "TS,"
+
+
+class Collector:
+    """Groups the lines of a report by sequence number."""
+
+    def __init__(self, out, csv):
+        self.out = out
+        self.csv = csv
+        self.sequence = None
+        self.period_cycles = 0
+        self.tasks = []
+        self.isr_load = None
+        self.peak_load = {}
+        self.min_stack = {}
+        if csv:
+            self.out.write("sequence,task,priority,load_percent,stack_free_bytes\n")
+
+    def line(self, text):
+        if not text.startswith(PREFIX):
+            return
+        fields = text.strip().split(",")
+        try:
+            sequence = int(fields[1])
+            kind = fields[2]
+            if kind == "P":
+                self.flush()
+                self.sequence = sequence
+                self.period_cycles = int(fields[3])
+            elif sequence != self.sequence:
+                return
+            elif kind == "T":
+                name, priority, load, stack = fields[3], int(fields[4]), float(fields[5]), int(fields[6])
+                self.tasks.append((name, priority, load, stack))
+                self.peak_load[name] = max(load, self.peak_load.get(name, 0.0))
+                self.min_stack[name] = min(stack, self.min_stack.get(name, stack))
+            elif kind == "I":
+                self.isr_load = float(fields[3])
+        except (IndexError, ValueError):
+            return
+
+    def flush(self):
+        if self.sequence is None:
+            return
+        if self.csv:
+            for name, priority, load, stack in self.tasks:
+                self.out.write("%d,%s,%d,%.2f,%d\n" % (self.sequence, name, priority, load, stack))
+            if self.isr_load is not None:
+                self.out.write("%d,ISR,,%.2f,\n" % (self.sequence, self.isr_load))
+        else:
+            self.out.write("report %d, %d cycles\n" % (self.sequence, self.period_cycles))
+            self.out.write("  %-20s %4s %8s %10s\n" % ("task", "prio", "load %", "free stack"))
+            for name, priority, load, stack in sorted(self.tasks, key=lambda task: -task[2]):
+                self.out.write("  %-20s %4d %8.2f %10d\n" % (name, priority, load, stack))
+            if self.isr_load is not None:
+                self.out.write("  %-20s %4s %8.2f  (included in the tasks)\n" % ("PDM/I2S ISR", "", self.isr_load))
+        self.out.flush()
+        self.sequence = None
+        self.tasks = []
+        self.isr_load = None
+
+    def summary(self):
+        self.flush()
+        if self.csv or not self.peak_load:
+            return
+        self.out.write("summary\n")
+        self.out.write("  %-20s %8s %10s\n" % ("task", "peak %", "min stack"))
+        for name in sorted(self.peak_load, key=lambda task: -self.peak_load[task]):
+            self.out.write("  %-20s %8.2f %10d\n" % (name, self.peak_load[name], self.min_stack[name]))
+
+
+def open_input(source, baud):
+    if source == "-":
+        return sys.stdin.buffer
+    try:
+        return open(source, "rb")
+    except OSError:
+        import serial  # pylint: disable=import-outside-toplevel
+        return serial.Serial(source, baud, timeout=0.1)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Collect the task load reports of the CM55")
+    parser.add_argument("source", help="Capture file, serial port or - for stdin")
+    parser.add_argument("--baud", type=int, default=115200, help="Serial port baud rate")
+    parser.add_argument("--csv", action="store_true", help="Print CSV rows instead of tables")
+    options = parser.parse_args()
+
+    collector = Collector(sys.stdout, options.csv)
+    stream = open_input(options.source, options.baud)
+    pending = b""
+    try:
+        while True:
+            data = stream.read(256)
+            if not data:
+                if hasattr(stream, "in_waiting"):
+                    continue
+                break
+            pending += data
+            while b"\n" in pending:
+                text, pending = pending.split(b"\n", 1)
+                collector.line(text.decode("ascii", "replace"))
+    except KeyboardInterrupt:
+        pass
+    collector.summary()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,92 @@
+/******************************************************************************
+* File Name : tuner_transport.h
+*
+* Description :
+* Byte transports of the AFE tuner. The transport is selected at build
+* time, the tuner only sees the init, read and write operations.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __TUNER_TRANSPORT_H__
+#define __TUNER_TRANSPORT_H__
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include "cy_result.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TUNER_TRANSPORT_UART                    (0)
+#define TUNER_TRANSPORT_USB                     (1)
+
+/* Transport of the AFE configurator protocol. TUNER_TRANSPORT_USB adds a
+ * vendor bulk interface to the USB audio device.
+ */
+#ifndef TUNER_TRANSPORT
+#define TUNER_TRANSPORT                         (TUNER_TRANSPORT_UART)
+#endif /* TUNER_TRANSPORT */
+
+#if (TUNER_TRANSPORT != TUNER_TRANSPORT_UART) && (TUNER_TRANSPORT != TUNER_TRANSPORT_USB)
+#error "Unsupported TUNER_TRANSPORT"
+#endif
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    const char *name;
+    /* Starts the transport */
+    cy_rslt_t (*init)(void);
+    /* Copies the received bytes, up to size, without blocking */
+    uint32_t (*read)(uint8_t *buffer, uint32_t size);
+    /* Queues bytes for transmission without blocking, returns the bytes queued */
+    uint32_t (*write)(const uint8_t *data, uint32_t length);
+} tuner_transport_t;
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
+const tuner_transport_t *tuner_transport_get(void);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* __TUNER_TRANSPORT_H__ */
+
+/* [] END OF FILE */
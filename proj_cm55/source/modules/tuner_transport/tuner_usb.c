@@ -0,0 +1,400 @@
+/******************************************************************************
+* File Name : tuner_usb.c
+*
+* Description :
+* AFE tuner transport on a vendor specific bulk interface of the USB
+* audio device. A low priority task moves the bulk traffic between the
+* endpoints and two byte rings, so the tuner never blocks on USB and the
+* isochronous audio endpoints keep their bandwidth.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdbool.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "USB.h"
+#include "USB_Bulk.h"
+#include "tuner_usb.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Below every audio task, bulk traffic only uses the bus time left over by
+ * the isochronous endpoints.
+ */
+#define TUNER_USB_TASK_PRIORITY                 (1)
+#define TUNER_USB_TASK_STACK_SIZE               (configMINIMAL_STACK_SIZE * 2)
+
+/* High speed bulk packet size */
+#define TUNER_USB_PACKET_SIZE                   (512u)
+
+/* Receive timeout, bounds the delay of queued responses */
+#define TUNER_USB_RECEIVE_TIMEOUT_MS            (5)
+#define TUNER_USB_WRITE_TIMEOUT_MS              (50)
+#define TUNER_USB_UNCONFIGURED_DELAY_MS         (50)
+
+#define TUNER_USB_RX_RING_MASK                  (TUNER_USB_RX_RING_SIZE - 1u)
+#define TUNER_USB_TX_RING_MASK                  (TUNER_USB_TX_RING_SIZE - 1u)
+
+#define TUNER_USB_LOAD(var)                     __atomic_load_n(&(var), __ATOMIC_ACQUIRE)
+#define TUNER_USB_STORE(var, val)               __atomic_store_n(&(var), (val), __ATOMIC_RELEASE)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Byte rings between the bulk task and the tuner. Indices count bytes and
+ * wrap at 2^32. The bulk task owns rx_head and tx_tail, the tuner owns
+ * rx_tail and tx_head.
+ */
+static uint8_t tuner_usb_rx_ring[TUNER_USB_RX_RING_SIZE];
+static uint8_t tuner_usb_tx_ring[TUNER_USB_TX_RING_SIZE];
+static volatile uint32_t tuner_usb_rx_head = 0;
+static volatile uint32_t tuner_usb_rx_tail = 0;
+static volatile uint32_t tuner_usb_tx_head = 0;
+static volatile uint32_t tuner_usb_tx_tail = 0;
+
+static uint8_t tuner_usb_out_buffer[TUNER_USB_PACKET_SIZE];
+static uint8_t tuner_usb_packet[TUNER_USB_PACKET_SIZE];
+
+static USB_BULK_HANDLE tuner_usb_handle;
+static volatile bool tuner_usb_added = false;
+static TaskHandle_t tuner_usb_task_handle = NULL;
+
+static tuner_usb_stats_t tuner_usb_stats;
+
+/*******************************************************************************
+* Function Name: tuner_usb_add
+********************************************************************************
+* Summary:
+*  Adds the bulk IN/OUT endpoint pair and the vendor interface to the USB
+*  stack. Must be called between USBD_Init() and USBD_Start().
+*
+* Parameters:
+*  None
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void tuner_usb_add(void)
+{
+    USB_BULK_INIT_DATA init_data;
+    USB_ADD_EP_INFO ep_in;
+    USB_ADD_EP_INFO ep_out;
+
+    memset(&init_data, 0, sizeof(init_data));
+    memset(&ep_in, 0, sizeof(ep_in));
+    memset(&ep_out, 0, sizeof(ep_out));
+
+    ep_in.InDir             = USB_DIR_IN;
+    ep_in.Interval          = 0;
+    ep_in.MaxPacketSize     = TUNER_USB_PACKET_SIZE;
+    ep_in.TransferType      = USB_TRANSFER_TYPE_BULK;
+
+    ep_out.InDir            = USB_DIR_OUT;
+    ep_out.Interval         = 0;
+    ep_out.MaxPacketSize    = TUNER_USB_PACKET_SIZE;
+    ep_out.TransferType     = USB_TRANSFER_TYPE_BULK;
+
+    init_data.EPIn  = USBD_AddEPEx(&ep_in, NULL, 0);
+    init_data.EPOut = USBD_AddEPEx(&ep_out, tuner_usb_out_buffer, sizeof(tuner_usb_out_buffer));
+
+    tuner_usb_handle = USBD_BULK_Add(&init_data);
+    TUNER_USB_STORE(tuner_usb_added, true);
+}
+
+/*******************************************************************************
+* Function Name: tuner_usb_receive
+********************************************************************************
+* Summary:
+*  Copies a received packet into the receive ring. Bytes that do not fit
+*  are dropped.
+*
+* Parameters:
+*  data - Received bytes
+*  length - Number of bytes
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void tuner_usb_receive(const uint8_t *data, uint32_t length)
+{
+    uint32_t head = tuner_usb_rx_head;
+    uint32_t tail = TUNER_USB_LOAD(tuner_usb_rx_tail);
+    uint32_t count = TUNER_USB_RX_RING_SIZE - (head - tail);
+    uint32_t offset = head & TUNER_USB_RX_RING_MASK;
+    uint32_t first;
+
+    if (count > length)
+    {
+        count = length;
+    }
+    tuner_usb_stats.rx_bytes += count;
+    tuner_usb_stats.rx_overruns += length - count;
+
+    first = TUNER_USB_RX_RING_SIZE - offset;
+    if (first > count)
+    {
+        first = count;
+    }
+    memcpy(&tuner_usb_rx_ring[offset], data, first);
+    memcpy(tuner_usb_rx_ring, &data[first], count - first);
+
+    TUNER_USB_STORE(tuner_usb_rx_head, head + count);
+    if ((head + count - tail) > tuner_usb_stats.rx_max_depth)
+    {
+        tuner_usb_stats.rx_max_depth = head + count - tail;
+    }
+}
+
+/*******************************************************************************
+* Function Name: tuner_usb_transmit
+********************************************************************************
+* Summary:
+*  Sends the content of the transmit ring on the bulk IN endpoint. The ring
+*  is emptied even if the host does not read, so a stale response never
+*  blocks the next one.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void tuner_usb_transmit(void)
+{
+    uint32_t head = TUNER_USB_LOAD(tuner_usb_tx_head);
+    uint32_t tail = tuner_usb_tx_tail;
+    uint32_t contiguous;
+
+    while (head != tail)
+    {
+        contiguous = TUNER_USB_TX_RING_SIZE - (tail & TUNER_USB_TX_RING_MASK);
+        if (contiguous > (head - tail))
+        {
+            contiguous = head - tail;
+        }
+        if (USBD_BULK_Write(tuner_usb_handle, &tuner_usb_tx_ring[tail & TUNER_USB_TX_RING_MASK],
+                            contiguous, TUNER_USB_WRITE_TIMEOUT_MS) != (int)contiguous)
+        {
+            tuner_usb_stats.tx_errors++;
+        }
+        tail += contiguous;
+        TUNER_USB_STORE(tuner_usb_tx_tail, tail);
+    }
+}
+
+/*******************************************************************************
+* Function Name: tuner_usb_task
+********************************************************************************
+* Summary:
+*  Bulk transport task. Waits for the interface to be added and the host to
+*  configure the device, then alternates between flushing queued responses and receiving requests.
+*
+* Parameters:
+*  arg - Not used
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void tuner_usb_task(void *arg)
+{
+    int received;
+
+    (void)arg;
+
+    while (1)
+    {
+        if (!TUNER_USB_LOAD(tuner_usb_added) || (0 == USBD_IsConfigured()))
+        {
+            vTaskDelay(pdMS_TO_TICKS(TUNER_USB_UNCONFIGURED_DELAY_MS));
+            continue;
+        }
+
+        tuner_usb_transmit();
+
+        received = USBD_BULK_Receive(tuner_usb_handle, tuner_usb_packet, sizeof(tuner_usb_packet),
+                                     TUNER_USB_RECEIVE_TIMEOUT_MS);
+        if (received > 0)
+        {
+            tuner_usb_receive(tuner_usb_packet, (uint32_t)received);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: tuner_usb_init
+********************************************************************************
+* Summary:
+*  Starts the bulk transport task. The task idles until tuner_usb_add() was
+*  called by the USB stack setup, which may run after the tuner started.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  CY_RSLT_SUCCESS on success, TUNER_USB_FAILURE otherwise.
+*
+*******************************************************************************/
+cy_rslt_t tuner_usb_init(void)
+{
+    if (NULL != tuner_usb_task_handle)
+    {
+        return CY_RSLT_SUCCESS;
+    }
+
+    tuner_usb_rx_head = 0;
+    tuner_usb_rx_tail = 0;
+    tuner_usb_tx_head = 0;
+    tuner_usb_tx_tail = 0;
+    memset(&tuner_usb_stats, 0, sizeof(tuner_usb_stats));
+
+    if (pdPASS != xTaskCreate(tuner_usb_task, "tuner_usb", TUNER_USB_TASK_STACK_SIZE, NULL,
+                              TUNER_USB_TASK_PRIORITY, &tuner_usb_task_handle))
+    {
+        return TUNER_USB_FAILURE;
+    }
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: tuner_usb_read
+********************************************************************************
+* Summary:
+*  Copies all received bytes, up to the buffer size, without blocking.
+*
+* Parameters:
+*  buffer - Receives the bytes
+*  size - Size of the buffer
+*
+* Return:
+*  Number of bytes copied
+*
+*******************************************************************************/
+uint32_t tuner_usb_read(uint8_t *buffer, uint32_t size)
+{
+    uint32_t head = TUNER_USB_LOAD(tuner_usb_rx_head);
+    uint32_t tail = tuner_usb_rx_tail;
+    uint32_t count = head - tail;
+    uint32_t offset = tail & TUNER_USB_RX_RING_MASK;
+    uint32_t first;
+
+    if (count > size)
+    {
+        count = size;
+    }
+
+    first = TUNER_USB_RX_RING_SIZE - offset;
+    if (first > count)
+    {
+        first = count;
+    }
+    memcpy(buffer, &tuner_usb_rx_ring[offset], first);
+    memcpy(&buffer[first], tuner_usb_rx_ring, count - first);
+
+    TUNER_USB_STORE(tuner_usb_rx_tail, tail + count);
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: tuner_usb_write
+********************************************************************************
+* Summary:
+*  Queues bytes for the bulk IN endpoint without blocking. Bytes that do not
+*  fit in the transmit ring are dropped. Single writer only.
+*
+* Parameters:
+*  data - Bytes to send
+*  length - Number of bytes
+*
+* Return:
+*  Number of bytes queued
+*
+*******************************************************************************/
+uint32_t tuner_usb_write(const uint8_t *data, uint32_t length)
+{
+    uint32_t head = tuner_usb_tx_head;
+    uint32_t tail = TUNER_USB_LOAD(tuner_usb_tx_tail);
+    uint32_t count = TUNER_USB_TX_RING_SIZE - (head - tail);
+    uint32_t offset = head & TUNER_USB_TX_RING_MASK;
+    uint32_t first;
+
+    if (count > length)
+    {
+        count = length;
+    }
+    tuner_usb_stats.tx_bytes += count;
+    tuner_usb_stats.tx_overruns += length - count;
+    if (0u == count)
+    {
+        return 0u;
+    }
+
+    first = TUNER_USB_TX_RING_SIZE - offset;
+    if (first > count)
+    {
+        first = count;
+    }
+    memcpy(&tuner_usb_tx_ring[offset], data, first);
+    memcpy(tuner_usb_tx_ring, &data[first], count - first);
+
+    TUNER_USB_STORE(tuner_usb_tx_head, head + count);
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: tuner_usb_get_stats
+********************************************************************************
+* Summary:
+*  Returns the byte counters of both directions.
+*
+* Parameters:
+*  stats - Receives the statistics
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void tuner_usb_get_stats(tuner_usb_stats_t *stats)
+{
+    *stats = tuner_usb_stats;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,96 @@
+/******************************************************************************
+* File Name : tuner_usb.h
+*
+* Description :
+* AFE tuner transport on a vendor specific bulk interface of the USB
+* audio device.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __TUNER_USB_H__
+#define __TUNER_USB_H__
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include "cy_result.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Ring sizes in bytes, powers of two */
+#ifndef TUNER_USB_RX_RING_SIZE
+#define TUNER_USB_RX_RING_SIZE                  (4096u)
+#endif /* TUNER_USB_RX_RING_SIZE */
+#ifndef TUNER_USB_TX_RING_SIZE
+#define TUNER_USB_TX_RING_SIZE                  (4096u)
+#endif /* TUNER_USB_TX_RING_SIZE */
+
+#define TUNER_USB_FAILURE                       (-1)
+
+#if ((TUNER_USB_RX_RING_SIZE & (TUNER_USB_RX_RING_SIZE - 1u)) != 0) || \
+    ((TUNER_USB_TX_RING_SIZE & (TUNER_USB_TX_RING_SIZE - 1u)) != 0)
+#error "Tuner USB ring sizes must be powers of two"
+#endif
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    uint32_t rx_bytes;                  /* Bytes received */
+    uint32_t rx_overruns;               /* Bytes lost because the receive ring was full */
+    uint32_t rx_max_depth;              /* High-water mark of the receive ring */
+    uint32_t tx_bytes;                  /* Bytes queued for transmission */
+    uint32_t tx_overruns;               /* Bytes lost because the transmit ring was full */
+    uint32_t tx_errors;                 /* Bulk writes that failed or timed out */
+} tuner_usb_stats_t;
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
+void tuner_usb_add(void);
+cy_rslt_t tuner_usb_init(void);
+uint32_t tuner_usb_read(uint8_t *buffer, uint32_t size);
+uint32_t tuner_usb_write(const uint8_t *data, uint32_t length);
+void tuner_usb_get_stats(tuner_usb_stats_t *stats);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* __TUNER_USB_H__ */
+
+/* [] END OF FILE */
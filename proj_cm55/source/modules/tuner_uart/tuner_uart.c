@@ -0,0 +1,537 @@
+/******************************************************************************
+* File Name : tuner_uart.c
+*
+* Description :
+* Interrupt driven receive and transmit rings on the debug UART for the
+* AFE tuner, with the lines of the pipeline console taken out of the
+* received bytes.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "cybsp.h"
+#include "cy_pdl.h"
+#include "tuner_uart.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TUNER_UART_HW                           (CYBSP_DEBUG_UART_HW)
+
+#define TUNER_UART_RX_RING_MASK                 (TUNER_UART_RX_RING_SIZE - 1u)
+#define TUNER_UART_TX_RING_MASK                 (TUNER_UART_TX_RING_SIZE - 1u)
+
+#define TUNER_UART_LOAD(var)                    __atomic_load_n(&(var), __ATOMIC_ACQUIRE)
+#define TUNER_UART_STORE(var, val)              __atomic_store_n(&(var), (val), __ATOMIC_RELEASE)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Byte rings between the UART interrupt and the tuner. Indices count bytes
+ * and wrap at 2^32. The interrupt owns rx_head and tx_tail, the tuner owns
+ * rx_tail and tx_head.
+ */
+static uint8_t tuner_uart_rx_ring[TUNER_UART_RX_RING_SIZE];
+static uint8_t tuner_uart_tx_ring[TUNER_UART_TX_RING_SIZE];
+static volatile uint32_t tuner_uart_rx_head = 0;
+static volatile uint32_t tuner_uart_rx_tail = 0;
+static volatile uint32_t tuner_uart_tx_head = 0;
+static volatile uint32_t tuner_uart_tx_tail = 0;
+
+static tuner_uart_stats_t tuner_uart_stats;
+static bool tuner_uart_started = false;
+
+/* Console lines sharing the UART with the tuner protocol. A line that starts
+ * with the console prefix is collected by the interrupt instead of being
+ * queued for the tuner, and handed over through tuner_uart_console_ready.
+ * Prefix bytes are held back until the prefix is complete or mismatches.
+ */
+static const char *tuner_uart_console_prefix = NULL;
+static uint32_t tuner_uart_console_match = 0;
+static uint32_t tuner_uart_console_length = 0;
+static bool tuner_uart_line_start = true;
+static bool tuner_uart_console_ended = false;
+static char tuner_uart_console_collect[TUNER_UART_CONSOLE_LINE_SIZE];
+static char tuner_uart_console_line[TUNER_UART_CONSOLE_LINE_SIZE];
+static volatile bool tuner_uart_console_ready = false;
+
+static const cy_stc_sysint_t tuner_uart_irq_cfg =
+{
+    .intrSrc = (IRQn_Type)CYBSP_DEBUG_UART_IRQ,
+    .intrPriority = TUNER_UART_INTR_PRIORITY
+};
+
+/*******************************************************************************
+* Function Name: tuner_uart_put
+********************************************************************************
+* Summary:
+*  Queues a received byte for the tuner. Bytes that do not fit are dropped.
+*
+* Parameters:
+*  head - Receive ring head, advanced
+*  tail - Receive ring tail
+*  data - Received byte
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static inline void tuner_uart_put(uint32_t *head, uint32_t tail, uint8_t data)
+{
+    if ((*head - tail) < TUNER_UART_RX_RING_SIZE)
+    {
+        tuner_uart_rx_ring[*head & TUNER_UART_RX_RING_MASK] = data;
+        (*head)++;
+    }
+    else
+    {
+        tuner_uart_stats.rx_overruns++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: tuner_uart_console_end
+********************************************************************************
+* Summary:
+*  Hands the collected console line to the reader, or drops it if the
+*  previous line was not read yet.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void tuner_uart_console_end(void)
+{
+    if (TUNER_UART_LOAD(tuner_uart_console_ready))
+    {
+        tuner_uart_stats.console_drops++;
+    }
+    else
+    {
+        memcpy(tuner_uart_console_line, tuner_uart_console_collect, tuner_uart_console_length);
+        tuner_uart_console_line[tuner_uart_console_length] = '\0';
+        TUNER_UART_STORE(tuner_uart_console_ready, true);
+        tuner_uart_stats.console_lines++;
+    }
+    tuner_uart_console_length = 0;
+    tuner_uart_console_ended = true;
+    tuner_uart_line_start = true;
+}
+
+/*******************************************************************************
+* Function Name: tuner_uart_route
+********************************************************************************
+* Summary:
+*  Routes a received byte to the console line being collected or to the
+*  tuner. Only a line that starts with the console prefix goes to the
+*  console, the line end that terminates it is not passed on.
+*
+* Parameters:
+*  head - Receive ring head, advanced
+*  tail - Receive ring tail
+*  data - Received byte
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void tuner_uart_route(uint32_t *head, uint32_t tail, uint8_t data)
+{
+    const char *prefix = tuner_uart_console_prefix;
+    bool line_end = ('\r' == data) || ('\n' == data);
+    uint32_t i;
+
+    if (tuner_uart_console_ended && line_end)
+    {
+        return;
+    }
+    tuner_uart_console_ended = false;
+
+    if (0u != tuner_uart_console_length)
+    {
+        if (line_end)
+        {
+            tuner_uart_console_end();
+        }
+        else if (tuner_uart_console_length < (TUNER_UART_CONSOLE_LINE_SIZE - 1u))
+        {
+            tuner_uart_console_collect[tuner_uart_console_length++] = (char)data;
+        }
+        return;
+    }
+
+    if ((NULL != prefix) && tuner_uart_line_start &&
+        (data == (uint8_t)prefix[tuner_uart_console_match]))
+    {
+        tuner_uart_console_match++;
+        if ('\0' == prefix[tuner_uart_console_match])
+        {
+            memcpy(tuner_uart_console_collect, prefix, tuner_uart_console_match);
+            tuner_uart_console_length = tuner_uart_console_match;
+            tuner_uart_console_match = 0;
+        }
+        return;
+    }
+
+    /* Not a console line, release the prefix bytes held back */
+    for (i = 0; i < tuner_uart_console_match; i++)
+    {
+        tuner_uart_put(head, tail, (uint8_t)prefix[i]);
+    }
+    tuner_uart_console_match = 0;
+    tuner_uart_put(head, tail, data);
+    tuner_uart_line_start = line_end;
+}
+
+/*******************************************************************************
+* Function Name: tuner_uart_receive
+********************************************************************************
+* Summary:
+*  Moves the RX FIFO content into the receive ring, or into the console line
+*  being collected. Bytes that do not fit are dropped.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void tuner_uart_receive(void)
+{
+    uint32_t head = tuner_uart_rx_head;
+    uint32_t tail = TUNER_UART_LOAD(tuner_uart_rx_tail);
+
+    while (0u != Cy_SCB_UART_GetNumInRxFifo(TUNER_UART_HW))
+    {
+        tuner_uart_route(&head, tail, (uint8_t)Cy_SCB_UART_Get(TUNER_UART_HW));
+        tuner_uart_stats.rx_bytes++;
+    }
+
+    TUNER_UART_STORE(tuner_uart_rx_head, head);
+    if ((head - tail) > tuner_uart_stats.rx_max_depth)
+    {
+        tuner_uart_stats.rx_max_depth = head - tail;
+    }
+}
+
+/*******************************************************************************
+* Function Name: tuner_uart_transmit
+********************************************************************************
+* Summary:
+*  Fills the TX FIFO from the transmit ring. The FIFO level interrupt is
+*  disabled once the ring is empty and enabled again by the next write.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void tuner_uart_transmit(void)
+{
+    uint32_t head = TUNER_UART_LOAD(tuner_uart_tx_head);
+    uint32_t tail = tuner_uart_tx_tail;
+    uint32_t contiguous;
+    uint32_t count;
+
+    while (head != tail)
+    {
+        contiguous = TUNER_UART_TX_RING_SIZE - (tail & TUNER_UART_TX_RING_MASK);
+        if (contiguous > (head - tail))
+        {
+            contiguous = head - tail;
+        }
+        count = Cy_SCB_UART_PutArray(TUNER_UART_HW, &tuner_uart_tx_ring[tail & TUNER_UART_TX_RING_MASK],
+                                     contiguous);
+        if (0u == count)
+        {
+            break;
+        }
+        tail += count;
+    }
+
+    TUNER_UART_STORE(tuner_uart_tx_tail, tail);
+    if (head == tail)
+    {
+        Cy_SCB_SetTxInterruptMask(TUNER_UART_HW, 0u);
+    }
+}
+
+/*******************************************************************************
+* Function Name: tuner_uart_interrupt_handler
+********************************************************************************
+* Summary:
+*  Debug UART ISR. Drains the RX FIFO and refills the TX FIFO.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void tuner_uart_interrupt_handler(void)
+{
+    uint32_t rx_status = Cy_SCB_GetRxInterruptStatusMasked(TUNER_UART_HW);
+    uint32_t tx_status = Cy_SCB_GetTxInterruptStatusMasked(TUNER_UART_HW);
+
+    if (0u != rx_status)
+    {
+        tuner_uart_receive();
+        Cy_SCB_ClearRxInterrupt(TUNER_UART_HW, rx_status);
+    }
+
+    if (0u != (CY_SCB_TX_INTR_LEVEL & tx_status))
+    {
+        tuner_uart_transmit();
+        Cy_SCB_ClearTxInterrupt(TUNER_UART_HW, CY_SCB_TX_INTR_LEVEL);
+    }
+}
+
+/*******************************************************************************
+* Function Name: tuner_uart_init
+********************************************************************************
+* Summary:
+*  Takes over the debug UART interrupt. The RX FIFO level interrupt fires
+*  for every received byte, the TX FIFO level interrupt once the FIFO is
+*  half empty while the transmit ring holds data. The UART itself is set up
+*  by retarget-io. The tuner and the pipeline console share the UART, only
+*  the first call initializes it.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  CY_RSLT_SUCCESS on success, TUNER_UART_FAILURE otherwise.
+*
+*******************************************************************************/
+cy_rslt_t tuner_uart_init(void)
+{
+    if (tuner_uart_started)
+    {
+        return CY_RSLT_SUCCESS;
+    }
+
+    NVIC_DisableIRQ(tuner_uart_irq_cfg.intrSrc);
+
+    tuner_uart_rx_head = 0;
+    tuner_uart_rx_tail = 0;
+    tuner_uart_tx_head = 0;
+    tuner_uart_tx_tail = 0;
+    memset(&tuner_uart_stats, 0, sizeof(tuner_uart_stats));
+
+    Cy_SCB_SetRxFifoLevel(TUNER_UART_HW, 0u);
+    Cy_SCB_SetTxFifoLevel(TUNER_UART_HW, Cy_SCB_GetFifoSize(TUNER_UART_HW) / 2u);
+    Cy_SCB_SetTxInterruptMask(TUNER_UART_HW, 0u);
+    Cy_SCB_ClearTxInterrupt(TUNER_UART_HW, CY_SCB_TX_INTR_MASK);
+    Cy_SCB_ClearRxInterrupt(TUNER_UART_HW, CY_SCB_RX_INTR_MASK);
+    Cy_SCB_SetRxInterruptMask(TUNER_UART_HW, CY_SCB_RX_INTR_LEVEL);
+
+    if (CY_SYSINT_SUCCESS != Cy_SysInt_Init(&tuner_uart_irq_cfg, tuner_uart_interrupt_handler))
+    {
+        return TUNER_UART_FAILURE;
+    }
+    NVIC_ClearPendingIRQ(tuner_uart_irq_cfg.intrSrc);
+    NVIC_EnableIRQ(tuner_uart_irq_cfg.intrSrc);
+    tuner_uart_started = true;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: tuner_uart_read
+********************************************************************************
+* Summary:
+*  Copies all received bytes, up to the buffer size, without blocking.
+*
+* Parameters:
+*  buffer - Receives the bytes
+*  size - Size of the buffer
+*
+* Return:
+*  Number of bytes copied
+*
+*******************************************************************************/
+uint32_t tuner_uart_read(uint8_t *buffer, uint32_t size)
+{
+    uint32_t head = TUNER_UART_LOAD(tuner_uart_rx_head);
+    uint32_t tail = tuner_uart_rx_tail;
+    uint32_t count = head - tail;
+    uint32_t offset = tail & TUNER_UART_RX_RING_MASK;
+    uint32_t first;
+
+    if (count > size)
+    {
+        count = size;
+    }
+
+    first = TUNER_UART_RX_RING_SIZE - offset;
+    if (first > count)
+    {
+        first = count;
+    }
+    memcpy(buffer, &tuner_uart_rx_ring[offset], first);
+    memcpy(&buffer[first], tuner_uart_rx_ring, count - first);
+
+    TUNER_UART_STORE(tuner_uart_rx_tail, tail + count);
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: tuner_uart_write
+********************************************************************************
+* Summary:
+*  Queues bytes for transmission without blocking. Bytes that do not fit in
+*  the transmit ring are dropped. Single writer only.
+*
+* Parameters:
+*  data - Bytes to send
+*  length - Number of bytes
+*
+* Return:
+*  Number of bytes queued
+*
+*******************************************************************************/
+uint32_t tuner_uart_write(const uint8_t *data, uint32_t length)
+{
+    uint32_t head = tuner_uart_tx_head;
+    uint32_t tail = TUNER_UART_LOAD(tuner_uart_tx_tail);
+    uint32_t count = TUNER_UART_TX_RING_SIZE - (head - tail);
+    uint32_t offset = head & TUNER_UART_TX_RING_MASK;
+    uint32_t first;
+
+    if (count > length)
+    {
+        count = length;
+    }
+    tuner_uart_stats.tx_bytes += count;
+    tuner_uart_stats.tx_overruns += length - count;
+    if (0u == count)
+    {
+        return 0u;
+    }
+
+    first = TUNER_UART_TX_RING_SIZE - offset;
+    if (first > count)
+    {
+        first = count;
+    }
+    memcpy(&tuner_uart_tx_ring[offset], data, first);
+    memcpy(tuner_uart_tx_ring, &data[first], count - first);
+
+    TUNER_UART_STORE(tuner_uart_tx_head, head + count);
+    Cy_SCB_SetTxInterruptMask(TUNER_UART_HW, CY_SCB_TX_INTR_LEVEL);
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: tuner_uart_set_console_prefix
+********************************************************************************
+* Summary:
+*  Sets the start of the lines taken out of the received bytes for the
+*  console. NULL passes all bytes to the tuner.
+*
+* Parameters:
+*  prefix - Line prefix, a string constant
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void tuner_uart_set_console_prefix(const char *prefix)
+{
+    NVIC_DisableIRQ(tuner_uart_irq_cfg.intrSrc);
+    tuner_uart_console_prefix = ((NULL != prefix) && ('\0' != prefix[0])) ? prefix : NULL;
+    tuner_uart_console_match = 0;
+    tuner_uart_console_length = 0;
+    if (tuner_uart_started)
+    {
+        NVIC_EnableIRQ(tuner_uart_irq_cfg.intrSrc);
+    }
+}
+
+/*******************************************************************************
+* Function Name: tuner_uart_read_console_line
+********************************************************************************
+* Summary:
+*  Copies the next console line, without the line end, without blocking.
+*  Longer lines are truncated to the buffer size.
+*
+* Parameters:
+*  line - Receives the line
+*  size - Size of the buffer
+*
+* Return:
+*  true if a line was copied
+*
+*******************************************************************************/
+bool tuner_uart_read_console_line(char *line, uint32_t size)
+{
+    if ((0u == size) || !TUNER_UART_LOAD(tuner_uart_console_ready))
+    {
+        return false;
+    }
+
+    strncpy(line, tuner_uart_console_line, size - 1u);
+    line[size - 1u] = '\0';
+    TUNER_UART_STORE(tuner_uart_console_ready, false);
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: tuner_uart_get_stats
+********************************************************************************
+* Summary:
+*  Returns the byte counters of both directions.
+*
+* Parameters:
+*  stats - Receives the statistics
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void tuner_uart_get_stats(tuner_uart_stats_t *stats)
+{
+    *stats = tuner_uart_stats;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,107 @@
+/******************************************************************************
+* File Name : tuner_uart.h
+*
+* Description :
+* Interrupt driven receive and transmit rings on the debug UART for the
+* AFE tuner.
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __TUNER_UART_H__
+#define __TUNER_UART_H__
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_result.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Ring sizes in bytes, powers of two. The receive ring holds the bytes that
+ * arrive between two tuner polls.
+ */
+#ifndef TUNER_UART_RX_RING_SIZE
+#define TUNER_UART_RX_RING_SIZE                 (4096u)
+#endif /* TUNER_UART_RX_RING_SIZE */
+#ifndef TUNER_UART_TX_RING_SIZE
+#define TUNER_UART_TX_RING_SIZE                 (2048u)
+#endif /* TUNER_UART_TX_RING_SIZE */
+
+/* Longest console line taken out of the received bytes, with terminator */
+#define TUNER_UART_CONSOLE_LINE_SIZE            (96u)
+
+/* Debug UART interrupt priority, below the audio interrupts */
+#define TUNER_UART_INTR_PRIORITY                (7u)
+
+#define TUNER_UART_FAILURE                      (-1)
+
+#if ((TUNER_UART_RX_RING_SIZE & (TUNER_UART_RX_RING_SIZE - 1u)) != 0) || \
+    ((TUNER_UART_TX_RING_SIZE & (TUNER_UART_TX_RING_SIZE - 1u)) != 0)
+#error "Tuner UART ring sizes must be powers of two"
+#endif
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    uint32_t rx_bytes;                  /* Bytes received */
+    uint32_t rx_overruns;               /* Bytes lost because the receive ring was full */
+    uint32_t rx_max_depth;              /* High-water mark of the receive ring */
+    uint32_t tx_bytes;                  /* Bytes queued for transmission */
+    uint32_t tx_overruns;               /* Bytes lost because the transmit ring was full */
+    uint32_t console_lines;             /* Console lines taken out of the received bytes */
+    uint32_t console_drops;             /* Console lines lost because the previous one was not read */
+} tuner_uart_stats_t;
+
+/*******************************************************************************
+* Functions Prototypes
+*******************************************************************************/
+cy_rslt_t tuner_uart_init(void);
+uint32_t tuner_uart_read(uint8_t *buffer, uint32_t size);
+uint32_t tuner_uart_write(const uint8_t *data, uint32_t length);
+void tuner_uart_set_console_prefix(const char *prefix);
+bool tuner_uart_read_console_line(char *line, uint32_t size);
+void tuner_uart_get_stats(tuner_uart_stats_t *stats);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* __TUNER_UART_H__ */
+
+/* [] END OF FILE */
@@ -98,6 +98,12 @@ extern "C" {
 #define AUDIO_IN_BIT_RESOLUTION                 (16)
 #define AUDIO_IN_SAMPLE_FREQ                    (AUDIO_SAMPLING_RATE_16KHZ)
 
+/* Highest rate offered to the host on both interfaces. The host selects
+ * 16, 32 or 48 kHz and the USB side resamples to the pipeline rate, the
+ * defaults above are the rates of the first format.
+ */
+#define AUDIO_USB_MAX_SAMPLE_FREQ               (AUDIO_SAMPLING_RATE_48KHZ)
+
 /* Each report consists of 2 bytes: The report ID (0x01) and a bit mask
  containing 8 control events: */
 
@@ -107,7 +113,7 @@ extern "C" {
 
 #define ADDITIONAL_AUDIO_IN_SAMPLE_SIZE_BYTES   (((AUDIO_IN_BIT_RESOLUTION) / 8U) * (AUDIO_IN_SUB_FRAME_SIZE)) /* In bytes */
 
-#define MAX_AUDIO_IN_PACKET_SIZE_BYTES          ((((AUDIO_IN_SAMPLE_FREQ) * (((AUDIO_IN_BIT_RESOLUTION) / 8U) * (AUDIO_IN_NUM_CHANNELS))) / 1000U) + (ADDITIONAL_AUDIO_IN_SAMPLE_SIZE_BYTES)) /* In bytes */
+#define MAX_AUDIO_IN_PACKET_SIZE_BYTES          ((((AUDIO_USB_MAX_SAMPLE_FREQ) * (((AUDIO_IN_BIT_RESOLUTION) / 8U) * (AUDIO_IN_NUM_CHANNELS))) / 1000U) + (ADDITIONAL_AUDIO_IN_SAMPLE_SIZE_BYTES)) /* In bytes */
 
 #define ADDITIONAL_AUDIO_IN_SAMPLE_SIZE_WORDS   ((ADDITIONAL_AUDIO_IN_SAMPLE_SIZE_BYTES) / (AUDIO_IN_SUB_FRAME_SIZE)) /* In words */
 
@@ -117,7 +123,7 @@ extern "C" {
 /* OUT endpoint macros */
 #define ADDITIONAL_AUDIO_OUT_SAMPLE_SIZE_BYTES   (((AUDIO_OUT_BIT_RESOLUTION) / 8U) * (AUDIO_OUT_SUB_FRAME_SIZE)) /* In bytes */
 
-#define MAX_AUDIO_OUT_PACKET_SIZE_BYTES          ((((AUDIO_OUT_SAMPLE_FREQ) * (((AUDIO_OUT_BIT_RESOLUTION) / 8U) * (AUDIO_OUT_NUM_CHANNELS))) / 1000U) + (ADDITIONAL_AUDIO_OUT_SAMPLE_SIZE_BYTES)) /* In bytes */
+#define MAX_AUDIO_OUT_PACKET_SIZE_BYTES          ((((AUDIO_USB_MAX_SAMPLE_FREQ) * (((AUDIO_OUT_BIT_RESOLUTION) / 8U) * (AUDIO_OUT_NUM_CHANNELS))) / 1000U) + (ADDITIONAL_AUDIO_OUT_SAMPLE_SIZE_BYTES)) /* In bytes */
 
 #define ADDITIONAL_AUDIO_OUT_SAMPLE_SIZE_WORDS   ((ADDITIONAL_AUDIO_OUT_SAMPLE_SIZE_BYTES) / (AUDIO_OUT_SUB_FRAME_SIZE)) /* In words */
 
@@ -49,6 +49,9 @@
 #include "cy_pdl.h"
 #include "cybsp.h"
 #include "cycfg.h"
+#include "audio_usb_send_utils.h"
+#include "tuner_transport.h"
+#include "tuner_usb.h"
 
 
 /*******************************************************************************
@@ -57,6 +60,20 @@
 #define DELAY_TICKS                        (50U)
 #define EP_IN_INTERVAL                     (8U)
 #define EP_OUT_INTERVAL                    (8U)
+#define EP_FEEDBACK_INTERVAL               (8U)
+#define EP_FEEDBACK_PACKET_SIZE            (3U)        /* 10.14 full speed feedback value */
+
+/* Set to 1 to register the explicit feedback endpoint of the asynchronous
+ * speaker interface. It needs an emUSB-Device whose USBD_AUDIO_INIT_DATA has
+ * the EPFeedback, pfOnFeedback and pFeedbackUserContext members. The
+ * emusb-device release-v2.1.0 pinned in deps/emusb-device.mtb is not known to
+ * provide them, so the endpoint is off by default and the speaker interface
+ * is registered without feedback, as before. The feedback value is computed
+ * either way (audio_out_get_feedback).
+ */
+#ifndef USB_AUDIO_OUT_FEEDBACK_ENABLE
+#define USB_AUDIO_OUT_FEEDBACK_ENABLE      (0)
+#endif /* USB_AUDIO_OUT_FEEDBACK_ENABLE */
 
 /*******************************************************************************
 * Global Variables
@@ -85,6 +102,23 @@ static USBD_AUDIO_IF_CONF  * microphoneConfig = (USBD_AUDIO_IF_CONF *) &audio_in
 *******************************************************************************/
 void audio_clock_init(void);
 
+/*******************************************************************************
+* Function Name: audio_app_select_format
+********************************************************************************
+* Summary:
+* Track the format of an interface. Every format is one alternate setting,
+* alternate setting 0 is the zero bandwidth setting.
+*
+*******************************************************************************/
+
+static void audio_app_select_format(const USBD_AUDIO_IF_CONF *config, uint8_t *format_index, U8 AltSetting)
+{
+    if ((AltSetting > 0) && (AltSetting <= config->NumFormats))
+    {
+        *format_index = AltSetting - 1;
+    }
+}
+
 /*******************************************************************************
 * Function Name: audio_control_callback
 ********************************************************************************
@@ -105,7 +139,9 @@ static int audio_control_callback(void * pUserContext, U8 Event, U8 Unit, U8 Con
 
         case USB_AUDIO_PLAYBACK_START:
 
-            /* Host enabled transmission */
+            /* Host enabled transmission, resample from the rate of the active format */
+            audio_app_select_format(speakerConfig, &current_speaker_format_index, AltSetting);
+            audio_out_set_sample_rate(speakerConfig->paFormats[current_speaker_format_index].SamFreq);
             audio_out_enable();
 
         break;
@@ -119,7 +155,9 @@ static int audio_control_callback(void * pUserContext, U8 Event, U8 Unit, U8 Con
 
         case USB_AUDIO_RECORD_START:
 
-            /* Host enabled reception */
+            /* Host enabled reception, packets follow the rate of the active format */
+            audio_app_select_format(microphoneConfig, &current_microphone_format_index, AltSetting);
+            usb_send_out_dbg_set_sample_rate(microphoneConfig->paFormats[current_microphone_format_index].SamFreq);
             audio_in_enable();
         break;
 
@@ -147,16 +185,10 @@ static int audio_control_callback(void * pUserContext, U8 Event, U8 Unit, U8 Con
                 {
                     if (Unit == speakerConfig->pUnits->FeatureUnitID)
                     {
-                        if ((AltSetting > 0) && (AltSetting < speakerConfig->NumFormats))
-                        {
-                            current_speaker_format_index = AltSetting - 1;
-                        }
+                        audio_app_select_format(speakerConfig, &current_speaker_format_index, AltSetting);
                     }
                     if (Unit == microphoneConfig->pUnits->FeatureUnitID) {
-                        if ((AltSetting > 0) && (AltSetting < microphoneConfig->NumFormats)) 
-                        {
-                            current_microphone_format_index = AltSetting - 1;
-                        }
+                        audio_app_select_format(microphoneConfig, &current_microphone_format_index, AltSetting);
                     }
                 }
 
@@ -281,6 +313,10 @@ static USBD_AUDIO_HANDLE addAudio(void)
     
     USB_ADD_EP_INFO       EPOut;
     USB_ADD_EP_INFO       EPIn;
+#if USB_AUDIO_OUT_FEEDBACK_ENABLE
+    USB_ADD_EP_INFO       EPFeedback;
+    memset(&EPFeedback, 0x0, sizeof(EPFeedback));
+#endif /* USB_AUDIO_OUT_FEEDBACK_ENABLE */
     memset(&EPIn, 0x0, sizeof(EPIn));
     memset(&audio_initData, 0x0, sizeof(audio_initData));
 
@@ -300,6 +336,16 @@ static USBD_AUDIO_HANDLE addAudio(void)
     EPIn.TransferType                = USB_TRANSFER_TYPE_ISO;                /* Endpoint type - Isochronous. */
     EPIn.ISO_Type                    = USB_ISO_SYNC_TYPE_ASYNCHRONOUS;       /* Async for isochronous endpoints */
 
+#if USB_AUDIO_OUT_FEEDBACK_ENABLE
+    /* Explicit feedback for the asynchronous OUT endpoint, 10.14 samples per 1 ms frame */
+    EPFeedback.MaxPacketSize         = EP_FEEDBACK_PACKET_SIZE;
+    EPFeedback.Interval              = EP_FEEDBACK_INTERVAL;                 /* Interval of 1 ms (8 * 125us) */
+    EPFeedback.Flags                 = USB_ADD_EP_FLAG_USE_ISO_SYNC_TYPES;
+    EPFeedback.InDir                 = USB_DIR_IN;
+    EPFeedback.TransferType          = USB_TRANSFER_TYPE_ISO;
+    EPFeedback.ISO_Type              = USB_ISO_SYNC_TYPE_NONE;               /* Feedback endpoints have no synchronization */
+#endif /* USB_AUDIO_OUT_FEEDBACK_ENABLE */
+
     memset(&audio_initData, 0, sizeof(audio_initData));
 
     audio_initData.EPIn                   = USBD_AddEPEx(&EPIn, NULL, 0);
@@ -313,6 +359,11 @@ static USBD_AUDIO_HANDLE addAudio(void)
     audio_initData.paInterfaces           = audio_interfaces;
     audio_initData.pOutUserContext        = NULL;
     audio_initData.pInUserContext         = NULL;
+#if USB_AUDIO_OUT_FEEDBACK_ENABLE
+    audio_initData.EPFeedback             = USBD_AddEPEx(&EPFeedback, NULL, 0);
+    audio_initData.pfOnFeedback           = &audio_out_feedback_callback;
+    audio_initData.pFeedbackUserContext   = NULL;
+#endif /* USB_AUDIO_OUT_FEEDBACK_ENABLE */
 
     hInst = USBD_AUDIO_Add(&audio_initData);
     return hInst;
@@ -368,6 +419,11 @@ void audio_app_init()
    /* Add HID Audio control endpoint to the USB stack */
      usb_hidControlContext = addHIDControl();
 
+#if (TUNER_TRANSPORT == TUNER_TRANSPORT_USB)
+    /* Add the AFE tuner bulk interface to the USB stack */
+    tuner_usb_add();
+#endif /* TUNER_TRANSPORT */
+
     /* Set USB read/write timeouts */
     USBD_AUDIO_Set_Timeouts(usb_audioContext, READ_TIMEOUT, WRITE_TIMEOUT);
 
@@ -62,6 +62,8 @@ const USB_DEVICE_INFO usb_deviceInfo = {
 static const USBD_AUDIO_FORMAT microphone_formats[] =
 {
     {0, AUDIO_IN_NUM_CHANNELS, AUDIO_IN_SUB_FRAME_SIZE, AUDIO_IN_BIT_RESOLUTION, AUDIO_IN_SAMPLE_FREQ},
+    {0, AUDIO_IN_NUM_CHANNELS, AUDIO_IN_SUB_FRAME_SIZE, AUDIO_IN_BIT_RESOLUTION, AUDIO_SAMPLING_RATE_32KHZ},
+    {0, AUDIO_IN_NUM_CHANNELS, AUDIO_IN_SUB_FRAME_SIZE, AUDIO_IN_BIT_RESOLUTION, AUDIO_SAMPLING_RATE_48KHZ},
 };
 
 static USBD_AUDIO_UNITS microphone_units;
@@ -69,6 +71,8 @@ static USBD_AUDIO_UNITS microphone_units;
 static USBD_AUDIO_FORMAT speaker_formats[] =
 {
     {0, AUDIO_OUT_NUM_CHANNELS, AUDIO_OUT_SUB_FRAME_SIZE, AUDIO_OUT_BIT_RESOLUTION, AUDIO_SAMPLING_RATE_16KHZ},
+    {0, AUDIO_OUT_NUM_CHANNELS, AUDIO_OUT_SUB_FRAME_SIZE, AUDIO_OUT_BIT_RESOLUTION, AUDIO_SAMPLING_RATE_32KHZ},
+    {0, AUDIO_OUT_NUM_CHANNELS, AUDIO_OUT_SUB_FRAME_SIZE, AUDIO_OUT_BIT_RESOLUTION, AUDIO_SAMPLING_RATE_48KHZ},
 };
 
 
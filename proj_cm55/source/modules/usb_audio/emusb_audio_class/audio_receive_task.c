@@ -39,16 +39,23 @@
 /*******************************************************************************
 * Header Files
 *******************************************************************************/
+#include <string.h>
 #include "USB_Audio.h"
 #include "audio_app.h"
 #include "audio.h"
 #include "cycfg.h"
 #include "rtos.h"
 #include "audio_conv_utils.h"
+#include "audio_pipeline_config.h"
 #include "audio_usb_send_utils.h"
 #include "audio_receive_task.h"
 #include "cyabs_rtos.h"
 #include "app_logger.h"
+#include "clock_drift.h"
+#include "i2s_playback.h"
+#include "audio_resampler.h"
+#include "audio_frame_ring.h"
+#include "ae_pipeline.h"
 
 #include "cy_afe_configurator_settings.h"
 
@@ -59,9 +66,39 @@
 /*******************************************************************************
 * Macros
 *******************************************************************************/
-#define USB_10MS_AUDIO_SAMP            (160)
+/* Samples (for all channels) and bytes of one frame received from the PC */
+#define USB_FRAME_AUDIO_SAMP           (AUDIO_PIPELINE_SAMPLES_PER_FRAME * AUDIO_PIPELINE_PLAYBACK_CHANNELS)
+#define USB_FRAME_AUDIO_BYTES          (AUDIO_PIPELINE_FRAME_BYTES(AUDIO_PIPELINE_PLAYBACK_CHANNELS))
+
+#if (AUDIO_OUT_NUM_CHANNELS != AUDIO_PIPELINE_PLAYBACK_CHANNELS)
+#error "USB speaker channels must match the audio pipeline configuration"
+#endif
 #define USB_AUDIO_RX_TASK_PRIORITY     (6)
 
+/* Frames the USB mic ring should hold between the host and the I2S playback */
+#define USB_OUT_TARGET_FILL_FRAMES     (USB_MIC_BUFFER_COUNT)
+
+/* Size of the full speed 10.14 feedback value */
+#define USB_OUT_FEEDBACK_SIZE          (3u)
+
+/* Bytes of one stereo sample frame received from the PC */
+#define USB_OUT_SAMPLE_FRAME_BYTES     (AUDIO_OUT_NUM_CHANNELS * AUDIO_OUT_SUB_FRAME_SIZE)
+
+/* Packets, 1 msec each, queued between the OUT endpoint and the buffer task */
+#define USB_OUT_PACKET_COUNT           (8u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Packet received from the PC, queued as received for the buffer task */
+typedef struct
+{
+    int16_t samples[MAX_AUDIO_OUT_PACKET_SIZE_WORDS];
+    uint32_t num_bytes;
+    /* First packet of a playing session */
+    bool session_start;
+} usb_out_packet_t;
+
 /*******************************************************************************
 * Global Variables
 *******************************************************************************/
@@ -74,9 +111,9 @@ volatile bool audio_start_streaming     = false;
 int usb_packet_count                    = 0;
 int ping_pong_buff                      = 0;
 uint32_t initial_buffer_count           = 0;
-int16_t audio_mic_buffer_usb_ping[USB_10MS_AUDIO_SAMP*2];
-int16_t audio_mic_buffer_usb_pong[USB_10MS_AUDIO_SAMP*2];
-int16_t audio_mic_buffer_zero_buff[USB_10MS_AUDIO_SAMP*2] = {0};
+int16_t audio_mic_buffer_usb_ping[USB_FRAME_AUDIO_SAMP];
+int16_t audio_mic_buffer_usb_pong[USB_FRAME_AUDIO_SAMP];
+int16_t audio_mic_buffer_zero_buff[USB_FRAME_AUDIO_SAMP] = {0};
 
 
 int8_t *audio_usb_ptr                   = NULL;
@@ -90,6 +127,34 @@ TaskHandle_t rtos_audio_buf_task;
 
 extern char *bdm_aec_ref_buffer;
 
+/* Drift of the host clock against the I2S clock, observed through the fill
+ * of the USB mic ring, and the value for the asynchronous OUT feedback
+ * endpoint derived from it. usb_out_feedback_value is written by
+ * audio_buff_task only; usb_out_feedback is the packet sent by the feedback
+ * endpoint callback. The nominal rate is sent while a restart is pending.
+ */
+static clock_drift_estimator_t usb_out_drift;
+static volatile bool usb_out_drift_restart = true;
+static uint32_t usb_out_received_frames = 0;
+static uint32_t usb_out_played_origin = 0;
+static volatile uint32_t usb_out_feedback_value = 0;
+static uint8_t usb_out_feedback[USB_OUT_FEEDBACK_SIZE];
+
+/* Rate selected by the host and the resampler from it to the pipeline
+ * rate. The OUT endpoint receives packets in place into the packet ring, or
+ * into usb_out_drop_packet when the ring is full. The buffer task resamples
+ * them into the ping/pong frames; usb_packet_count is the fill of the current
+ * frame in bytes.
+ */
+static volatile uint32_t usb_out_sample_rate = AUDIO_OUT_SAMPLE_FREQ;
+static audio_resampler_t usb_out_resampler;
+static usb_out_packet_t usb_out_packet_storage[USB_OUT_PACKET_COUNT];
+static audio_frame_ring_t usb_out_packet_ring;
+static usb_out_packet_t usb_out_drop_packet;
+static usb_out_packet_t *usb_out_receiving = &usb_out_drop_packet;
+static bool usb_out_session_start = false;
+static int16_t usb_out_resampled[MAX_AUDIO_OUT_PACKET_SIZE_WORDS];
+
 /*******************************************************************************
 * Functions Prototypes
 *******************************************************************************/
@@ -106,6 +171,9 @@ void audio_out_init(void)
 {
     BaseType_t rtos_task_status;
 
+    (void)audio_frame_ring_init(&usb_out_packet_ring, usb_out_packet_storage,
+                                sizeof(usb_out_packet_t), USB_OUT_PACKET_COUNT);
+
     rtos_task_status = xTaskCreate(audio_out_process, "usb_audio_to_psoc",
                         RTOS_STACK_DEPTH, NULL, USB_AUDIO_RX_TASK_PRIORITY,
                         &rtos_audio_out_task);
@@ -153,6 +221,21 @@ void audio_out_disable(void)
 
 }
 
+/*******************************************************************************
+* Function Name: audio_out_set_sample_rate
+********************************************************************************
+* Summary:
+*   Set the rate of the speaker format selected by the host. Takes effect at
+*   the start of the next playing session, the feedback endpoint reports the
+*   nominal rate until then.
+*
+*******************************************************************************/
+void audio_out_set_sample_rate(uint32_t sample_rate)
+{
+    usb_out_sample_rate = sample_rate;
+    usb_out_drift_restart = true;
+}
+
 /*******************************************************************************
 * Function Name: audio_out_process
 ********************************************************************************
@@ -175,40 +258,278 @@ void audio_out_process(void *arg)
     }
 }
 
+/*******************************************************************************
+* Function Name: audio_out_drift_update
+********************************************************************************
+* Summary:
+*   Updates the host clock drift estimate after a frame was queued for
+*   playback and recomputes the feedback value.
+*
+*******************************************************************************/
+static void audio_out_drift_update(void)
+{
+    uint32_t played = 0;
+    uint32_t value = 0;
+    int32_t fill = 0;
+
+    if (usb_out_drift_restart)
+    {
+        usb_out_drift_restart = false;
+        clock_drift_init(&usb_out_drift, CLOCK_DRIFT_DEFAULT_TIME_CONSTANT);
+        usb_out_received_frames = 0;
+        usb_out_played_origin = i2s_get_played_frames();
+    }
+
+    usb_out_received_frames++;
+    played = i2s_get_played_frames() - usb_out_played_origin;
+    fill = (int32_t)(usb_out_received_frames - played) * (int32_t)AUDIO_PIPELINE_SAMPLES_PER_FRAME;
+
+    clock_drift_update(&usb_out_drift, played * AUDIO_PIPELINE_SAMPLES_PER_FRAME, fill);
+
+    /* The fill is counted at the pipeline rate, the feedback at the host rate */
+    fill -= (int32_t)(USB_OUT_TARGET_FILL_FRAMES * AUDIO_PIPELINE_SAMPLES_PER_FRAME);
+    fill = (int32_t)(((int64_t)fill * (int32_t)usb_out_sample_rate) / (int32_t)AUDIO_PIPELINE_SAMPLE_RATE_HZ);
+    value = clock_drift_feedback_10_14(usb_out_sample_rate, clock_drift_get_ppm(&usb_out_drift), fill);
+    usb_out_feedback_value = value;
+}
+
+/*******************************************************************************
+* Function Name: audio_out_get_feedback
+********************************************************************************
+* Summary:
+*   Returns the value for the asynchronous OUT feedback endpoint: samples
+*   per 1 ms frame in 10.14 format, little endian. Called from the feedback
+*   endpoint callback only, the returned packet stays valid until the next
+*   call.
+*
+*******************************************************************************/
+const uint8_t *audio_out_get_feedback(void)
+{
+    uint32_t value = usb_out_feedback_value;
+
+    if (usb_out_drift_restart || (0u == value))
+    {
+        value = clock_drift_feedback_10_14(usb_out_sample_rate, 0.0f, 0);
+    }
+    usb_out_feedback[0] = (uint8_t)value;
+    usb_out_feedback[1] = (uint8_t)(value >> 8u);
+    usb_out_feedback[2] = (uint8_t)(value >> 16u);
+
+    return usb_out_feedback;
+}
+
+/*******************************************************************************
+* Function Name: audio_out_feedback_callback
+********************************************************************************
+* Summary:
+*   Feedback IN endpoint callback. Sends the current feedback value once per
+*   polling interval.
+*
+*******************************************************************************/
+void audio_out_feedback_callback(void * pUserContext, const uint8_t ** ppNextBuffer, unsigned long * pNextPacketSize)
+{
+    CY_UNUSED_PARAMETER(pUserContext);
+
+    *ppNextBuffer = audio_out_get_feedback();
+    *pNextPacketSize = USB_OUT_FEEDBACK_SIZE;
+}
+
+/*******************************************************************************
+* Function Name: audio_out_get_drift_ppm
+********************************************************************************
+* Summary:
+*   Returns the estimated drift of the host clock against the I2S clock.
+*
+*******************************************************************************/
+float audio_out_get_drift_ppm(void)
+{
+    return clock_drift_get_ppm(&usb_out_drift);
+}
+
+/*******************************************************************************
+* Function Name: audio_out_frame_ready
+********************************************************************************
+* Summary:
+*   Hands a completed frame received over USB to the playback or to the
+*   pipeline input.
+*
+*******************************************************************************/
+static void audio_out_frame_ready(void)
+{
+    aec_ref_flag=0;
+
+    if(NULL == bdm_aec_ref_buffer)
+    {
+        if (AE_PIPELINE_INPUT_MIC == ae_pipeline_get_config()->input_source)
+        {
+            /* Data coming from USB is played on the device speaker */
+            if (CY_RSLT_SUCCESS == usb_mic_push(usb_aec_ref))
+            {
+                audio_out_drift_update();
+            }
+        }
+        else
+        {
+            /* The ping/pong USB buffer stays valid for the next 10 ms and is
+             * de-interleaved straight into a frame from the frame pool */
+            ae_audio_data_feed_usb(usb_aec_ref);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: audio_out_start_session
+********************************************************************************
+* Summary:
+*   Restarts the frame assembly and the resampler for a new playing session.
+*
+*******************************************************************************/
+static void audio_out_start_session(void)
+{
+    audio_usb_ptr = (int8_t*)audio_mic_buffer_usb_ping;
+    ping_pong_buff= 0;
+    audio_usb_ref = audio_usb_ptr;
+    usb_packet_count = 0;
+    initial_buffer_count=0;
+
+/* Resample from the rate the host selected, plain copy at the pipeline rate */
+    if (CY_RSLT_SUCCESS != audio_resampler_init(&usb_out_resampler, usb_out_sample_rate,
+            AUDIO_PIPELINE_SAMPLE_RATE_HZ, AUDIO_OUT_NUM_CHANNELS))
+    {
+        (void)audio_resampler_init(&usb_out_resampler, AUDIO_PIPELINE_SAMPLE_RATE_HZ,
+                AUDIO_PIPELINE_SAMPLE_RATE_HZ, AUDIO_OUT_NUM_CHANNELS);
+    }
+}
+
+/*******************************************************************************
+* Function Name: audio_out_process_packet
+********************************************************************************
+* Summary:
+*   Resamples a received packet to the pipeline rate and appends it to the
+*   current ping/pong frame. A packet may complete a frame and start the
+*   next one.
+*
+*******************************************************************************/
+static void audio_out_process_packet(const usb_out_packet_t *packet)
+{
+    uint32_t frames = packet->num_bytes / USB_OUT_SAMPLE_FRAME_BYTES;
+    uint32_t bytes = 0;
+    uint32_t count = 0;
+    const int8_t *src = (const int8_t *)usb_out_resampled;
+
+    if (packet->session_start)
+    {
+        audio_out_start_session();
+    }
+
+    frames = audio_resampler_process(&usb_out_resampler, packet->samples, frames, usb_out_resampled);
+    bytes = frames * USB_OUT_SAMPLE_FRAME_BYTES;
+
+    while (0u != bytes)
+    {
+        count = USB_FRAME_AUDIO_BYTES - usb_packet_count;
+        if (count > bytes)
+        {
+            count = bytes;
+        }
+        memcpy(audio_usb_ptr, src, count);
+        audio_usb_ptr += count;
+        src += count;
+        bytes -= count;
+        usb_packet_count += count;
+
+/* A frame of data collected, so queue them */
+        if (usb_packet_count >= USB_FRAME_AUDIO_BYTES)
+        {
+/* Pre-buffer counter for I2S playback */
+            initial_buffer_count++;
+            usb_packet_count=0;
+            usb_aec_ref=(int16_t *)audio_usb_ref;
+            aec_ref_flag=1;
+
+            audio_out_frame_ready();
+/* Double buffers so that a frame of AEC reference can be queued */
+            if (ping_pong_buff==0)
+            {
+                audio_usb_ptr=(int8_t*)audio_mic_buffer_usb_pong;
+                ping_pong_buff=1;
+            }
+            else
+            {
+                audio_usb_ptr=(int8_t*)audio_mic_buffer_usb_ping;
+                ping_pong_buff=0;
+            }
+            audio_usb_ref = audio_usb_ptr;
+        }
+    }
+}
+
 /*******************************************************************************
 * Function Name: audio_buff_task
 ********************************************************************************
 * Summary:
-*   Buffers audio data received over USB for further processing.
+*   Buffers audio data received over USB for further processing. Drains the
+*   packets queued by the OUT endpoint callback, so that the resampling runs
+*   here instead of in the callback.
 *
 *******************************************************************************/
 void audio_buff_task(void *arg)
 {
     uint32_t notify_val=0;
-#if AFE_INPUT_SOURCE== AFE_INPUT_SOURCE_USB   
-    int16_t usb_buffer[USB_10MS_AUDIO_SAMP*2] = {0};
-#endif /* AFE_INPUT_SOURCE */  
+    const usb_out_packet_t *packet = NULL;
+
     while(1)
     {
         xTaskNotifyWait(0,0,&notify_val,portMAX_DELAY);
-        aec_ref_flag=0;
 
-        if(NULL == bdm_aec_ref_buffer)
+        while (NULL != (packet = (const usb_out_packet_t *)audio_frame_ring_peek(&usb_out_packet_ring)))
         {
-#if AFE_INPUT_SOURCE==AFE_INPUT_SOURCE_MIC
-#if AFE_USE_TARGET_SPEAKER /* Data coming from USB is played on device speaker*/
-            usb_mic_push(usb_aec_ref);
-#else
-            usb_mic_push(usb_aec_ref);
-#endif /*AFE_USE_TARGET_SPEAKER*/            
-#else
-            memcpy(usb_buffer,usb_aec_ref,USB_10MS_AUDIO_SAMP*2*2);
-            ae_audio_data_feed_usb(usb_buffer);
-#endif /*AFE_INPUT_SOURCE */
+            audio_out_process_packet(packet);
+            audio_frame_ring_release(&usb_out_packet_ring);
         }
     }
 }
 
+/*******************************************************************************
+* Function Name: audio_out_next_packet
+********************************************************************************
+* Summary:
+*   Returns the buffer the OUT endpoint receives the next packet into: a slot
+*   of the packet ring, or usb_out_drop_packet if the buffer task fell behind
+*   and the ring is full (counted as an overrun of the ring).
+*
+*******************************************************************************/
+static uint8_t* audio_out_next_packet(void)
+{
+    usb_out_packet_t *packet = (usb_out_packet_t *)audio_frame_ring_reserve(&usb_out_packet_ring);
+
+    usb_out_receiving = (NULL != packet) ? packet : &usb_out_drop_packet;
+    return (uint8_t *)usb_out_receiving->samples;
+}
+
+/*******************************************************************************
+* Function Name: audio_out_queue_packet
+********************************************************************************
+* Summary:
+*   Queues the packet just received for the buffer task, unchanged. The
+*   resampling and the frame assembly run in audio_buff_task.
+*
+*******************************************************************************/
+static void audio_out_queue_packet(uint32_t num_bytes)
+{
+    if (&usb_out_drop_packet == usb_out_receiving)
+    {
+        return;
+    }
+
+    usb_out_receiving->num_bytes = num_bytes;
+    usb_out_receiving->session_start = usb_out_session_start;
+    usb_out_session_start = false;
+    audio_frame_ring_commit(&usb_out_packet_ring);
+
+    xTaskNotify(rtos_audio_buf_task, 0,eNoAction);
+}
+
 /*******************************************************************************
 * Function Name: audio_out_endpoint_callback
 ********************************************************************************
@@ -230,52 +551,25 @@ void audio_out_endpoint_callback(void * pUserContext,
         audio_out_is_streaming = true;
 
 
-        audio_usb_ptr = (int8_t*)audio_mic_buffer_usb_ping;
-        ping_pong_buff= 0;
-        audio_usb_ref = audio_usb_ptr;
+/* The buffer task restarts the frame assembly at the first packet queued */
+        usb_out_session_start = true;
 
 /* Start a transfer to the Audio OUT endpoint */
-        *ppNextBuffer = (uint8_t *) audio_usb_ptr;
-        initial_buffer_count=0;
+        *ppNextBuffer = audio_out_next_packet();
 /* Flush queues as PC will not send USB stop always. Depends on the media player used in PC */
         usb_mic_flush();
         usb_aec_flush();
+        usb_out_drift_restart = true;
     }
     else if(audio_out_is_streaming)
     {
 /* USB receives 1ms of data for every interrupt */
-        if(NumBytesReceived != 0)
+        if(NumBytesReceived > 0)
         {
-            if (usb_packet_count<USB_10MS_AUDIO_SAMP*4) {
-                usb_packet_count+=NumBytesReceived;
-                audio_usb_ptr+=NumBytesReceived;
-            }
-/* 10 ms data collected, so queue them */
-            if (usb_packet_count>=USB_10MS_AUDIO_SAMP*4)
-            {
-/* Pre-buffer counter for I2S playback */
-                initial_buffer_count++;
-                usb_packet_count=0;
-                usb_aec_ref=(int16_t *)audio_usb_ref;
-                aec_ref_flag=1;
-
-                xTaskNotify(rtos_audio_buf_task, 0,eNoAction);
-/* Double buffers so that 10 ms AEC reference can be queued */
-                if (ping_pong_buff==0)
-                {
-                    audio_usb_ptr=(int8_t*)audio_mic_buffer_usb_pong;
-                    audio_usb_ref = audio_usb_ptr;
-                    ping_pong_buff=1;
-                }
-                else
-                {
-                    audio_usb_ptr=(int8_t*)audio_mic_buffer_usb_ping;
-                    audio_usb_ref = audio_usb_ptr;
-                    ping_pong_buff=0;
-                }
-            }
+            audio_out_queue_packet((uint32_t)NumBytesReceived);
+
 /* Start a transfer to OUT endpoint */
-            *ppNextBuffer = (uint8_t *) audio_usb_ptr;
+            *ppNextBuffer = audio_out_next_packet();
         }
     }
 }
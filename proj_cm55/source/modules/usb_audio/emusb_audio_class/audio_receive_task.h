@@ -55,6 +55,10 @@ void audio_out_disable(void);
 void audio_out_process(void *arg);
 void audio_buff_task(void *arg);
 void audio_out_endpoint_callback(void * pUserContext, int NumBytesReceived, uint8_t ** ppNextBuffer, unsigned long * pNextBufferSize);
+const uint8_t *audio_out_get_feedback(void);
+void audio_out_feedback_callback(void * pUserContext, const uint8_t ** ppNextBuffer, unsigned long * pNextPacketSize);
+float audio_out_get_drift_ppm(void);
+void audio_out_set_sample_rate(uint32_t sample_rate);
 
 #if defined(__cplusplus)
 }
@@ -51,20 +51,19 @@
 #include "cyabs_rtos.h"
 #include "app_logger.h"
 #include "audio_usb_send_utils.h"
+#include "audio_pipeline_config.h"
+#include "rt_stats.h"
+#include "latency_trace.h"
+#include "aec_jitter_buffer.h"
+#include "audio_conv_utils.h"
+#include "audio.h"
+#include "audio_resampler.h"
 
 
 /*******************************************************************************
 * Macros
 *******************************************************************************/
 
-#define MAX_USB_CH1_DATA_Q              (320)
-
-#ifdef AE_TUNING_MODE
-#define MAX_USB_CH2_DATA_Q              (320)
-#define MAX_USB_CH3_DATA_Q              (320)
-#define MAX_USB_CH4_DATA_Q              (320)
-#endif /* AE_TUNING_MODE */
-
 #define USB_QUEUE_ELEMENTS_CH1          (120) /* Increased queue size 6->120 */
 
 #ifdef AE_TUNING_MODE
@@ -73,235 +72,246 @@
 #define USB_QUEUE_ELEMENTS_CH4          (60)
 #endif /* AE_TUNING_MODE */
 
-#define USB_MONO_AUDIO_SIZE_BYTES       (320)
+#define USB_MONO_AUDIO_SIZE_BYTES       (AUDIO_PIPELINE_FRAME_BYTES(1u))
+#define USB_SAMPLES_PER_FRAME           (AUDIO_PIPELINE_SAMPLES_PER_FRAME)
+
+/* Largest packet the IN endpoint accepts, in samples per channel */
+#define USB_PACK_MAX_SAMPLES            (MAX_AUDIO_IN_PACKET_SIZE_BYTES / (USB_OUT_NUM_CHANNELS * sizeof(int16_t)))
+
+/* Largest number of pipeline rate samples packed per 1 ms packet */
+#define USB_PACK_MAX_PIPELINE_SAMPLES   (AUDIO_PIPELINE_SAMPLES_PER_MS + 1u)
+
+#if (AUDIO_IN_NUM_CHANNELS != USB_OUT_NUM_CHANNELS)
+#error "USB_OUT_NUM_CHANNELS must match the channels of the microphone interface"
+#endif
 
 #if defined(__ARMCC_VERSION)
 #define USB_MIC_IN_Q_LEN                (240) /* Increased queue size 12->240*/
 #else
 #define USB_MIC_IN_Q_LEN                (240)
 #endif /* __ARMCC_VERSION */
-#define USB_MIC_IN_Q_SIZE               (640)
+#define USB_MIC_IN_Q_SIZE               (AUDIO_PIPELINE_FRAME_BYTES(AUDIO_PIPELINE_PLAYBACK_CHANNELS))
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+
+/* Packer channel. Pulls 10 ms mono frames from its ring. frame points
+ * either into a ring slot that is held until the frame is fully packed, or
+ * to the zero frame.
+ */
+typedef struct
+{
+    audio_frame_ring_t ring;
+    uint32_t slot_count;
+    const uint16_t *frame;
+    bool held;
+} usb_send_channel_t;
 
 /*******************************************************************************
 * Functions Prototypes
 *******************************************************************************/
 
 extern int is_audio_usb_send_out_data_from_device_started(void);
-extern bool is_in_isr();
+
 /*******************************************************************************
 * Global Variables
 *******************************************************************************/
 
-#ifdef AE_TUNING_MODE
-uint16_t audio_usb_out_buffer[USB_MONO_AUDIO_SIZE_BYTES] = {0};
-#else
-uint16_t audio_usb_out_buffer[USB_MONO_AUDIO_SIZE_BYTES/10] = {0};
-#endif /* AE_TUNING_MODE */
+uint16_t audio_usb_out_buffer[USB_PACK_MAX_SAMPLES * USB_OUT_NUM_CHANNELS] = {0};
 
-QueueHandle_t usb_ch1_queue;
+/* Packet at the pipeline rate, before resampling to the host rate */
+static uint16_t usb_pack_buffer[USB_PACK_MAX_PIPELINE_SAMPLES * USB_OUT_NUM_CHANNELS];
 
+/* Channel table of the packer, one entry per interleaved USB channel */
+static usb_send_channel_t usb_send_channels[USB_OUT_NUM_CHANNELS] =
+{
+    { .slot_count = USB_QUEUE_ELEMENTS_CH1 },
 #ifdef AE_TUNING_MODE
-QueueHandle_t usb_ch2_queue;
-QueueHandle_t usb_ch3_queue;
-QueueHandle_t usb_ch4_queue;
+    { .slot_count = USB_QUEUE_ELEMENTS_CH2 },
+    { .slot_count = USB_QUEUE_ELEMENTS_CH3 },
+    { .slot_count = USB_QUEUE_ELEMENTS_CH4 },
 #endif /* AE_TUNING_MODE */
+};
 
-QueueHandle_t usb_aec_ref_queue;
-QueueHandle_t usb_mic_queue;
-
-short channel_1[USB_MONO_AUDIO_SIZE_BYTES/2]= {0};
+audio_frame_ring_t usb_mic_ring;
 
-#ifdef AE_TUNING_MODE
-short channel_2[USB_MONO_AUDIO_SIZE_BYTES/2]= {0};
-short channel_3[USB_MONO_AUDIO_SIZE_BYTES/2]= {0};
-short channel_4[USB_MONO_AUDIO_SIZE_BYTES/2]= {0};
-#endif /* AE_TUNING_MODE */
+static const uint16_t usb_zero_frame[USB_SAMPLES_PER_FRAME] = {0};
 
-short *ch1 = NULL;
+/* Packer state. usb_pack_pos is the next sample of the current frames,
+ * usb_pack_rate_acc the sub-sample remainder of the pipeline rate carried
+ * from packet to packet, usb_pack_max_samples the pipeline samples that fit
+ * in one packet after resampling.
+ */
+static uint32_t usb_pack_pos = USB_SAMPLES_PER_FRAME;
+static uint32_t usb_pack_rate_acc = 0;
+static uint32_t usb_pack_max_samples = USB_PACK_MAX_PIPELINE_SAMPLES;
 
-#ifdef AE_TUNING_MODE
-short *ch2 = NULL;
-short *ch3 = NULL;
-short *ch4 = NULL;
-#endif /* AE_TUNING_MODE */
+/* Rate selected by the host, applied by the next packet, and the resampler
+ * from the pipeline rate to it.
+ */
+static volatile uint32_t usb_pack_host_rate = AUDIO_IN_SAMPLE_FREQ;
+static volatile bool usb_pack_rate_pending = true;
+static audio_resampler_t usb_pack_resampler;
 
+/*******************************************************************************
+* Function Name: usb_ring_create
+********************************************************************************
+* Summary:
+*   Allocates storage for a frame ring and initializes it.
+*
+*******************************************************************************/
 
-void* bufferch1[USB_MONO_AUDIO_SIZE_BYTES] = {0};
+static cy_rslt_t usb_ring_create(audio_frame_ring_t *ring, uint32_t slot_size, uint32_t slot_count)
+{
+    void *storage = pvPortMalloc(slot_size * slot_count);
 
-#ifdef AE_TUNING_MODE
-void* bufferch2[USB_MONO_AUDIO_SIZE_BYTES] = {0};
-void* bufferch3[USB_MONO_AUDIO_SIZE_BYTES] = {0};
-void* bufferch4[USB_MONO_AUDIO_SIZE_BYTES] = {0};
-#endif /* AE_TUNING_MODE */
+    if (NULL == storage)
+    {
+        return USB_QUEUE_FAILURE;
+    }
+    return audio_frame_ring_init(ring, storage, slot_size, slot_count);
+}
 
 /*******************************************************************************
-* Function Name: usb_queue_push
+* Function Name: usb_send_out_dbg_get
 ********************************************************************************
 * Summary:
-*   Wrapper API for pushing data to USB queues.
+*   Get the next 10 ms frame for a channel. The frame is read in place from
+*   the channel ring and released once it is fully packed. Zeros are sent
+*   if no frame is available.
 *
 *******************************************************************************/
 
-cy_rslt_t usb_queue_push(QueueHandle_t queue, void* item_ptr, bool isr)
+static void usb_send_out_dbg_get(unsigned int index)
 {
-    cy_rslt_t ret_val = CY_RSLT_SUCCESS;
+    usb_send_channel_t *channel = &usb_send_channels[index];
+    const uint16_t *slot = NULL;
+
+    if (channel->held)
+    {
+        audio_frame_ring_release(&channel->ring);
+        channel->held = false;
+    }
 
-    if (isr == 0)
+    slot = (const uint16_t *)audio_frame_ring_peek(&channel->ring);
+    if (NULL != slot)
     {
-        if (pdTRUE != xQueueSendToBack(queue, item_ptr, 0))
+        channel->frame = slot;
+        channel->held = true;
+        if (0u == index)
         {
-            return USB_QUEUE_FAILURE;
+            LATENCY_TRACE_SENT(audio_frame_ring_depth(&channel->ring));
         }
     }
     else
     {
-        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-        BaseType_t ret;
-        ret = xQueueSendToBackFromISR(queue, item_ptr, &xHigherPriorityTaskWoken);
-        if (ret == pdTRUE)
-        {
-            portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
-        }
-        else
-        {
-            return USB_QUEUE_FAILURE;
-        }
-
+        audio_frame_ring_count_underrun(&channel->ring);
+        channel->frame = usb_zero_frame;
     }
-    return ret_val;
-
 }
 
 /*******************************************************************************
-* Function Name: usb_queue_pop
+* Function Name: usb_send_out_packet_samples
 ********************************************************************************
 * Summary:
-*   Wrapper API for popping data from USB queues.
+*   Pipeline samples per channel of the next 1 ms packet. Rates that are
+*   not a multiple of 1 kHz alternate between two packet sizes. The result
+*   never exceeds the endpoint packet size after resampling, samples beyond
+*   it are carried to the next packet for at most one packet period.
 *
 *******************************************************************************/
 
-cy_rslt_t usb_queue_pop(QueueHandle_t queue, void* item_ptr, bool isr)
+static uint32_t usb_send_out_packet_samples(void)
 {
-    cy_rslt_t ret_val = CY_RSLT_SUCCESS;
-    if (isr == 0)
+    uint32_t samples;
+
+    usb_pack_rate_acc += AUDIO_PIPELINE_SAMPLE_RATE_HZ;
+    samples = usb_pack_rate_acc / 1000u;
+    if (samples > usb_pack_max_samples)
     {
-        if (pdTRUE != xQueueReceive(queue, item_ptr, 0))
-        {
-            return USB_QUEUE_FAILURE;
-        }
+        samples = usb_pack_max_samples;
     }
-    else
+    usb_pack_rate_acc -= samples * 1000u;
+    if (usb_pack_rate_acc >= 1000u)
     {
-        BaseType_t ret;
-        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-        ret = xQueueReceiveFromISR(queue, item_ptr, &xHigherPriorityTaskWoken);
-        if (ret == pdTRUE)
-        {
-            portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
-        }
-        else
-        {
-            return USB_QUEUE_FAILURE;
-        }
+        usb_pack_rate_acc = 999u;
     }
-    return ret_val;
-}
-
 
+    return samples;
+}
 
 /*******************************************************************************
-* Function Name: usb_send_out_dbg_get
+* Function Name: usb_send_out_pack
 ********************************************************************************
 * Summary:
-*   Get the data for 4 channel audio from RTOS queues.
+*   Interleave samples of all channels of the table into a USB packet. New
+*   frames are pulled from the channel rings whenever the current ones are
+*   used up, also in the middle of a packet.
 *
 *******************************************************************************/
 
-static void usb_send_out_dbg_get(unsigned int channel_no,void *pbuffer)
+static void usb_send_out_pack(uint16_t *data_to_send, uint32_t samples)
 {
-    cy_rslt_t ret_val = CY_RSLT_SUCCESS;
+    const uint16_t *planes[USB_OUT_NUM_CHANNELS];
+    uint32_t count;
+    unsigned int index;
 
-    if (1 == channel_no)
-    {
-        ret_val = usb_queue_pop(usb_ch1_queue, pbuffer, is_in_isr());
-    }
-#ifdef AE_TUNING_MODE
-    if (2 == channel_no)
-    {
-        ret_val = usb_queue_pop(usb_ch2_queue, pbuffer, is_in_isr());
-    }
-    if (3 == channel_no)
+    while (0u != samples)
     {
-        ret_val = usb_queue_pop(usb_ch3_queue, pbuffer, is_in_isr());
-    }
-    if (4 == channel_no)
-    {
-        ret_val = usb_queue_pop(usb_ch4_queue, pbuffer, is_in_isr());
-    }
-#endif /* AE_TUNING_MODE */
-    if ((CY_RSLT_SUCCESS != ret_val))
-    {
-        if (1 == channel_no)
+        if (USB_SAMPLES_PER_FRAME == usb_pack_pos)
         {
-            memset(pbuffer, 0, USB_MONO_AUDIO_SIZE_BYTES);
+            for (index = 0; index < USB_OUT_NUM_CHANNELS; index++)
+            {
+                usb_send_out_dbg_get(index);
+            }
+            usb_pack_pos = 0;
         }
-#ifdef AE_TUNING_MODE
-        if (2 == channel_no)
-        {
-            memset(pbuffer, 0, USB_MONO_AUDIO_SIZE_BYTES);
-        }
-        if (3 == channel_no)
+
+        count = USB_SAMPLES_PER_FRAME - usb_pack_pos;
+        if (count > samples)
         {
-            memset(pbuffer, 0, USB_MONO_AUDIO_SIZE_BYTES);
+            count = samples;
         }
-        if (4 == channel_no)
+
+        for (index = 0; index < USB_OUT_NUM_CHANNELS; index++)
         {
-            memset(pbuffer, 0, USB_MONO_AUDIO_SIZE_BYTES);
+            planes[index] = usb_send_channels[index].frame + usb_pack_pos;
         }
-#endif /* AE_TUNING_MODE */
+        audio_conv_interleave_planes(planes, data_to_send, count, USB_OUT_NUM_CHANNELS);
+
+        data_to_send += count * USB_OUT_NUM_CHANNELS;
+        usb_pack_pos += count;
+        samples -= count;
     }
 }
 
 /*******************************************************************************
-* Function Name: usb_send_out_for_1_channel_worth_1ms
+* Function Name: usb_send_out_apply_sample_rate
 ********************************************************************************
 * Summary:
-*   Create 1 channel data worth 1 ms from buffers.
+*   Set up the resampler from the pipeline rate to the host rate and limit
+*   the packed samples to what fits in one packet at that rate. Rates the
+*   resampler does not support are sent at the pipeline rate.
 *
 *******************************************************************************/
 
-static void usb_send_out_for_1_channel_worth_1ms(short *data_to_send)
+static void usb_send_out_apply_sample_rate(uint32_t sample_rate)
 {
-    static int usb_send_counter = 0;
-    if ((usb_send_counter % 10) == 0)
+    if (CY_RSLT_SUCCESS != audio_resampler_init(&usb_pack_resampler, AUDIO_PIPELINE_SAMPLE_RATE_HZ,
+            sample_rate, USB_OUT_NUM_CHANNELS))
     {
-        usb_send_counter=0;
-
-        usb_send_out_dbg_get(1, bufferch1);
-        ch1 = (short *)bufferch1;
-#ifdef AE_TUNING_MODE
-        usb_send_out_dbg_get(2, bufferch2);
-        ch2 = (short *)bufferch2;
-
-        usb_send_out_dbg_get(3, bufferch3);
-        ch3 = (short *)bufferch3;
-
-        usb_send_out_dbg_get(4, bufferch4);
-        ch4 = (short *)bufferch4;
-#endif /* AE_TUNING_MODE */
+        app_log_print("USB mic rate %lu Hz not supported \r\n", (unsigned long)sample_rate);
+        (void)audio_resampler_init(&usb_pack_resampler, AUDIO_PIPELINE_SAMPLE_RATE_HZ,
+                AUDIO_PIPELINE_SAMPLE_RATE_HZ, USB_OUT_NUM_CHANNELS);
     }
 
-    usb_send_counter++;
-
-    for (int i = 0; i < 16; i++)
+    usb_pack_max_samples = (USB_PACK_MAX_SAMPLES * usb_pack_resampler.down) / usb_pack_resampler.up;
+    if (usb_pack_max_samples > USB_PACK_MAX_PIPELINE_SAMPLES)
     {
-        *data_to_send++ = *ch1++;
-#ifdef AE_TUNING_MODE
-        *data_to_send++ = *ch2++;
-        *data_to_send++ = *ch3++;
-        *data_to_send++ = *ch4++;
-#endif /* AE_TUNING_MODE */
+        usb_pack_max_samples = USB_PACK_MAX_PIPELINE_SAMPLES;
     }
+    usb_pack_rate_acc = 0;
 }
 
 /*******************************************************************************
@@ -314,223 +324,235 @@ static void usb_send_out_for_1_channel_worth_1ms(short *data_to_send)
 
 void usb_send_out_dbg_callback(uint8_t **data, uint16_t *length)
 {
+    uint32_t samples = 0;
+
+    if (usb_pack_rate_pending)
+    {
+        usb_pack_rate_pending = false;
+        usb_send_out_apply_sample_rate(usb_pack_host_rate);
+    }
+
+    samples = usb_send_out_packet_samples();
+    usb_send_out_pack(usb_pack_buffer, samples);
+    samples = audio_resampler_process(&usb_pack_resampler, (const int16_t *)usb_pack_buffer,
+            samples, (int16_t *)audio_usb_out_buffer);
 
-    usb_send_out_for_1_channel_worth_1ms((short *)audio_usb_out_buffer);
     *data = (uint8_t*)audio_usb_out_buffer;
-#ifdef AE_TUNING_MODE
-    *length = 128;
-#else
-    *length = 32;
-#endif /* AE_TUNING_MODE */
+    *length = (uint16_t)(samples * USB_OUT_NUM_CHANNELS * sizeof(int16_t));
+
+}
+
+/*******************************************************************************
+* Function Name: usb_send_out_dbg_set_sample_rate
+********************************************************************************
+* Summary:
+*   Set the sample rate of the active microphone alternate setting. The
+*   packets are resampled to this rate from the next packet on.
+*
+*******************************************************************************/
 
+void usb_send_out_dbg_set_sample_rate(uint32_t sample_rate)
+{
+    usb_pack_host_rate = sample_rate;
+    usb_pack_rate_pending = true;
 }
 
 /*******************************************************************************
 * Function Name: usb_send_out_dbg_put
 ********************************************************************************
 * Summary:
-*   Store audio data in RTOS queues.
+*   Store audio data in the channel frame rings.
 *
 *******************************************************************************/
 
 cy_rslt_t usb_send_out_dbg_put(unsigned int channel_no, short *mono_data_10ms)
 {
-    cy_rslt_t ret_val  = CY_RSLT_SUCCESS;
-    size_t num_waiting = 0;
+    cy_rslt_t result = CY_RSLT_SUCCESS;
     int index = 0;
 
     if(false == is_audio_usb_send_out_data_from_device_started())
     {
-        num_waiting = uxQueueMessagesWaiting(usb_ch1_queue);
-        for (index=0; index < num_waiting; index++)
-        {
-            usb_send_out_dbg_get(1, bufferch1);
-        }
-#ifdef AE_TUNING_MODE
-        num_waiting = uxQueueMessagesWaiting(usb_ch2_queue);
-        for (index=0; index < num_waiting; index++)
-        {
-            usb_send_out_dbg_get(2, bufferch2);
-        }
-        num_waiting = uxQueueMessagesWaiting(usb_ch3_queue);
-        for (index=0; index < num_waiting; index++)
-        {
-            usb_send_out_dbg_get(3, bufferch3);
-        }
-        num_waiting = uxQueueMessagesWaiting(usb_ch4_queue);
-        for (index=0; index < num_waiting; index++)
+        for (index = 0; index < USB_OUT_NUM_CHANNELS; index++)
         {
-            usb_send_out_dbg_get(4, bufferch4);
+            audio_frame_ring_flush(&usb_send_channels[index].ring);
         }
-#endif /* AE_TUNING_MODE */
-        return ret_val;
+        LATENCY_TRACE_FLUSH();
+        return CY_RSLT_SUCCESS;
     }
 
-    if(1 == channel_no)
-    {
-        ret_val = usb_queue_push(usb_ch1_queue, mono_data_10ms,is_in_isr());
-    }
-#ifdef AE_TUNING_MODE
-    if(2 == channel_no)
+    if ((channel_no < USB_CHANNEL_1) || (channel_no > USB_OUT_NUM_CHANNELS))
     {
-        ret_val = usb_queue_push(usb_ch2_queue, mono_data_10ms,is_in_isr());
+        return USB_QUEUE_FAILURE;
     }
-    if(3 == channel_no)
-    {
-        ret_val = usb_queue_push(usb_ch3_queue, mono_data_10ms,is_in_isr());
-    }
-    if(4 == channel_no)
+
+    CY_PROFILER_PROBE_BEGIN(CY_PROFILER_PROBE_USB_PUSH);
+    result = audio_frame_ring_write(&usb_send_channels[channel_no - 1].ring, mono_data_10ms);
+    CY_PROFILER_PROBE_END(CY_PROFILER_PROBE_USB_PUSH);
+    if ((USB_CHANNEL_1 == channel_no) && (CY_RSLT_SUCCESS == result))
     {
-        ret_val = usb_queue_push(usb_ch4_queue, mono_data_10ms,is_in_isr());
+        LATENCY_TRACE_QUEUED();
     }
-#endif /* AE_TUNING_MODE */
-    return ret_val;
+
+    return result;
 }
 
 /*******************************************************************************
 * Function Name: usb_aec_push
 ********************************************************************************
 * Summary:
-*   Push data to USB aec queue.
+*   Append the left channel of a played out frame to the AEC reference
+*   jitter buffer.
 *
 *******************************************************************************/
 cy_rslt_t usb_aec_push(short* item_ptr)
 {
-    cy_rslt_t ret_val  = CY_RSLT_SUCCESS;
-    ret_val = usb_queue_push(usb_aec_ref_queue, item_ptr, is_in_isr());
-
-    return ret_val;
+    aec_jb_write(item_ptr, AUDIO_PIPELINE_SAMPLES_PER_FRAME, AUDIO_PIPELINE_PLAYBACK_CHANNELS, 0u);
 
+    return CY_RSLT_SUCCESS;
 }
 
 /*******************************************************************************
-* Function Name: usb_aec_pop
+* Function Name: usb_aec_flush
 ********************************************************************************
 * Summary:
-*   Pop data from USB aec queue.
+*   Reset the AEC reference jitter buffer.
 *
 *******************************************************************************/
-
-cy_rslt_t usb_aec_pop(short* item_ptr, int bulk_delay)
+void usb_aec_flush()
 {
-    cy_rslt_t ret_val  = CY_RSLT_SUCCESS;
-    int queue_frames = 0;
-    queue_frames=uxQueueMessagesWaiting(usb_aec_ref_queue);
-    if (queue_frames >= bulk_delay)
-    {
-        ret_val = usb_queue_pop(usb_aec_ref_queue, item_ptr, is_in_isr());
-    }
-    else
-    {
-        ret_val=USB_QUEUE_FAILURE;
-    }
-    return ret_val;
+    aec_jb_flush();
 }
 
 /*******************************************************************************
-* Function Name: usb_aec_flush
+* Function Name: usb_mic_push
 ********************************************************************************
 * Summary:
-*   Reset USB aec queue.
+*   Push data to USB mic ring.
 *
 *******************************************************************************/
-void usb_aec_flush()
+cy_rslt_t usb_mic_push(short* item_ptr)
 {
-    xQueueReset(usb_aec_ref_queue);
+   return audio_frame_ring_write(&usb_mic_ring, item_ptr);
 }
 
 /*******************************************************************************
-* Function Name: usb_mic_push
+* Function Name: usb_mic_peek
 ********************************************************************************
 * Summary:
-*   Push data to USB mic queue.
+*   Get the oldest USB mic frame in place. The frame must be returned with
+*   usb_mic_release. Called when playback needs the next frame, an empty
+*   ring is counted as an underrun.
 *
 *******************************************************************************/
-cy_rslt_t usb_mic_push(short* item_ptr)
+short* usb_mic_peek(void)
 {
-   cy_rslt_t ret_val  = CY_RSLT_SUCCESS;
-   ret_val = usb_queue_push(usb_mic_queue, item_ptr, is_in_isr());
-   return ret_val;
+   short *frame = (short *)audio_frame_ring_peek(&usb_mic_ring);
 
+   if (NULL == frame)
+   {
+       audio_frame_ring_count_underrun(&usb_mic_ring);
+   }
+   return frame;
+}
+
+/*******************************************************************************
+* Function Name: usb_mic_release
+********************************************************************************
+* Summary:
+*   Release the USB mic frame obtained by usb_mic_peek.
+*
+*******************************************************************************/
+void usb_mic_release(void)
+{
+   audio_frame_ring_release(&usb_mic_ring);
 }
 
 /*******************************************************************************
 * Function Name: usb_mic_pop
 ********************************************************************************
 * Summary:
-*   Pop data from USB mic queue.
+*   Pop data from USB mic ring. Called when playback needs the next frame,
+*   an empty ring is counted as an underrun.
 *
 *******************************************************************************/
 cy_rslt_t usb_mic_pop(short* item_ptr)
 {
-   cy_rslt_t ret_val  = CY_RSLT_SUCCESS;
-   ret_val = usb_queue_pop(usb_mic_queue, item_ptr, is_in_isr());
+   cy_rslt_t result = audio_frame_ring_read(&usb_mic_ring, item_ptr);
 
-   return ret_val;
+   if (CY_RSLT_SUCCESS != result)
+   {
+       audio_frame_ring_count_underrun(&usb_mic_ring);
+   }
+   return result;
 }
 
 /*******************************************************************************
 * Function Name: usb_mic_flush
 ********************************************************************************
 * Summary:
-*   Pop data from USB mic queue.
+*   Reset USB mic ring.
 *
 *******************************************************************************/
 void usb_mic_flush()
 {
-    xQueueReset(usb_mic_queue);
+    audio_frame_ring_flush(&usb_mic_ring);
 }
 
 /*******************************************************************************
-* Function Name: usb_send_out_dbg_init_channels
+* Function Name: usb_queue_print_stats
 ********************************************************************************
 * Summary:
-*   Initialize RTOS queues for USB data.
+*   Print depth, high-water mark, overruns and underruns of the USB rings.
 *
 *******************************************************************************/
-
-void usb_send_out_dbg_init_channels()
+void usb_queue_print_stats(void)
 {
+    audio_frame_ring_stats_t stats;
 
-    usb_ch1_queue = xQueueCreate(USB_QUEUE_ELEMENTS_CH1, MAX_USB_CH1_DATA_Q);
-    if (usb_ch1_queue == NULL)
+    for (int index = 0; index < USB_OUT_NUM_CHANNELS; index++)
     {
-         app_log_print("Init queue for channel 1 failed \r\n");
+        audio_frame_ring_get_stats(&usb_send_channels[index].ring, &stats);
+        app_log_print("USB ch%d ring: depth %lu max %lu overruns %lu underruns %lu \r\n",
+                index + 1, (unsigned long)stats.depth, (unsigned long)stats.max_depth,
+                (unsigned long)stats.overruns, (unsigned long)stats.underruns);
     }
 
-#ifdef AE_TUNING_MODE
-    usb_ch2_queue = xQueueCreate(USB_QUEUE_ELEMENTS_CH2, MAX_USB_CH2_DATA_Q);
-    if (usb_ch2_queue == NULL)
-    {
-         app_log_print("Init queue for channel 2 failed \r\n");
-    }
+    audio_frame_ring_get_stats(&usb_mic_ring, &stats);
+    app_log_print("USB mic ring: depth %lu max %lu overruns %lu underruns %lu drift %.1f ppm \r\n",
+            (unsigned long)stats.depth, (unsigned long)stats.max_depth,
+            (unsigned long)stats.overruns, (unsigned long)stats.underruns,
+            (double)audio_out_get_drift_ppm());
 
-    usb_ch3_queue = xQueueCreate(USB_QUEUE_ELEMENTS_CH3, MAX_USB_CH3_DATA_Q);
-    if (usb_ch3_queue == NULL)
-    {
-         app_log_print("Init queue for channel 3 failed \r\n");
-    }
+    aec_jb_print_stats();
+}
 
-    usb_ch4_queue = xQueueCreate(USB_QUEUE_ELEMENTS_CH4, MAX_USB_CH4_DATA_Q);
-    if (usb_ch4_queue == NULL)
-    {
-         app_log_print("Init queue for channel 4 failed \r\n");
-    }
-#endif /* AE_TUNING_MODE */
+/*******************************************************************************
+* Function Name: usb_send_out_dbg_init_channels
+********************************************************************************
+* Summary:
+*   Initialize frame rings for USB data.
+*
+*******************************************************************************/
 
-    usb_mic_queue = xQueueCreate(USB_MIC_IN_Q_LEN, USB_MIC_IN_Q_SIZE);
-    if (usb_mic_queue == NULL)
+void usb_send_out_dbg_init_channels()
+{
+    for (int index = 0; index < USB_OUT_NUM_CHANNELS; index++)
     {
-         app_log_print("Init queue for mic failed \r\n");
+        usb_send_channels[index].frame = usb_zero_frame;
+        if (CY_RSLT_SUCCESS != usb_ring_create(&usb_send_channels[index].ring,
+                USB_MONO_AUDIO_SIZE_BYTES, usb_send_channels[index].slot_count))
+        {
+            app_log_print("Init ring for channel %d failed \r\n", index + 1);
+        }
     }
 
-
-    usb_aec_ref_queue = xQueueCreate(USB_MIC_IN_Q_LEN, USB_MIC_IN_Q_SIZE);
-    if (usb_aec_ref_queue == NULL)
+    if (CY_RSLT_SUCCESS != usb_ring_create(&usb_mic_ring, USB_MIC_IN_Q_SIZE, USB_MIC_IN_Q_LEN))
     {
-         app_log_print("Init queue for aec failed \r\n");
+         app_log_print("Init ring for mic failed \r\n");
     }
 
+    (void)aec_jb_init();
+
 }
 
 /* [] END OF FILE */
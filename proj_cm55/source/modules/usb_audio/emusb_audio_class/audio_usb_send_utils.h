@@ -48,6 +48,7 @@ extern "C"
 #include "rtos.h"
 #include "cyabs_rtos.h"
 #include "cyabs_rtos_internal.h"
+#include "audio_frame_ring.h"
 /*******************************************************************************
 * Macros
 *******************************************************************************/
@@ -56,6 +57,13 @@ extern "C"
 #define USB_CHANNEL_3                       (3)
 #define USB_CHANNEL_4                       (4)
 
+/* Channels sent to the PC, the tuning build sends the AFE debug outputs */
+#ifdef AE_TUNING_MODE
+#define USB_OUT_NUM_CHANNELS                (4)
+#else
+#define USB_OUT_NUM_CHANNELS                (1)
+#endif /* AE_TUNING_MODE */
+
 #define USB_QUEUE_FAILURE                   (-1)
 
 #define USB_MIC_BUFFER_COUNT                (2)
@@ -66,16 +74,17 @@ extern "C"
 void usb_send_out_dbg_init_channels();
 cy_rslt_t usb_send_out_dbg_put(unsigned int channel_no, short *mono_data_10ms);
 void usb_send_out_dbg_callback(uint8_t** data, uint16_t* length);
+void usb_send_out_dbg_set_sample_rate(uint32_t sample_rate);
 
-cy_rslt_t usb_queue_push(QueueHandle_t queue, void* item_ptr, bool isr);
-cy_rslt_t usb_queue_pop(QueueHandle_t queue, void* item_ptr, bool isr);
+void usb_queue_print_stats(void);
 
 cy_rslt_t usb_aec_push(short* item_ptr);
-cy_rslt_t usb_aec_pop(short* item_ptr,int bulk_delay);
 void usb_aec_flush();
 
 cy_rslt_t usb_mic_push(short* item_ptr);
 cy_rslt_t usb_mic_pop(short* item_ptr);
+short* usb_mic_peek(void);
+void usb_mic_release(void);
 void usb_mic_flush();
 
 #ifdef __cplusplus